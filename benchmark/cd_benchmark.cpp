@@ -0,0 +1,2056 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-16 14:05:12
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-16 14:05:12
+ */
+
+// 碰撞检测基准测试
+//   cd_benchmark [--filter 子串] [--min-time 秒] [--samples 次数] [--output 文件]
+//                [--baseline 文件] [--threshold 百分比] [--list]
+// 结果以JSON输出到标准输出;指定 --baseline 时与基线JSON逐项对比,
+// 任意一项变慢超过 --threshold 时返回码为1
+
+#include "collision_detection.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+    typedef CD_U64 (*CD_BENCH_FUNC)(CD_S32 reps); // 运行 reps 轮,返回执行的操作数
+
+    struct CD_BENCH_ENTRY
+    {
+        const char *name; // 名称, micro/ 为单个原语, macro/ 为完整场景
+        const char *unit; // 一次操作的含义
+        CD_BENCH_FUNC func;
+    };
+
+    struct CD_BENCH_RESULT
+    {
+        std::string name;
+        std::string unit;
+        CD_F64 nsPerOp;
+        CD_U64 opsPerSample;
+        CD_F64 baseline; // 基线 ns/op, <0 表示没有基线
+    };
+
+    volatile CD_F32 g_sink_f = 0.0f; // 防止结果被优化掉
+    volatile CD_U32 g_sink_i = 0;    // 无符号累加,溢出时回绕而不是未定义行为
+
+    // 固定种子的随机数,保证每次运行的数据一致
+    CD_U32 g_rand_state = 0x12345678u;
+    CD_F32 rand_f(CD_F32 lo, CD_F32 hi)
+    {
+        g_rand_state ^= g_rand_state << 13;
+        g_rand_state ^= g_rand_state >> 17;
+        g_rand_state ^= g_rand_state << 5;
+        return lo + (hi - lo) * (CD_F32)(g_rand_state & 0xFFFFFF) / (CD_F32)0xFFFFFF;
+    }
+
+    const CD_S32 MICRO_N = 4096;       // 原语测试的输入数量,保证数据在缓存中
+    const CD_S32 TOI_SAMPLES = 32;     // 稠密时间采样的采样数
+    const CD_S32 OBSTACLE_N = 10000;   // 场景中障碍物的数量
+    const CD_S32 CLOUD_N = 100000;     // 点云的点数
+    const CD_S32 FOOTPRINT_N = 64;     // 沿轨迹的足迹数
+    const CD_S32 SAP_N = 1024;         // 扫描剪枝的代理数
+    const CD_S32 TRAJECTORY_N = 32;    // 候选轨迹数
+    const CD_S32 TRAJECTORY_POSES = 100; // 每条轨迹的位姿数
+    const CD_F32 WORLD_SIZE = 200.0f;  // 场景边长
+    const CD_F32 GRID_RESOLUTION = 0.2f; // 栅格地图分辨率, 200m 场景为 1000x1000 栅格
+    const CD_S32 GRID_UPDATE_N = 16;   // 每次增量更新变化的栅格数
+    const CD_S32 CLUSTER_N = 256;      // 构建多边形的点簇数
+    const CD_S32 CLUSTER_POINTS = 64;  // 每簇的点数
+    const CD_S32 LIDAR_BEAMS = 2048;   // 一帧激光雷达的射线数
+    const CD_F32 LIDAR_RANGE = 50.0f;  // 射程
+    const CD_S32 ROUND_HULL_VERTICES = 24; // 感知凸包的顶点数,超过 MAX_POLYGON_VERTICES
+
+    struct CD_BENCH_DATA
+    {
+        std::vector<CD_VEC2> pointsA;
+        std::vector<CD_VEC2> pointsB;
+        std::vector<CD_ROT> rots;
+        std::vector<CD_TRANSFORM> transforms;
+        std::vector<CD_AABB> aabbsA;
+        std::vector<CD_AABB> aabbsB;
+        std::vector<CD_OBB> obbsA;
+        std::vector<CD_OBB> obbsB;
+        std::vector<CD_OBB_D> mapObbsA; // obbsA/obbsB 平移到公里级坐标的双精度版本
+        std::vector<CD_OBB_D> mapObbsB;
+        std::vector<CD_CIRCLE> circles;
+        std::vector<CD_SEGMENT> segsA;
+        std::vector<CD_SEGMENT> segsB;
+        std::vector<CD_CAPSULE> capsulesA; // segsA/segsB 外扩随机半径
+        std::vector<CD_CAPSULE> capsulesB;
+        std::vector<CD_FX_OBB> fxObbsA; // obbsA/obbsB/pointsB/segsA/segsB 的整数毫米版本
+        std::vector<CD_FX_OBB> fxObbsB;
+        std::vector<CD_FX_VEC2> fxPointsB;
+        std::vector<CD_FX_SEGMENT> fxSegsA;
+        std::vector<CD_FX_SEGMENT> fxSegsB;
+        std::vector<CD_POLYGON> polygons;
+        std::vector<CD_SHAPE> shapes; // 圆/aabb/obb/多边形/线段/胶囊体轮流出现的混合场景,多边形引用 polygons
+        std::vector<CD_DISTANCE_INPUT> distanceInputs;
+        std::vector<CD_DISTANCE_CACHE> distanceCaches;
+        std::vector<CD_TOI_INPUT> toiInputs;
+        std::vector<CD_VEC2> polyline;
+        std::vector<CD_VEC2> clusterPoints; // 每簇 CLUSTER_POINTS 个点,凸包为八边形
+        std::vector<CD_VEC2> hullScratch;
+        std::vector<CD_VEC2> roundClusterPoints; // 每簇 CLUSTER_POINTS 个点,凸包为 ROUND_HULL_VERTICES 边形
+        std::vector<CD_VEC2> arenaVertices;
+        std::vector<CD_VEC2> arenaNormals;
+        CD_VERTEX_ARENA vertexArena;
+        std::vector<CD_ARENA_POLYGON> arenaPolygons;
+        std::vector<CD_F32> microXs;
+        std::vector<CD_F32> microYs;
+
+        // 场景
+        std::vector<CD_OBB> obstacles;
+        std::vector<CD_AABB> obstacleAabbs;
+        std::vector<CD_F32> soaLowerX, soaLowerY, soaUpperX, soaUpperY;
+        CD_AABB_SOA obstacleSoa;
+        std::vector<CD_OBB> footprints;
+        std::vector<CD_TREE_NODE> treeNodes;
+        CD_DYNAMIC_TREE tree;
+        std::vector<CD_S32> hashBuckets;
+        std::vector<CD_HASH_ENTRY> hashEntries;
+        std::vector<CD_U32> hashStamps;
+        CD_SPATIAL_HASH hash;
+        std::vector<CD_S32> candidates;
+
+        std::vector<CD_F32> cloudXs;
+        std::vector<CD_F32> cloudYs;
+        std::vector<CD_U32> cloudMask;
+        CD_OBB cloudObb;
+        CD_POLYGON cloudPolygon;
+
+        std::vector<CD_F32> trajectoryXs;
+        std::vector<CD_F32> trajectoryYs;
+        std::vector<CD_F32> trajectoryHeadings;
+        std::vector<CD_TRANSFORM> trajectoryPoses;
+        std::vector<CD_OBB> trajectoryObstacles;
+        std::vector<CD_S32> trajectoryResults;
+        std::vector<CD_RAY_INPUT> rays;
+        std::vector<CD_F32> lidarDxs, lidarDys;
+        std::vector<CD_RAY_OUTPUT> rayOutputs;
+        std::vector<CD_S32> footprintResults;
+        CD_WORKER_POOL pool;
+        std::vector<CD_F32> trajectoryCloudXs; // 以障碍物中心作为点云
+        std::vector<CD_F32> trajectoryCloudYs;
+        CD_OBB vehicle;
+        CD_CIRCLE_COVER vehicleCover;
+
+        std::vector<CD_U08> gridCells;
+        std::vector<CD_F32> gridDistance;
+        std::vector<CD_F32> gridScratch;
+        std::vector<CD_S32> gridIndices;
+        CD_GRID_MAP grid;
+
+        std::vector<CD_SAP_PROXY> sapProxies;
+        std::vector<CD_SAP_ENDPOINT> sapEndX;
+        std::vector<CD_SAP_ENDPOINT> sapEndY;
+        std::vector<CD_SAP_PAIR> sapPairs;
+        std::vector<CD_VEC2> sapCenters;
+        std::vector<CD_VEC2> sapVelocities;
+        CD_SWEEP_PRUNE sap;
+    };
+
+    CD_BENCH_DATA g_data;
+
+    CD_OBB random_obb(CD_F32 lo, CD_F32 hi, CD_F32 min_size, CD_F32 max_size)
+    {
+        return cd_create_obb_v(cd_vec2_make_v(rand_f(lo, hi), rand_f(lo, hi)),
+                               rand_f(min_size, max_size), rand_f(min_size, max_size), rand_f(-CD_PI, CD_PI));
+    }
+
+    CD_POLYGON random_polygon(CD_F32 lo, CD_F32 hi)
+    {
+        CD_POLYGON polygon;
+        memset(&polygon, 0, sizeof(polygon));
+        const CD_VEC2 center = cd_vec2_make_v(rand_f(lo, hi), rand_f(lo, hi));
+        const CD_F32 radius = rand_f(0.5f, 2.0f);
+        const CD_F32 phase = rand_f(0.0f, CD_2PI);
+        CD_VEC2 points[MAX_POLYGON_VERTICES];
+        CD_VEC2 scratch[CD_HULL_SCRATCH_SIZE(MAX_POLYGON_VERTICES)];
+        for (CD_S32 i = 0; i < MAX_POLYGON_VERTICES; ++i)
+        {
+            const CD_F32 angle = phase + CD_2PI * (CD_F32)i / (CD_F32)MAX_POLYGON_VERTICES;
+            points[i] = cd_vec2_mul_add_v(center, radius, cd_create_unit_vec2_v(angle));
+        }
+        cd_make_polygon(points, MAX_POLYGON_VERTICES, 0.0f, scratch, &polygon);
+        return polygon;
+    }
+
+    CD_BOOL tree_query_callback(CD_S32 proxyId, CD_S32 userData, CD_VOID *context)
+    {
+        (void)proxyId;
+        const CD_OBB *footprint = (const CD_OBB *)context;
+        g_sink_i += cd_obb_overlap_v(*footprint, g_data.obstacles[userData]);
+        return CD_TRUE;
+    }
+
+    CD_VOID setup()
+    {
+        CD_BENCH_DATA &d = g_data;
+        d.pointsA.resize(MICRO_N);
+        d.pointsB.resize(MICRO_N);
+        d.rots.resize(MICRO_N);
+        d.transforms.resize(MICRO_N);
+        d.aabbsA.resize(MICRO_N);
+        d.aabbsB.resize(MICRO_N);
+        d.obbsA.resize(MICRO_N);
+        d.obbsB.resize(MICRO_N);
+        d.mapObbsA.resize(MICRO_N);
+        d.mapObbsB.resize(MICRO_N);
+        d.shapes.resize(MICRO_N);
+        d.fxObbsA.resize(MICRO_N);
+        d.fxObbsB.resize(MICRO_N);
+        d.fxPointsB.resize(MICRO_N);
+        d.fxSegsA.resize(MICRO_N);
+        d.fxSegsB.resize(MICRO_N);
+        d.circles.resize(MICRO_N);
+        d.segsA.resize(MICRO_N);
+        d.segsB.resize(MICRO_N);
+        d.capsulesA.resize(MICRO_N);
+        d.capsulesB.resize(MICRO_N);
+        d.polygons.resize(MICRO_N);
+        d.distanceInputs.resize(MICRO_N);
+        d.distanceCaches.resize(MICRO_N);
+        d.toiInputs.resize(MICRO_N);
+        d.microXs.resize(MICRO_N);
+        d.microYs.resize(MICRO_N);
+        for (CD_S32 i = 0; i < MICRO_N; ++i)
+        {
+            d.pointsA[i] = cd_vec2_make_v(rand_f(-10.0f, 10.0f), rand_f(-10.0f, 10.0f));
+            d.pointsB[i] = cd_vec2_make_v(rand_f(-10.0f, 10.0f), rand_f(-10.0f, 10.0f));
+            d.microXs[i] = d.pointsA[i].x;
+            d.microYs[i] = d.pointsA[i].y;
+            d.rots[i] = cd_rot_from_angle_v(rand_f(-CD_PI, CD_PI));
+            d.transforms[i].p = d.pointsB[i];
+            d.transforms[i].q = d.rots[i];
+            d.aabbsA[i] = cd_create_aabb_v(d.pointsA[i], rand_f(0.5f, 4.0f), rand_f(0.5f, 4.0f));
+            d.aabbsB[i] = cd_create_aabb_v(d.pointsB[i], rand_f(0.5f, 4.0f), rand_f(0.5f, 4.0f));
+            d.obbsA[i] = random_obb(-10.0f, 10.0f, 0.5f, 6.0f);
+            d.obbsB[i] = random_obb(-10.0f, 10.0f, 0.5f, 6.0f);
+            d.mapObbsA[i] = cd_obb_to_d_v(d.obbsA[i]);
+            d.mapObbsB[i] = cd_obb_to_d_v(d.obbsB[i]);
+            d.mapObbsA[i].center = cd_vec2_add_d_v(d.mapObbsA[i].center, cd_vec2_make_d_v(3500000.0, 4500000.0));
+            d.mapObbsB[i].center = cd_vec2_add_d_v(d.mapObbsB[i].center, cd_vec2_make_d_v(3500000.0, 4500000.0));
+            d.circles[i].center = d.pointsB[i];
+            d.circles[i].radius = rand_f(0.5f, 5.0f);
+            d.segsA[i].point1 = d.pointsA[i];
+            d.segsA[i].point2 = cd_vec2_make_v(rand_f(-10.0f, 10.0f), rand_f(-10.0f, 10.0f));
+            d.segsB[i].point1 = d.pointsB[i];
+            d.segsB[i].point2 = cd_vec2_make_v(rand_f(-10.0f, 10.0f), rand_f(-10.0f, 10.0f));
+            d.capsulesA[i] = cd_create_capsule_v(d.segsA[i].point1, d.segsA[i].point2, rand_f(0.1f, 2.0f));
+            d.capsulesB[i] = cd_create_capsule_v(d.segsB[i].point1, d.segsB[i].point2, rand_f(0.1f, 2.0f));
+            d.fxObbsA[i] = cd_fx_create_obb_v(cd_fx_vec2_from_vec2_v(d.obbsA[i].center), CD_M2MM(d.obbsA[i].length),
+                                              CD_M2MM(d.obbsA[i].width), CD_RAD2MRAD(cd_obb_heading_v(d.obbsA[i])));
+            d.fxObbsB[i] = cd_fx_create_obb_v(cd_fx_vec2_from_vec2_v(d.obbsB[i].center), CD_M2MM(d.obbsB[i].length),
+                                              CD_M2MM(d.obbsB[i].width), CD_RAD2MRAD(cd_obb_heading_v(d.obbsB[i])));
+            d.fxPointsB[i] = cd_fx_vec2_from_vec2_v(d.pointsB[i]);
+            d.fxSegsA[i].point1 = cd_fx_vec2_from_vec2_v(d.segsA[i].point1);
+            d.fxSegsA[i].point2 = cd_fx_vec2_from_vec2_v(d.segsA[i].point2);
+            d.fxSegsB[i].point1 = cd_fx_vec2_from_vec2_v(d.segsB[i].point1);
+            d.fxSegsB[i].point2 = cd_fx_vec2_from_vec2_v(d.segsB[i].point2);
+            d.polygons[i] = random_polygon(-10.0f, 10.0f);
+            switch (i % CD_SHAPE_TYPE_COUNT)
+            {
+            case CD_SHAPE_CIRCLE:
+                d.shapes[i] = cd_make_circle_shape_v(d.circles[i]);
+                break;
+            case CD_SHAPE_AABB:
+                d.shapes[i] = cd_make_aabb_shape_v(d.aabbsB[i]);
+                break;
+            case CD_SHAPE_OBB:
+                d.shapes[i] = cd_make_obb_shape_v(d.obbsA[i]);
+                break;
+            case CD_SHAPE_POLYGON:
+                d.shapes[i] = cd_make_polygon_shape_v(&d.polygons[i]);
+                break;
+            case CD_SHAPE_SEGMENT:
+                d.shapes[i] = cd_make_segment_shape_v(d.segsA[i]);
+                break;
+            default:
+                d.shapes[i] = cd_make_capsule_shape_v(d.capsulesA[i]);
+                break;
+            }
+
+            CD_POLYGON other = random_polygon(-10.0f, 10.0f);
+            CD_DISTANCE_INPUT &input = d.distanceInputs[i];
+            memset(&input, 0, sizeof(input));
+            cd_make_proxy(d.polygons[i].vertices, (CD_S16)d.polygons[i].count, 0.0f, &input.proxyA);
+            cd_make_proxy(other.vertices, (CD_S16)other.count, 0.0f, &input.proxyB);
+            input.transformA = TRANSFORM_IDENTITY;
+            input.transformB = TRANSFORM_IDENTITY;
+            input.useRadii = CD_FALSE;
+            d.distanceCaches[i] = emptyDistanceCache;
+
+            // 一个时间步内相向运动的两个多边形,中心相对原点对称
+            CD_TOI_INPUT &toi = d.toiInputs[i];
+            memset(&toi, 0, sizeof(toi));
+            cd_make_proxy(d.polygons[i].vertices, (CD_S16)d.polygons[i].count, 0.0f, &toi.proxyA);
+            cd_make_proxy(other.vertices, (CD_S16)other.count, 0.0f, &toi.proxyB);
+            toi.sweepA.transform = TRANSFORM_IDENTITY;
+            toi.sweepA.localCenter = d.polygons[i].centroid;
+            toi.sweepA.velocity = cd_vec2_scale_v(d.polygons[i].centroid, -1.0f);
+            toi.sweepA.angularVelocity = rand_f(-2.0f, 2.0f);
+            toi.sweepB.transform = TRANSFORM_IDENTITY;
+            toi.sweepB.localCenter = other.centroid;
+            toi.sweepB.velocity = cd_vec2_scale_v(other.centroid, -1.0f);
+            toi.sweepB.angularVelocity = rand_f(-2.0f, 2.0f);
+            toi.tMax = 1.0f;
+            toi.tolerance = 1e-3f;
+        }
+        // 雷达点簇: 八边形的顶点加上内部的随机点,打乱顺序
+        d.clusterPoints.resize(CLUSTER_N * CLUSTER_POINTS);
+        d.hullScratch.resize(CD_HULL_SCRATCH_SIZE(CLUSTER_POINTS));
+        for (CD_S32 c = 0; c < CLUSTER_N; ++c)
+        {
+            CD_VEC2 *points = d.clusterPoints.data() + c * CLUSTER_POINTS;
+            const CD_VEC2 center = cd_vec2_make_v(rand_f(-10.0f, 10.0f), rand_f(-10.0f, 10.0f));
+            const CD_F32 radius = rand_f(0.5f, 2.0f);
+            for (CD_S32 i = 0; i < CLUSTER_POINTS; ++i)
+            {
+                const CD_F32 angle = CD_2PI * (CD_F32)(i % 8) / 8.0f;
+                const CD_F32 r = i < 8 ? radius : radius * rand_f(0.0f, 0.9f);
+                points[i] = cd_vec2_mul_add_v(center, r, cd_create_unit_vec2_v(i < 8 ? angle : rand_f(0.0f, CD_2PI)));
+            }
+            for (CD_S32 i = CLUSTER_POINTS - 1; i > 0; --i)
+            {
+                std::swap(points[i], points[(CD_S32)rand_f(0.0f, (CD_F32)i)]);
+            }
+        }
+        // 感知点簇: 与上面相同,但凸包为 ROUND_HULL_VERTICES 边形,预先放入顶点池
+        d.roundClusterPoints.resize(CLUSTER_N * CLUSTER_POINTS);
+        d.arenaVertices.resize(CLUSTER_N * CLUSTER_POINTS);
+        d.arenaNormals.resize(CLUSTER_N * CLUSTER_POINTS);
+        d.arenaPolygons.resize(CLUSTER_N);
+        cd_vertex_arena_init(d.arenaVertices.data(), d.arenaNormals.data(), CLUSTER_N * CLUSTER_POINTS, &d.vertexArena);
+        for (CD_S32 c = 0; c < CLUSTER_N; ++c)
+        {
+            CD_VEC2 *points = d.roundClusterPoints.data() + c * CLUSTER_POINTS;
+            const CD_VEC2 center = cd_vec2_make_v(rand_f(-5.0f, 5.0f), rand_f(-5.0f, 5.0f));
+            const CD_F32 radius = rand_f(0.5f, 2.0f);
+            for (CD_S32 i = 0; i < CLUSTER_POINTS; ++i)
+            {
+                const CD_F32 angle = CD_2PI * (CD_F32)(i % ROUND_HULL_VERTICES) / (CD_F32)ROUND_HULL_VERTICES;
+                const CD_F32 r = i < ROUND_HULL_VERTICES ? radius : radius * rand_f(0.0f, 0.9f);
+                points[i] = cd_vec2_mul_add_v(center, r, cd_create_unit_vec2_v(i < ROUND_HULL_VERTICES ? angle : rand_f(0.0f, CD_2PI)));
+            }
+            for (CD_S32 i = CLUSTER_POINTS - 1; i > 0; --i)
+            {
+                std::swap(points[i], points[(CD_S32)rand_f(0.0f, (CD_F32)i)]);
+            }
+            cd_make_arena_polygon(&d.vertexArena, points, CLUSTER_POINTS, 0.0f, d.hullScratch.data(), &d.arenaPolygons[c]);
+        }
+        d.polyline.resize(256);
+        for (CD_S32 i = 0; i < (CD_S32)d.polyline.size(); ++i)
+        {
+            d.polyline[i] = cd_vec2_make_v(-10.0f + 20.0f * (CD_F32)i / 255.0f, rand_f(-3.0f, 3.0f));
+        }
+
+        // 足迹 vs 障碍物场景
+        d.obstacles.resize(OBSTACLE_N);
+        d.obstacleAabbs.resize(OBSTACLE_N);
+        d.soaLowerX.resize(OBSTACLE_N);
+        d.soaLowerY.resize(OBSTACLE_N);
+        d.soaUpperX.resize(OBSTACLE_N);
+        d.soaUpperY.resize(OBSTACLE_N);
+        d.obstacleSoa.lowerX = d.soaLowerX.data();
+        d.obstacleSoa.lowerY = d.soaLowerY.data();
+        d.obstacleSoa.upperX = d.soaUpperX.data();
+        d.obstacleSoa.upperY = d.soaUpperY.data();
+        d.obstacleSoa.count = OBSTACLE_N;
+        d.treeNodes.resize(2 * OBSTACLE_N);
+        cd_dynamic_tree_init(&d.tree, d.treeNodes.data(), (CD_S32)d.treeNodes.size());
+        d.hashBuckets.resize(16384);
+        d.hashEntries.resize(8 * OBSTACLE_N);
+        d.hashStamps.resize(OBSTACLE_N);
+        cd_spatial_hash_init(&d.hash, 4.0f, d.hashBuckets.data(), (CD_S32)d.hashBuckets.size(),
+                             d.hashEntries.data(), (CD_S32)d.hashEntries.size(), d.hashStamps.data(), OBSTACLE_N);
+        for (CD_S32 i = 0; i < OBSTACLE_N; ++i)
+        {
+            d.obstacles[i] = random_obb(0.0f, WORLD_SIZE, 0.2f, 2.0f);
+            d.obstacleAabbs[i] = cd_obb_to_aabb_v(d.obstacles[i]);
+            cd_aabb_soa_set(&d.obstacleSoa, i, &d.obstacleAabbs[i]);
+            CD_S32 proxy_id;
+            cd_dynamic_tree_create_proxy(&d.tree, &d.obstacleAabbs[i], i, &proxy_id);
+            cd_spatial_hash_insert_obb(&d.hash, &d.obstacles[i], i);
+        }
+        d.candidates.resize(OBSTACLE_N);
+        d.footprints.resize(FOOTPRINT_N);
+        for (CD_S32 i = 0; i < FOOTPRINT_N; ++i)
+        {
+            // 车辆足迹沿一条对角线轨迹
+            const CD_F32 t = (CD_F32)i / (CD_F32)FOOTPRINT_N;
+            d.footprints[i] = cd_create_obb_v(cd_vec2_make_v(20.0f + 160.0f * t, 30.0f + 140.0f * t), 4.8f, 1.9f, CD_PI4);
+        }
+
+        // 候选轨迹场景,从同一起点以不同曲率出发
+        d.trajectoryXs.resize(TRAJECTORY_N * TRAJECTORY_POSES);
+        d.trajectoryYs.resize(TRAJECTORY_N * TRAJECTORY_POSES);
+        d.trajectoryHeadings.resize(TRAJECTORY_N * TRAJECTORY_POSES);
+        d.trajectoryPoses.resize(TRAJECTORY_N * TRAJECTORY_POSES);
+        for (CD_S32 t = 0; t < TRAJECTORY_N; ++t)
+        {
+            const CD_F32 curvature = -0.05f + 0.1f * (CD_F32)t / (CD_F32)(TRAJECTORY_N - 1);
+            CD_F32 x = 100.0f;
+            CD_F32 y = 100.0f;
+            CD_F32 heading = CD_PI4;
+            for (CD_S32 i = 0; i < TRAJECTORY_POSES; ++i)
+            {
+                const CD_S32 k = t * TRAJECTORY_POSES + i;
+                d.trajectoryXs[k] = x;
+                d.trajectoryYs[k] = y;
+                d.trajectoryHeadings[k] = heading;
+                x += 0.3f * cosf(heading);
+                y += 0.3f * sinf(heading);
+                heading += 0.3f * curvature;
+            }
+        }
+        cd_trajectory_poses_from_xyh(d.trajectoryXs.data(), d.trajectoryYs.data(), d.trajectoryHeadings.data(),
+                                     (CD_S32)d.trajectoryPoses.size(), d.trajectoryPoses.data());
+        d.vehicle = cd_create_obb_v(cd_vec2_make_v(1.4f, 0.0f), 4.8f, 1.9f, 0.0f);
+        // 起点附近15m内没有障碍物,轨迹在中途才可能发生碰撞
+        d.trajectoryObstacles.resize(OBSTACLE_N);
+        d.trajectoryResults.resize(TRAJECTORY_N);
+        // 场景中心的激光雷达,射线按角度顺序排列
+        d.rays.resize(LIDAR_BEAMS);
+        d.lidarDxs.resize(LIDAR_BEAMS);
+        d.lidarDys.resize(LIDAR_BEAMS);
+        d.rayOutputs.resize(LIDAR_BEAMS);
+        for (CD_S32 i = 0; i < LIDAR_BEAMS; ++i)
+        {
+            const CD_VEC2 dir = cd_create_unit_vec2_v(CD_2PI * (CD_F32)i / (CD_F32)LIDAR_BEAMS);
+            d.lidarDxs[i] = LIDAR_RANGE * dir.x;
+            d.lidarDys[i] = LIDAR_RANGE * dir.y;
+            d.rays[i].origin = Vec2_Zero;
+            d.rays[i].translation = cd_vec2_make_v(d.lidarDxs[i], d.lidarDys[i]);
+            d.rays[i].maxFraction = 1.0f;
+        }
+        d.footprintResults.resize(FOOTPRINT_N);
+        cd_worker_pool_init(&d.pool, (CD_S32)CD_CLIP(std::thread::hardware_concurrency(), 1u, (unsigned)CD_MAX_WORKERS));
+        for (CD_S32 i = 0; i < OBSTACLE_N; ++i)
+        {
+            CD_OBB obb;
+            do
+            {
+                obb = random_obb(0.0f, WORLD_SIZE, 0.2f, 2.0f);
+            } while (cd_vec2_dis_v(obb.center, cd_vec2_make_v(100.0f, 100.0f)) < 15.0f);
+            d.trajectoryObstacles[i] = obb;
+            d.trajectoryCloudXs.push_back(obb.center.x);
+            d.trajectoryCloudYs.push_back(obb.center.y);
+        }
+        cd_circle_cover_from_obb(&d.vehicle, 0.15f, &d.vehicleCover);
+
+        // 栅格地图场景,轨迹场景的障碍物栅格化到地图上
+        const CD_S32 grid_size = (CD_S32)(WORLD_SIZE / GRID_RESOLUTION);
+        d.gridCells.resize(grid_size * grid_size);
+        d.gridDistance.resize(grid_size * grid_size);
+        d.gridScratch.resize(CD_GRID_SCRATCH_SIZE(grid_size, grid_size));
+        d.gridIndices.resize(CD_GRID_INDEX_SIZE(grid_size, grid_size));
+        const CD_VEC2 grid_origin = {0.0f, 0.0f};
+        cd_grid_map_init(&d.grid, grid_size, grid_size, GRID_RESOLUTION, &grid_origin, 2.0f,
+                         d.gridCells.data(), d.gridDistance.data(), d.gridScratch.data(), d.gridIndices.data());
+        for (CD_S32 i = 0; i < OBSTACLE_N; ++i)
+        {
+            const CD_AABB box = cd_obb_to_aabb_v(d.trajectoryObstacles[i]);
+            for (CD_F32 y = box.lowerBound.y; y <= box.upperBound.y; y += 0.5f * GRID_RESOLUTION)
+            {
+                for (CD_F32 x = box.lowerBound.x; x <= box.upperBound.x; x += 0.5f * GRID_RESOLUTION)
+                {
+                    CD_S32 cell_x;
+                    CD_S32 cell_y;
+                    if (cd_is_point_in_obb_v(d.trajectoryObstacles[i], cd_vec2_make_v(x, y)) &&
+                        cd_grid_map_cell_v(&d.grid, cd_vec2_make_v(x, y), &cell_x, &cell_y))
+                    {
+                        cd_grid_map_set_cell(&d.grid, cell_x, cell_y, CD_TRUE);
+                    }
+                }
+            }
+        }
+        cd_grid_map_update_distance(&d.grid);
+
+        // 点云 vs obb 场景
+        d.cloudXs.resize(CLOUD_N);
+        d.cloudYs.resize(CLOUD_N);
+        d.cloudMask.resize((CLOUD_N + 31) / 32);
+        for (CD_S32 i = 0; i < CLOUD_N; ++i)
+        {
+            d.cloudXs[i] = rand_f(-30.0f, 30.0f);
+            d.cloudYs[i] = rand_f(-30.0f, 30.0f);
+        }
+        d.cloudObb = cd_create_obb_v(cd_vec2_make_v(1.0f, -2.0f), 4.8f, 1.9f, 0.3f);
+        d.cloudPolygon = random_polygon(-5.0f, 5.0f);
+        d.cloudPolygon.radius = 0.2f;
+        cd_polygon_update(&d.cloudPolygon);
+
+        // 扫描剪枝场景
+        d.sapProxies.resize(SAP_N);
+        d.sapEndX.resize(2 * SAP_N);
+        d.sapEndY.resize(2 * SAP_N);
+        d.sapPairs.resize(8 * SAP_N);
+        d.sapCenters.resize(SAP_N);
+        d.sapVelocities.resize(SAP_N);
+        cd_sap_init(&d.sap, d.sapProxies.data(), SAP_N, d.sapEndX.data(), d.sapEndY.data(),
+                    d.sapPairs.data(), (CD_S32)d.sapPairs.size(), CD_NULL, CD_NULL);
+        for (CD_S32 i = 0; i < SAP_N; ++i)
+        {
+            d.sapCenters[i] = cd_vec2_make_v(rand_f(0.0f, 100.0f), rand_f(0.0f, 100.0f));
+            d.sapVelocities[i] = cd_vec2_make_v(rand_f(-0.2f, 0.2f), rand_f(-0.2f, 0.2f));
+            const CD_AABB box = cd_create_aabb_v(d.sapCenters[i], 2.0f, 2.0f);
+            CD_S32 proxy_id;
+            cd_sap_create_proxy(&d.sap, &box, i, &proxy_id);
+        }
+    }
+
+    // ---------------------------------------------------------------- 原语
+
+    CD_U64 bench_vec2_add(CD_S32 reps)
+    {
+        CD_VEC2 acc = Vec2_Zero;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_VEC2 v = Vec2_Zero;
+                cd_vec2_add(&g_data.pointsA[i], &g_data.pointsB[i], &v);
+                cd_vec2_add(&acc, &v, &acc);
+            }
+        }
+        g_sink_f += acc.x + acc.y;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_vec2_add_v(CD_S32 reps)
+    {
+        CD_VEC2 acc = Vec2_Zero;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                acc = cd_vec2_add_v(acc, cd_vec2_add_v(g_data.pointsA[i], g_data.pointsB[i]));
+            }
+        }
+        g_sink_f += acc.x + acc.y;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_rot_vector(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_VEC2 v = Vec2_Zero;
+                cd_rot_vector(&g_data.rots[i], &g_data.pointsA[i], &v);
+                acc += v.x;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_transforms_point(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_VEC2 v = Vec2_Zero;
+                cd_transforms_point(&g_data.transforms[i], &g_data.pointsA[i], &v);
+                acc += v.x;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_aabb_overlap(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_BOOL overlap = CD_FALSE;
+                cd_aabb_overlap(&g_data.aabbsA[i], &g_data.aabbsB[i], &overlap);
+                hits += overlap;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_aabb_overlap_v(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                hits += cd_aabb_overlap_v(g_data.aabbsA[i], g_data.aabbsB[i]);
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_point_in_circle(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_BOOL inside = CD_FALSE;
+                cd_point_in_circle(&g_data.pointsA[i], &g_data.circles[i], &inside);
+                hits += inside;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_is_point_in_obb(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_BOOL inside = CD_FALSE;
+                cd_is_point_in_obb(&g_data.obbsA[i], &g_data.pointsB[i], &inside);
+                hits += inside;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_points_in_obb_batch(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            CD_S32 count = 0;
+            cd_points_in_obb_batch(g_data.microXs.data(), g_data.microYs.data(), MICRO_N, &g_data.obbsA[r & (MICRO_N - 1)],
+                                   CD_NULL, &count);
+            hits += count;
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_obb_to_aabb(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_AABB box = {{0.0f, 0.0f}, {0.0f, 0.0f}};
+                cd_obb_to_aabb(&g_data.obbsA[i], &box);
+                acc += box.upperBound.x;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_obb_overlap(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_BOOL overlap = CD_FALSE;
+                cd_obb_overlap(&g_data.obbsA[i], &g_data.obbsB[i], &overlap);
+                hits += overlap;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_obb_overlap_f64_map(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                hits += cd_obb_overlap_d_v(g_data.mapObbsA[i], g_data.mapObbsB[i]);
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_ray_cast_obb(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        CD_RAY_INPUT ray;
+        ray.maxFraction = 1.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                ray.origin = g_data.pointsA[i];
+                ray.translation = cd_vec2_sub_v(g_data.obbsA[i].center, g_data.pointsA[i]);
+                acc += cd_ray_cast_obb_v(&ray, g_data.obbsA[i]).fraction;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_ray_cast_polygon(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        CD_RAY_INPUT ray;
+        ray.maxFraction = 1.0f;
+        const CD_S32 n = (CD_S32)g_data.polygons.size();
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < n; ++i)
+            {
+                ray.origin = g_data.pointsA[i];
+                ray.translation = cd_vec2_sub_v(g_data.polygons[i].centroid, g_data.pointsA[i]);
+                acc += cd_ray_cast_polygon_v(&ray, &g_data.polygons[i]).fraction;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * n;
+    }
+
+    CD_U64 bench_obb_overlap_mtv(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_BOOL overlap = CD_FALSE;
+                CD_VEC2 normal = Vec2_Zero;
+                CD_F32 depth = 0.0f;
+                cd_obb_overlap_mtv(&g_data.obbsA[i], &g_data.obbsB[i], &overlap, &normal, &depth);
+                acc += depth;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_segments_intersect(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_BOOL hit = CD_FALSE;
+                CD_VEC2 point = Vec2_Zero;
+                cd_segments_intersect(&g_data.segsA[i], &g_data.segsB[i], &point, &hit);
+                hits += hit;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_segment_dis_to_point(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_F32 distance = 0.0f;
+                cd_segment_dis_to_point(&g_data.segsA[i], &g_data.pointsB[i], CD_NULL, &distance);
+                acc += distance;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_fx_point_in_obb(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_BOOL inside = CD_FALSE;
+                cd_fx_is_point_in_obb(&g_data.fxObbsA[i], &g_data.fxPointsB[i], &inside);
+                hits += inside;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_fx_obb_overlap(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_BOOL overlap = CD_FALSE;
+                cd_fx_obb_overlap(&g_data.fxObbsA[i], &g_data.fxObbsB[i], &overlap);
+                hits += overlap;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_fx_segments_intersect(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_BOOL hit = CD_FALSE;
+                CD_FX_VEC2 point = cd_fx_vec2_make_v(0, 0);
+                cd_fx_segments_intersect(&g_data.fxSegsA[i], &g_data.fxSegsB[i], &point, &hit);
+                hits += hit;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_fx_segment_dis_to_point(CD_S32 reps)
+    {
+        CD_U64 acc = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_S32 distance = 0;
+                cd_fx_segment_dis_to_point(&g_data.fxSegsA[i], &g_data.fxPointsB[i], CD_NULL, &distance);
+                acc += (CD_U64)distance;
+            }
+        }
+        g_sink_i += (CD_U32)acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_fx_segment_dis_sqr_to_point(CD_S32 reps)
+    {
+        CD_U64 acc = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                acc += (CD_U64)cd_fx_segment_dis_sqr_to_point_v(g_data.fxSegsA[i], g_data.fxPointsB[i]);
+            }
+        }
+        g_sink_i += (CD_U32)acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    // 混合场景中与第i个形状配对的形状,i / 64 的偏移使所有类型组合都大致均匀出现
+    CD_S32 shape_partner(CD_S32 i)
+    {
+        return (i * 7 + 3 + i / 64) & (MICRO_N - 1);
+    }
+
+    CD_U64 bench_shapes_overlap_dispatch(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                hits += cd_shapes_overlap_v(&g_data.shapes[i], &g_data.shapes[shape_partner(i)]);
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_shapes_distance_dispatch(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_DISTANCE_OUTPUT output;
+                cd_shapes_distance_v(&g_data.shapes[i], &g_data.shapes[shape_partner(i)], &output);
+                acc += output.distance;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_shapes_distance_gjk(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_DISTANCE_OUTPUT output;
+                cd_shape_distance_gjk_v(&g_data.shapes[i], &g_data.shapes[shape_partner(i)], &output);
+                acc += output.distance;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_shapes_manifold_dispatch(CD_S32 reps)
+    {
+        CD_S32 points = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                points += cd_shapes_manifold_v(&g_data.shapes[i], &g_data.shapes[shape_partner(i)]).pointCount;
+            }
+        }
+        g_sink_i += points;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_shape_overlap_circle_obb_template(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                hits += cd::shape_overlap(g_data.circles[i], g_data.obbsA[i]);
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_capsules_overlap(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                hits += cd_capsules_overlap_v(g_data.capsulesA[i], g_data.capsulesB[i]);
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_capsule_obb_overlap(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                hits += cd_capsule_obb_overlap_v(g_data.capsulesA[i], g_data.obbsB[i]);
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_capsule_polygon_overlap(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                const CD_POLYGON_VIEW view = cd_polygon_view_v(&g_data.polygons[i]);
+                hits += cd_capsule_polygon_view_overlap_v(g_data.capsulesA[i], &view);
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_capsules_distance(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                acc += cd_capsules_distance_v(g_data.capsulesA[i], g_data.capsulesB[i]);
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    // 对照: 同一组胶囊体走 GJK 通用路径
+    CD_U64 bench_capsules_distance_gjk(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                const CD_SHAPE a = cd_make_capsule_shape_v(g_data.capsulesA[i]);
+                const CD_SHAPE b = cd_make_capsule_shape_v(g_data.capsulesB[i]);
+                CD_DISTANCE_OUTPUT output;
+                cd_shape_distance_gjk_v(&a, &b, &output);
+                acc += output.distance;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_segment_polyline_intersect(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        CD_S32 indices[256];
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < 64; ++i)
+            {
+                CD_S32 count = 0;
+                cd_segment_polyline_intersect(&g_data.segsA[i], g_data.polyline.data(), (CD_S32)g_data.polyline.size(),
+                                              CD_FALSE, indices, CD_NULL, 256, &count);
+                hits += count;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * 64 * (g_data.polyline.size() - 1);
+    }
+
+    CD_U64 bench_polygon_to_aabb(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_AABB box = {{0.0f, 0.0f}, {0.0f, 0.0f}};
+                cd_polygon_to_aabb(&g_data.polygons[i], &box);
+                acc += box.lowerBound.x;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_make_polygon(CD_S32 reps)
+    {
+        CD_S32 vertices = 0;
+        CD_POLYGON polygon;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 c = 0; c < CLUSTER_N; ++c)
+            {
+                cd_make_polygon(g_data.clusterPoints.data() + c * CLUSTER_POINTS, CLUSTER_POINTS, 0.0f,
+                                g_data.hullScratch.data(), &polygon);
+                vertices += polygon.count;
+            }
+        }
+        g_sink_i += vertices;
+        return (CD_U64)reps * CLUSTER_N;
+    }
+
+    CD_U64 bench_arena_alloc(CD_S32 reps)
+    {
+        const CD_S32 n = 1024;
+        std::vector<CD_U08> buffer(n * 64 + 64);
+        CD_ARENA arena;
+        cd_arena_init(buffer.data(), (CD_U32)buffer.size(), &arena);
+        CD_VOID *p = CD_NULL;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            cd_arena_reset_v(&arena);
+            for (CD_S32 i = 0; i < n; ++i)
+            {
+                cd_arena_alloc(&arena, 48, 16, &p);
+            }
+            g_sink_i += arena.offset;
+        }
+        return (CD_U64)reps * n;
+    }
+
+    CD_U64 bench_pool_alloc_free(CD_S32 reps)
+    {
+        const CD_S32 n = 1024;
+        std::vector<CD_U08> buffer(n * 64 + 64);
+        CD_ARENA arena;
+        cd_arena_init(buffer.data(), (CD_U32)buffer.size(), &arena);
+        CD_POOL pool = CD_POOL();
+        cd_pool_init_from_arena(&arena, 48, 16, n, &pool);
+        std::vector<CD_VOID *> blocks(n);
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < n; ++i)
+            {
+                cd_pool_alloc(&pool, &blocks[i]);
+            }
+            // 交错释放,下一轮的分配走空闲链表
+            for (CD_S32 i = 0; i < n; i += 2)
+            {
+                cd_pool_free(&pool, blocks[i]);
+            }
+            for (CD_S32 i = 1; i < n; i += 2)
+            {
+                cd_pool_free(&pool, blocks[i]);
+            }
+            g_sink_i += pool.count;
+        }
+        return (CD_U64)reps * n;
+    }
+
+    CD_U64 bench_make_arena_polygon(CD_S32 reps)
+    {
+        std::vector<CD_VEC2> vertices(CLUSTER_N * CLUSTER_POINTS);
+        std::vector<CD_VEC2> normals(CLUSTER_N * CLUSTER_POINTS);
+        CD_VERTEX_ARENA arena;
+        cd_vertex_arena_init(vertices.data(), normals.data(), CLUSTER_N * CLUSTER_POINTS, &arena);
+        CD_ARENA_POLYGON polygon;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            cd_vertex_arena_reset_v(&arena);
+            for (CD_S32 c = 0; c < CLUSTER_N; ++c)
+            {
+                cd_make_arena_polygon(&arena, g_data.roundClusterPoints.data() + c * CLUSTER_POINTS, CLUSTER_POINTS, 0.0f,
+                                      g_data.hullScratch.data(), &polygon);
+            }
+            g_sink_i += arena.count;
+        }
+        return (CD_U64)reps * CLUSTER_N;
+    }
+
+    CD_U64 bench_arena_polygons_overlap(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 c = 0; c < CLUSTER_N; ++c)
+            {
+                const CD_POLYGON_VIEW a = cd_arena_polygon_view_v(&g_data.vertexArena, &g_data.arenaPolygons[c]);
+                const CD_POLYGON_VIEW b = cd_arena_polygon_view_v(&g_data.vertexArena, &g_data.arenaPolygons[(c + 1) % CLUSTER_N]);
+                hits += cd_polygon_views_overlap_v(&a, &b);
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * CLUSTER_N;
+    }
+
+    CD_U64 bench_arena_polygons_distance(CD_S32 reps)
+    {
+        CD_DISTANCE_SPAN_INPUT input;
+        input.transformA = TRANSFORM_IDENTITY;
+        input.transformB = TRANSFORM_IDENTITY;
+        input.useRadii = CD_TRUE;
+        CD_DISTANCE_OUTPUT output;
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 c = 0; c < CLUSTER_N; ++c)
+            {
+                CD_DISTANCE_CACHE cache = emptyDistanceCache;
+                input.proxyA = cd_arena_polygon_span_v(&g_data.vertexArena, &g_data.arenaPolygons[c]);
+                input.proxyB = cd_arena_polygon_span_v(&g_data.vertexArena, &g_data.arenaPolygons[(c + 1) % CLUSTER_N]);
+                cd_shape_distance_span(&cache, &input, CD_NULL, 0, &output);
+                acc += output.distance;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * CLUSTER_N;
+    }
+
+    CD_U64 bench_collide_polygons(CD_S32 reps)
+    {
+        CD_S32 points = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                const CD_MANIFOLD m = cd_collide_polygons_v(&g_data.polygons[i], &g_data.polygons[(i + 1) & (MICRO_N - 1)]);
+                points += m.pointCount;
+            }
+        }
+        g_sink_i += points;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_collide_obbs(CD_S32 reps)
+    {
+        CD_S32 points = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                const CD_MANIFOLD m = cd_collide_obbs_v(g_data.obbsA[i], g_data.obbsB[i]);
+                points += m.pointCount;
+            }
+        }
+        g_sink_i += points;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_collide_polygon_circle(CD_S32 reps)
+    {
+        CD_S32 points = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                const CD_MANIFOLD m = cd_collide_polygon_circle_v(&g_data.polygons[i], g_data.circles[i]);
+                points += m.pointCount;
+            }
+        }
+        g_sink_i += points;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_shape_distance_cold(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_DISTANCE_CACHE cache = emptyDistanceCache;
+                CD_DISTANCE_OUTPUT output = {{0.0f, 0.0f}, {0.0f, 0.0f}, 0.0f, 0, 0};
+                cd_shape_distance(&cache, &g_data.distanceInputs[i], CD_NULL, 0, &output);
+                acc += output.distance;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_shape_distance_warm(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_DISTANCE_OUTPUT output = {{0.0f, 0.0f}, {0.0f, 0.0f}, 0.0f, 0, 0};
+                cd_shape_distance(&g_data.distanceCaches[i], &g_data.distanceInputs[i], CD_NULL, 0, &output);
+                acc += output.distance;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    // 在时间步内均匀采样,找到第一个重叠的采样时刻
+    CD_U64 bench_toi_dense_sampling(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                const CD_TOI_INPUT &toi = g_data.toiInputs[i];
+                CD_DISTANCE_INPUT input;
+                input.proxyA = toi.proxyA;
+                input.proxyB = toi.proxyB;
+                input.useRadii = CD_FALSE;
+                CD_DISTANCE_CACHE cache = emptyDistanceCache;
+                CD_F32 first = toi.tMax;
+                for (CD_S32 k = 0; k <= TOI_SAMPLES; ++k)
+                {
+                    const CD_F32 t = toi.tMax * (CD_F32)k / (CD_F32)TOI_SAMPLES;
+                    input.transformA = cd_sweep_transform_v(toi.sweepA, t);
+                    input.transformB = cd_sweep_transform_v(toi.sweepB, t);
+                    CD_DISTANCE_OUTPUT output = {{0.0f, 0.0f}, {0.0f, 0.0f}, 0.0f, 0, 0};
+                    cd_shape_distance(&cache, &input, CD_NULL, 0, &output);
+                    if (output.distance < toi.tolerance)
+                    {
+                        first = t;
+                        break;
+                    }
+                }
+                acc += first;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    CD_U64 bench_toi_conservative_advancement(CD_S32 reps)
+    {
+        CD_F32 acc = 0.0f;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < MICRO_N; ++i)
+            {
+                CD_TOI_OUTPUT output;
+                output.t = 0.0f;
+                cd_time_of_impact(&g_data.toiInputs[i], &output);
+                acc += output.t;
+            }
+        }
+        g_sink_f += acc;
+        return (CD_U64)reps * MICRO_N;
+    }
+
+    // ---------------------------------------------------------------- 场景
+
+    CD_U64 bench_footprint_brute_force(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 f = 0; f < FOOTPRINT_N; ++f)
+            {
+                const CD_OBB footprint = g_data.footprints[f];
+                for (CD_S32 i = 0; i < OBSTACLE_N; ++i)
+                {
+                    hits += cd_obb_overlap_v(footprint, g_data.obstacles[i]);
+                }
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * FOOTPRINT_N;
+    }
+
+    CD_U64 bench_footprint_aabb_soa(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 f = 0; f < FOOTPRINT_N; ++f)
+            {
+                const CD_OBB footprint = g_data.footprints[f];
+                const CD_AABB box = cd_obb_to_aabb_v(footprint);
+                CD_S32 count = 0;
+                cd_aabb_overlap_batch(&box, &g_data.obstacleSoa, g_data.candidates.data(), OBSTACLE_N, &count);
+                for (CD_S32 k = 0; k < count; ++k)
+                {
+                    hits += cd_obb_overlap_v(footprint, g_data.obstacles[g_data.candidates[k]]);
+                }
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * FOOTPRINT_N;
+    }
+
+    CD_U64 bench_footprint_dynamic_tree(CD_S32 reps)
+    {
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 f = 0; f < FOOTPRINT_N; ++f)
+            {
+                const CD_AABB box = cd_obb_to_aabb_v(g_data.footprints[f]);
+                cd_dynamic_tree_query(&g_data.tree, &box, tree_query_callback, &g_data.footprints[f]);
+            }
+        }
+        return (CD_U64)reps * FOOTPRINT_N;
+    }
+
+    CD_U64 bench_footprint_dynamic_tree_parallel(CD_S32 reps)
+    {
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            cd_parallel_tree_overlap_obbs(&g_data.pool, &g_data.tree, g_data.obstacles.data(), g_data.footprints.data(),
+                                          FOOTPRINT_N, g_data.footprintResults.data());
+            g_sink_i += g_data.footprintResults[0];
+        }
+        return (CD_U64)reps * FOOTPRINT_N;
+    }
+
+    CD_U64 bench_lidar_tree(CD_S32 reps)
+    {
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            cd_dynamic_tree_ray_cast_obbs(&g_data.tree, g_data.obstacles.data(), g_data.rays.data(), LIDAR_BEAMS,
+                                          g_data.rayOutputs.data(), CD_NULL);
+            g_sink_f += g_data.rayOutputs[0].fraction;
+        }
+        return (CD_U64)reps * LIDAR_BEAMS;
+    }
+
+    CD_U64 bench_lidar_packet(CD_S32 reps)
+    {
+        const CD_VEC2 origin = Vec2_Zero;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            cd_dynamic_tree_ray_cast_obbs_packet(&g_data.tree, g_data.obstacles.data(), &origin, g_data.lidarDxs.data(),
+                                                 g_data.lidarDys.data(), LIDAR_BEAMS, g_data.rayOutputs.data(), CD_NULL);
+            g_sink_f += g_data.rayOutputs[0].fraction;
+        }
+        return (CD_U64)reps * LIDAR_BEAMS;
+    }
+
+    CD_U64 bench_footprint_spatial_hash(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 f = 0; f < FOOTPRINT_N; ++f)
+            {
+                const CD_OBB footprint = g_data.footprints[f];
+                const CD_AABB box = cd_obb_to_aabb_v(footprint);
+                CD_S32 count = 0;
+                cd_spatial_hash_query(&g_data.hash, &box, g_data.candidates.data(), OBSTACLE_N, &count);
+                for (CD_S32 k = 0; k < count; ++k)
+                {
+                    hits += cd_obb_overlap_v(footprint, g_data.obstacles[g_data.candidates[k]]);
+                }
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * FOOTPRINT_N;
+    }
+
+    CD_U64 bench_trajectory_naive(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 t = 0; t < TRAJECTORY_N; ++t)
+            {
+                CD_S32 first = CD_TRAJECTORY_NO_HIT;
+                for (CD_S32 i = 0; i < TRAJECTORY_POSES && first == CD_TRAJECTORY_NO_HIT; ++i)
+                {
+                    const CD_S32 k = t * TRAJECTORY_POSES + i;
+                    const CD_F32 heading = g_data.trajectoryHeadings[k];
+                    CD_VEC2 center = {g_data.trajectoryXs[k] + 1.4f * cosf(heading),
+                                      g_data.trajectoryYs[k] + 1.4f * sinf(heading)};
+                    CD_OBB footprint;
+                    cd_create_obb(&center, g_data.vehicle.length, g_data.vehicle.width, heading, &footprint);
+                    for (CD_S32 j = 0; j < OBSTACLE_N; ++j)
+                    {
+                        CD_BOOL overlap = CD_FALSE;
+                        cd_obb_overlap(&footprint, &g_data.trajectoryObstacles[j], &overlap);
+                        if (overlap)
+                        {
+                            first = i;
+                            break;
+                        }
+                    }
+                }
+                hits += first;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * TRAJECTORY_N;
+    }
+
+    CD_U64 bench_trajectory_checker(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 t = 0; t < TRAJECTORY_N; ++t)
+            {
+                CD_S32 first = CD_TRAJECTORY_NO_HIT;
+                cd_trajectory_check_obb(&g_data.trajectoryPoses[t * TRAJECTORY_POSES], TRAJECTORY_POSES, &g_data.vehicle,
+                                        g_data.trajectoryObstacles.data(), OBSTACLE_N, &first, CD_NULL);
+                hits += first;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * TRAJECTORY_N;
+    }
+
+    CD_U64 bench_trajectory_parallel(CD_S32 reps)
+    {
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            cd_parallel_trajectories_check_obb(&g_data.pool, g_data.trajectoryPoses.data(), TRAJECTORY_POSES, TRAJECTORY_N,
+                                               &g_data.vehicle, g_data.trajectoryObstacles.data(), OBSTACLE_N,
+                                               g_data.trajectoryResults.data(), CD_NULL);
+            g_sink_i += g_data.trajectoryResults[0];
+        }
+        return (CD_U64)reps * TRAJECTORY_N;
+    }
+
+    // 整张地图重算距离场
+    CD_U64 bench_grid_edt_full(CD_S32 reps)
+    {
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            CD_GRID_MAP &grid = g_data.grid;
+            grid.dirtyMinX = 0;
+            grid.dirtyMinY = 0;
+            grid.dirtyMaxX = grid.width - 1;
+            grid.dirtyMaxY = grid.height - 1;
+            cd_grid_map_update_distance(&grid);
+        }
+        g_sink_f += g_data.gridDistance[0];
+        return (CD_U64)reps;
+    }
+
+    // 地图中部少量栅格变化后增量更新,每轮翻转两次,保持地图不变
+    CD_U64 bench_grid_edt_incremental(CD_S32 reps)
+    {
+        CD_GRID_MAP &grid = g_data.grid;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 pass = 0; pass < 2; ++pass)
+            {
+                CD_U32 state = 0x9E3779B9u;
+                for (CD_S32 k = 0; k < GRID_UPDATE_N; ++k)
+                {
+                    state = state * 1664525u + 1013904223u;
+                    const CD_S32 cell_x = (CD_S32)((state >> 8) % 40u) + 480;
+                    const CD_S32 cell_y = (CD_S32)((state >> 20) % 40u) + 480;
+                    const CD_BOOL occupied = g_data.gridCells[cell_y * grid.width + cell_x] != CD_GRID_FREE;
+                    cd_grid_map_set_cell(&grid, cell_x, cell_y, !occupied);
+                }
+                cd_grid_map_update_distance(&grid);
+            }
+        }
+        g_sink_f += g_data.gridDistance[500 * grid.width + 500];
+        return (CD_U64)reps * 2;
+    }
+
+    CD_U64 bench_grid_footprint_scan(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 f = 0; f < FOOTPRINT_N; ++f)
+            {
+                hits += cd_grid_map_obb_scan_v(&g_data.grid, g_data.footprints[f]);
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * FOOTPRINT_N;
+    }
+
+    CD_U64 bench_grid_footprint_distance_field(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 f = 0; f < FOOTPRINT_N; ++f)
+            {
+                CD_BOOL hit = CD_FALSE;
+                cd_grid_map_obb_collide(&g_data.grid, &g_data.footprints[f], &hit);
+                hits += hit;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * FOOTPRINT_N;
+    }
+
+    // 每个位姿变换足迹obb后逐点判断
+    CD_U64 bench_trajectory_cloud_obb(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 t = 0; t < TRAJECTORY_N; ++t)
+            {
+                CD_S32 first = CD_TRAJECTORY_NO_HIT;
+                for (CD_S32 i = 0; i < TRAJECTORY_POSES && first == CD_TRAJECTORY_NO_HIT; ++i)
+                {
+                    const CD_TRANSFORM pose = g_data.trajectoryPoses[t * TRAJECTORY_POSES + i];
+                    CD_OBB footprint = g_data.vehicle;
+                    footprint.center = cd_transforms_point_v(pose, g_data.vehicle.center);
+                    footprint.q = cd_rot_mul_v(pose.q, g_data.vehicle.q);
+                    for (CD_S32 j = 0; j < OBSTACLE_N; ++j)
+                    {
+                        if (cd_is_point_in_obb_v(footprint, cd_vec2_make_v(g_data.trajectoryCloudXs[j], g_data.trajectoryCloudYs[j])))
+                        {
+                            first = i;
+                            break;
+                        }
+                    }
+                }
+                hits += first;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * TRAJECTORY_N;
+    }
+
+    CD_U64 bench_trajectory_cloud_circle_cover(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 t = 0; t < TRAJECTORY_N; ++t)
+            {
+                CD_S32 first = CD_TRAJECTORY_NO_HIT;
+                cd_circle_cover_check_points(&g_data.vehicleCover, &g_data.trajectoryPoses[t * TRAJECTORY_POSES], TRAJECTORY_POSES,
+                                             g_data.trajectoryCloudXs.data(), g_data.trajectoryCloudYs.data(), OBSTACLE_N,
+                                             &first, CD_NULL);
+                hits += first;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * TRAJECTORY_N;
+    }
+
+    CD_U64 bench_trajectory_grid_obb(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 t = 0; t < TRAJECTORY_N; ++t)
+            {
+                CD_S32 first = CD_TRAJECTORY_NO_HIT;
+                for (CD_S32 i = 0; i < TRAJECTORY_POSES; ++i)
+                {
+                    const CD_TRANSFORM pose = g_data.trajectoryPoses[t * TRAJECTORY_POSES + i];
+                    CD_OBB footprint = g_data.vehicle;
+                    footprint.center = cd_transforms_point_v(pose, g_data.vehicle.center);
+                    footprint.q = cd_rot_mul_v(pose.q, g_data.vehicle.q);
+                    CD_BOOL hit = CD_FALSE;
+                    cd_grid_map_obb_collide(&g_data.grid, &footprint, &hit);
+                    if (hit)
+                    {
+                        first = i;
+                        break;
+                    }
+                }
+                hits += first;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * TRAJECTORY_N;
+    }
+
+    CD_U64 bench_trajectory_grid_circle_cover(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 t = 0; t < TRAJECTORY_N; ++t)
+            {
+                CD_S32 first = CD_TRAJECTORY_NO_HIT;
+                cd_circle_cover_check_grid(&g_data.vehicleCover, &g_data.trajectoryPoses[t * TRAJECTORY_POSES], TRAJECTORY_POSES,
+                                           &g_data.grid, &first);
+                hits += first;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps * TRAJECTORY_N;
+    }
+
+    CD_U64 bench_cloud_scalar(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < CLOUD_N; ++i)
+            {
+                CD_VEC2 point = {g_data.cloudXs[i], g_data.cloudYs[i]};
+                CD_BOOL inside = CD_FALSE;
+                cd_is_point_in_obb(&g_data.cloudObb, &point, &inside);
+                hits += inside;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps;
+    }
+
+    CD_U64 bench_cloud_batch(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            CD_S32 count = 0;
+            cd_points_in_obb_batch(g_data.cloudXs.data(), g_data.cloudYs.data(), CLOUD_N, &g_data.cloudObb,
+                                   g_data.cloudMask.data(), &count);
+            hits += count;
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps;
+    }
+
+    CD_U64 bench_cloud_polygon_scalar(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < CLOUD_N; ++i)
+            {
+                CD_VEC2 point = {g_data.cloudXs[i], g_data.cloudYs[i]};
+                CD_BOOL inside = CD_FALSE;
+                cd_point_in_polygon(&point, &g_data.cloudPolygon, &inside);
+                hits += inside;
+            }
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps;
+    }
+
+    CD_U64 bench_cloud_polygon_batch(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            CD_S32 count = 0;
+            cd_points_in_polygon_batch(g_data.cloudXs.data(), g_data.cloudYs.data(), CLOUD_N, &g_data.cloudPolygon,
+                                       g_data.cloudPolygon.radius, g_data.cloudMask.data(), &count);
+            hits += count;
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps;
+    }
+
+    CD_U64 bench_cloud_polygon_parallel(CD_S32 reps)
+    {
+        CD_S32 hits = 0;
+        const CD_POLYGON_VIEW view = cd_polygon_view_v(&g_data.cloudPolygon);
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            CD_S32 count = 0;
+            cd_parallel_points_in_polygon(&g_data.pool, g_data.cloudXs.data(), g_data.cloudYs.data(), CLOUD_N, &view,
+                                          g_data.cloudPolygon.radius, g_data.cloudMask.data(), &count);
+            hits += count;
+        }
+        g_sink_i += hits;
+        return (CD_U64)reps;
+    }
+
+    CD_U64 bench_sap_update(CD_S32 reps)
+    {
+        for (CD_S32 r = 0; r < reps; ++r)
+        {
+            for (CD_S32 i = 0; i < SAP_N; ++i)
+            {
+                CD_VEC2 &center = g_data.sapCenters[i];
+                CD_VEC2 &velocity = g_data.sapVelocities[i];
+                center = cd_vec2_add_v(center, velocity);
+                if (center.x < 0.0f || center.x > 100.0f)
+                {
+                    velocity.x = -velocity.x;
+                }
+                if (center.y < 0.0f || center.y > 100.0f)
+                {
+                    velocity.y = -velocity.y;
+                }
+                const CD_AABB box = cd_create_aabb_v(center, 2.0f, 2.0f);
+                cd_sap_move_proxy(&g_data.sap, i, &box);
+            }
+        }
+        g_sink_i += g_data.sap.pairCount;
+        return (CD_U64)reps;
+    }
+
+    const CD_BENCH_ENTRY g_entries[] = {
+        {"micro/vec2_add", "op", bench_vec2_add},
+        {"micro/vec2_add_v", "op", bench_vec2_add_v},
+        {"micro/rot_vector", "op", bench_rot_vector},
+        {"micro/transforms_point", "op", bench_transforms_point},
+        {"micro/aabb_overlap", "pair", bench_aabb_overlap},
+        {"micro/aabb_overlap_v", "pair", bench_aabb_overlap_v},
+        {"micro/point_in_circle", "point", bench_point_in_circle},
+        {"micro/is_point_in_obb", "point", bench_is_point_in_obb},
+        {"micro/points_in_obb_batch", "point", bench_points_in_obb_batch},
+        {"micro/obb_to_aabb", "op", bench_obb_to_aabb},
+        {"micro/obb_overlap", "pair", bench_obb_overlap},
+        {"micro/obb_overlap_f64_map", "pair", bench_obb_overlap_f64_map},
+        {"micro/obb_overlap_mtv", "pair", bench_obb_overlap_mtv},
+        {"micro/ray_cast_obb", "ray", bench_ray_cast_obb},
+        {"micro/ray_cast_polygon", "ray", bench_ray_cast_polygon},
+        {"micro/segments_intersect", "pair", bench_segments_intersect},
+        {"micro/segment_dis_to_point", "op", bench_segment_dis_to_point},
+        {"micro/segment_polyline_intersect", "segment", bench_segment_polyline_intersect},
+        {"micro/capsules_overlap", "pair", bench_capsules_overlap},
+        {"micro/capsule_obb_overlap", "pair", bench_capsule_obb_overlap},
+        {"micro/capsule_polygon_overlap", "pair", bench_capsule_polygon_overlap},
+        {"micro/capsules_distance", "pair", bench_capsules_distance},
+        {"micro/capsules_distance_gjk", "pair", bench_capsules_distance_gjk},
+        {"micro/shapes_mixed_overlap_dispatch", "pair", bench_shapes_overlap_dispatch},
+        {"micro/shapes_mixed_distance_dispatch", "pair", bench_shapes_distance_dispatch},
+        {"micro/shapes_mixed_distance_gjk", "pair", bench_shapes_distance_gjk},
+        {"micro/shapes_mixed_manifold_dispatch", "pair", bench_shapes_manifold_dispatch},
+        {"micro/shape_overlap_circle_obb_template", "pair", bench_shape_overlap_circle_obb_template},
+        {"micro/fx_point_in_obb", "point", bench_fx_point_in_obb},
+        {"micro/fx_obb_overlap", "pair", bench_fx_obb_overlap},
+        {"micro/fx_segments_intersect", "pair", bench_fx_segments_intersect},
+        {"micro/fx_segment_dis_to_point", "op", bench_fx_segment_dis_to_point},
+        {"micro/fx_segment_dis_sqr_to_point", "op", bench_fx_segment_dis_sqr_to_point},
+        {"micro/polygon_to_aabb", "op", bench_polygon_to_aabb},
+        {"micro/make_polygon_64_points", "polygon", bench_make_polygon},
+        {"micro/arena_alloc", "alloc", bench_arena_alloc},
+        {"micro/pool_alloc_free", "alloc", bench_pool_alloc_free},
+        {"micro/make_arena_polygon_24_gon", "polygon", bench_make_arena_polygon},
+        {"micro/arena_polygons_overlap_24_gon", "pair", bench_arena_polygons_overlap},
+        {"micro/arena_polygons_distance_24_gon", "pair", bench_arena_polygons_distance},
+        {"micro/collide_polygons", "pair", bench_collide_polygons},
+        {"micro/collide_obbs", "pair", bench_collide_obbs},
+        {"micro/collide_polygon_circle", "pair", bench_collide_polygon_circle},
+        {"micro/shape_distance_cold", "pair", bench_shape_distance_cold},
+        {"micro/shape_distance_warm", "pair", bench_shape_distance_warm},
+        {"micro/toi_dense_sampling_32", "pair", bench_toi_dense_sampling},
+        {"micro/toi_conservative_advancement", "pair", bench_toi_conservative_advancement},
+        {"macro/footprint_vs_10k_obb_brute_force", "footprint", bench_footprint_brute_force},
+        {"macro/footprint_vs_10k_obb_aabb_soa", "footprint", bench_footprint_aabb_soa},
+        {"macro/footprint_vs_10k_obb_dynamic_tree", "footprint", bench_footprint_dynamic_tree},
+        {"macro/footprint_vs_10k_obb_dynamic_tree_parallel", "footprint", bench_footprint_dynamic_tree_parallel},
+        {"macro/footprint_vs_10k_obb_spatial_hash", "footprint", bench_footprint_spatial_hash},
+        {"macro/lidar_2048_beams_vs_10k_obb_tree", "beam", bench_lidar_tree},
+        {"macro/lidar_2048_beams_vs_10k_obb_packet", "beam", bench_lidar_packet},
+        {"macro/trajectory_100_poses_vs_10k_obb_naive", "trajectory", bench_trajectory_naive},
+        {"macro/trajectory_100_poses_vs_10k_obb_checker", "trajectory", bench_trajectory_checker},
+        {"macro/trajectory_100_poses_vs_10k_obb_parallel", "trajectory", bench_trajectory_parallel},
+        {"macro/grid_1000x1000_edt_full", "map", bench_grid_edt_full},
+        {"macro/grid_1000x1000_edt_incremental_16_cells", "update", bench_grid_edt_incremental},
+        {"macro/grid_footprint_raster_scan", "footprint", bench_grid_footprint_scan},
+        {"macro/grid_footprint_distance_field", "footprint", bench_grid_footprint_distance_field},
+        {"macro/trajectory_100_poses_vs_10k_points_obb", "trajectory", bench_trajectory_cloud_obb},
+        {"macro/trajectory_100_poses_vs_10k_points_circle_cover", "trajectory", bench_trajectory_cloud_circle_cover},
+        {"macro/trajectory_100_poses_vs_grid_obb", "trajectory", bench_trajectory_grid_obb},
+        {"macro/trajectory_100_poses_vs_grid_circle_cover", "trajectory", bench_trajectory_grid_circle_cover},
+        {"macro/cloud_100k_vs_obb_scalar", "cloud", bench_cloud_scalar},
+        {"macro/cloud_100k_vs_obb_batch", "cloud", bench_cloud_batch},
+        {"macro/cloud_100k_vs_polygon_scalar", "cloud", bench_cloud_polygon_scalar},
+        {"macro/cloud_100k_vs_polygon_batch", "cloud", bench_cloud_polygon_batch},
+        {"macro/cloud_100k_vs_polygon_parallel", "cloud", bench_cloud_polygon_parallel},
+        {"macro/sap_1k_moving_update", "step", bench_sap_update},
+    };
+
+    CD_F64 now_ns()
+    {
+        return (CD_F64)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    // 先倍增轮数直到单次采样超过 min_time / samples,再取多次采样的中位数
+    CD_BENCH_RESULT run_entry(const CD_BENCH_ENTRY &entry, CD_F64 min_time_s, CD_S32 samples)
+    {
+        const CD_F64 sample_ns = min_time_s * 1e9 / samples;
+        CD_S32 reps = 1;
+        CD_U64 ops = 0;
+        for (;;)
+        {
+            const CD_F64 t0 = now_ns();
+            ops = entry.func(reps);
+            const CD_F64 elapsed = now_ns() - t0;
+            if (elapsed >= sample_ns || reps >= (1 << 24))
+            {
+                break;
+            }
+            const CD_F64 scale = elapsed > 0.0 ? sample_ns / elapsed : 16.0;
+            reps = (CD_S32)std::min<CD_F64>(reps * std::min(std::max(scale * 1.2, 2.0), 16.0), (CD_F64)(1 << 24));
+        }
+        std::vector<CD_F64> ns_per_op;
+        for (CD_S32 s = 0; s < samples; ++s)
+        {
+            const CD_F64 t0 = now_ns();
+            ops = entry.func(reps);
+            const CD_F64 elapsed = now_ns() - t0;
+            ns_per_op.push_back(elapsed / (CD_F64)ops);
+        }
+        std::sort(ns_per_op.begin(), ns_per_op.end());
+        CD_BENCH_RESULT result;
+        result.name = entry.name;
+        result.unit = entry.unit;
+        result.nsPerOp = ns_per_op[ns_per_op.size() / 2];
+        result.opsPerSample = ops;
+        result.baseline = -1.0;
+        return result;
+    }
+
+    // 从本程序输出的JSON中读取每项的 ns_per_op
+    CD_BOOL load_baseline(const char *path, std::vector<std::pair<std::string, CD_F64> > *result)
+    {
+        FILE *file = fopen(path, "rb");
+        if (file == CD_NULL)
+        {
+            return CD_FALSE;
+        }
+        std::string text;
+        char buffer[4096];
+        size_t n;
+        while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        {
+            text.append(buffer, n);
+        }
+        fclose(file);
+        const std::string name_key = "\"name\": \"";
+        const std::string value_key = "\"ns_per_op\": ";
+        size_t pos = 0;
+        while ((pos = text.find(name_key, pos)) != std::string::npos)
+        {
+            pos += name_key.size();
+            const size_t end = text.find('"', pos);
+            if (end == std::string::npos)
+            {
+                break;
+            }
+            const std::string name = text.substr(pos, end - pos);
+            const size_t next = text.find(name_key, end);
+            const size_t value = text.find(value_key, end);
+            if (value != std::string::npos && (next == std::string::npos || value < next))
+            {
+                result->push_back(std::make_pair(name, atof(text.c_str() + value + value_key.size())));
+            }
+            pos = end;
+        }
+        return CD_TRUE;
+    }
+
+    const char *simd_name()
+    {
+#if defined(CD_SIMD_AVX2)
+        return "avx2";
+#elif defined(CD_SIMD_SSE2)
+        return "sse2";
+#else
+        return "scalar";
+#endif
+    }
+
+    CD_VOID print_usage()
+    {
+        fprintf(stderr,
+                "usage: cd_benchmark [--filter STR] [--min-time SEC] [--samples N] [--output FILE]\n"
+                "                    [--baseline FILE] [--threshold PCT] [--list]\n");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *filter = CD_NULL;
+    const char *output_path = CD_NULL;
+    const char *baseline_path = CD_NULL;
+    CD_F64 min_time_s = 0.5;
+    CD_S32 samples = 5;
+    CD_F64 threshold_pct = 10.0;
+    CD_BOOL list_only = CD_FALSE;
+    for (CD_S32 i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const CD_BOOL has_value = i + 1 < argc;
+        if (arg == "--filter" && has_value)
+        {
+            filter = argv[++i];
+        }
+        else if (arg == "--min-time" && has_value)
+        {
+            min_time_s = atof(argv[++i]);
+        }
+        else if (arg == "--samples" && has_value)
+        {
+            samples = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--output" && has_value)
+        {
+            output_path = argv[++i];
+        }
+        else if (arg == "--baseline" && has_value)
+        {
+            baseline_path = argv[++i];
+        }
+        else if (arg == "--threshold" && has_value)
+        {
+            threshold_pct = atof(argv[++i]);
+        }
+        else if (arg == "--list")
+        {
+            list_only = CD_TRUE;
+        }
+        else
+        {
+            print_usage();
+            return 2;
+        }
+    }
+
+    const CD_S32 entry_count = (CD_S32)(sizeof(g_entries) / sizeof(g_entries[0]));
+    if (list_only)
+    {
+        for (CD_S32 i = 0; i < entry_count; ++i)
+        {
+            printf("%s\n", g_entries[i].name);
+        }
+        return 0;
+    }
+
+    std::vector<std::pair<std::string, CD_F64> > baseline;
+    if (baseline_path != CD_NULL && !load_baseline(baseline_path, &baseline))
+    {
+        fprintf(stderr, "cannot read baseline %s\n", baseline_path);
+        return 2;
+    }
+
+    setup();
+    std::vector<CD_BENCH_RESULT> results;
+    for (CD_S32 i = 0; i < entry_count; ++i)
+    {
+        if (filter != CD_NULL && strstr(g_entries[i].name, filter) == CD_NULL)
+        {
+            continue;
+        }
+        CD_BENCH_RESULT result = run_entry(g_entries[i], min_time_s, samples);
+        for (size_t k = 0; k < baseline.size(); ++k)
+        {
+            if (baseline[k].first == result.name)
+            {
+                result.baseline = baseline[k].second;
+            }
+        }
+        fprintf(stderr, "%-48s %12.3f ns/%s\n", result.name.c_str(), result.nsPerOp, result.unit.c_str());
+        results.push_back(result);
+    }
+    cd_worker_pool_destroy(&g_data.pool);
+
+    std::string json;
+    char line[512];
+    CD_S32 regressions = 0;
+    snprintf(line, sizeof(line), "{\n  \"version\": %d,\n  \"simd\": \"%s\",\n  \"benchmarks\": [\n",
+             COLLISION_DETECTION_VERSION, simd_name());
+    json += line;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const CD_BENCH_RESULT &r = results[i];
+        snprintf(line, sizeof(line), "    {\"name\": \"%s\", \"unit\": \"%s\", \"ns_per_op\": %.4f, \"ops_per_sec\": %.1f, \"ops_per_sample\": %llu",
+                 r.name.c_str(), r.unit.c_str(), r.nsPerOp, r.nsPerOp > 0.0 ? 1e9 / r.nsPerOp : 0.0,
+                 (unsigned long long)r.opsPerSample);
+        json += line;
+        if (r.baseline > 0.0)
+        {
+            const CD_F64 delta_pct = (r.nsPerOp - r.baseline) / r.baseline * 100.0;
+            const char *status = delta_pct > threshold_pct ? "regression" : (delta_pct < -threshold_pct ? "improvement" : "same");
+            regressions += delta_pct > threshold_pct ? 1 : 0;
+            snprintf(line, sizeof(line), ", \"baseline_ns_per_op\": %.4f, \"delta_pct\": %.2f, \"status\": \"%s\"",
+                     r.baseline, delta_pct, status);
+            json += line;
+        }
+        json += i + 1 < results.size() ? "},\n" : "}\n";
+    }
+    json += "  ]";
+    if (baseline_path != CD_NULL)
+    {
+        snprintf(line, sizeof(line), ",\n  \"threshold_pct\": %.2f,\n  \"regressions\": %d", threshold_pct, regressions);
+        json += line;
+    }
+    json += "\n}\n";
+
+    fputs(json.c_str(), stdout);
+    if (output_path != CD_NULL)
+    {
+        FILE *file = fopen(output_path, "wb");
+        if (file == CD_NULL)
+        {
+            fprintf(stderr, "cannot write %s\n", output_path);
+            return 2;
+        }
+        fputs(json.c_str(), file);
+        fclose(file);
+    }
+    return regressions > 0 ? 1 : 0;
+}
@@ -8,6 +8,7 @@
 #ifndef __COLLISION_DETECTION_H__
 #define __COLLISION_DETECTION_H__
 
+#include "collision_detection_allocator.h"
 #include "collision_detection_vec2.h"
 #include "collision_detection_segment.h"
 #include "collision_detection_circle.h"
@@ -16,5 +17,21 @@
 #include "collision_detection_polygon.h"
 #include "collision_detection_aabb.h"
 #include "collision_detection_mat22.h"
+#include "collision_detection_dynamic_tree.h"
+#include "collision_detection_spatial_hash.h"
+#include "collision_detection_sweep_prune.h"
+#include "collision_detection_batch.h"
+#include "collision_detection_trajectory.h"
+#include "collision_detection_toi.h"
+#include "collision_detection_grid.h"
+#include "collision_detection_circle_cover.h"
+#include "collision_detection_manifold.h"
+#include "collision_detection_vertex_arena.h"
+#include "collision_detection_parallel.h"
+#include "collision_detection_raycast.h"
+#include "collision_detection_scalar.h"
+#include "collision_detection_fixed.h"
+#include "collision_detection_capsule.h"
+#include "collision_detection_shape.h"
 
 #endif /* __COLLISION_DETECTION_H__ */
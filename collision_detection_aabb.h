@@ -15,12 +15,24 @@ extern "C"
 {
 #endif
 
-  // 轴对齐包围盒
-  typedef struct _CD_AABB_
+  // CD_AABB 与 cd_aabb_overlap_v、cd_aabb_union_v、cd_is_point_in_aabb_v 由 collision_detection_scalar.inl 实例化
+
+  /**
+ * @brief 根据中心和长宽构建aabb,无参数检查
+ * @param center 中心
+ * @param length x方向长度
+ * @param width y方向宽度
+ * @return aabb
+ */
+  CD_INLINE CD_AABB cd_create_aabb_v(CD_VEC2 center, CD_F32 length, CD_F32 width)
   {
-    CD_VEC2 lowerBound; // 坐标轴最小值
-    CD_VEC2 upperBound; // 坐标轴最大值
-  } CD_AABB;
+    CD_AABB r;
+    r.lowerBound.x = center.x - length * 0.5f;
+    r.lowerBound.y = center.y - width * 0.5f;
+    r.upperBound.x = center.x + length * 0.5f;
+    r.upperBound.y = center.y + width * 0.5f;
+    return r;
+  }
 
   /**
  * @brief
@@ -37,22 +49,28 @@ extern "C"
     CD_RET ret = CD_RET_OK;
     CD_CHECK_ERROR(center == CD_NULL || result == CD_NULL,
                    COLLISION_DETECTION_E_PARAM_NULL);
-    result->lowerBound.x = center->x - length * 0.5f;
-    result->lowerBound.y = center->y - width * 0.5f;
-    result->upperBound.x = center->x + length * 0.5f;
-    result->upperBound.y = center->y + width * 0.5f;
+    *result = cd_create_aabb_v(*center, length, width);
     return ret;
   }
+  /**
+ * @brief 判断aabb a是否包含aabb b,无参数检查
+ * @param a aabb a
+ * @param b aabb b
+ * @return 1 包含, 0 不包含
+ */
+  CD_INLINE CD_BOOL cd_aabb_contains_v(CD_AABB a, CD_AABB b)
+  {
+    return (a.lowerBound.x <= b.lowerBound.x && a.lowerBound.y <= b.lowerBound.y &&
+            a.upperBound.x >= b.upperBound.x && a.upperBound.y >= b.upperBound.y);
+  }
+
   CD_INLINE CD_RET cd_aabb_contains(const CD_AABB *a, const CD_AABB *b,
                                     CD_BOOL *result)
   {
     CD_RET ret = CD_RET_OK;
     CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL,
                    COLLISION_DETECTION_E_PARAM_NULL);
-    *result = (a->lowerBound.x <= b->lowerBound.x &&
-               a->lowerBound.y <= b->lowerBound.y &&
-               a->upperBound.x >= b->upperBound.x &&
-               a->upperBound.y >= b->upperBound.y);
+    *result = cd_aabb_contains_v(*a, *b);
     return ret;
   }
   /**
@@ -69,20 +87,29 @@ extern "C"
     CD_RET ret = CD_RET_OK;
     CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL,
                    COLLISION_DETECTION_E_PARAM_NULL);
-    *result = (a->lowerBound.x <= b->upperBound.x &&
-               a->upperBound.x >= b->lowerBound.x &&
-               a->lowerBound.y <= b->upperBound.y &&
-               a->upperBound.y >= b->lowerBound.y);
+    *result = cd_aabb_overlap_v(*a, *b);
     return ret;
   }
 
+  /**
+ * @brief 求aabb的中心,无参数检查
+ * @param a aabb
+ * @return 中心
+ */
+  CD_INLINE CD_VEC2 cd_aabb_center_v(CD_AABB a)
+  {
+    CD_VEC2 r;
+    r.x = (a.lowerBound.x + a.upperBound.x) * 0.5f;
+    r.y = (a.lowerBound.y + a.upperBound.y) * 0.5f;
+    return r;
+  }
+
   CD_INLINE CD_RET cd_aabb_center(const CD_AABB *a, CD_VEC2 *result)
   {
     CD_RET ret = CD_RET_OK;
     CD_CHECK_ERROR(a == CD_NULL || result == CD_NULL,
                    COLLISION_DETECTION_E_PARAM_NULL);
-    result->x = (a->lowerBound.x + a->upperBound.x) * 0.5f;
-    result->y = (a->lowerBound.y + a->upperBound.y) * 0.5f;
+    *result = cd_aabb_center_v(*a);
     return ret;
   }
 
@@ -92,10 +119,7 @@ extern "C"
     CD_RET ret = CD_RET_OK;
     CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL,
                    COLLISION_DETECTION_E_PARAM_NULL);
-    result->lowerBound.x = CD_MIN(a->lowerBound.x, b->lowerBound.x);
-    result->lowerBound.y = CD_MIN(a->lowerBound.y, b->lowerBound.y);
-    result->upperBound.x = CD_MAX(a->upperBound.x, b->upperBound.x);
-    result->upperBound.y = CD_MAX(a->upperBound.y, b->upperBound.y);
+    *result = cd_aabb_union_v(*a, *b);
     return ret;
   }
 
@@ -105,8 +129,65 @@ extern "C"
     CD_RET ret = CD_RET_OK;
     CD_CHECK_ERROR(a == CD_NULL || point == CD_NULL || result == CD_NULL,
                    COLLISION_DETECTION_E_PARAM_NULL);
-    *result = (point->x >= a->lowerBound.x && point->x <= a->upperBound.x &&
-               point->y >= a->lowerBound.y && point->y <= a->upperBound.y);
+    *result = cd_is_point_in_aabb_v(*a, *point);
+    return ret;
+  }
+
+  /**
+ * @brief 求aabb的周长,无参数检查
+ * @param a aabb
+ * @return 周长
+ */
+  CD_INLINE CD_F32 cd_aabb_perimeter_v(CD_AABB a)
+  {
+    return 2.0f * ((a.upperBound.x - a.lowerBound.x) + (a.upperBound.y - a.lowerBound.y));
+  }
+
+  /**
+ * @brief 求aabb的周长,二维下作为表面积启发式(SAH)的代价
+ * @param a aabb
+ * @param result 周长
+ * @return ok / 参数异常
+ */
+  CD_INLINE CD_RET cd_aabb_perimeter(const CD_AABB *a, CD_F32 *result)
+  {
+    CD_RET ret = CD_RET_OK;
+    CD_CHECK_ERROR(a == CD_NULL || result == CD_NULL,
+                   COLLISION_DETECTION_E_PARAM_NULL);
+    *result = cd_aabb_perimeter_v(*a);
+    return ret;
+  }
+
+  /**
+ * @brief aabb向四周扩展,无参数检查
+ * @param a aabb
+ * @param margin 扩展量
+ * @return 扩展后的aabb
+ */
+  CD_INLINE CD_AABB cd_aabb_extend_v(CD_AABB a, CD_F32 margin)
+  {
+    CD_AABB r;
+    r.lowerBound.x = a.lowerBound.x - margin;
+    r.lowerBound.y = a.lowerBound.y - margin;
+    r.upperBound.x = a.upperBound.x + margin;
+    r.upperBound.y = a.upperBound.y + margin;
+    return r;
+  }
+
+  /**
+ * @brief aabb向四周扩展
+ * @param a aabb
+ * @param margin 扩展量
+ * @param result 扩展后的aabb
+ * @return ok / 参数异常
+ */
+  CD_INLINE CD_RET cd_aabb_extend(const CD_AABB *a, CD_F32 margin,
+                                  CD_AABB *result)
+  {
+    CD_RET ret = CD_RET_OK;
+    CD_CHECK_ERROR(a == CD_NULL || result == CD_NULL,
+                   COLLISION_DETECTION_E_PARAM_NULL);
+    *result = cd_aabb_extend_v(*a, margin);
     return ret;
   }
 
@@ -0,0 +1,256 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-17 17:25:03
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-17 17:25:03
+ */
+
+#ifndef __COLLISION_DETECTION_ALLOCATOR_H__
+#define __COLLISION_DETECTION_ALLOCATOR_H__
+
+#include <stdint.h>
+#include "collision_detection_type.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+#define CD_ALIGNOF(type) alignof(type)
+#else
+#define CD_ALIGNOF(type) _Alignof(type)
+#endif
+
+#define CD_ARENA_DEFAULT_ALIGN 16 // 默认对齐,满足 SSE 加载
+
+// 从线性分配器中分配 count 个 type,result 为 type** ,按 type 的对齐要求对齐
+#define CD_ARENA_ALLOC_ARRAY(arena, type, count, result) \
+    cd_arena_alloc((arena), (CD_U32)sizeof(type) * (CD_U32)(count), (CD_U32)CD_ALIGNOF(type), (CD_VOID **)(result))
+
+    // 线性分配器: 在调用方提供的一块内存上顺序分配,只能整体或按标记回退,不能单独释放
+    typedef struct _CD_ARENA_
+    {
+        CD_U08 *base;     ///< 内存起始地址
+        CD_U32 capacity;  ///< 内存字节数
+        CD_U32 offset;    ///< 已使用的字节数
+        CD_U32 peak;      ///< offset 的历史最大值,用于确定预分配大小
+    } CD_ARENA;
+
+    // 定长块分配器: 块大小与对齐在初始化时确定,分配与释放均为 O(1)
+    typedef struct _CD_POOL_
+    {
+        CD_U08 *base;        ///< 块存储起始地址
+        CD_U32 blockSize;    ///< 块字节数,已按对齐向上取整
+        CD_S32 capacity;     ///< 块数量
+        CD_S32 bumpIndex;    ///< 从未分配过的第一个块,重置时只需归零
+        CD_VOID *freeList;   ///< 已释放块的链表,链表指针存放在块内
+        CD_S32 count;        ///< 使用中的块数
+    } CD_POOL;
+
+    /**
+     * @brief 判断对齐是否为2的幂,无参数检查
+     * @param align 对齐字节数
+     * @return 1 是, 0 否
+     */
+    CD_INLINE CD_BOOL cd_is_valid_align_v(CD_U32 align)
+    {
+        return align != 0 && (align & (align - 1)) == 0;
+    }
+
+    /**
+     * @brief 初始化线性分配器
+     * @param buffer 调用方提供的内存,生命周期需覆盖分配器的使用
+     * @param capacity 内存字节数
+     * @param arena 线性分配器
+     * @return ok / 参数异常 / 内存为空 / 容量为0
+     */
+    CD_INLINE CD_RET cd_arena_init(CD_VOID *buffer, CD_U32 capacity, CD_ARENA *arena)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(arena == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(buffer == CD_NULL, COLLISION_DETECTION_E_MEM_NULL);
+        CD_CHECK_ERROR(capacity == 0, COLLISION_DETECTION_E_ZERO_NUM);
+        arena->base = (CD_U08 *)buffer;
+        arena->capacity = capacity;
+        arena->offset = 0;
+        arena->peak = 0;
+        return ret;
+    }
+
+    /**
+     * @brief 从线性分配器中分配内存,地址按 align 对齐
+     * @param arena 线性分配器
+     * @param size 字节数
+     * @param align 对齐字节数,必须是2的幂
+     * @param result 分配到的地址
+     * @return ok / 参数异常 / 字节数为0 / 对齐不是2的幂 / 容量不足
+     */
+    CD_INLINE CD_RET cd_arena_alloc(CD_ARENA *arena, CD_U32 size, CD_U32 align, CD_VOID **result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(arena == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(size == 0, COLLISION_DETECTION_E_ZERO_NUM);
+        CD_CHECK_ERROR(!cd_is_valid_align_v(align), COLLISION_DETECTION_E_MEM_ALIGN);
+        // 按实际地址对齐,调用方的内存本身不需要对齐
+        const uintptr_t address = (uintptr_t)(arena->base + arena->offset);
+        const CD_U32 padding = (CD_U32)((align - (address & (align - 1))) & (align - 1));
+        CD_CHECK_ERROR(padding > arena->capacity - arena->offset ||
+                           size > arena->capacity - arena->offset - padding,
+                       COLLISION_DETECTION_E_MEM_FULL);
+        *result = arena->base + arena->offset + padding;
+        arena->offset += padding + size;
+        arena->peak = arena->offset > arena->peak ? arena->offset : arena->peak;
+        return ret;
+    }
+
+    /**
+     * @brief 记录当前的分配位置,配合 cd_arena_rewind_v 释放临时内存,无参数检查
+     * @param arena 线性分配器
+     * @return 分配位置
+     */
+    CD_INLINE CD_U32 cd_arena_mark_v(const CD_ARENA *arena)
+    {
+        return arena->offset;
+    }
+
+    /**
+     * @brief 回退到之前记录的分配位置,之后分配的内存全部失效,无参数检查
+     * @param arena 线性分配器
+     * @param mark cd_arena_mark_v 的返回值,不大于当前位置
+     */
+    CD_INLINE CD_VOID cd_arena_rewind_v(CD_ARENA *arena, CD_U32 mark)
+    {
+        arena->offset = mark < arena->offset ? mark : arena->offset;
+    }
+
+    /**
+     * @brief 清空线性分配器,O(1),所有分配的内存失效,无参数检查
+     * @param arena 线性分配器
+     */
+    CD_INLINE CD_VOID cd_arena_reset_v(CD_ARENA *arena)
+    {
+        arena->offset = 0;
+    }
+
+    /**
+     * @brief 初始化定长块分配器
+     * @param buffer 调用方提供的内存,起始地址需按 align 对齐
+     * @param size 内存字节数
+     * @param blockSize 块字节数,不足一个指针时按指针大小,并按 align 向上取整
+     * @param align 块的对齐字节数,必须是2的幂
+     * @param pool 定长块分配器
+     * @return ok / 参数异常 / 内存为空 / 对齐错误 / 容纳不下一个块
+     */
+    CD_INLINE CD_RET cd_pool_init(CD_VOID *buffer, CD_U32 size, CD_U32 blockSize, CD_U32 align, CD_POOL *pool)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(pool == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(buffer == CD_NULL, COLLISION_DETECTION_E_MEM_NULL);
+        CD_CHECK_ERROR(blockSize == 0, COLLISION_DETECTION_E_ZERO_NUM);
+        CD_CHECK_ERROR(!cd_is_valid_align_v(align) || ((uintptr_t)buffer & (align - 1)) != 0, COLLISION_DETECTION_E_MEM_ALIGN);
+        // 块内需要放下空闲链表指针,且每个块都要满足对齐
+        if (align < (CD_U32)CD_ALIGNOF(CD_VOID *))
+        {
+            align = (CD_U32)CD_ALIGNOF(CD_VOID *);
+            CD_CHECK_ERROR(((uintptr_t)buffer & (align - 1)) != 0, COLLISION_DETECTION_E_MEM_ALIGN);
+        }
+        blockSize = blockSize < (CD_U32)sizeof(CD_VOID *) ? (CD_U32)sizeof(CD_VOID *) : blockSize;
+        blockSize = (blockSize + align - 1) & ~(align - 1);
+        CD_CHECK_ERROR(size / blockSize == 0, COLLISION_DETECTION_E_ZERO_NUM);
+        pool->base = (CD_U08 *)buffer;
+        pool->blockSize = blockSize;
+        pool->capacity = (CD_S32)(size / blockSize);
+        pool->bumpIndex = 0;
+        pool->freeList = CD_NULL;
+        pool->count = 0;
+        return ret;
+    }
+
+    /**
+     * @brief 在线性分配器上初始化定长块分配器
+     * @param arena 线性分配器
+     * @param blockSize 块字节数
+     * @param align 块的对齐字节数,必须是2的幂
+     * @param blockCount 块数量
+     * @param pool 定长块分配器
+     * @return ok / 参数异常 / 对齐错误 / 线性分配器容量不足
+     */
+    CD_INLINE CD_RET cd_pool_init_from_arena(CD_ARENA *arena, CD_U32 blockSize, CD_U32 align, CD_S32 blockCount, CD_POOL *pool)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(arena == CD_NULL || pool == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(blockSize == 0 || blockCount <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        CD_CHECK_ERROR(!cd_is_valid_align_v(align), COLLISION_DETECTION_E_MEM_ALIGN);
+        const CD_U32 ptr_align = (CD_U32)CD_ALIGNOF(CD_VOID *);
+        const CD_U32 block_align = align < ptr_align ? ptr_align : align;
+        CD_U32 block_size = blockSize < (CD_U32)sizeof(CD_VOID *) ? (CD_U32)sizeof(CD_VOID *) : blockSize;
+        block_size = (block_size + block_align - 1) & ~(block_align - 1);
+        CD_CHECK_ERROR((CD_U64)block_size * (CD_U64)blockCount > CD_MAX_U32, COLLISION_DETECTION_E_MEM_FULL);
+        CD_VOID *buffer = CD_NULL;
+        ret = cd_arena_alloc(arena, block_size * (CD_U32)blockCount, block_align, &buffer);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        return cd_pool_init(buffer, block_size * (CD_U32)blockCount, block_size, block_align, pool);
+    }
+
+    /**
+     * @brief 分配一个块,优先复用已释放的块
+     * @param pool 定长块分配器
+     * @param result 块地址
+     * @return ok / 参数异常 / 块已用完
+     */
+    CD_INLINE CD_RET cd_pool_alloc(CD_POOL *pool, CD_VOID **result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(pool == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        if (pool->freeList != CD_NULL)
+        {
+            *result = pool->freeList;
+            pool->freeList = *(CD_VOID **)pool->freeList;
+        }
+        else
+        {
+            CD_CHECK_ERROR(pool->bumpIndex >= pool->capacity, COLLISION_DETECTION_E_MEM_FULL);
+            *result = pool->base + (CD_U32)pool->bumpIndex * pool->blockSize;
+            pool->bumpIndex += 1;
+        }
+        pool->count += 1;
+        return ret;
+    }
+
+    /**
+     * @brief 释放一个块
+     * @param pool 定长块分配器
+     * @param block cd_pool_alloc 分配的块地址
+     * @return ok / 参数异常 / 地址为空 / 地址不是本分配器的块
+     */
+    CD_INLINE CD_RET cd_pool_free(CD_POOL *pool, CD_VOID *block)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(pool == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(block == CD_NULL, COLLISION_DETECTION_E_MEM_NULL);
+        const CD_U08 *p = (const CD_U08 *)block;
+        CD_CHECK_ERROR(p < pool->base || p >= pool->base + (CD_U32)pool->bumpIndex * pool->blockSize ||
+                           (CD_U32)(p - pool->base) % pool->blockSize != 0,
+                       COLLISION_DETECTION_E_MEM_ALIGN);
+        *(CD_VOID **)block = pool->freeList;
+        pool->freeList = block;
+        pool->count -= 1;
+        return ret;
+    }
+
+    /**
+     * @brief 清空定长块分配器,O(1),所有块失效,无参数检查
+     * @param pool 定长块分配器
+     */
+    CD_INLINE CD_VOID cd_pool_reset_v(CD_POOL *pool)
+    {
+        pool->bumpIndex = 0;
+        pool->freeList = CD_NULL;
+        pool->count = 0;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __COLLISION_DETECTION_ALLOCATOR_H__ */
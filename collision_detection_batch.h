@@ -0,0 +1,613 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-16 11:32:08
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-16 11:32:08
+ */
+
+#ifndef __COLLISION_DETECTION_BATCH_H__
+#define __COLLISION_DETECTION_BATCH_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_simd.h"
+#include "collision_detection_obb.h"
+#include "collision_detection_aabb.h"
+#include "collision_detection_segment.h"
+#include "collision_detection_polygon.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define MAX_BATCH_OBBS 16        // 批量点在obb内判断时一次最多的obb数量
+#define CD_AABB_BATCH_CHUNK 256  // 多对多aabb重叠检测时每块的aabb数量
+#define CD_POLYGON_BATCH_TILE 256 // 批量点在多边形内判断时每块的点数,需为32的倍数
+#define CD_POLYGON_BATCH_EDGES 16 // 批量点在多边形内判断时每次预计算的边数
+
+    // 批量点在obb内判断时每个obb的预计算参数
+    typedef struct _CD_OBB_BATCH_PARAM_
+    {
+        CD_F32 cx; // 中心x
+        CD_F32 cy; // 中心y
+        CD_F32 c;  // 旋转cos
+        CD_F32 s;  // 旋转sin
+        CD_F32 hl; // 半长 + CD_EPS
+        CD_F32 hw; // 半宽 + CD_EPS
+    } CD_OBB_BATCH_PARAM;
+
+    /**
+     * @brief 批量判断点是否在obb内,SoA输入,与 cd_is_point_in_obb 判定结果一致
+     *        (编译器开启乘加融合 -ffp-contract=fast 时边界上的点可能相差1ulp)
+     *        点在任意一个obb内即视为在内,内层循环无分支、无逐点的参数检查
+     * @param xs 点的x坐标数组
+     * @param ys 点的y坐标数组
+     * @param count 点的数量
+     * @param obbs obb数组
+     * @param obb_count obb数量,不超过 MAX_BATCH_OBBS
+     * @param mask 输出位掩码,第i个点对应 mask[i / 32] 的第 i % 32 位,长度为 (count + 31) / 32,可为null
+     * @param result_count 在obb内的点的数量,可为null
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_points_in_obbs_batch(const CD_F32 *xs, const CD_F32 *ys, CD_S32 count,
+                                             const CD_OBB *obbs, CD_S32 obb_count,
+                                             CD_U32 *mask, CD_S32 *result_count)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(xs == CD_NULL || ys == CD_NULL || obbs == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(mask == CD_NULL && result_count == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(count < 0 || obb_count <= 0 || obb_count > MAX_BATCH_OBBS, COLLISION_DETECTION_E_ZERO_NUM);
+
+        CD_OBB_BATCH_PARAM params[MAX_BATCH_OBBS];
+        for (CD_S32 k = 0; k < obb_count; ++k)
+        {
+            params[k].cx = obbs[k].center.x;
+            params[k].cy = obbs[k].center.y;
+            params[k].c = obbs[k].q.c;
+            params[k].s = obbs[k].q.s;
+            params[k].hl = obbs[k].length * 0.5f + CD_EPS;
+            params[k].hw = obbs[k].width * 0.5f + CD_EPS;
+        }
+
+        const CD_S32 word_count = mask != CD_NULL ? (count + 31) / 32 : 0;
+        for (CD_S32 w = 0; w < word_count; ++w)
+        {
+            mask[w] = 0;
+        }
+
+        CD_S32 inside_count = 0;
+        CD_S32 i = 0;
+#if defined(CD_SIMD_AVX2)
+        const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 px = _mm256_loadu_ps(xs + i);
+            const __m256 py = _mm256_loadu_ps(ys + i);
+            __m256 inside = _mm256_setzero_ps();
+            for (CD_S32 k = 0; k < obb_count; ++k)
+            {
+                const __m256 c = _mm256_set1_ps(params[k].c);
+                const __m256 s = _mm256_set1_ps(params[k].s);
+                const __m256 x0 = _mm256_sub_ps(px, _mm256_set1_ps(params[k].cx));
+                const __m256 y0 = _mm256_sub_ps(py, _mm256_set1_ps(params[k].cy));
+                const __m256 dx = _mm256_andnot_ps(sign_mask, _mm256_add_ps(_mm256_mul_ps(x0, c), _mm256_mul_ps(y0, s)));
+                const __m256 dy = _mm256_andnot_ps(sign_mask, _mm256_sub_ps(_mm256_mul_ps(y0, c), _mm256_mul_ps(x0, s)));
+                const __m256 in_x = _mm256_cmp_ps(dx, _mm256_set1_ps(params[k].hl), _CMP_LE_OQ);
+                const __m256 in_y = _mm256_cmp_ps(dy, _mm256_set1_ps(params[k].hw), _CMP_LE_OQ);
+                inside = _mm256_or_ps(inside, _mm256_and_ps(in_x, in_y));
+            }
+            const CD_U32 bits = (CD_U32)_mm256_movemask_ps(inside);
+            if (mask != CD_NULL)
+            {
+                mask[i >> 5] |= bits << (i & 31);
+            }
+            inside_count += cd_popcount32(bits);
+        }
+#elif defined(CD_SIMD_SSE2)
+        const __m128 sign_mask = _mm_set1_ps(-0.0f);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 px = _mm_loadu_ps(xs + i);
+            const __m128 py = _mm_loadu_ps(ys + i);
+            __m128 inside = _mm_setzero_ps();
+            for (CD_S32 k = 0; k < obb_count; ++k)
+            {
+                const __m128 c = _mm_set1_ps(params[k].c);
+                const __m128 s = _mm_set1_ps(params[k].s);
+                const __m128 x0 = _mm_sub_ps(px, _mm_set1_ps(params[k].cx));
+                const __m128 y0 = _mm_sub_ps(py, _mm_set1_ps(params[k].cy));
+                const __m128 dx = _mm_andnot_ps(sign_mask, _mm_add_ps(_mm_mul_ps(x0, c), _mm_mul_ps(y0, s)));
+                const __m128 dy = _mm_andnot_ps(sign_mask, _mm_sub_ps(_mm_mul_ps(y0, c), _mm_mul_ps(x0, s)));
+                const __m128 in_x = _mm_cmple_ps(dx, _mm_set1_ps(params[k].hl));
+                const __m128 in_y = _mm_cmple_ps(dy, _mm_set1_ps(params[k].hw));
+                inside = _mm_or_ps(inside, _mm_and_ps(in_x, in_y));
+            }
+            const CD_U32 bits = (CD_U32)_mm_movemask_ps(inside);
+            if (mask != CD_NULL)
+            {
+                mask[i >> 5] |= bits << (i & 31);
+            }
+            inside_count += cd_popcount32(bits);
+        }
+#endif
+        // 标量实现,同时处理SIMD剩余的点
+        for (; i < count; ++i)
+        {
+            CD_U32 inside = 0;
+            for (CD_S32 k = 0; k < obb_count; ++k)
+            {
+                const CD_F32 x0 = xs[i] - params[k].cx;
+                const CD_F32 y0 = ys[i] - params[k].cy;
+                const CD_F32 dx = CD_FABS(x0 * params[k].c + y0 * params[k].s);
+                const CD_F32 dy = CD_FABS(y0 * params[k].c - x0 * params[k].s);
+                inside |= (CD_U32)((dx <= params[k].hl) & (dy <= params[k].hw));
+            }
+            if (mask != CD_NULL)
+            {
+                mask[i >> 5] |= inside << (i & 31);
+            }
+            inside_count += (CD_S32)inside;
+        }
+
+        if (result_count != CD_NULL)
+        {
+            *result_count = inside_count;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 批量判断点是否在单个obb内
+     * @param xs 点的x坐标数组
+     * @param ys 点的y坐标数组
+     * @param count 点的数量
+     * @param obb obb
+     * @param mask 输出位掩码,长度为 (count + 31) / 32,可为null
+     * @param result_count 在obb内的点的数量,可为null
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_points_in_obb_batch(const CD_F32 *xs, const CD_F32 *ys, CD_S32 count,
+                                            const CD_OBB *obb, CD_U32 *mask, CD_S32 *result_count)
+    {
+        return cd_points_in_obbs_batch(xs, ys, count, obb, 1, mask, result_count);
+    }
+
+    /**
+     * @brief 批量判断点是否在外扩 radius 后的凸多边形内,SoA输入,与 cd_point_in_polygon_view_v 判定结果一致
+     *        (编译器开启乘加融合 -ffp-contract=fast 时边界上的点可能相差1ulp)
+     *        点按 CD_POLYGON_BATCH_TILE 分块,每块对各边半平面(每次预计算 CD_POLYGON_BATCH_EDGES 条边)
+     *        求最大分离量,内层循环无分支,顶点数不受限制;
+     *        只有分离量落在 (0, radius] 之间的点才回退到逐点的圆角距离计算
+     * @param xs 点的x坐标数组
+     * @param ys 点的y坐标数组
+     * @param count 点的数量
+     * @param polygon 凸多边形视图,逆时针,需已填好 normals
+     * @param radius 外扩距离, 0 表示不外扩
+     * @param mask 输出位掩码,第i个点对应 mask[i / 32] 的第 i % 32 位,长度为 (count + 31) / 32,可为null
+     * @param result_count 在多边形内的点的数量,可为null
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_points_in_polygon_view_batch(const CD_F32 *xs, const CD_F32 *ys, CD_S32 count,
+                                                     const CD_POLYGON_VIEW *polygon, CD_F32 radius,
+                                                     CD_U32 *mask, CD_S32 *result_count)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(xs == CD_NULL || ys == CD_NULL || polygon == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(polygon->vertices == CD_NULL || polygon->normals == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(mask == CD_NULL && result_count == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(count < 0 || polygon->count < 3, COLLISION_DETECTION_E_ZERO_NUM);
+
+        const CD_S32 edge_count = polygon->count;
+        const CD_F32 inner = CD_EPS;
+        const CD_F32 outer = CD_MAX(radius, 0.0f) + CD_EPS;
+
+        CD_F32 separations[CD_POLYGON_BATCH_TILE];
+        CD_F32 nxs[CD_POLYGON_BATCH_EDGES];
+        CD_F32 nys[CD_POLYGON_BATCH_EDGES];
+        CD_F32 offsets[CD_POLYGON_BATCH_EDGES];
+        CD_S32 inside_count = 0;
+        for (CD_S32 start = 0; start < count; start += CD_POLYGON_BATCH_TILE)
+        {
+            const CD_S32 n = CD_MIN(CD_POLYGON_BATCH_TILE, count - start);
+            const CD_F32 *px_tile = xs + start;
+            const CD_F32 *py_tile = ys + start;
+            for (CD_S32 i = 0; i < n; ++i)
+            {
+                separations[i] = -CD_MAXABS_F;
+            }
+            for (CD_S32 e = 0; e < edge_count; e += CD_POLYGON_BATCH_EDGES)
+            {
+                // 各边的半平面 nx * x + ny * y - offset <= 0
+                const CD_S32 ne = CD_MIN(CD_POLYGON_BATCH_EDGES, edge_count - e);
+                for (CD_S32 k = 0; k < ne; ++k)
+                {
+                    nxs[k] = polygon->normals[e + k].x;
+                    nys[k] = polygon->normals[e + k].y;
+                    offsets[k] = nxs[k] * polygon->vertices[e + k].x + nys[k] * polygon->vertices[e + k].y;
+                }
+                CD_S32 i = 0;
+#if defined(CD_SIMD_AVX2)
+                for (; i + 8 <= n; i += 8)
+                {
+                    const __m256 px = _mm256_loadu_ps(px_tile + i);
+                    const __m256 py = _mm256_loadu_ps(py_tile + i);
+                    __m256 separation = _mm256_loadu_ps(separations + i);
+                    for (CD_S32 k = 0; k < ne; ++k)
+                    {
+                        const __m256 d = _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(nxs[k]), px),
+                                                                     _mm256_mul_ps(_mm256_set1_ps(nys[k]), py)),
+                                                       _mm256_set1_ps(offsets[k]));
+                        separation = _mm256_max_ps(separation, d);
+                    }
+                    _mm256_storeu_ps(separations + i, separation);
+                }
+#elif defined(CD_SIMD_SSE2)
+                for (; i + 4 <= n; i += 4)
+                {
+                    const __m128 px = _mm_loadu_ps(px_tile + i);
+                    const __m128 py = _mm_loadu_ps(py_tile + i);
+                    __m128 separation = _mm_loadu_ps(separations + i);
+                    for (CD_S32 k = 0; k < ne; ++k)
+                    {
+                        const __m128 d = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(nxs[k]), px),
+                                                               _mm_mul_ps(_mm_set1_ps(nys[k]), py)),
+                                                    _mm_set1_ps(offsets[k]));
+                        separation = _mm_max_ps(separation, d);
+                    }
+                    _mm_storeu_ps(separations + i, separation);
+                }
+#endif
+                // 标量实现,同时处理SIMD剩余的点
+                for (; i < n; ++i)
+                {
+                    CD_F32 separation = separations[i];
+                    for (CD_S32 k = 0; k < ne; ++k)
+                    {
+                        separation = CD_MAX(separation, nxs[k] * px_tile[i] + nys[k] * py_tile[i] - offsets[k]);
+                    }
+                    separations[i] = separation;
+                }
+            }
+
+            // 分块大小是32的倍数,每32个点组成掩码的一个字
+            for (CD_S32 w = 0; w < n; w += 32)
+            {
+                const CD_S32 wn = CD_MIN(32, n - w);
+                CD_U32 bits = 0;
+                CD_U32 band = 0;
+                CD_S32 i = 0;
+#if defined(CD_SIMD_AVX2)
+                for (; i + 8 <= wn; i += 8)
+                {
+                    const __m256 separation = _mm256_loadu_ps(separations + w + i);
+                    bits |= (CD_U32)_mm256_movemask_ps(_mm256_cmp_ps(separation, _mm256_set1_ps(inner), _CMP_LE_OQ)) << i;
+                    band |= (CD_U32)_mm256_movemask_ps(_mm256_cmp_ps(separation, _mm256_set1_ps(outer), _CMP_LE_OQ)) << i;
+                }
+#elif defined(CD_SIMD_SSE2)
+                for (; i + 4 <= wn; i += 4)
+                {
+                    const __m128 separation = _mm_loadu_ps(separations + w + i);
+                    bits |= (CD_U32)_mm_movemask_ps(_mm_cmple_ps(separation, _mm_set1_ps(inner))) << i;
+                    band |= (CD_U32)_mm_movemask_ps(_mm_cmple_ps(separation, _mm_set1_ps(outer))) << i;
+                }
+#endif
+                for (; i < wn; ++i)
+                {
+                    bits |= (CD_U32)(separations[w + i] <= inner) << i;
+                    band |= (CD_U32)(separations[w + i] <= outer) << i;
+                }
+                band &= ~bits;
+                while (band != 0)
+                {
+                    const CD_S32 j = cd_ctz32(band);
+                    band &= band - 1;
+                    bits |= (CD_U32)cd_point_near_polygon_v(polygon, cd_vec2_make_v(px_tile[w + j], py_tile[w + j]), radius) << j;
+                }
+                if (mask != CD_NULL)
+                {
+                    mask[(start + w) >> 5] = bits;
+                }
+                inside_count += cd_popcount32(bits);
+            }
+        }
+
+        if (result_count != CD_NULL)
+        {
+            *result_count = inside_count;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 批量判断点是否在外扩 radius 后的凸多边形内,SoA输入,与 cd_point_in_polygon_v 判定结果一致
+     * @param xs 点的x坐标数组
+     * @param ys 点的y坐标数组
+     * @param count 点的数量
+     * @param polygon 凸多边形,逆时针,需已填好 normals
+     * @param radius 外扩距离, 0 表示不外扩
+     * @param mask 输出位掩码,长度为 (count + 31) / 32,可为null
+     * @param result_count 在多边形内的点的数量,可为null
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_points_in_polygon_batch(const CD_F32 *xs, const CD_F32 *ys, CD_S32 count,
+                                                const CD_POLYGON *polygon, CD_F32 radius,
+                                                CD_U32 *mask, CD_S32 *result_count)
+    {
+        CD_CHECK_ERROR(polygon == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_POLYGON_VIEW view = cd_polygon_view_v(polygon);
+        return cd_points_in_polygon_view_batch(xs, ys, count, &view, radius, mask, result_count);
+    }
+
+    // SoA存储的aabb数组
+    typedef struct _CD_AABB_SOA_
+    {
+        CD_F32 *lowerX; // 最小值x
+        CD_F32 *lowerY; // 最小值y
+        CD_F32 *upperX; // 最大值x
+        CD_F32 *upperY; // 最大值y
+        CD_S32 count;   // aabb数量
+    } CD_AABB_SOA;
+
+    // 一对索引
+    typedef struct _CD_INDEX_PAIR_
+    {
+        CD_S32 indexA;
+        CD_S32 indexB;
+    } CD_INDEX_PAIR;
+
+    /**
+     * @brief 写入SoA数组中的一个aabb
+     * @param soa SoA数组
+     * @param index 下标
+     * @param aabb aabb
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_aabb_soa_set(CD_AABB_SOA *soa, CD_S32 index, const CD_AABB *aabb)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(soa == CD_NULL || aabb == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(index < 0 || index >= soa->count, COLLISION_DETECTION_E_PARAM_NULL);
+        soa->lowerX[index] = aabb->lowerBound.x;
+        soa->lowerY[index] = aabb->lowerBound.y;
+        soa->upperX[index] = aabb->upperBound.x;
+        soa->upperY[index] = aabb->upperBound.y;
+        return ret;
+    }
+
+    /**
+     * @brief 一个aabb与SoA数组中所有aabb做重叠检测,输出重叠的下标,判定与 cd_aabb_overlap 一致(边界相接视为重叠)
+     * @param query 查询的aabb
+     * @param boxes SoA数组
+     * @param result_indices 输出重叠的下标,按升序排列
+     * @param capacity result_indices 的容量
+     * @param result_count 重叠的数量
+     * @return ok / 参数异常 / 结果超过容量(已输出前 capacity 个)
+     */
+    CD_INLINE CD_RET cd_aabb_overlap_batch(const CD_AABB *query, const CD_AABB_SOA *boxes,
+                                           CD_S32 *result_indices, CD_S32 capacity, CD_S32 *result_count)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(query == CD_NULL || boxes == CD_NULL || result_indices == CD_NULL || result_count == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(boxes->lowerX == CD_NULL || boxes->lowerY == CD_NULL || boxes->upperX == CD_NULL || boxes->upperY == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_S32 count = boxes->count;
+        CD_S32 hit_count = 0;
+        CD_S32 i = 0;
+#if defined(CD_SIMD_AVX2)
+        const __m256 q_lower_x = _mm256_set1_ps(query->lowerBound.x);
+        const __m256 q_lower_y = _mm256_set1_ps(query->lowerBound.y);
+        const __m256 q_upper_x = _mm256_set1_ps(query->upperBound.x);
+        const __m256 q_upper_y = _mm256_set1_ps(query->upperBound.y);
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 ox = _mm256_and_ps(_mm256_cmp_ps(q_lower_x, _mm256_loadu_ps(boxes->upperX + i), _CMP_LE_OQ),
+                                            _mm256_cmp_ps(q_upper_x, _mm256_loadu_ps(boxes->lowerX + i), _CMP_GE_OQ));
+            const __m256 oy = _mm256_and_ps(_mm256_cmp_ps(q_lower_y, _mm256_loadu_ps(boxes->upperY + i), _CMP_LE_OQ),
+                                            _mm256_cmp_ps(q_upper_y, _mm256_loadu_ps(boxes->lowerY + i), _CMP_GE_OQ));
+            CD_U32 bits = (CD_U32)_mm256_movemask_ps(_mm256_and_ps(ox, oy));
+            // 只在命中时写出
+            while (bits != 0)
+            {
+                *result_count = hit_count;
+                CD_CHECK_ERROR(hit_count >= capacity, COLLISION_DETECTION_E_MEM_FULL);
+                result_indices[hit_count++] = i + cd_ctz32(bits);
+                bits &= bits - 1;
+            }
+        }
+#elif defined(CD_SIMD_SSE2)
+        const __m128 q_lower_x = _mm_set1_ps(query->lowerBound.x);
+        const __m128 q_lower_y = _mm_set1_ps(query->lowerBound.y);
+        const __m128 q_upper_x = _mm_set1_ps(query->upperBound.x);
+        const __m128 q_upper_y = _mm_set1_ps(query->upperBound.y);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 ox = _mm_and_ps(_mm_cmple_ps(q_lower_x, _mm_loadu_ps(boxes->upperX + i)),
+                                         _mm_cmpge_ps(q_upper_x, _mm_loadu_ps(boxes->lowerX + i)));
+            const __m128 oy = _mm_and_ps(_mm_cmple_ps(q_lower_y, _mm_loadu_ps(boxes->upperY + i)),
+                                         _mm_cmpge_ps(q_upper_y, _mm_loadu_ps(boxes->lowerY + i)));
+            CD_U32 bits = (CD_U32)_mm_movemask_ps(_mm_and_ps(ox, oy));
+            while (bits != 0)
+            {
+                *result_count = hit_count;
+                CD_CHECK_ERROR(hit_count >= capacity, COLLISION_DETECTION_E_MEM_FULL);
+                result_indices[hit_count++] = i + cd_ctz32(bits);
+                bits &= bits - 1;
+            }
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            const CD_BOOL overlap = (query->lowerBound.x <= boxes->upperX[i]) & (query->upperBound.x >= boxes->lowerX[i]) &
+                                    (query->lowerBound.y <= boxes->upperY[i]) & (query->upperBound.y >= boxes->lowerY[i]);
+            if (overlap)
+            {
+                *result_count = hit_count;
+                CD_CHECK_ERROR(hit_count >= capacity, COLLISION_DETECTION_E_MEM_FULL);
+                result_indices[hit_count++] = i;
+            }
+        }
+        *result_count = hit_count;
+        return ret;
+    }
+
+    /**
+     * @brief 两组aabb两两做重叠检测,输出重叠的下标对
+     * @param queries 查询的aabb数组
+     * @param query_count 查询的aabb数量
+     * @param boxes SoA数组
+     * @param result_pairs 输出重叠的下标对,indexA 为 queries 的下标, indexB 为 boxes 的下标
+     * @param capacity result_pairs 的容量
+     * @param result_count 重叠对的数量
+     * @return ok / 参数异常 / 结果超过容量(已输出前 capacity 个)
+     */
+    CD_INLINE CD_RET cd_aabbs_overlap_batch(const CD_AABB *queries, CD_S32 query_count, const CD_AABB_SOA *boxes,
+                                            CD_INDEX_PAIR *result_pairs, CD_S32 capacity, CD_S32 *result_count)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(queries == CD_NULL || boxes == CD_NULL || result_pairs == CD_NULL || result_count == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(boxes->lowerX == CD_NULL || boxes->lowerY == CD_NULL || boxes->upperX == CD_NULL || boxes->upperY == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(capacity < 0, COLLISION_DETECTION_E_ZERO_NUM);
+        *result_count = 0;
+        // 按块处理,每块的命中下标先写入栈上的缓冲区
+        CD_S32 indices[CD_AABB_BATCH_CHUNK];
+        for (CD_S32 start = 0; start < boxes->count; start += CD_AABB_BATCH_CHUNK)
+        {
+            CD_AABB_SOA chunk;
+            chunk.lowerX = boxes->lowerX + start;
+            chunk.lowerY = boxes->lowerY + start;
+            chunk.upperX = boxes->upperX + start;
+            chunk.upperY = boxes->upperY + start;
+            chunk.count = CD_MIN(boxes->count - start, CD_AABB_BATCH_CHUNK);
+            for (CD_S32 q = 0; q < query_count; ++q)
+            {
+                CD_S32 hit_count = 0;
+                ret = cd_aabb_overlap_batch(queries + q, &chunk, indices, CD_AABB_BATCH_CHUNK, &hit_count);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                // 超过容量时与单查询版本一致: 先填满 capacity 个再返回
+                const CD_S32 write_count = CD_MIN(hit_count, capacity - *result_count);
+                for (CD_S32 k = 0; k < write_count; ++k)
+                {
+                    result_pairs[*result_count + k].indexA = q;
+                    result_pairs[*result_count + k].indexB = start + indices[k];
+                }
+                *result_count += write_count;
+                CD_CHECK_ERROR(write_count < hit_count, COLLISION_DETECTION_E_MEM_FULL);
+            }
+        }
+        return ret;
+    }
+
+    // SoA存储的线段数组
+    typedef struct _CD_SEGMENT_SOA_
+    {
+        CD_F32 *x1;   // 起点x
+        CD_F32 *y1;   // 起点y
+        CD_F32 *x2;   // 终点x
+        CD_F32 *y2;   // 终点y
+        CD_S32 count; // 线段数量
+    } CD_SEGMENT_SOA;
+
+    /**
+     * @brief 一条线段与折线做相交检测
+     * @param seg 线段
+     * @param points 折线的点,第i段为 points[i] 到 points[i + 1]
+     * @param point_count 折线的点数
+     * @param first_only 1 只输出第一个交点(折线顺序), 0 输出所有交点
+     * @param hit_indices 相交的折线段下标
+     * @param hit_points 交点,可为null
+     * @param capacity hit_indices / hit_points 的容量
+     * @param result_count 交点数量
+     * @return ok / 参数异常 / 结果超过容量(已输出前 capacity 个)
+     */
+    CD_INLINE CD_RET cd_segment_polyline_intersect(const CD_SEGMENT *seg, const CD_VEC2 *points, CD_S32 point_count,
+                                                   CD_BOOL first_only, CD_S32 *hit_indices, CD_VEC2 *hit_points,
+                                                   CD_S32 capacity, CD_S32 *result_count)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(seg == CD_NULL || points == CD_NULL || hit_indices == CD_NULL || result_count == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        *result_count = 0;
+        const CD_F32 x1 = seg->point1.x;
+        const CD_F32 y1 = seg->point1.y;
+        const CD_F32 x2 = seg->point2.x;
+        const CD_F32 y2 = seg->point2.y;
+        CD_VEC2 hit;
+        for (CD_S32 i = 0; i + 1 < point_count; ++i)
+        {
+            if (!cd_segments_intersect_core(x1, y1, x2, y2, points[i].x, points[i].y, points[i + 1].x, points[i + 1].y,
+                                            hit_points != CD_NULL ? &hit : CD_NULL))
+            {
+                continue;
+            }
+            CD_CHECK_ERROR(*result_count >= capacity, COLLISION_DETECTION_E_MEM_FULL);
+            hit_indices[*result_count] = i;
+            if (hit_points != CD_NULL)
+            {
+                hit_points[*result_count] = hit;
+            }
+            *result_count += 1;
+            if (first_only)
+            {
+                break;
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 一条线段与SoA线段数组做相交检测
+     * @param seg 线段
+     * @param segs SoA线段数组
+     * @param first_only 1 只输出第一个交点(数组顺序), 0 输出所有交点
+     * @param hit_indices 相交的线段下标
+     * @param hit_points 交点,可为null
+     * @param capacity hit_indices / hit_points 的容量
+     * @param result_count 交点数量
+     * @return ok / 参数异常 / 结果超过容量(已输出前 capacity 个)
+     */
+    CD_INLINE CD_RET cd_segment_soa_intersect(const CD_SEGMENT *seg, const CD_SEGMENT_SOA *segs,
+                                              CD_BOOL first_only, CD_S32 *hit_indices, CD_VEC2 *hit_points,
+                                              CD_S32 capacity, CD_S32 *result_count)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(seg == CD_NULL || segs == CD_NULL || hit_indices == CD_NULL || result_count == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(segs->x1 == CD_NULL || segs->y1 == CD_NULL || segs->x2 == CD_NULL || segs->y2 == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        *result_count = 0;
+        const CD_F32 x1 = seg->point1.x;
+        const CD_F32 y1 = seg->point1.y;
+        const CD_F32 x2 = seg->point2.x;
+        const CD_F32 y2 = seg->point2.y;
+        CD_VEC2 hit;
+        for (CD_S32 i = 0; i < segs->count; ++i)
+        {
+            if (!cd_segments_intersect_core(x1, y1, x2, y2, segs->x1[i], segs->y1[i], segs->x2[i], segs->y2[i],
+                                            hit_points != CD_NULL ? &hit : CD_NULL))
+            {
+                continue;
+            }
+            CD_CHECK_ERROR(*result_count >= capacity, COLLISION_DETECTION_E_MEM_FULL);
+            hit_indices[*result_count] = i;
+            if (hit_points != CD_NULL)
+            {
+                hit_points[*result_count] = hit;
+            }
+            *result_count += 1;
+            if (first_only)
+            {
+                break;
+            }
+        }
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __COLLISION_DETECTION_BATCH_H__ */
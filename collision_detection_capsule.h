@@ -0,0 +1,451 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-19 16:40:52
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-19 16:40:52
+ */
+
+#ifndef __COLLISION_DETECTION_CAPSULE_H__
+#define __COLLISION_DETECTION_CAPSULE_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_vec2.h"
+#include "collision_detection_segment.h"
+#include "collision_detection_circle.h"
+#include "collision_detection_aabb.h"
+#include "collision_detection_obb.h"
+#include "collision_detection_polygon.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // 胶囊体: 线段外扩 radius,即圆沿线段扫过的区域
+    typedef struct _CD_CAPSULE_
+    {
+        CD_SEGMENT seg; ///< 中轴线段
+        CD_F32 radius;  ///< 半径
+    } CD_CAPSULE;
+
+    // 两条线段之间的最近点
+    typedef struct _CD_SEGMENT_DISTANCE_RESULT_
+    {
+        CD_VEC2 closest1;      ///< 线段1上的最近点
+        CD_VEC2 closest2;      ///< 线段2上的最近点
+        CD_F32 fraction1;      ///< closest1 在线段1上的比例,[0, 1]
+        CD_F32 fraction2;      ///< closest2 在线段2上的比例,[0, 1]
+        CD_F32 distanceSquared; ///< 最近点距离的平方
+    } CD_SEGMENT_DISTANCE_RESULT;
+
+    /**
+     * @brief 构建胶囊体,无参数检查
+     * @param point1 中轴起点
+     * @param point2 中轴终点
+     * @param radius 半径
+     * @return 胶囊体
+     */
+    CD_INLINE CD_CAPSULE cd_create_capsule_v(CD_VEC2 point1, CD_VEC2 point2, CD_F32 radius)
+    {
+        CD_CAPSULE r;
+        r.seg.point1 = point1;
+        r.seg.point2 = point2;
+        r.radius = radius;
+        return r;
+    }
+
+    /**
+     * @brief 构建胶囊体
+     * @param point1 中轴起点
+     * @param point2 中轴终点
+     * @param radius 半径,不能为负
+     * @param result 胶囊体
+     * @return ok / 参数异常 / 半径为负
+     */
+    CD_INLINE CD_RET cd_create_capsule(const CD_VEC2 *point1, const CD_VEC2 *point2, CD_F32 radius, CD_CAPSULE *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(point1 == CD_NULL || point2 == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(radius < 0.0f, COLLISION_DETECTION_E_CALC_ERROR);
+        *result = cd_create_capsule_v(*point1, *point2, radius);
+        return ret;
+    }
+
+    /**
+     * @brief 圆沿直线平移扫过的区域,用于一段直线轨迹的包络,无参数检查
+     * @param circle 起始位置的圆
+     * @param translation 平移量
+     * @return 胶囊体
+     */
+    CD_INLINE CD_CAPSULE cd_swept_circle_capsule_v(CD_CIRCLE circle, CD_VEC2 translation)
+    {
+        return cd_create_capsule_v(circle.center, cd_vec2_add_v(circle.center, translation), circle.radius);
+    }
+
+    /**
+     * @brief 胶囊体的aabb,无参数检查
+     * @param capsule 胶囊体
+     * @return aabb
+     */
+    CD_INLINE CD_AABB cd_capsule_to_aabb_v(CD_CAPSULE capsule)
+    {
+        CD_AABB r;
+        r.lowerBound = cd_vec2_min_v(capsule.seg.point1, capsule.seg.point2);
+        r.upperBound = cd_vec2_max_v(capsule.seg.point1, capsule.seg.point2);
+        return cd_aabb_extend_v(r, capsule.radius);
+    }
+
+    /**
+     * @brief 胶囊体的aabb
+     * @param capsule 胶囊体
+     * @param result aabb
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_capsule_to_aabb(const CD_CAPSULE *capsule, CD_AABB *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(capsule == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_capsule_to_aabb_v(*capsule);
+        return ret;
+    }
+
+    /**
+     * @brief 闭式求两条线段之间的最近点,无参数检查
+     *        先求两条直线的最近点参数并限制到线段1上,再求线段2上的对应参数,超出 [0, 1] 时限制后回代线段1;
+     *        退化成点的线段按点处理
+     * @param seg1 线段1
+     * @param seg2 线段2
+     * @return 最近点、比例与距离平方
+     */
+    CD_INLINE CD_SEGMENT_DISTANCE_RESULT cd_segments_distance_v(CD_SEGMENT seg1, CD_SEGMENT seg2)
+    {
+        CD_SEGMENT_DISTANCE_RESULT r;
+        const CD_VEC2 d1 = cd_vec2_sub_v(seg1.point2, seg1.point1);
+        const CD_VEC2 d2 = cd_vec2_sub_v(seg2.point2, seg2.point1);
+        const CD_VEC2 w = cd_vec2_sub_v(seg1.point1, seg2.point1);
+        const CD_F32 dd1 = cd_vec2_dot_v(d1, d1);
+        const CD_F32 dd2 = cd_vec2_dot_v(d2, d2);
+        const CD_F32 rd1 = cd_vec2_dot_v(w, d1);
+        const CD_F32 rd2 = cd_vec2_dot_v(w, d2);
+        const CD_F32 eps_sqr = CD_EPS * CD_EPS;
+        CD_F32 f1 = 0.0f;
+        CD_F32 f2 = 0.0f;
+
+        if (dd1 < eps_sqr || dd2 < eps_sqr)
+        {
+            if (dd1 >= eps_sqr)
+            {
+                f1 = CD_CLIP(-rd1 / dd1, 0.0f, 1.0f);
+            }
+            else if (dd2 >= eps_sqr)
+            {
+                f2 = CD_CLIP(rd2 / dd2, 0.0f, 1.0f);
+            }
+        }
+        else
+        {
+            const CD_F32 d12 = cd_vec2_dot_v(d1, d2);
+            const CD_F32 denom = dd1 * dd2 - d12 * d12;
+            // 平行时 denom 为0,任取线段1的起点
+            if (denom != 0.0f)
+            {
+                f1 = CD_CLIP((d12 * rd2 - rd1 * dd2) / denom, 0.0f, 1.0f);
+            }
+            f2 = (d12 * f1 + rd2) / dd2;
+            if (f2 < 0.0f)
+            {
+                f2 = 0.0f;
+                f1 = CD_CLIP(-rd1 / dd1, 0.0f, 1.0f);
+            }
+            else if (f2 > 1.0f)
+            {
+                f2 = 1.0f;
+                f1 = CD_CLIP((d12 - rd1) / dd1, 0.0f, 1.0f);
+            }
+        }
+
+        r.closest1 = cd_vec2_mul_add_v(seg1.point1, f1, d1);
+        r.closest2 = cd_vec2_mul_add_v(seg2.point1, f2, d2);
+        r.fraction1 = f1;
+        r.fraction2 = f2;
+        r.distanceSquared = cd_vec2_dis_sqr_v(r.closest1, r.closest2);
+        return r;
+    }
+
+    /**
+     * @brief 闭式求两条线段之间的最近点
+     * @param seg1 线段1
+     * @param seg2 线段2
+     * @param result 最近点、比例与距离平方
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_segments_distance(const CD_SEGMENT *seg1, const CD_SEGMENT *seg2, CD_SEGMENT_DISTANCE_RESULT *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(seg1 == CD_NULL || seg2 == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_segments_distance_v(*seg1, *seg2);
+        return ret;
+    }
+
+    /**
+     * @brief 判断两个胶囊体是否重叠(含边界接触),无参数检查
+     * @param a 胶囊体a
+     * @param b 胶囊体b
+     * @return 1 重叠, 0 不重叠
+     */
+    CD_INLINE CD_BOOL cd_capsules_overlap_v(CD_CAPSULE a, CD_CAPSULE b)
+    {
+        const CD_F32 radius = a.radius + b.radius;
+        return cd_segments_distance_v(a.seg, b.seg).distanceSquared <= radius * radius;
+    }
+
+    /**
+     * @brief 判断两个胶囊体是否重叠(含边界接触)
+     * @param a 胶囊体a
+     * @param b 胶囊体b
+     * @param result 1 重叠, 0 不重叠
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_capsules_overlap(const CD_CAPSULE *a, const CD_CAPSULE *b, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_capsules_overlap_v(*a, *b);
+        return ret;
+    }
+
+    /**
+     * @brief 两个胶囊体表面之间的距离,重叠时为0,无参数检查
+     * @param a 胶囊体a
+     * @param b 胶囊体b
+     * @return 距离
+     */
+    CD_INLINE CD_F32 cd_capsules_distance_v(CD_CAPSULE a, CD_CAPSULE b)
+    {
+        const CD_F32 core = sqrtf(cd_segments_distance_v(a.seg, b.seg).distanceSquared);
+        return CD_MAX(0.0f, core - a.radius - b.radius);
+    }
+
+    /**
+     * @brief 两个胶囊体表面之间的距离
+     * @param a 胶囊体a
+     * @param b 胶囊体b
+     * @param distance 距离,重叠时为0
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_capsules_distance(const CD_CAPSULE *a, const CD_CAPSULE *b, CD_F32 *distance)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || distance == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *distance = cd_capsules_distance_v(*a, *b);
+        return ret;
+    }
+
+    /**
+     * @brief 判断胶囊体与圆是否重叠(含边界接触),无参数检查
+     * @param capsule 胶囊体
+     * @param circle 圆
+     * @return 1 重叠, 0 不重叠
+     */
+    CD_INLINE CD_BOOL cd_capsule_circle_overlap_v(CD_CAPSULE capsule, CD_CIRCLE circle)
+    {
+        const CD_F32 radius = capsule.radius + circle.radius;
+        return cd_vec2_dis_sqr_v(circle.center, cd_segment_nearest_point_v(capsule.seg, circle.center)) <= radius * radius;
+    }
+
+    /**
+     * @brief 判断胶囊体与圆是否重叠(含边界接触)
+     * @param capsule 胶囊体
+     * @param circle 圆
+     * @param result 1 重叠, 0 不重叠
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_capsule_circle_overlap(const CD_CAPSULE *capsule, const CD_CIRCLE *circle, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(capsule == CD_NULL || circle == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_capsule_circle_overlap_v(*capsule, *circle);
+        return ret;
+    }
+
+    /**
+     * @brief 线段与以 center 为中心、半长宽为 half 的轴对齐盒子的分离轴测试,轴为坐标轴与线段法向
+     */
+    CD_INLINE CD_BOOL cd_box_segment_overlap_v(CD_VEC2 center, CD_VEC2 half, CD_VEC2 p1, CD_VEC2 p2)
+    {
+        if (CD_MAX(p1.x, p2.x) < center.x - half.x || CD_MIN(p1.x, p2.x) > center.x + half.x ||
+            CD_MAX(p1.y, p2.y) < center.y - half.y || CD_MIN(p1.y, p2.y) > center.y + half.y)
+        {
+            return CD_FALSE;
+        }
+        const CD_VEC2 n = cd_vec2_right_perp_v(cd_vec2_sub_v(p2, p1));
+        return CD_FABS(cd_vec2_dot_v(n, cd_vec2_sub_v(center, p1))) <= CD_FABS(n.x) * half.x + CD_FABS(n.y) * half.y;
+    }
+
+    /**
+     * @brief 局部坐标系下胶囊体与以原点为中心、半长宽为 half 的轴对齐盒子是否重叠,无参数检查
+     *        中轴与盒子相交时重叠;否则最近点对必然包含中轴端点或盒子角点,只需比较这六个点的距离
+     * @param p1 中轴起点,局部坐标
+     * @param p2 中轴终点,局部坐标
+     * @param radius 半径
+     * @param half 盒子半长宽
+     * @return 1 重叠(含边界接触), 0 不重叠
+     */
+    CD_INLINE CD_BOOL cd_capsule_local_box_overlap_v(CD_VEC2 p1, CD_VEC2 p2, CD_F32 radius, CD_VEC2 half)
+    {
+        // 先用外扩后的盒子快速排除
+        if (CD_MAX(p1.x, p2.x) < -half.x - radius || CD_MIN(p1.x, p2.x) > half.x + radius ||
+            CD_MAX(p1.y, p2.y) < -half.y - radius || CD_MIN(p1.y, p2.y) > half.y + radius)
+        {
+            return CD_FALSE;
+        }
+        if (cd_box_segment_overlap_v(Vec2_Zero, half, p1, p2))
+        {
+            return CD_TRUE;
+        }
+        const CD_F32 radius_sqr = radius * radius;
+        const CD_VEC2 c1 = cd_vec2_make_v(CD_CLIP(p1.x, -half.x, half.x), CD_CLIP(p1.y, -half.y, half.y));
+        const CD_VEC2 c2 = cd_vec2_make_v(CD_CLIP(p2.x, -half.x, half.x), CD_CLIP(p2.y, -half.y, half.y));
+        if (cd_vec2_dis_sqr_v(p1, c1) <= radius_sqr || cd_vec2_dis_sqr_v(p2, c2) <= radius_sqr)
+        {
+            return CD_TRUE;
+        }
+        CD_SEGMENT seg;
+        seg.point1 = p1;
+        seg.point2 = p2;
+        for (CD_S32 i = 0; i < 4; ++i)
+        {
+            const CD_VEC2 corner = cd_vec2_make_v((i & 1) ? half.x : -half.x, (i & 2) ? half.y : -half.y);
+            if (cd_vec2_dis_sqr_v(corner, cd_segment_nearest_point_v(seg, corner)) <= radius_sqr)
+            {
+                return CD_TRUE;
+            }
+        }
+        return CD_FALSE;
+    }
+
+    /**
+     * @brief 判断胶囊体与obb是否重叠(含边界接触),胶囊体变换到obb局部坐标系后闭式计算,无参数检查
+     * @param capsule 胶囊体
+     * @param obb obb
+     * @return 1 重叠, 0 不重叠
+     */
+    CD_INLINE CD_BOOL cd_capsule_obb_overlap_v(CD_CAPSULE capsule, CD_OBB obb)
+    {
+        const CD_VEC2 d1 = cd_vec2_sub_v(capsule.seg.point1, obb.center);
+        const CD_VEC2 d2 = cd_vec2_sub_v(capsule.seg.point2, obb.center);
+        const CD_VEC2 p1 = cd_vec2_make_v(d1.x * obb.q.c + d1.y * obb.q.s, d1.y * obb.q.c - d1.x * obb.q.s);
+        const CD_VEC2 p2 = cd_vec2_make_v(d2.x * obb.q.c + d2.y * obb.q.s, d2.y * obb.q.c - d2.x * obb.q.s);
+        return cd_capsule_local_box_overlap_v(p1, p2, capsule.radius, cd_vec2_make_v(obb.length * 0.5f, obb.width * 0.5f));
+    }
+
+    /**
+     * @brief 判断胶囊体与obb是否重叠(含边界接触)
+     * @param capsule 胶囊体
+     * @param obb obb
+     * @param result 1 重叠, 0 不重叠
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_capsule_obb_overlap(const CD_CAPSULE *capsule, const CD_OBB *obb, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(capsule == CD_NULL || obb == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_capsule_obb_overlap_v(*capsule, *obb);
+        return ret;
+    }
+
+    /**
+     * @brief 判断胶囊体与aabb是否重叠(含边界接触),无参数检查
+     * @param capsule 胶囊体
+     * @param aabb aabb
+     * @return 1 重叠, 0 不重叠
+     */
+    CD_INLINE CD_BOOL cd_capsule_aabb_overlap_v(CD_CAPSULE capsule, CD_AABB aabb)
+    {
+        const CD_VEC2 center = cd_aabb_center_v(aabb);
+        const CD_VEC2 half = cd_vec2_scale_v(cd_vec2_sub_v(aabb.upperBound, aabb.lowerBound), 0.5f);
+        return cd_capsule_local_box_overlap_v(cd_vec2_sub_v(capsule.seg.point1, center), cd_vec2_sub_v(capsule.seg.point2, center),
+                                              capsule.radius, half);
+    }
+
+    /**
+     * @brief 判断胶囊体与凸多边形视图是否重叠(含边界接触),考虑多边形的圆角半径,无参数检查
+     *        中轴与多边形核心相交时重叠;否则比较中轴端点到多边形、多边形顶点到中轴的距离
+     * @param capsule 胶囊体
+     * @param polygon 凸多边形视图,逆时针,需已填好 normals
+     * @return 1 重叠, 0 不重叠
+     */
+    CD_INLINE CD_BOOL cd_capsule_polygon_view_overlap_v(CD_CAPSULE capsule, const CD_POLYGON_VIEW *polygon)
+    {
+        const CD_F32 radius = capsule.radius + polygon->radius;
+        const CD_VEC2 p1 = capsule.seg.point1;
+        const CD_VEC2 p2 = capsule.seg.point2;
+        CD_POLYGON_VIEW core = *polygon;
+        core.radius = 0.0f;
+
+        // 中轴与多边形核心的分离轴测试,轴为多边形各边法向与中轴法向
+        CD_F32 separation = -CD_MAXABS_F;
+        for (CD_S32 i = 0; i < polygon->count; ++i)
+        {
+            separation = CD_MAX(separation, CD_MIN(cd_polygon_edge_separation_v(&core, i, p1),
+                                                   cd_polygon_edge_separation_v(&core, i, p2)));
+        }
+        if (separation > radius)
+        {
+            return CD_FALSE;
+        }
+        if (separation <= 0.0f)
+        {
+            const CD_VEC2 n = cd_vec2_right_perp_v(cd_vec2_sub_v(p2, p1));
+            CD_F32 lo = CD_MAXABS_F;
+            CD_F32 hi = -CD_MAXABS_F;
+            for (CD_S32 i = 0; i < polygon->count; ++i)
+            {
+                const CD_F32 s = cd_vec2_dot_v(n, cd_vec2_sub_v(polygon->vertices[i], p1));
+                lo = CD_MIN(lo, s);
+                hi = CD_MAX(hi, s);
+            }
+            if (lo <= 0.0f && hi >= 0.0f)
+            {
+                return CD_TRUE;
+            }
+        }
+
+        if (cd_point_in_polygon_view_v(&core, p1, radius) || cd_point_in_polygon_view_v(&core, p2, radius))
+        {
+            return CD_TRUE;
+        }
+        const CD_F32 radius_sqr = radius * radius;
+        for (CD_S32 i = 0; i < polygon->count; ++i)
+        {
+            const CD_VEC2 v = polygon->vertices[i];
+            if (cd_vec2_dis_sqr_v(v, cd_segment_nearest_point_v(capsule.seg, v)) <= radius_sqr)
+            {
+                return CD_TRUE;
+            }
+        }
+        return CD_FALSE;
+    }
+
+    /**
+     * @brief 判断胶囊体与凸多边形是否重叠(含边界接触),考虑多边形的圆角半径
+     * @param capsule 胶囊体
+     * @param polygon 凸多边形,逆时针,需已填好 normals
+     * @param result 1 重叠, 0 不重叠
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_capsule_polygon_overlap(const CD_CAPSULE *capsule, const CD_POLYGON *polygon, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(capsule == CD_NULL || polygon == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(polygon->count < 3, COLLISION_DETECTION_E_ZERO_NUM);
+        const CD_POLYGON_VIEW view = cd_polygon_view_v(polygon);
+        *result = cd_capsule_polygon_view_overlap_v(*capsule, &view);
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __COLLISION_DETECTION_CAPSULE_H__ */
@@ -18,12 +18,7 @@ extern "C"
 {
 #endif
 
-    // 圆
-    typedef struct _CD_CIRCLE_
-    {
-        CD_VEC2 center; // 中心
-        CD_F32 radius;  // 半径
-    } CD_CIRCLE;
+    // CD_CIRCLE 与 cd_point_in_circle_v 由 collision_detection_scalar.inl 实例化
 
     /**
  * @brief 判断点是否在圆内
@@ -36,13 +31,25 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(point == CD_NULL || circle == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_F32 dist_sqr = 0;
-        ret = cd_vec2_dis_sqr(point, &circle->center, &dist_sqr);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-        *result = (dist_sqr <= CD_SQUARE(circle->radius));
+        *result = cd_point_in_circle_v(*point, *circle);
         return ret;
     }
 
+    /**
+     * @brief 将圆转化成aabb,无参数检查
+     * @param circle 圆
+     * @return aabb
+     */
+    CD_INLINE CD_AABB cd_circle_to_aabb_v(CD_CIRCLE circle)
+    {
+        CD_AABB r;
+        r.lowerBound.x = circle.center.x - circle.radius;
+        r.lowerBound.y = circle.center.y - circle.radius;
+        r.upperBound.x = circle.center.x + circle.radius;
+        r.upperBound.y = circle.center.y + circle.radius;
+        return r;
+    }
+
     /**
  * @brief 将圆转化成aabb
  * @param circle 圆
@@ -53,13 +60,7 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(circle == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_F32 radius = circle->radius;
-        CD_F32 half_width = radius;
-        CD_F32 half_height = radius;
-        result->lowerBound.x = circle->center.x - half_width;
-        result->lowerBound.y = circle->center.y - half_height;
-        result->upperBound.x = circle->center.x + half_width;
-        result->upperBound.y = circle->center.y + half_height;
+        *result = cd_circle_to_aabb_v(*circle);
         return ret;
     }
 #ifdef __cplusplus
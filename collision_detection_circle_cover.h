@@ -0,0 +1,383 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-16 18:03:27
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-16 18:03:27
+ */
+
+#ifndef __COLLISION_DETECTION_CIRCLE_COVER_H__
+#define __COLLISION_DETECTION_CIRCLE_COVER_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_vec2.h"
+#include "collision_detection_transform.h"
+#include "collision_detection_circle.h"
+#include "collision_detection_obb.h"
+#include "collision_detection_polygon.h"
+#include "collision_detection_grid.h"
+#include "collision_detection_trajectory.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CD_MAX_COVER_CIRCLES 8 // 覆盖圆的最大数量
+
+    // 用若干个圆保守地覆盖足迹,圆心位于足迹局部坐标系
+    typedef struct _CD_CIRCLE_COVER_
+    {
+        CD_CIRCLE circles[CD_MAX_COVER_CIRCLES]; // 覆盖圆
+        CD_S32 count;                            // 覆盖圆数量
+        CD_CIRCLE bound;                         // 包含所有覆盖圆的外接圆,用于快速剔除
+    } CD_CIRCLE_COVER;
+
+    /**
+     * @brief 沿给定主轴把凸多边形等分成 count 段,每段用一个圆覆盖,无参数检查
+     *        每段先求多边形在该段内的部分(顶点与边和段边界的交点),圆心取其在主轴和侧向上范围的中点,
+     *        半径取圆心到这些点的最大距离,因此每个圆都完整覆盖该段
+     * @param vertices 凸多边形顶点
+     * @param vertex_count 顶点数量, 1 ~ MAX_POLYGON_VERTICES
+     * @param axis 主轴,单位向量
+     * @param count 覆盖圆数量, 1 ~ CD_MAX_COVER_CIRCLES
+     * @param cover 覆盖圆
+     * @return 覆盖圆超出多边形侧向范围的最大值,用于衡量覆盖的保守程度
+     */
+    CD_INLINE CD_F32 cd_circle_cover_slabs_v(const CD_VEC2 *vertices, CD_S32 vertex_count, CD_VEC2 axis,
+                                             CD_S32 count, CD_CIRCLE_COVER *cover)
+    {
+        const CD_VEC2 side = cd_vec2_left_perp_v(axis);
+        CD_F32 u_min = CD_MAXABS_F;
+        CD_F32 u_max = -CD_MAXABS_F;
+        for (CD_S32 i = 0; i < vertex_count; ++i)
+        {
+            const CD_F32 u = cd_vec2_dot_v(vertices[i], axis);
+            u_min = CD_MIN(u_min, u);
+            u_max = CD_MAX(u_max, u);
+        }
+        const CD_F32 step = (u_max - u_min) / (CD_F32)count;
+        CD_F32 excess = 0.0f;
+        // 段内的点: 顶点加上每条边与两条段边界的交点
+        CD_F32 us[MAX_POLYGON_VERTICES * 3];
+        CD_F32 vs[MAX_POLYGON_VERTICES * 3];
+        for (CD_S32 k = 0; k < count; ++k)
+        {
+            const CD_F32 a = u_min + step * (CD_F32)k;
+            const CD_F32 b = k == count - 1 ? u_max : a + step;
+            CD_S32 n = 0;
+            for (CD_S32 i = 0; i < vertex_count; ++i)
+            {
+                const CD_VEC2 p1 = vertices[i];
+                const CD_VEC2 p2 = vertices[i + 1 < vertex_count ? i + 1 : 0];
+                const CD_F32 u1 = cd_vec2_dot_v(p1, axis);
+                const CD_F32 u2 = cd_vec2_dot_v(p2, axis);
+                const CD_F32 v1 = cd_vec2_dot_v(p1, side);
+                const CD_F32 v2 = cd_vec2_dot_v(p2, side);
+                if (u1 >= a && u1 <= b)
+                {
+                    us[n] = u1;
+                    vs[n] = v1;
+                    ++n;
+                }
+                const CD_F32 bounds[2] = {a, b};
+                for (CD_S32 j = 0; j < 2; ++j)
+                {
+                    const CD_F32 c = bounds[j];
+                    if ((u1 < c && u2 > c) || (u1 > c && u2 < c))
+                    {
+                        us[n] = c;
+                        vs[n] = v1 + (v2 - v1) * (c - u1) / (u2 - u1);
+                        ++n;
+                    }
+                }
+            }
+            CD_F32 v_min = CD_MAXABS_F;
+            CD_F32 v_max = -CD_MAXABS_F;
+            for (CD_S32 i = 0; i < n; ++i)
+            {
+                v_min = CD_MIN(v_min, vs[i]);
+                v_max = CD_MAX(v_max, vs[i]);
+            }
+            const CD_F32 u_c = 0.5f * (a + b);
+            const CD_F32 v_c = n > 0 ? 0.5f * (v_min + v_max) : 0.0f;
+            CD_F32 radius_sqr = 0.0f;
+            for (CD_S32 i = 0; i < n; ++i)
+            {
+                radius_sqr = CD_MAX(radius_sqr, CD_SQUARE(us[i] - u_c) + CD_SQUARE(vs[i] - v_c));
+            }
+            CD_CIRCLE *circle = cover->circles + k;
+            circle->center = cd_vec2_add_v(cd_vec2_scale_v(axis, u_c), cd_vec2_scale_v(side, v_c));
+            circle->radius = sqrtf(radius_sqr);
+            if (n > 0)
+            {
+                excess = CD_MAX(excess, circle->radius - 0.5f * (v_max - v_min));
+            }
+        }
+        cover->count = count;
+
+        // 外接圆
+        const CD_VEC2 first = cover->circles[0].center;
+        const CD_VEC2 last = cover->circles[count - 1].center;
+        cover->bound.center = cd_vec2_scale_v(cd_vec2_add_v(first, last), 0.5f);
+        cover->bound.radius = 0.0f;
+        for (CD_S32 k = 0; k < count; ++k)
+        {
+            cover->bound.radius = CD_MAX(cover->bound.radius,
+                                         cd_vec2_dis_v(cover->bound.center, cover->circles[k].center) + cover->circles[k].radius);
+        }
+        return excess;
+    }
+
+    /**
+     * @brief 生成凸多边形顶点的最少覆盖圆,无参数检查
+     *        主轴取多边形最窄方向的垂直方向(各边方向中侧向宽度最小者),
+     *        从1个圆开始增加,直到覆盖圆超出多边形侧向范围不大于 tolerance 或达到 CD_MAX_COVER_CIRCLES
+     * @param vertices 凸多边形顶点
+     * @param vertex_count 顶点数量, 1 ~ MAX_POLYGON_VERTICES
+     * @param tolerance 允许的最大外扩量
+     * @param cover 覆盖圆
+     */
+    CD_INLINE CD_VOID cd_circle_cover_vertices_v(const CD_VEC2 *vertices, CD_S32 vertex_count, CD_F32 tolerance,
+                                                 CD_CIRCLE_COVER *cover)
+    {
+        CD_VEC2 axis = {1.0f, 0.0f};
+        CD_F32 best_width = CD_MAXABS_F;
+        for (CD_S32 i = 0; i < vertex_count && vertex_count > 1; ++i)
+        {
+            const CD_VEC2 edge = cd_vec2_sub_v(vertices[i + 1 < vertex_count ? i + 1 : 0], vertices[i]);
+            if (cd_vec2_len_sqr_v(edge) < CD_EPS)
+            {
+                continue;
+            }
+            const CD_VEC2 dir = cd_vec2_norm_v(edge);
+            const CD_VEC2 side = cd_vec2_left_perp_v(dir);
+            CD_F32 lo = CD_MAXABS_F;
+            CD_F32 hi = -CD_MAXABS_F;
+            for (CD_S32 j = 0; j < vertex_count; ++j)
+            {
+                const CD_F32 v = cd_vec2_dot_v(vertices[j], side);
+                lo = CD_MIN(lo, v);
+                hi = CD_MAX(hi, v);
+            }
+            if (hi - lo < best_width)
+            {
+                best_width = hi - lo;
+                axis = dir;
+            }
+        }
+        for (CD_S32 count = 1; count <= CD_MAX_COVER_CIRCLES; ++count)
+        {
+            if (cd_circle_cover_slabs_v(vertices, vertex_count, axis, count, cover) <= tolerance)
+            {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief 生成obb的最少覆盖圆,圆心沿obb长边方向分布,坐标系与obb相同
+     * @param obb obb,一般为足迹局部坐标系下的obb
+     * @param tolerance 允许的最大外扩量,越小圆越多
+     * @param cover 覆盖圆
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_circle_cover_from_obb(const CD_OBB *obb, CD_F32 tolerance, CD_CIRCLE_COVER *cover)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(obb == CD_NULL || cover == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_VEC2 vertices[4];
+        ret = cd_obb_vertices(obb, vertices);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        cd_circle_cover_vertices_v(vertices, 4, tolerance, cover);
+        return ret;
+    }
+
+    /**
+     * @brief 生成凸多边形的最少覆盖圆,坐标系与多边形相同,多边形的圆角半径计入每个覆盖圆
+     * @param polygon 凸多边形
+     * @param tolerance 允许的最大外扩量,越小圆越多
+     * @param cover 覆盖圆
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_circle_cover_from_polygon(const CD_POLYGON *polygon, CD_F32 tolerance, CD_CIRCLE_COVER *cover)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(polygon == CD_NULL || cover == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(polygon->count <= 0 || polygon->count > MAX_POLYGON_VERTICES, COLLISION_DETECTION_E_ZERO_NUM);
+        cd_circle_cover_vertices_v(polygon->vertices, polygon->count, tolerance, cover);
+        for (CD_S32 k = 0; k < cover->count; ++k)
+        {
+            cover->circles[k].radius += polygon->radius;
+        }
+        cover->bound.radius += polygon->radius;
+        return ret;
+    }
+
+    /**
+     * @brief 把覆盖圆变换到位姿下,只做 k 次旋转平移,无参数检查
+     * @param cover 覆盖圆
+     * @param pose 位姿
+     * @param result 世界坐标系下的覆盖圆, cover->count 个
+     * @return 世界坐标系下的外接圆
+     */
+    CD_INLINE CD_CIRCLE cd_circle_cover_transform_v(const CD_CIRCLE_COVER *cover, CD_TRANSFORM pose, CD_CIRCLE *result)
+    {
+        for (CD_S32 k = 0; k < cover->count; ++k)
+        {
+            result[k].center = cd_transforms_point_v(pose, cover->circles[k].center);
+            result[k].radius = cover->circles[k].radius;
+        }
+        CD_CIRCLE bound;
+        bound.center = cd_transforms_point_v(pose, cover->bound.center);
+        bound.radius = cover->bound.radius;
+        return bound;
+    }
+
+    /**
+     * @brief 检查覆盖圆沿一组位姿与点云是否碰撞,返回第一个碰撞的位姿
+     *        每个点先与外接圆比较,再与各覆盖圆比较,全部是圆心距离的平方比较
+     * @param cover 覆盖圆,足迹局部坐标系
+     * @param poses 位姿数组
+     * @param pose_count 位姿数量
+     * @param xs 点云x
+     * @param ys 点云y
+     * @param point_count 点数
+     * @param result_pose 第一个碰撞的位姿下标,无碰撞时为 CD_TRAJECTORY_NO_HIT
+     * @param result_point 碰撞的点下标,无碰撞时为 CD_TRAJECTORY_NO_HIT,可为null
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_circle_cover_check_points(const CD_CIRCLE_COVER *cover, const CD_TRANSFORM *poses, CD_S32 pose_count,
+                                                  const CD_F32 *xs, const CD_F32 *ys, CD_S32 point_count,
+                                                  CD_S32 *result_pose, CD_S32 *result_point)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(cover == CD_NULL || poses == CD_NULL || xs == CD_NULL || ys == CD_NULL || result_pose == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        *result_pose = CD_TRAJECTORY_NO_HIT;
+        if (result_point != CD_NULL)
+        {
+            *result_point = CD_TRAJECTORY_NO_HIT;
+        }
+        CD_CIRCLE circles[CD_MAX_COVER_CIRCLES];
+        for (CD_S32 p = 0; p < pose_count; ++p)
+        {
+            const CD_CIRCLE bound = cd_circle_cover_transform_v(cover, poses[p], circles);
+            const CD_F32 bound_sqr = bound.radius * bound.radius;
+            for (CD_S32 i = 0; i < point_count; ++i)
+            {
+                if (CD_SQUARE(xs[i] - bound.center.x) + CD_SQUARE(ys[i] - bound.center.y) > bound_sqr)
+                {
+                    continue;
+                }
+                for (CD_S32 k = 0; k < cover->count; ++k)
+                {
+                    if (CD_SQUARE(xs[i] - circles[k].center.x) + CD_SQUARE(ys[i] - circles[k].center.y) <=
+                        circles[k].radius * circles[k].radius)
+                    {
+                        *result_pose = p;
+                        if (result_point != CD_NULL)
+                        {
+                            *result_point = i;
+                        }
+                        return ret;
+                    }
+                }
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 检查覆盖圆沿一组位姿与圆形障碍物是否碰撞,返回第一个碰撞的位姿
+     * @param cover 覆盖圆,足迹局部坐标系
+     * @param poses 位姿数组
+     * @param pose_count 位姿数量
+     * @param obstacles 圆形障碍物
+     * @param obstacle_count 障碍物数量
+     * @param result_pose 第一个碰撞的位姿下标,无碰撞时为 CD_TRAJECTORY_NO_HIT
+     * @param result_obstacle 碰撞的障碍物下标,无碰撞时为 CD_TRAJECTORY_NO_HIT,可为null
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_circle_cover_check_circles(const CD_CIRCLE_COVER *cover, const CD_TRANSFORM *poses, CD_S32 pose_count,
+                                                   const CD_CIRCLE *obstacles, CD_S32 obstacle_count,
+                                                   CD_S32 *result_pose, CD_S32 *result_obstacle)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(cover == CD_NULL || poses == CD_NULL || obstacles == CD_NULL || result_pose == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        *result_pose = CD_TRAJECTORY_NO_HIT;
+        if (result_obstacle != CD_NULL)
+        {
+            *result_obstacle = CD_TRAJECTORY_NO_HIT;
+        }
+        CD_CIRCLE circles[CD_MAX_COVER_CIRCLES];
+        for (CD_S32 p = 0; p < pose_count; ++p)
+        {
+            const CD_CIRCLE bound = cd_circle_cover_transform_v(cover, poses[p], circles);
+            for (CD_S32 i = 0; i < obstacle_count; ++i)
+            {
+                const CD_CIRCLE obstacle = obstacles[i];
+                if (cd_vec2_dis_sqr_v(obstacle.center, bound.center) > CD_SQUARE(bound.radius + obstacle.radius))
+                {
+                    continue;
+                }
+                for (CD_S32 k = 0; k < cover->count; ++k)
+                {
+                    if (cd_vec2_dis_sqr_v(obstacle.center, circles[k].center) <= CD_SQUARE(circles[k].radius + obstacle.radius))
+                    {
+                        *result_pose = p;
+                        if (result_obstacle != CD_NULL)
+                        {
+                            *result_obstacle = i;
+                        }
+                        return ret;
+                    }
+                }
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 检查覆盖圆沿一组位姿与栅格地图是否碰撞,返回第一个碰撞的位姿
+     *        每个覆盖圆先用距离场 O(1) 判断,无法确定时再逐栅格检查
+     * @param cover 覆盖圆,足迹局部坐标系
+     * @param poses 位姿数组
+     * @param pose_count 位姿数量
+     * @param map 栅格地图,距离场需已更新
+     * @param result_pose 第一个碰撞的位姿下标,无碰撞时为 CD_TRAJECTORY_NO_HIT
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_circle_cover_check_grid(const CD_CIRCLE_COVER *cover, const CD_TRANSFORM *poses, CD_S32 pose_count,
+                                                const CD_GRID_MAP *map, CD_S32 *result_pose)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(cover == CD_NULL || poses == CD_NULL || map == CD_NULL || result_pose == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        *result_pose = CD_TRAJECTORY_NO_HIT;
+        CD_CIRCLE circles[CD_MAX_COVER_CIRCLES];
+        for (CD_S32 p = 0; p < pose_count; ++p)
+        {
+            const CD_CIRCLE bound = cd_circle_cover_transform_v(cover, poses[p], circles);
+            if (cd_grid_map_circle_bound_v(map, bound.center, bound.radius) == 0)
+            {
+                continue;
+            }
+            for (CD_S32 k = 0; k < cover->count; ++k)
+            {
+                const CD_S32 state = cd_grid_map_circle_bound_v(map, circles[k].center, circles[k].radius);
+                if (state == 1 || (state < 0 && cd_grid_map_circle_scan_v(map, circles[k])))
+                {
+                    *result_pose = p;
+                    return ret;
+                }
+            }
+        }
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __COLLISION_DETECTION_CIRCLE_COVER_H__ */
@@ -29,16 +29,29 @@ extern "C"
         CD_F32 radius;
     } CD_DISTANCE_PROXY;
 
+    /// 点集视图,点存放在外部的连续存储中(如顶点池),顶点数不受 MAX_POLYGON_VERTICES 限制
+    typedef struct _CD_DISTANCE_SPAN_
+    {
+        /// The point cloud
+        const CD_VEC2 *points;
+
+        /// The number of points
+        CD_S32 count;
+
+        /// The external radius of the point cloud
+        CD_F32 radius;
+    } CD_DISTANCE_SPAN;
+
     typedef struct _CD_DISTANCE_CACHE_
     {
         /// The number of stored simplex points
         CD_U16 count;
 
         /// The cached simplex indices on shape A
-        CD_U08 indexA[3];
+        CD_U16 indexA[3];
 
         /// The cached simplex indices on shape B
-        CD_U08 indexB[3];
+        CD_U16 indexB[3];
     } CD_DISTANCE_CACHE;
 
     static const CD_DISTANCE_CACHE emptyDistanceCache = {0};
@@ -61,6 +74,24 @@ extern "C"
         CD_BOOL useRadii;
     } CD_DISTANCE_INPUT;
 
+    typedef struct _CD_DISTANCE_SPAN_INPUT_
+    {
+        /// The point span for shape A
+        CD_DISTANCE_SPAN proxyA;
+
+        /// The point span for shape B
+        CD_DISTANCE_SPAN proxyB;
+
+        /// The world transform for shape A
+        CD_TRANSFORM transformA;
+
+        /// The world transform for shape B
+        CD_TRANSFORM transformB;
+
+        /// Should the proxy radius be considered?
+        CD_BOOL useRadii;
+    } CD_DISTANCE_SPAN_INPUT;
+
     typedef struct _CD_DISTANCE_OUTPUT_
     {
         CD_VEC2 pointA;      ///< Closest point on shapeA
@@ -88,11 +119,19 @@ extern "C"
         CD_S32 count;                 ///< number of valid vertices
     } CD_SIMPLEX;
 
-    CD_INLINE CD_RET cd_make_proxy(CD_VEC2 *vertices, CD_S16 count, CD_F32 radius, CD_DISTANCE_PROXY *result)
+    /**
+     * @brief 构建定长点集,超过 MAX_POLYGON_VERTICES 的点集请使用 CD_DISTANCE_SPAN
+     * @param vertices 点
+     * @param count 点数量
+     * @param radius 点集的外扩半径
+     * @param result 点集
+     * @return ok / 参数异常 / 点数超过 MAX_POLYGON_VERTICES
+     */
+    CD_INLINE CD_RET cd_make_proxy(const CD_VEC2 *vertices, CD_S16 count, CD_F32 radius, CD_DISTANCE_PROXY *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(vertices == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        count = CD_MIN(count, MAX_POLYGON_VERTICES);
+        CD_CHECK_ERROR(count > MAX_POLYGON_VERTICES, COLLISION_DETECTION_E_MEM_FULL);
         for (CD_S32 i = 0; i < count; i++)
         {
             result->points[i] = vertices[i];
@@ -102,15 +141,567 @@ extern "C"
         return ret;
     }
 
+    /**
+     * @brief 由定长点集构建点集视图,无参数检查
+     * @param proxy 定长点集,生命周期需覆盖视图的使用
+     * @return 点集视图
+     */
+    CD_INLINE CD_DISTANCE_SPAN cd_proxy_span_v(const CD_DISTANCE_PROXY *proxy)
+    {
+        CD_DISTANCE_SPAN r;
+        r.points = proxy->points;
+        r.count = proxy->count;
+        r.radius = proxy->radius;
+        return r;
+    }
+
+    /**
+     * @brief 由外部连续存储的点构建点集视图,无参数检查
+     * @param points 点
+     * @param count 点数量,不超过 CD_MAX_U16
+     * @param radius 点集的外扩半径
+     * @return 点集视图
+     */
+    CD_INLINE CD_DISTANCE_SPAN cd_make_span_v(const CD_VEC2 *points, CD_S32 count, CD_F32 radius)
+    {
+        CD_DISTANCE_SPAN r;
+        r.points = points;
+        r.count = count;
+        r.radius = radius;
+        return r;
+    }
+
+#define CD_GJK_MAX_ITERS 20 // GJK最大迭代次数
+
+    /**
+     * @brief 查找点集视图在指定方向上的支撑点,无参数检查
+     * @param span 点集视图
+     * @param direction 搜索方向(点集局部坐标系)
+     * @return 支撑点的索引
+     */
+    CD_INLINE CD_S32 cd_span_find_support_v(const CD_DISTANCE_SPAN *span, CD_VEC2 direction)
+    {
+        CD_S32 best_index = 0;
+        CD_F32 best_value = span->points[0].x * direction.x + span->points[0].y * direction.y;
+        for (CD_S32 i = 1; i < span->count; ++i)
+        {
+            const CD_F32 value = span->points[i].x * direction.x + span->points[i].y * direction.y;
+            if (value > best_value)
+            {
+                best_index = i;
+                best_value = value;
+            }
+        }
+        return best_index;
+    }
+
+    /**
+     * @brief 查找点集在指定方向上的支撑点
+     * @param proxy 点集
+     * @param direction 搜索方向(点集局部坐标系)
+     * @param result 支撑点的索引
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_proxy_find_support(const CD_DISTANCE_PROXY *proxy, const CD_VEC2 *direction, CD_S32 *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(proxy == CD_NULL || direction == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_DISTANCE_SPAN span = cd_proxy_span_v(proxy);
+        *result = cd_span_find_support_v(&span, *direction);
+        return ret;
+    }
+
+    /**
+     * @brief 根据点集索引计算单纯形顶点的世界坐标
+     * @param input 距离计算输入
+     * @param vertex 单纯形顶点,需已填好 indexA / indexB
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_simplex_vertex_update(const CD_DISTANCE_SPAN_INPUT *input, CD_SIMPLEX_VERTEX *vertex)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(input == CD_NULL || vertex == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        ret = cd_transforms_point(&input->transformA, &input->proxyA.points[vertex->indexA], &vertex->wA);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = cd_transforms_point(&input->transformB, &input->proxyB.points[vertex->indexB], &vertex->wB);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        vertex->w.x = vertex->wB.x - vertex->wA.x;
+        vertex->w.y = vertex->wB.y - vertex->wA.y;
+        return ret;
+    }
+
+    /**
+     * @brief 由缓存的索引构建初始单纯形(热启动)，缓存为空或无效时从第0个点开始
+     * @param cache 距离缓存
+     * @param input 距离计算输入
+     * @param result 初始单纯形
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_make_simplex_from_cache(const CD_DISTANCE_CACHE *cache, const CD_DISTANCE_SPAN_INPUT *input, CD_SIMPLEX *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(cache == CD_NULL || input == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_SIMPLEX_VERTEX *vertices[3] = {&result->v1, &result->v2, &result->v3};
+        result->count = cache->count <= 3 ? cache->count : 0;
+        // 点集发生变化时缓存的索引可能越界，此时放弃热启动
+        for (CD_S32 i = 0; i < result->count; ++i)
+        {
+            if (cache->indexA[i] >= input->proxyA.count || cache->indexB[i] >= input->proxyB.count)
+            {
+                result->count = 0;
+                break;
+            }
+        }
+        for (CD_S32 i = 0; i < result->count; ++i)
+        {
+            CD_SIMPLEX_VERTEX *v = vertices[i];
+            v->indexA = cache->indexA[i];
+            v->indexB = cache->indexB[i];
+            ret = cd_simplex_vertex_update(input, v);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            v->a = -1.0f; // 重心坐标在求解单纯形时重新计算
+        }
+        if (result->count == 0)
+        {
+            CD_SIMPLEX_VERTEX *v = vertices[0];
+            v->indexA = 0;
+            v->indexB = 0;
+            ret = cd_simplex_vertex_update(input, v);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            v->a = 1.0f;
+            result->count = 1;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 将单纯形的顶点索引写入缓存，供下一帧热启动
+     * @param simplex 单纯形
+     * @param cache 距离缓存
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_make_simplex_cache(const CD_SIMPLEX *simplex, CD_DISTANCE_CACHE *cache)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(simplex == CD_NULL || cache == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_SIMPLEX_VERTEX *vertices[3] = {&simplex->v1, &simplex->v2, &simplex->v3};
+        cache->count = (CD_U16)simplex->count;
+        for (CD_S32 i = 0; i < simplex->count; ++i)
+        {
+            cache->indexA[i] = (CD_U16)vertices[i]->indexA;
+            cache->indexB[i] = (CD_U16)vertices[i]->indexB;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 根据重心坐标计算两个形状上的最近点
+     * @param simplex 单纯形
+     * @param point_a 形状A上的最近点
+     * @param point_b 形状B上的最近点
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_simplex_witness_points(const CD_SIMPLEX *simplex, CD_VEC2 *point_a, CD_VEC2 *point_b)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(simplex == CD_NULL || point_a == CD_NULL || point_b == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_SIMPLEX_VERTEX *v1 = &simplex->v1;
+        const CD_SIMPLEX_VERTEX *v2 = &simplex->v2;
+        const CD_SIMPLEX_VERTEX *v3 = &simplex->v3;
+        switch (simplex->count)
+        {
+        case 1:
+            *point_a = v1->wA;
+            *point_b = v1->wB;
+            break;
+        case 2:
+            point_a->x = v1->a * v1->wA.x + v2->a * v2->wA.x;
+            point_a->y = v1->a * v1->wA.y + v2->a * v2->wA.y;
+            point_b->x = v1->a * v1->wB.x + v2->a * v2->wB.x;
+            point_b->y = v1->a * v1->wB.y + v2->a * v2->wB.y;
+            break;
+        case 3:
+            // 原点在三角形内，两形状重叠，最近点重合
+            point_a->x = v1->a * v1->wA.x + v2->a * v2->wA.x + v3->a * v3->wA.x;
+            point_a->y = v1->a * v1->wA.y + v2->a * v2->wA.y + v3->a * v3->wA.y;
+            *point_b = *point_a;
+            break;
+        default:
+            ret = COLLISION_DETECTION_E_CALC_ERROR;
+            break;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 求解线段单纯形上离原点最近的区域(重心坐标)
+     * @param simplex 单纯形，求解后可能退化为一个点
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_solve_simplex2(CD_SIMPLEX *simplex)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(simplex == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_VEC2 w1 = simplex->v1.w;
+        const CD_VEC2 w2 = simplex->v2.w;
+        const CD_VEC2 e12 = {w2.x - w1.x, w2.y - w1.y};
+
+        // w1 区域
+        const CD_F32 d12_2 = -(w1.x * e12.x + w1.y * e12.y);
+        if (d12_2 <= 0.0f)
+        {
+            simplex->v1.a = 1.0f;
+            simplex->count = 1;
+            return ret;
+        }
+
+        // w2 区域
+        const CD_F32 d12_1 = w2.x * e12.x + w2.y * e12.y;
+        if (d12_1 <= 0.0f)
+        {
+            simplex->v2.a = 1.0f;
+            simplex->count = 1;
+            simplex->v1 = simplex->v2;
+            return ret;
+        }
+
+        // e12 区域
+        const CD_F32 inv_d12 = 1.0f / (d12_1 + d12_2);
+        simplex->v1.a = d12_1 * inv_d12;
+        simplex->v2.a = d12_2 * inv_d12;
+        simplex->count = 2;
+        return ret;
+    }
+
+    /**
+     * @brief 求解三角形单纯形上离原点最近的区域(重心坐标)
+     * @param simplex 单纯形，求解后可能退化为点或线段
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_solve_simplex3(CD_SIMPLEX *simplex)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(simplex == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_VEC2 w1 = simplex->v1.w;
+        const CD_VEC2 w2 = simplex->v2.w;
+        const CD_VEC2 w3 = simplex->v3.w;
+
+        // 边 12
+        const CD_VEC2 e12 = {w2.x - w1.x, w2.y - w1.y};
+        const CD_F32 d12_1 = w2.x * e12.x + w2.y * e12.y;
+        const CD_F32 d12_2 = -(w1.x * e12.x + w1.y * e12.y);
+
+        // 边 13
+        const CD_VEC2 e13 = {w3.x - w1.x, w3.y - w1.y};
+        const CD_F32 d13_1 = w3.x * e13.x + w3.y * e13.y;
+        const CD_F32 d13_2 = -(w1.x * e13.x + w1.y * e13.y);
+
+        // 边 23
+        const CD_VEC2 e23 = {w3.x - w2.x, w3.y - w2.y};
+        const CD_F32 d23_1 = w3.x * e23.x + w3.y * e23.y;
+        const CD_F32 d23_2 = -(w2.x * e23.x + w2.y * e23.y);
+
+        // 三角形 123
+        const CD_F32 n123 = e12.x * e13.y - e12.y * e13.x;
+        const CD_F32 d123_1 = n123 * (w2.x * w3.y - w2.y * w3.x);
+        const CD_F32 d123_2 = n123 * (w3.x * w1.y - w3.y * w1.x);
+        const CD_F32 d123_3 = n123 * (w1.x * w2.y - w1.y * w2.x);
+
+        // w1 区域
+        if (d12_2 <= 0.0f && d13_2 <= 0.0f)
+        {
+            simplex->v1.a = 1.0f;
+            simplex->count = 1;
+            return ret;
+        }
+
+        // e12 区域
+        if (d12_1 > 0.0f && d12_2 > 0.0f && d123_3 <= 0.0f)
+        {
+            const CD_F32 inv_d12 = 1.0f / (d12_1 + d12_2);
+            simplex->v1.a = d12_1 * inv_d12;
+            simplex->v2.a = d12_2 * inv_d12;
+            simplex->count = 2;
+            return ret;
+        }
+
+        // e13 区域
+        if (d13_1 > 0.0f && d13_2 > 0.0f && d123_2 <= 0.0f)
+        {
+            const CD_F32 inv_d13 = 1.0f / (d13_1 + d13_2);
+            simplex->v1.a = d13_1 * inv_d13;
+            simplex->v3.a = d13_2 * inv_d13;
+            simplex->count = 2;
+            simplex->v2 = simplex->v3;
+            return ret;
+        }
+
+        // w2 区域
+        if (d12_1 <= 0.0f && d23_2 <= 0.0f)
+        {
+            simplex->v2.a = 1.0f;
+            simplex->count = 1;
+            simplex->v1 = simplex->v2;
+            return ret;
+        }
+
+        // w3 区域
+        if (d13_1 <= 0.0f && d23_1 <= 0.0f)
+        {
+            simplex->v3.a = 1.0f;
+            simplex->count = 1;
+            simplex->v1 = simplex->v3;
+            return ret;
+        }
+
+        // e23 区域
+        if (d23_1 > 0.0f && d23_2 > 0.0f && d123_1 <= 0.0f)
+        {
+            const CD_F32 inv_d23 = 1.0f / (d23_1 + d23_2);
+            simplex->v2.a = d23_1 * inv_d23;
+            simplex->v3.a = d23_2 * inv_d23;
+            simplex->count = 2;
+            simplex->v1 = simplex->v3;
+            return ret;
+        }
+
+        // 原点在三角形 123 内
+        const CD_F32 inv_d123 = 1.0f / (d123_1 + d123_2 + d123_3);
+        simplex->v1.a = d123_1 * inv_d123;
+        simplex->v2.a = d123_2 * inv_d123;
+        simplex->v3.a = d123_3 * inv_d123;
+        simplex->count = 3;
+        return ret;
+    }
+
+    /**
+     * @brief 计算单纯形指向原点的搜索方向
+     * @param simplex 单纯形(点或线段)
+     * @param result 搜索方向
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_simplex_search_direction(const CD_SIMPLEX *simplex, CD_VEC2 *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(simplex == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        switch (simplex->count)
+        {
+        case 1:
+            result->x = -simplex->v1.w.x;
+            result->y = -simplex->v1.w.y;
+            break;
+        case 2:
+        {
+            const CD_VEC2 e12 = {simplex->v2.w.x - simplex->v1.w.x, simplex->v2.w.y - simplex->v1.w.y};
+            const CD_F32 sgn = -(e12.x * simplex->v1.w.y - e12.y * simplex->v1.w.x);
+            if (sgn > 0.0f)
+            {
+                // 原点在 e12 左侧
+                result->x = -e12.y;
+                result->y = e12.x;
+            }
+            else
+            {
+                // 原点在 e12 右侧
+                result->x = e12.y;
+                result->y = -e12.x;
+            }
+            break;
+        }
+        default:
+            *result = Vec2_Zero;
+            break;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief GJK算法计算两个凸形状之间的距离和最近点
+     * @param cache 单纯形缓存，输入用于热启动，输出为本次结果的单纯形索引；首次调用请置为 emptyDistanceCache
+     * @param input 两个形状的点集视图与位姿,点数不超过 CD_MAX_U16
+     * @param simplexes 单纯形迭代过程记录，可为null
+     * @param simplexCapacity simplexes 的容量
+     * @param output 最近点、距离、迭代次数
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_shape_distance_span(CD_DISTANCE_CACHE *cache,
+                                            const CD_DISTANCE_SPAN_INPUT *input,
+                                            CD_SIMPLEX *simplexes,
+                                            CD_S32 simplexCapacity,
+                                            CD_DISTANCE_OUTPUT *output)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(cache == CD_NULL || input == CD_NULL || output == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(input->proxyA.points == CD_NULL || input->proxyB.points == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(input->proxyA.count <= 0 || input->proxyB.count <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        CD_CHECK_ERROR(input->proxyA.count > CD_MAX_U16 || input->proxyB.count > CD_MAX_U16, COLLISION_DETECTION_E_MEM_FULL);
+        const CD_DISTANCE_SPAN *proxy_a = &input->proxyA;
+        const CD_DISTANCE_SPAN *proxy_b = &input->proxyB;
+
+        // 初始化单纯形
+        CD_SIMPLEX simplex;
+        ret = cd_make_simplex_from_cache(cache, input, &simplex);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+
+        CD_S32 simplex_index = 0;
+        if (simplexes != CD_NULL && simplex_index < simplexCapacity)
+        {
+            simplexes[simplex_index] = simplex;
+            simplex_index += 1;
+        }
+
+        CD_SIMPLEX_VERTEX *vertices[3] = {&simplex.v1, &simplex.v2, &simplex.v3};
+
+        // 上一次单纯形的顶点索引，用于检查重复支撑点防止死循环
+        CD_S32 save_a[3];
+        CD_S32 save_b[3];
+
+        CD_S32 iter = 0;
+        while (iter < CD_GJK_MAX_ITERS)
+        {
+            const CD_S32 save_count = simplex.count;
+            for (CD_S32 i = 0; i < save_count; ++i)
+            {
+                save_a[i] = vertices[i]->indexA;
+                save_b[i] = vertices[i]->indexB;
+            }
+
+            if (simplex.count == 2)
+            {
+                ret = cd_solve_simplex2(&simplex);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            }
+            else if (simplex.count == 3)
+            {
+                ret = cd_solve_simplex3(&simplex);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            }
+
+            // 单纯形为三角形时，原点在其内部，两形状重叠
+            if (simplex.count == 3)
+            {
+                break;
+            }
+
+            if (simplexes != CD_NULL && simplex_index < simplexCapacity)
+            {
+                simplexes[simplex_index] = simplex;
+                simplex_index += 1;
+            }
+
+            CD_VEC2 d;
+            ret = cd_simplex_search_direction(&simplex, &d);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+
+            // 搜索方向过小，原点在单纯形上或非常接近，视为接触
+            if (d.x * d.x + d.y * d.y < CD_EPS * CD_EPS)
+            {
+                break;
+            }
+
+            // 新的支撑点 support(B, d) - support(A, -d)
+            CD_SIMPLEX_VERTEX *vertex = vertices[simplex.count];
+            const CD_VEC2 neg_d = {-d.x, -d.y};
+            CD_VEC2 local_d;
+            ret = cd_inv_rot_vector(&input->transformA.q, &neg_d, &local_d);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            vertex->indexA = cd_span_find_support_v(proxy_a, local_d);
+            ret = cd_inv_rot_vector(&input->transformB.q, &d, &local_d);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            vertex->indexB = cd_span_find_support_v(proxy_b, local_d);
+            ret = cd_simplex_vertex_update(input, vertex);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+
+            // 迭代次数等于支撑点的查询次数
+            ++iter;
+
+            // 支撑点重复说明已无法继续逼近，这是主要的终止条件
+            CD_BOOL duplicate = CD_FALSE;
+            for (CD_S32 i = 0; i < save_count; ++i)
+            {
+                if (vertex->indexA == save_a[i] && vertex->indexB == save_b[i])
+                {
+                    duplicate = CD_TRUE;
+                    break;
+                }
+            }
+            if (duplicate)
+            {
+                break;
+            }
+
+            ++simplex.count;
+        }
+
+        if (simplexes != CD_NULL && simplex_index < simplexCapacity)
+        {
+            simplexes[simplex_index] = simplex;
+            simplex_index += 1;
+        }
+
+        ret = cd_simplex_witness_points(&simplex, &output->pointA, &output->pointB);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = cd_vec2_dis(&output->pointA, &output->pointB, &output->distance);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        output->iterations = iter;
+        output->simplexCount = simplex_index;
+
+        ret = cd_make_simplex_cache(&simplex, cache);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+
+        if (input->useRadii)
+        {
+            if (output->distance < CD_EPS)
+            {
+                // 距离过近，无法可靠地计算法向
+                const CD_VEC2 p = {0.5f * (output->pointA.x + output->pointB.x), 0.5f * (output->pointA.y + output->pointB.y)};
+                output->pointA = p;
+                output->pointB = p;
+                output->distance = 0.0f;
+            }
+            else
+            {
+                // 重叠时最近点仍保持在外轮廓上，保证其连续变化
+                const CD_F32 radius_a = proxy_a->radius;
+                const CD_F32 radius_b = proxy_b->radius;
+                CD_VEC2 normal;
+                ret = cd_vec2_sub(&output->pointB, &output->pointA, &normal);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                ret = cd_vec2_norm(&normal, &normal);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                output->distance = CD_MAX(0.0f, output->distance - radius_a - radius_b);
+                ret = cd_vec2_mul_add(&output->pointA, radius_a, &normal, &output->pointA);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                ret = cd_vec2_mul_sub(&output->pointB, radius_b, &normal, &output->pointB);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief GJK算法计算两个定长点集之间的距离和最近点
+     * @param cache 单纯形缓存，输入用于热启动，输出为本次结果的单纯形索引；首次调用请置为 emptyDistanceCache
+     * @param input 两个形状的点集与位姿
+     * @param simplexes 单纯形迭代过程记录，可为null
+     * @param simplexCapacity simplexes 的容量
+     * @param output 最近点、距离、迭代次数
+     * @return ok / 参数异常
+     */
     CD_INLINE CD_RET cd_shape_distance(CD_DISTANCE_CACHE *cache,
-                                       CD_DISTANCE_INPUT *input,
+                                       const CD_DISTANCE_INPUT *input,
                                        CD_SIMPLEX *simplexes,
                                        CD_S32 simplexCapacity,
                                        CD_DISTANCE_OUTPUT *output)
     {
-        CD_RET ret = CD_RET_OK;
-        CD_CHECK_ERROR(cache == CD_NULL || input == CD_NULL || simplexes == CD_NULL || output == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        return ret;
+        CD_CHECK_ERROR(input == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_DISTANCE_SPAN_INPUT span_input;
+        span_input.proxyA = cd_proxy_span_v(&input->proxyA);
+        span_input.proxyB = cd_proxy_span_v(&input->proxyB);
+        span_input.transformA = input->transformA;
+        span_input.transformB = input->transformB;
+        span_input.useRadii = input->useRadii;
+        return cd_shape_distance_span(cache, &span_input, simplexes, simplexCapacity, output);
     }
 
 #ifdef __cplusplus
@@ -0,0 +1,794 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-16 09:12:05
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-16 09:12:05
+ */
+
+#ifndef __COLLISION_DETECTION_DYNAMIC_TREE_H__
+#define __COLLISION_DETECTION_DYNAMIC_TREE_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_aabb.h"
+#include "collision_detection_allocator.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CD_TREE_NULL_NODE (-1)   // 空节点索引
+#define CD_TREE_STACK_SIZE 1024  // 遍历时的栈深度
+#define CD_AABB_MARGIN (0.1f)    // 叶子节点aabb的扩展量,单位m
+
+    // 动态树节点
+    typedef struct _CD_TREE_NODE_
+    {
+        CD_AABB aabb;     // 叶子节点为扩展后的aabb,内部节点为子节点的并集
+        CD_S32 parent;    // 父节点索引,节点空闲时为空闲链表的下一个节点
+        CD_S32 child1;    // 子节点1,叶子节点为 CD_TREE_NULL_NODE
+        CD_S32 child2;    // 子节点2,叶子节点为 CD_TREE_NULL_NODE
+        CD_S32 userData;  // 用户数据,一般为障碍物id
+        CD_S32 height;    // 叶子节点为0,空闲节点为-1
+    } CD_TREE_NODE;
+
+    // 动态aabb树,节点存放在调用者提供的连续内存中,以索引代替指针
+    typedef struct _CD_DYNAMIC_TREE_
+    {
+        CD_TREE_NODE *nodes;  // 节点池
+        CD_S32 root;          // 根节点索引
+        CD_S32 nodeCount;     // 已使用的节点数
+        CD_S32 nodeCapacity;  // 节点池容量
+        CD_S32 freeList;      // 空闲链表表头
+        CD_S32 proxyCount;    // 叶子节点数
+    } CD_DYNAMIC_TREE;
+
+    /**
+     * @brief 查询回调
+     * @param proxyId 叶子节点索引
+     * @param userData 用户数据
+     * @param context 调用者上下文
+     * @return 1 继续查询, 0 终止查询
+     */
+    typedef CD_BOOL (*CD_TREE_QUERY_CALLBACK)(CD_S32 proxyId, CD_S32 userData, CD_VOID *context);
+
+    /**
+     * @brief 初始化动态树,N个障碍物需要 2N-1 个节点
+     * @param tree 动态树
+     * @param nodes 节点池
+     * @param capacity 节点池容量
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_init(CD_DYNAMIC_TREE *tree, CD_TREE_NODE *nodes, CD_S32 capacity)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL || nodes == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(capacity <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        tree->nodes = nodes;
+        tree->root = CD_TREE_NULL_NODE;
+        tree->nodeCount = 0;
+        tree->nodeCapacity = capacity;
+        tree->proxyCount = 0;
+        // 构建空闲链表
+        for (CD_S32 i = 0; i < capacity; ++i)
+        {
+            nodes[i].parent = i + 1 < capacity ? i + 1 : CD_TREE_NULL_NODE;
+            nodes[i].height = -1;
+        }
+        tree->freeList = 0;
+        return ret;
+    }
+
+    /**
+     * @brief 在线性分配器上分配节点池并初始化动态树
+     * @param tree 动态树
+     * @param arena 线性分配器
+     * @param capacity 节点池容量
+     * @return ok / 参数异常 / 线性分配器容量不足
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_init_from_arena(CD_DYNAMIC_TREE *tree, CD_ARENA *arena, CD_S32 capacity)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL || arena == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(capacity <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        CD_TREE_NODE *nodes = CD_NULL;
+        ret = CD_ARENA_ALLOC_ARRAY(arena, CD_TREE_NODE, capacity, &nodes);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        return cd_dynamic_tree_init(tree, nodes, capacity);
+    }
+
+    /**
+     * @brief 从节点池中分配一个节点
+     * @param tree 动态树
+     * @param result 节点索引
+     * @return ok / 参数异常 / 容量已满
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_allocate_node(CD_DYNAMIC_TREE *tree, CD_S32 *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(tree->freeList == CD_TREE_NULL_NODE, COLLISION_DETECTION_E_MEM_FULL);
+        const CD_S32 index = tree->freeList;
+        CD_TREE_NODE *node = tree->nodes + index;
+        tree->freeList = node->parent;
+        node->parent = CD_TREE_NULL_NODE;
+        node->child1 = CD_TREE_NULL_NODE;
+        node->child2 = CD_TREE_NULL_NODE;
+        node->userData = -1;
+        node->height = 0;
+        tree->nodeCount += 1;
+        *result = index;
+        return ret;
+    }
+
+    /**
+     * @brief 将节点归还节点池
+     * @param tree 动态树
+     * @param index 节点索引
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_free_node(CD_DYNAMIC_TREE *tree, CD_S32 index)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(index < 0 || index >= tree->nodeCapacity, COLLISION_DETECTION_E_PARAM_NULL);
+        tree->nodes[index].parent = tree->freeList;
+        tree->nodes[index].height = -1;
+        tree->freeList = index;
+        tree->nodeCount -= 1;
+        return ret;
+    }
+
+    /**
+     * @brief 按表面积启发式(SAH)贪心地查找新叶子的最佳兄弟节点
+     * @param tree 动态树
+     * @param box 新叶子的aabb
+     * @param result 兄弟节点索引
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_find_best_sibling(const CD_DYNAMIC_TREE *tree, const CD_AABB *box, CD_S32 *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL || box == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_TREE_NODE *nodes = tree->nodes;
+        CD_VEC2 center_d;
+        ret = cd_aabb_center(box, &center_d);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        CD_F32 area_d;
+        ret = cd_aabb_perimeter(box, &area_d);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+
+        CD_AABB union_box;
+        CD_F32 area_base;
+        ret = cd_aabb_perimeter(&nodes[tree->root].aabb, &area_base);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = cd_aabb_union(&nodes[tree->root].aabb, box, &union_box);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        CD_F32 direct_cost;
+        ret = cd_aabb_perimeter(&union_box, &direct_cost);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        CD_F32 inherited_cost = 0.0f;
+
+        CD_S32 best_sibling = tree->root;
+        CD_F32 best_cost = direct_cost;
+
+        // 沿一条贪心路径从根节点向下搜索
+        CD_S32 index = tree->root;
+        while (nodes[index].height > 0)
+        {
+            const CD_S32 child1 = nodes[index].child1;
+            const CD_S32 child2 = nodes[index].child2;
+
+            // 在当前节点处新建父节点的代价
+            const CD_F32 cost = direct_cost + inherited_cost;
+            if (cost < best_cost)
+            {
+                best_sibling = index;
+                best_cost = cost;
+            }
+
+            // 子节点继承的代价:当前节点面积的增量
+            inherited_cost += direct_cost - area_base;
+
+            const CD_BOOL leaf1 = nodes[child1].height == 0;
+            const CD_BOOL leaf2 = nodes[child2].height == 0;
+
+            // 下降到子节点1的代价
+            CD_F32 lower_cost1 = CD_MAXABS_F;
+            CD_F32 direct_cost1;
+            CD_F32 area1 = 0.0f;
+            ret = cd_aabb_union(&nodes[child1].aabb, box, &union_box);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_perimeter(&union_box, &direct_cost1);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            if (leaf1)
+            {
+                const CD_F32 cost1 = direct_cost1 + inherited_cost;
+                if (cost1 < best_cost)
+                {
+                    best_sibling = child1;
+                    best_cost = cost1;
+                }
+            }
+            else
+            {
+                ret = cd_aabb_perimeter(&nodes[child1].aabb, &area1);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                // 插入子节点1之下的代价下界
+                lower_cost1 = inherited_cost + direct_cost1 + CD_MIN(area_d - area1, 0.0f);
+            }
+
+            // 下降到子节点2的代价
+            CD_F32 lower_cost2 = CD_MAXABS_F;
+            CD_F32 direct_cost2;
+            CD_F32 area2 = 0.0f;
+            ret = cd_aabb_union(&nodes[child2].aabb, box, &union_box);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_perimeter(&union_box, &direct_cost2);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            if (leaf2)
+            {
+                const CD_F32 cost2 = direct_cost2 + inherited_cost;
+                if (cost2 < best_cost)
+                {
+                    best_sibling = child2;
+                    best_cost = cost2;
+                }
+            }
+            else
+            {
+                ret = cd_aabb_perimeter(&nodes[child2].aabb, &area2);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                lower_cost2 = inherited_cost + direct_cost2 + CD_MIN(area_d - area2, 0.0f);
+            }
+
+            if (leaf1 && leaf2)
+            {
+                break;
+            }
+
+            // 代价不可能再降低
+            if (best_cost <= lower_cost1 && best_cost <= lower_cost2)
+            {
+                break;
+            }
+
+            if (lower_cost1 == lower_cost2 && leaf1 == CD_FALSE)
+            {
+                // 两个子节点都完全包含新叶子时无法区分,改用中心距离
+                CD_VEC2 center1;
+                CD_VEC2 center2;
+                ret = cd_aabb_center(&nodes[child1].aabb, &center1);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                ret = cd_aabb_center(&nodes[child2].aabb, &center2);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                ret = cd_vec2_dis_sqr(&center1, &center_d, &lower_cost1);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                ret = cd_vec2_dis_sqr(&center2, &center_d, &lower_cost2);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            }
+
+            if (lower_cost1 < lower_cost2 && leaf1 == CD_FALSE)
+            {
+                index = child1;
+                area_base = area1;
+                direct_cost = direct_cost1;
+            }
+            else
+            {
+                index = child2;
+                area_base = area2;
+                direct_cost = direct_cost2;
+            }
+        }
+        *result = best_sibling;
+        return ret;
+    }
+
+    /**
+     * @brief 若旋转能降低子树的表面积代价,则对节点A做一次旋转
+     *
+     *         A
+     *       /   \
+     *      B     C
+     *     / \   / \
+     *    D   E F   G
+     *
+     * @param tree 动态树
+     * @param index_a 节点A的索引
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_rotate(CD_DYNAMIC_TREE *tree, CD_S32 index_a)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_TREE_NODE *nodes = tree->nodes;
+        CD_TREE_NODE *a = nodes + index_a;
+        if (a->height < 2)
+        {
+            return ret;
+        }
+
+        const CD_S32 index_b = a->child1;
+        const CD_S32 index_c = a->child2;
+        CD_TREE_NODE *b = nodes + index_b;
+        CD_TREE_NODE *c = nodes + index_c;
+
+        // 可选的旋转: B与F交换, B与G交换, C与D交换, C与E交换
+        enum
+        {
+            CD_ROTATE_NONE,
+            CD_ROTATE_BF,
+            CD_ROTATE_BG,
+            CD_ROTATE_CD,
+            CD_ROTATE_CE
+        } best_rotation = CD_ROTATE_NONE;
+
+        CD_AABB aabb_bg, aabb_bf, aabb_ce, aabb_cd;
+        CD_F32 cost_bf, cost_bg, cost_cd, cost_ce;
+
+        if (b->height == 0)
+        {
+            // B为叶子,C为内部节点,只能将B与C的子节点交换
+            const CD_TREE_NODE *f = nodes + c->child1;
+            const CD_TREE_NODE *g = nodes + c->child2;
+            CD_F32 cost_base;
+            ret = cd_aabb_perimeter(&c->aabb, &cost_base);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_union(&b->aabb, &g->aabb, &aabb_bg);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_perimeter(&aabb_bg, &cost_bf);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_union(&b->aabb, &f->aabb, &aabb_bf);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_perimeter(&aabb_bf, &cost_bg);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            if (cost_base < cost_bf && cost_base < cost_bg)
+            {
+                return ret;
+            }
+            best_rotation = cost_bf < cost_bg ? CD_ROTATE_BF : CD_ROTATE_BG;
+        }
+        else if (c->height == 0)
+        {
+            // C为叶子,B为内部节点,只能将C与B的子节点交换
+            const CD_TREE_NODE *d = nodes + b->child1;
+            const CD_TREE_NODE *e = nodes + b->child2;
+            CD_F32 cost_base;
+            ret = cd_aabb_perimeter(&b->aabb, &cost_base);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_union(&c->aabb, &e->aabb, &aabb_ce);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_perimeter(&aabb_ce, &cost_cd);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_union(&c->aabb, &d->aabb, &aabb_cd);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_perimeter(&aabb_cd, &cost_ce);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            if (cost_base < cost_cd && cost_base < cost_ce)
+            {
+                return ret;
+            }
+            best_rotation = cost_cd < cost_ce ? CD_ROTATE_CD : CD_ROTATE_CE;
+        }
+        else
+        {
+            const CD_TREE_NODE *d = nodes + b->child1;
+            const CD_TREE_NODE *e = nodes + b->child2;
+            const CD_TREE_NODE *f = nodes + c->child1;
+            const CD_TREE_NODE *g = nodes + c->child2;
+            CD_F32 area_b, area_c, area;
+            ret = cd_aabb_perimeter(&b->aabb, &area_b);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_perimeter(&c->aabb, &area_c);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            CD_F32 best_cost = area_b + area_c;
+
+            ret = cd_aabb_union(&b->aabb, &g->aabb, &aabb_bg);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_perimeter(&aabb_bg, &area);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            cost_bf = area_b + area;
+            if (cost_bf < best_cost)
+            {
+                best_rotation = CD_ROTATE_BF;
+                best_cost = cost_bf;
+            }
+
+            ret = cd_aabb_union(&b->aabb, &f->aabb, &aabb_bf);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_perimeter(&aabb_bf, &area);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            cost_bg = area_b + area;
+            if (cost_bg < best_cost)
+            {
+                best_rotation = CD_ROTATE_BG;
+                best_cost = cost_bg;
+            }
+
+            ret = cd_aabb_union(&c->aabb, &e->aabb, &aabb_ce);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_perimeter(&aabb_ce, &area);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            cost_cd = area_c + area;
+            if (cost_cd < best_cost)
+            {
+                best_rotation = CD_ROTATE_CD;
+                best_cost = cost_cd;
+            }
+
+            ret = cd_aabb_union(&c->aabb, &d->aabb, &aabb_cd);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            ret = cd_aabb_perimeter(&aabb_cd, &area);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            cost_ce = area_c + area;
+            if (cost_ce < best_cost)
+            {
+                best_rotation = CD_ROTATE_CE;
+                best_cost = cost_ce;
+            }
+        }
+
+        switch (best_rotation)
+        {
+        case CD_ROTATE_BF:
+        {
+            const CD_S32 index_f = c->child1;
+            CD_TREE_NODE *f = nodes + index_f;
+            a->child1 = index_f;
+            c->child1 = index_b;
+            b->parent = index_c;
+            f->parent = index_a;
+            c->aabb = aabb_bg;
+            c->height = 1 + CD_MAX(b->height, nodes[c->child2].height);
+            a->height = 1 + CD_MAX(c->height, f->height);
+            break;
+        }
+        case CD_ROTATE_BG:
+        {
+            const CD_S32 index_g = c->child2;
+            CD_TREE_NODE *g = nodes + index_g;
+            a->child1 = index_g;
+            c->child2 = index_b;
+            b->parent = index_c;
+            g->parent = index_a;
+            c->aabb = aabb_bf;
+            c->height = 1 + CD_MAX(b->height, nodes[c->child1].height);
+            a->height = 1 + CD_MAX(c->height, g->height);
+            break;
+        }
+        case CD_ROTATE_CD:
+        {
+            const CD_S32 index_d = b->child1;
+            CD_TREE_NODE *d = nodes + index_d;
+            a->child2 = index_d;
+            b->child1 = index_c;
+            c->parent = index_b;
+            d->parent = index_a;
+            b->aabb = aabb_ce;
+            b->height = 1 + CD_MAX(c->height, nodes[b->child2].height);
+            a->height = 1 + CD_MAX(b->height, d->height);
+            break;
+        }
+        case CD_ROTATE_CE:
+        {
+            const CD_S32 index_e = b->child2;
+            CD_TREE_NODE *e = nodes + index_e;
+            a->child2 = index_e;
+            b->child2 = index_c;
+            c->parent = index_b;
+            e->parent = index_a;
+            b->aabb = aabb_cd;
+            b->height = 1 + CD_MAX(c->height, nodes[b->child1].height);
+            a->height = 1 + CD_MAX(b->height, e->height);
+            break;
+        }
+        default:
+            break;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 插入叶子节点,并沿路径向上更新aabb、高度并旋转
+     * @param tree 动态树
+     * @param leaf 叶子节点索引
+     * @return ok / 参数异常 / 容量已满
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_insert_leaf(CD_DYNAMIC_TREE *tree, CD_S32 leaf)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_TREE_NODE *nodes = tree->nodes;
+        if (tree->root == CD_TREE_NULL_NODE)
+        {
+            tree->root = leaf;
+            nodes[leaf].parent = CD_TREE_NULL_NODE;
+            return ret;
+        }
+
+        // 1. 查找最佳兄弟节点
+        CD_S32 sibling;
+        ret = cd_dynamic_tree_find_best_sibling(tree, &nodes[leaf].aabb, &sibling);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+
+        // 2. 为叶子和兄弟节点新建父节点
+        const CD_S32 old_parent = nodes[sibling].parent;
+        CD_S32 new_parent;
+        ret = cd_dynamic_tree_allocate_node(tree, &new_parent);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        nodes[new_parent].parent = old_parent;
+        ret = cd_aabb_union(&nodes[leaf].aabb, &nodes[sibling].aabb, &nodes[new_parent].aabb);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        nodes[new_parent].height = nodes[sibling].height + 1;
+        nodes[new_parent].child1 = sibling;
+        nodes[new_parent].child2 = leaf;
+        nodes[sibling].parent = new_parent;
+        nodes[leaf].parent = new_parent;
+        if (old_parent != CD_TREE_NULL_NODE)
+        {
+            if (nodes[old_parent].child1 == sibling)
+            {
+                nodes[old_parent].child1 = new_parent;
+            }
+            else
+            {
+                nodes[old_parent].child2 = new_parent;
+            }
+        }
+        else
+        {
+            tree->root = new_parent;
+        }
+
+        // 3. 向上更新aabb与高度,并做旋转
+        CD_S32 index = nodes[leaf].parent;
+        while (index != CD_TREE_NULL_NODE)
+        {
+            const CD_S32 child1 = nodes[index].child1;
+            const CD_S32 child2 = nodes[index].child2;
+            ret = cd_aabb_union(&nodes[child1].aabb, &nodes[child2].aabb, &nodes[index].aabb);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            nodes[index].height = 1 + CD_MAX(nodes[child1].height, nodes[child2].height);
+            ret = cd_dynamic_tree_rotate(tree, index);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            index = nodes[index].parent;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 移除叶子节点,叶子节点本身不归还节点池
+     * @param tree 动态树
+     * @param leaf 叶子节点索引
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_remove_leaf(CD_DYNAMIC_TREE *tree, CD_S32 leaf)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_TREE_NODE *nodes = tree->nodes;
+        if (leaf == tree->root)
+        {
+            tree->root = CD_TREE_NULL_NODE;
+            return ret;
+        }
+
+        const CD_S32 parent = nodes[leaf].parent;
+        const CD_S32 grand_parent = nodes[parent].parent;
+        const CD_S32 sibling = nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1;
+
+        if (grand_parent == CD_TREE_NULL_NODE)
+        {
+            tree->root = sibling;
+            nodes[sibling].parent = CD_TREE_NULL_NODE;
+            return cd_dynamic_tree_free_node(tree, parent);
+        }
+
+        // 删除父节点,兄弟节点接到祖父节点上
+        if (nodes[grand_parent].child1 == parent)
+        {
+            nodes[grand_parent].child1 = sibling;
+        }
+        else
+        {
+            nodes[grand_parent].child2 = sibling;
+        }
+        nodes[sibling].parent = grand_parent;
+        ret = cd_dynamic_tree_free_node(tree, parent);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+
+        CD_S32 index = grand_parent;
+        while (index != CD_TREE_NULL_NODE)
+        {
+            CD_TREE_NODE *node = nodes + index;
+            const CD_TREE_NODE *child1 = nodes + node->child1;
+            const CD_TREE_NODE *child2 = nodes + node->child2;
+            ret = cd_aabb_union(&child1->aabb, &child2->aabb, &node->aabb);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            node->height = 1 + CD_MAX(child1->height, child2->height);
+            index = node->parent;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 插入一个障碍物,叶子的aabb会扩展 CD_AABB_MARGIN
+     * @param tree 动态树
+     * @param aabb 障碍物的aabb
+     * @param userData 用户数据
+     * @param result 叶子节点索引(proxyId)
+     * @return ok / 参数异常 / 容量已满
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_create_proxy(CD_DYNAMIC_TREE *tree, const CD_AABB *aabb, CD_S32 userData, CD_S32 *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL || aabb == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        // 叶子节点与其新父节点需要两个空闲节点
+        CD_CHECK_ERROR(tree->nodeCount + 2 > tree->nodeCapacity && tree->root != CD_TREE_NULL_NODE, COLLISION_DETECTION_E_MEM_FULL);
+        CD_S32 proxy_id;
+        ret = cd_dynamic_tree_allocate_node(tree, &proxy_id);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        CD_TREE_NODE *node = tree->nodes + proxy_id;
+        ret = cd_aabb_extend(aabb, CD_AABB_MARGIN, &node->aabb);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        node->userData = userData;
+        ret = cd_dynamic_tree_insert_leaf(tree, proxy_id);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        tree->proxyCount += 1;
+        *result = proxy_id;
+        return ret;
+    }
+
+    /**
+     * @brief 删除一个障碍物
+     * @param tree 动态树
+     * @param proxyId 叶子节点索引
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_destroy_proxy(CD_DYNAMIC_TREE *tree, CD_S32 proxyId)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(proxyId < 0 || proxyId >= tree->nodeCapacity || tree->nodes[proxyId].height != 0, COLLISION_DETECTION_E_PARAM_NULL);
+        ret = cd_dynamic_tree_remove_leaf(tree, proxyId);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = cd_dynamic_tree_free_node(tree, proxyId);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        tree->proxyCount -= 1;
+        return ret;
+    }
+
+    /**
+     * @brief 移动一个障碍物,新aabb仍在扩展后的aabb内时不修改树
+     * @param tree 动态树
+     * @param proxyId 叶子节点索引
+     * @param aabb 障碍物新的aabb
+     * @param moved 1 重新插入了叶子, 0 未修改树,可为null
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_move_proxy(CD_DYNAMIC_TREE *tree, CD_S32 proxyId, const CD_AABB *aabb, CD_BOOL *moved)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL || aabb == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(proxyId < 0 || proxyId >= tree->nodeCapacity || tree->nodes[proxyId].height != 0, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_BOOL contained;
+        ret = cd_aabb_contains(&tree->nodes[proxyId].aabb, aabb, &contained);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        if (moved != CD_NULL)
+        {
+            *moved = !contained;
+        }
+        if (contained)
+        {
+            return ret;
+        }
+        // 移除叶子会归还一个父节点,重新插入时一定有空闲节点
+        ret = cd_dynamic_tree_remove_leaf(tree, proxyId);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = cd_aabb_extend(aabb, CD_AABB_MARGIN, &tree->nodes[proxyId].aabb);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = cd_dynamic_tree_insert_leaf(tree, proxyId);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        return ret;
+    }
+
+    /**
+     * @brief 查询与aabb重叠的所有叶子
+     * @param tree 动态树
+     * @param aabb 查询的aabb
+     * @param callback 回调,返回0时终止查询
+     * @param context 回调上下文,可为null
+     * @return ok / 参数异常 / 树深度超过 CD_TREE_STACK_SIZE
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_query(const CD_DYNAMIC_TREE *tree, const CD_AABB *aabb, CD_TREE_QUERY_CALLBACK callback, CD_VOID *context)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL || aabb == CD_NULL || callback == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        if (tree->root == CD_TREE_NULL_NODE)
+        {
+            return ret;
+        }
+        CD_S32 stack[CD_TREE_STACK_SIZE];
+        CD_S32 stack_count = 0;
+        stack[stack_count++] = tree->root;
+        while (stack_count > 0)
+        {
+            const CD_S32 index = stack[--stack_count];
+            const CD_TREE_NODE *node = tree->nodes + index;
+            CD_BOOL overlap;
+            ret = cd_aabb_overlap(&node->aabb, aabb, &overlap);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            if (!overlap)
+            {
+                continue;
+            }
+            if (node->height == 0)
+            {
+                if (!callback(index, node->userData, context))
+                {
+                    return ret;
+                }
+            }
+            else
+            {
+                CD_CHECK_ERROR(stack_count + 2 > CD_TREE_STACK_SIZE, COLLISION_DETECTION_E_MEM_FULL);
+                stack[stack_count++] = node->child1;
+                stack[stack_count++] = node->child2;
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 获取叶子节点扩展后的aabb
+     * @param tree 动态树
+     * @param proxyId 叶子节点索引
+     * @param result 扩展后的aabb
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_get_fat_aabb(const CD_DYNAMIC_TREE *tree, CD_S32 proxyId, CD_AABB *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(proxyId < 0 || proxyId >= tree->nodeCapacity, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = tree->nodes[proxyId].aabb;
+        return ret;
+    }
+
+    /**
+     * @brief 获取叶子节点的用户数据
+     * @param tree 动态树
+     * @param proxyId 叶子节点索引
+     * @param result 用户数据
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_get_user_data(const CD_DYNAMIC_TREE *tree, CD_S32 proxyId, CD_S32 *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(proxyId < 0 || proxyId >= tree->nodeCapacity, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = tree->nodes[proxyId].userData;
+        return ret;
+    }
+
+    /**
+     * @brief 获取树的高度
+     * @param tree 动态树
+     * @param result 树的高度,空树为0
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_get_height(const CD_DYNAMIC_TREE *tree, CD_S32 *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = tree->root == CD_TREE_NULL_NODE ? 0 : tree->nodes[tree->root].height;
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __COLLISION_DETECTION_DYNAMIC_TREE_H__ */
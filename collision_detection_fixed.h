@@ -0,0 +1,676 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-18 14:27:05
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-18 14:27:05
+ */
+
+#ifndef __COLLISION_DETECTION_FIXED_H__
+#define __COLLISION_DETECTION_FIXED_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_vec2.h"
+#include "collision_detection_obb.h"
+
+/*
+ * 定点(整数毫米)确定性碰撞检测
+ *
+ * 坐标与长度单位为毫米(CD_S32),角度单位为毫弧度(CD_S32),旋转的 cos/sin 为 Q24 定点数(CD_FX_ONE 表示 1)。
+ * 全部计算只用整数加减乘、移位与整数除法,中间结果用 64 位,不依赖 FPU,相同输入在任何平台与编译选项下结果一致。
+ *
+ * 适用范围: 坐标与长宽的绝对值不超过 CD_FX_MAX_COORD(2^29 mm, 约 536 km),在此范围内所有 64 位中间量不会溢出。
+ *
+ * 误差上界:
+ * - sin/cos: |角度| <= 10^6 mrad 时,毫弧度先换算为 2^24 等分一周的角度(舍入误差不超过 2.8e-7 rad),
+ *            再查 257 项四分之一周期表并线性插值,插值误差不超过 4.8e-6,Q24 舍入不超过 6e-8,合计 |误差| <= 5.2e-6
+ * - aabb 重叠、线段相交判定: 精确,无误差
+ * - 点在 obb 内、obb 分离轴: 旋转误差引起的投影误差不超过 1.1e-5 * 距离,
+ *                           例如距 obb 中心 100 m 处的误差不超过 1.1 mm,边界接触视为重叠
+ * - obb 外接 aabb: 向外取整,保证包住 obb
+ * - 线段交点、点到线段最近点: 每个分量不超过 1 mm; 点到线段距离四舍五入到毫米,误差不超过 2 mm
+ * - 点到线段距离平方: 由叉积按 128 位精确计算后向上取整到平方毫米,与整数毫米安全距离的平方用 <= 比较时结果精确
+ */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CD_FX_SHIFT (24)                 // 旋转定点数的小数位数
+#define CD_FX_ONE (1 << CD_FX_SHIFT)     // 定点数 1.0
+#define CD_FX_MAX_COORD (1 << 29)        // 坐标与长宽绝对值上限,毫米
+#define CD_FX_ANGLE_BITS (24)            // 内部角度: 一周 2^24 等分
+#define CD_FX_ABS(x) ((x) < 0 ? -(x) : (x))
+
+    // 整数毫米点/向量
+    typedef struct _CD_FX_VEC2_
+    {
+        CD_S32 x; ///< 毫米
+        CD_S32 y; ///< 毫米
+    } CD_FX_VEC2;
+
+    // Q24 定点旋转
+    typedef struct _CD_FX_ROT_
+    {
+        CD_S32 c; ///< cos,Q24
+        CD_S32 s; ///< sin,Q24
+    } CD_FX_ROT;
+
+    // 整数毫米 aabb
+    typedef struct _CD_FX_AABB_
+    {
+        CD_FX_VEC2 lowerBound;
+        CD_FX_VEC2 upperBound;
+    } CD_FX_AABB;
+
+    // 整数毫米 obb
+    typedef struct _CD_FX_OBB_
+    {
+        CD_FX_VEC2 center; ///< 中心,毫米
+        CD_S32 length;     ///< 长,毫米
+        CD_S32 width;      ///< 宽,毫米
+        CD_FX_ROT q;       ///< 朝向
+    } CD_FX_OBB;
+
+    // 整数毫米线段
+    typedef struct _CD_FX_SEGMENT_
+    {
+        CD_FX_VEC2 point1;
+        CD_FX_VEC2 point2;
+    } CD_FX_SEGMENT;
+
+    // sin 在 [0, pi/2] 上 256 等分的取值,Q24
+    static const CD_S32 cdFxSinTable[257] = {
+        0, 102943, 205882, 308814, 411733, 514638, 617523, 720384,
+        823219, 926023, 1028791, 1131521, 1234209, 1336849, 1439440, 1541976,
+        1644455, 1746871, 1849222, 1951503, 2053710, 2155841, 2257890, 2359854,
+        2461729, 2563511, 2665197, 2766783, 2868265, 2969638, 3070900, 3172046,
+        3273072, 3373976, 3474752, 3575398, 3675909, 3776281, 3876512, 3976596,
+        4076531, 4176312, 4275936, 4375399, 4474698, 4573827, 4672785, 4771567,
+        4870169, 4968587, 5066819, 5164860, 5262706, 5360355, 5457801, 5555042,
+        5652074, 5748893, 5845495, 5941878, 6038037, 6133968, 6229669, 6325135,
+        6420363, 6515349, 6610090, 6704582, 6798821, 6892805, 6986529, 7079990,
+        7173184, 7266109, 7358759, 7451133, 7543226, 7635036, 7726557, 7817788,
+        7908725, 7999364, 8089701, 8179734, 8269459, 8358873, 8447972, 8536753,
+        8625213, 8713348, 8801154, 8888630, 8975771, 9062573, 9149035, 9235152,
+        9320922, 9406340, 9491405, 9576112, 9660458, 9744441, 9828057, 9911303,
+        9994176, 10076672, 10158790, 10240524, 10321873, 10402834, 10483403, 10563577,
+        10643353, 10722729, 10801701, 10880266, 10958422, 11036165, 11113493, 11190402,
+        11266890, 11342953, 11418590, 11493797, 11568571, 11642909, 11716809, 11790268,
+        11863283, 11935852, 12007971, 12079638, 12150850, 12221604, 12291899, 12361731,
+        12431097, 12499995, 12568423, 12636378, 12703856, 12770857, 12837376, 12903413,
+        12968963, 13034026, 13098597, 13162675, 13226258, 13289343, 13351928, 13414009,
+        13475586, 13536656, 13597215, 13657263, 13716797, 13775814, 13834313, 13892291,
+        13949745, 14006675, 14063077, 14118950, 14174291, 14229098, 14283370, 14337104,
+        14390298, 14442951, 14495059, 14546622, 14597637, 14648103, 14698017, 14747378,
+        14796184, 14844432, 14892122, 14939251, 14985817, 15031819, 15077256, 15122124,
+        15166424, 15210152, 15253308, 15295889, 15337895, 15379323, 15420172, 15460440,
+        15500126, 15539229, 15577747, 15615678, 15653022, 15689776, 15725939, 15761510,
+        15796488, 15830871, 15864658, 15897848, 15930439, 15962431, 15993821, 16024610,
+        16054795, 16084375, 16113350, 16141719, 16169479, 16196631, 16223173, 16249104,
+        16274424, 16299131, 16323224, 16346702, 16369565, 16391812, 16413442, 16434454,
+        16454846, 16474620, 16493773, 16512305, 16530216, 16547504, 16564169, 16580211,
+        16595628, 16610420, 16624588, 16638129, 16651044, 16663331, 16674992, 16686025,
+        16696429, 16706205, 16715352, 16723869, 16731757, 16739015, 16745643, 16751640,
+        16757007, 16761743, 16765847, 16769321, 16772163, 16774374, 16775953, 16776900,
+        16777216,
+    };
+
+    /**
+     * @brief 构建整数向量
+     * @param x 毫米
+     * @param y 毫米
+     * @return 向量
+     */
+    CD_INLINE CD_FX_VEC2 cd_fx_vec2_make_v(CD_S32 x, CD_S32 y)
+    {
+        CD_FX_VEC2 r;
+        r.x = x;
+        r.y = y;
+        return r;
+    }
+
+    /**
+     * @brief 浮点米转整数毫米,四舍五入,只用于在确定性计算之外准备输入
+     * @param v 米
+     * @return 毫米
+     */
+    CD_INLINE CD_FX_VEC2 cd_fx_vec2_from_vec2_v(CD_VEC2 v)
+    {
+        return cd_fx_vec2_make_v((CD_S32)floorf(v.x * 1000.0f + 0.5f), (CD_S32)floorf(v.y * 1000.0f + 0.5f));
+    }
+
+    /**
+     * @brief 非负数除法,四舍五入,无参数检查
+     * @param num 被除数
+     * @param den 除数,大于0
+     * @return 商
+     */
+    CD_INLINE CD_S64 cd_fx_div_round_v(CD_S64 num, CD_S64 den)
+    {
+        return num >= 0 ? (num + den / 2) / den : -((-num + den / 2) / den);
+    }
+
+    /**
+     * @brief 64位整数平方根,向下取整
+     * @param v 被开方数
+     * @return floor(sqrt(v))
+     */
+    CD_INLINE CD_U64 cd_fx_isqrt_v(CD_U64 v)
+    {
+        CD_U64 r = 0;
+        // 二分找到不超过 v 的最高的 4 的幂
+        CD_S32 shift = 0;
+        CD_S32 step = 32;
+        while (step >= 2)
+        {
+            if ((v >> (shift + step)) != 0)
+            {
+                shift += step;
+            }
+            step >>= 1;
+        }
+        CD_U64 bit = (CD_U64)1 << (shift & ~1);
+        if (v == 0)
+        {
+            return 0;
+        }
+        while (bit != 0)
+        {
+            // 无分支逐位确定: v >= r + bit 时减去并置位
+            const CD_U64 t = r + bit;
+            const CD_U64 mask = (CD_U64)0 - (CD_U64)(v >= t);
+            v -= t & mask;
+            r = (r >> 1) + (bit & mask);
+            bit >>= 2;
+        }
+        return r;
+    }
+
+    /**
+     * @brief num * num / den 向上取整的可移植实现,用 32 位拆分乘法得到 128 位乘积,再逐位长除,无参数检查
+     * @param num 被平方的数
+     * @param den 除数,大于0,且 num * num / den 小于 2^63
+     * @return ceil(num * num / den)
+     */
+    CD_INLINE CD_U64 cd_fx_sqr_div_ceil_soft_v(CD_U64 num, CD_U64 den)
+    {
+        // num * num = hi * 2^64 + lo
+        const CD_U64 n0 = num & 0xFFFFFFFFu;
+        const CD_U64 n1 = num >> 32;
+        const CD_U64 p00 = n0 * n0;
+        const CD_U64 p01 = n0 * n1;
+        const CD_U64 p11 = n1 * n1;
+        const CD_U64 mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) * 2;
+        const CD_U64 lo = (p00 & 0xFFFFFFFFu) | (mid << 32);
+        // 商小于 2^64 时 hi 小于 den,此后余数始终小于 den
+        CD_U64 rem = p11 + (p01 >> 32) * 2 + (mid >> 32);
+        CD_U64 q = 0;
+        for (CD_S32 i = 63; i >= 0; --i)
+        {
+            const CD_U64 top = rem >> 63;
+            rem = (rem << 1) | ((lo >> i) & 1u);
+            q <<= 1;
+            if (top != 0 || rem >= den)
+            {
+                rem -= den;
+                q |= 1u;
+            }
+        }
+        return q + (rem != 0 ? 1u : 0u);
+    }
+
+    /**
+     * @brief num * num / den 向上取整,编译器支持 128 位整数时直接计算,否则用可移植实现,两者结果一致,无参数检查
+     * @param num 被平方的数
+     * @param den 除数,大于0,且 num * num / den 小于 2^63
+     * @return ceil(num * num / den)
+     */
+    CD_INLINE CD_U64 cd_fx_sqr_div_ceil_v(CD_U64 num, CD_U64 den)
+    {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 sqr = (unsigned __int128)num * num;
+        return (CD_U64)((sqr + den - 1) / den);
+#else
+        return cd_fx_sqr_div_ceil_soft_v(num, den);
+#endif
+    }
+
+    /**
+     * @brief 四分之一周期内的 sin 查表与线性插值
+     * @param w 角度,[0, 2^22],2^22 对应 pi/2
+     * @return sin,Q24
+     */
+    CD_INLINE CD_S32 cd_fx_quarter_sin_v(CD_S32 w)
+    {
+        const CD_S32 idx = w >> 14;
+        if (idx >= 256)
+        {
+            return cdFxSinTable[256];
+        }
+        const CD_S32 frac = w & 0x3FFF;
+        const CD_S64 step = (CD_S64)(cdFxSinTable[idx + 1] - cdFxSinTable[idx]);
+        return cdFxSinTable[idx] + (CD_S32)((step * frac + (1 << 13)) >> 14);
+    }
+
+    /**
+     * @brief 查表计算 sin 与 cos,误差见文件头
+     * @param mrad 角度,毫弧度,任意范围
+     * @param s sin,Q24
+     * @param c cos,Q24
+     */
+    CD_INLINE CD_VOID cd_fx_sin_cos_v(CD_S32 mrad, CD_S32 *s, CD_S32 *c)
+    {
+        // 一周 2^24 等分的角度 = mrad * 2^24 / (2000 * pi),乘数为其 Q20 定点值,|mrad| < 2^31 时乘积不超过 64 位
+        const CD_U64 k = 2799883369u;
+        const CD_U64 mag = (CD_U64)(mrad < 0 ? -(CD_S64)mrad : (CD_S64)mrad);
+        CD_U32 angle = (CD_U32)((mag * k + (1u << 19)) >> 20);
+        if (mrad < 0)
+        {
+            angle = 0u - angle;
+        }
+        angle &= (1u << CD_FX_ANGLE_BITS) - 1u;
+
+        const CD_S32 quarter = 1 << (CD_FX_ANGLE_BITS - 2);
+        const CD_S32 w = (CD_S32)(angle & (CD_U32)(quarter - 1));
+        const CD_S32 sw = cd_fx_quarter_sin_v(w);
+        const CD_S32 cw = cd_fx_quarter_sin_v(quarter - w);
+        switch (angle >> (CD_FX_ANGLE_BITS - 2))
+        {
+        case 0:
+            *s = sw;
+            *c = cw;
+            break;
+        case 1:
+            *s = cw;
+            *c = -sw;
+            break;
+        case 2:
+            *s = -sw;
+            *c = -cw;
+            break;
+        default:
+            *s = -cw;
+            *c = sw;
+            break;
+        }
+    }
+
+    /**
+     * @brief 由毫弧度构建定点旋转
+     * @param mrad 角度,毫弧度
+     * @return 旋转
+     */
+    CD_INLINE CD_FX_ROT cd_fx_rot_from_mrad_v(CD_S32 mrad)
+    {
+        CD_FX_ROT r;
+        cd_fx_sin_cos_v(mrad, &r.s, &r.c);
+        return r;
+    }
+
+    /**
+     * @brief 构建整数obb,无参数检查
+     * @param center 中心,毫米
+     * @param length 长,毫米
+     * @param width 宽,毫米
+     * @param heading 朝向,毫弧度
+     * @return obb
+     */
+    CD_INLINE CD_FX_OBB cd_fx_create_obb_v(CD_FX_VEC2 center, CD_S32 length, CD_S32 width, CD_S32 heading)
+    {
+        CD_FX_OBB r;
+        r.center = center;
+        r.length = length;
+        r.width = width;
+        r.q = cd_fx_rot_from_mrad_v(heading);
+        return r;
+    }
+
+    /**
+     * @brief 浮点obb转整数obb,旋转直接量化为 Q24,只用于在确定性计算之外准备输入
+     * @param obb 浮点obb,单位米
+     * @return 整数obb
+     */
+    CD_INLINE CD_FX_OBB cd_fx_obb_from_obb_v(CD_OBB obb)
+    {
+        CD_FX_OBB r;
+        r.center = cd_fx_vec2_from_vec2_v(obb.center);
+        r.length = (CD_S32)floorf(obb.length * 1000.0f + 0.5f);
+        r.width = (CD_S32)floorf(obb.width * 1000.0f + 0.5f);
+        r.q.c = (CD_S32)floorf(obb.q.c * (CD_F32)CD_FX_ONE + 0.5f);
+        r.q.s = (CD_S32)floorf(obb.q.s * (CD_F32)CD_FX_ONE + 0.5f);
+        return r;
+    }
+
+    /**
+     * @brief 判断两个整数aabb是否重叠(含边界接触),无参数检查
+     * @param a aabb a
+     * @param b aabb b
+     * @return 1 重叠, 0 不重叠
+     */
+    CD_INLINE CD_BOOL cd_fx_aabb_overlap_v(CD_FX_AABB a, CD_FX_AABB b)
+    {
+        return (a.lowerBound.x <= b.upperBound.x && a.upperBound.x >= b.lowerBound.x &&
+                a.lowerBound.y <= b.upperBound.y && a.upperBound.y >= b.lowerBound.y);
+    }
+
+    /**
+     * @brief 判断两个整数aabb是否重叠(含边界接触)
+     * @param a aabb a
+     * @param b aabb b
+     * @param result 1 重叠, 0 不重叠
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_fx_aabb_overlap(const CD_FX_AABB *a, const CD_FX_AABB *b, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_fx_aabb_overlap_v(*a, *b);
+        return ret;
+    }
+
+    /**
+     * @brief 整数obb的外接aabb,向外取整,无参数检查
+     * @param obb obb
+     * @return aabb
+     */
+    CD_INLINE CD_FX_AABB cd_fx_obb_to_aabb_v(CD_FX_OBB obb)
+    {
+        // 2 * 半长宽投影,Q24
+        const CD_S64 ac = CD_FX_ABS((CD_S64)obb.q.c);
+        const CD_S64 as = CD_FX_ABS((CD_S64)obb.q.s);
+        const CD_S64 ex = ac * obb.length + as * obb.width;
+        const CD_S64 ey = as * obb.length + ac * obb.width;
+        const CD_S64 round_up = ((CD_S64)1 << (CD_FX_SHIFT + 1)) - 1;
+        const CD_S32 hx = (CD_S32)((ex + round_up) >> (CD_FX_SHIFT + 1));
+        const CD_S32 hy = (CD_S32)((ey + round_up) >> (CD_FX_SHIFT + 1));
+        CD_FX_AABB r;
+        r.lowerBound = cd_fx_vec2_make_v(obb.center.x - hx, obb.center.y - hy);
+        r.upperBound = cd_fx_vec2_make_v(obb.center.x + hx, obb.center.y + hy);
+        return r;
+    }
+
+    /**
+     * @brief 判断点是否在整数obb内(含边界),无参数检查
+     * @param obb obb
+     * @param point 点
+     * @return 1 在obb内, 0 不在obb内
+     */
+    CD_INLINE CD_BOOL cd_fx_is_point_in_obb_v(CD_FX_OBB obb, CD_FX_VEC2 point)
+    {
+        const CD_S64 x0 = (CD_S64)point.x - obb.center.x;
+        const CD_S64 y0 = (CD_S64)point.y - obb.center.y;
+        // 局部坐标 * 2,Q24,与长宽(Q24)比较
+        const CD_S64 dx = CD_FX_ABS(x0 * obb.q.c + y0 * obb.q.s) * 2;
+        const CD_S64 dy = CD_FX_ABS(y0 * obb.q.c - x0 * obb.q.s) * 2;
+        return (dx <= ((CD_S64)obb.length << CD_FX_SHIFT)) && (dy <= ((CD_S64)obb.width << CD_FX_SHIFT));
+    }
+
+    /**
+     * @brief 判断点是否在整数obb内(含边界)
+     * @param obb obb
+     * @param point 点
+     * @param result 1 在obb内, 0 不在obb内
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_fx_is_point_in_obb(const CD_FX_OBB *obb, const CD_FX_VEC2 *point, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(obb == CD_NULL || point == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_fx_is_point_in_obb_v(*obb, *point);
+        return ret;
+    }
+
+    /**
+     * @brief 分离轴检测两个整数obb是否重叠(含边界接触),无参数检查
+     * @param a obb a
+     * @param b obb b
+     * @return 1 重叠, 0 不重叠
+     */
+    CD_INLINE CD_BOOL cd_fx_obb_overlap_v(CD_FX_OBB a, CD_FX_OBB b)
+    {
+        const CD_S64 tx = (CD_S64)b.center.x - a.center.x;
+        const CD_S64 ty = (CD_S64)b.center.y - a.center.y;
+        const CD_S64 half = (CD_S64)1 << (CD_FX_SHIFT - 1);
+        // a与b的轴之间夹角余弦的绝对值,Q24
+        const CD_S64 r00 = (CD_FX_ABS((CD_S64)a.q.c * b.q.c + (CD_S64)a.q.s * b.q.s) + half) >> CD_FX_SHIFT;
+        const CD_S64 r01 = (CD_FX_ABS((CD_S64)a.q.s * b.q.c - (CD_S64)a.q.c * b.q.s) + half) >> CD_FX_SHIFT;
+        const CD_S64 la = (CD_S64)a.length << CD_FX_SHIFT;
+        const CD_S64 wa = (CD_S64)a.width << CD_FX_SHIFT;
+        const CD_S64 lb = (CD_S64)b.length << CD_FX_SHIFT;
+        const CD_S64 wb = (CD_S64)b.width << CD_FX_SHIFT;
+
+        // 两边同乘2,投影与长宽都为 Q24
+        // a的x轴
+        if (CD_FX_ABS(tx * a.q.c + ty * a.q.s) * 2 > la + b.length * r00 + b.width * r01)
+        {
+            return CD_FALSE;
+        }
+        // a的y轴
+        if (CD_FX_ABS(ty * a.q.c - tx * a.q.s) * 2 > wa + b.length * r01 + b.width * r00)
+        {
+            return CD_FALSE;
+        }
+        // b的x轴
+        if (CD_FX_ABS(tx * b.q.c + ty * b.q.s) * 2 > a.length * r00 + a.width * r01 + lb)
+        {
+            return CD_FALSE;
+        }
+        // b的y轴
+        if (CD_FX_ABS(ty * b.q.c - tx * b.q.s) * 2 > a.length * r01 + a.width * r00 + wb)
+        {
+            return CD_FALSE;
+        }
+        return CD_TRUE;
+    }
+
+    /**
+     * @brief 分离轴检测两个整数obb是否重叠(含边界接触)
+     * @param a obb a
+     * @param b obb b
+     * @param result 1 重叠, 0 不重叠
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_fx_obb_overlap(const CD_FX_OBB *a, const CD_FX_OBB *b, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_fx_obb_overlap_v(*a, *b);
+        return ret;
+    }
+
+    /**
+     * @brief 把比例 num / den (0 <= num <= den) 的分子分母同时右移到 31 位以内,使后续乘毫米坐标不溢出
+     * @param num 分子
+     * @param den 分母
+     */
+    CD_INLINE CD_VOID cd_fx_shrink_ratio_v(CD_S64 *num, CD_S64 *den)
+    {
+        while (*den >= ((CD_S64)1 << 31))
+        {
+            *num >>= 1;
+            *den >>= 1;
+        }
+    }
+
+    /**
+     * @brief 判断值是否在两个边界之间(含边界)
+     */
+    CD_INLINE CD_BOOL cd_fx_is_with_in_v(CD_S32 val, CD_S32 bound1, CD_S32 bound2)
+    {
+        return (val >= CD_MIN(bound1, bound2)) && (val <= CD_MAX(bound1, bound2));
+    }
+
+    /**
+     * @brief 判断两条整数线段是否相交,方向判定是精确的,端点接触与共线重叠视为相交,无参数检查
+     * @param seg1 线段1
+     * @param seg2 线段2
+     * @param point 交点,四舍五入到毫米,可为null
+     * @return 1 相交, 0 不相交
+     */
+    CD_INLINE CD_BOOL cd_fx_segments_intersect_v(CD_FX_SEGMENT seg1, CD_FX_SEGMENT seg2, CD_FX_VEC2 *point)
+    {
+        const CD_S32 x1 = seg1.point1.x, y1 = seg1.point1.y, x2 = seg1.point2.x, y2 = seg1.point2.y;
+        const CD_S32 x3 = seg2.point1.x, y3 = seg2.point1.y, x4 = seg2.point2.x, y4 = seg2.point2.y;
+        const CD_S64 ex1 = (CD_S64)x2 - x1;
+        const CD_S64 ey1 = (CD_S64)y2 - y1;
+        const CD_S64 ex2 = (CD_S64)x4 - x3;
+        const CD_S64 ey2 = (CD_S64)y4 - y3;
+        const CD_S64 d1 = ex2 * ((CD_S64)y1 - y3) - ey2 * ((CD_S64)x1 - x3);
+        const CD_S64 d2 = ex2 * ((CD_S64)y2 - y3) - ey2 * ((CD_S64)x2 - x3);
+        const CD_S64 d3 = ex1 * ((CD_S64)y3 - y1) - ey1 * ((CD_S64)x3 - x1);
+        const CD_S64 d4 = ex1 * ((CD_S64)y4 - y1) - ey1 * ((CD_S64)x4 - x1);
+
+        // 严格相交:两条线段的端点都分居另一条线段两侧
+        if (((d1 > 0 && d2 < 0) || (d1 < 0 && d2 > 0)) && ((d3 > 0 && d4 < 0) || (d3 < 0 && d4 > 0)))
+        {
+            if (point != CD_NULL)
+            {
+                // t = d1 / (d1 - d2),取同号后在 (0, 1) 内
+                CD_S64 num = d1 > 0 ? d1 : -d1;
+                CD_S64 den = d1 > 0 ? d1 - d2 : d2 - d1;
+                cd_fx_shrink_ratio_v(&num, &den);
+                point->x = x1 + (CD_S32)cd_fx_div_round_v(ex1 * num, den);
+                point->y = y1 + (CD_S32)cd_fx_div_round_v(ey1 * num, den);
+            }
+            return CD_TRUE;
+        }
+
+        // 端点接触或共线重叠
+        CD_FX_VEC2 p;
+        if (d3 == 0 && cd_fx_is_with_in_v(x3, x1, x2) && cd_fx_is_with_in_v(y3, y1, y2))
+        {
+            p = seg2.point1;
+        }
+        else if (d4 == 0 && cd_fx_is_with_in_v(x4, x1, x2) && cd_fx_is_with_in_v(y4, y1, y2))
+        {
+            p = seg2.point2;
+        }
+        else if (d1 == 0 && cd_fx_is_with_in_v(x1, x3, x4) && cd_fx_is_with_in_v(y1, y3, y4))
+        {
+            p = seg1.point1;
+        }
+        else if (d2 == 0 && cd_fx_is_with_in_v(x2, x3, x4) && cd_fx_is_with_in_v(y2, y3, y4))
+        {
+            p = seg1.point2;
+        }
+        else
+        {
+            return CD_FALSE;
+        }
+        if (point != CD_NULL)
+        {
+            *point = p;
+        }
+        return CD_TRUE;
+    }
+
+    /**
+     * @brief 判断两条整数线段是否相交
+     * @param seg1 线段1
+     * @param seg2 线段2
+     * @param point 交点,可为null
+     * @param result 1 相交, 0 不相交
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_fx_segments_intersect(const CD_FX_SEGMENT *seg1, const CD_FX_SEGMENT *seg2, CD_FX_VEC2 *point, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(seg1 == CD_NULL || seg2 == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_fx_segments_intersect_v(*seg1, *seg2, point);
+        return ret;
+    }
+
+    /**
+     * @brief 整数线段上距离点最近的点,四舍五入到毫米,退化线段返回起点,无参数检查
+     * @param seg 线段
+     * @param point 点
+     * @return 最近点
+     */
+    CD_INLINE CD_FX_VEC2 cd_fx_segment_nearest_point_v(CD_FX_SEGMENT seg, CD_FX_VEC2 point)
+    {
+        const CD_S64 dx = (CD_S64)seg.point2.x - seg.point1.x;
+        const CD_S64 dy = (CD_S64)seg.point2.y - seg.point1.y;
+        CD_S64 num = dx * ((CD_S64)point.x - seg.point1.x) + dy * ((CD_S64)point.y - seg.point1.y);
+        CD_S64 den = dx * dx + dy * dy;
+        if (num <= 0 || den == 0)
+        {
+            return seg.point1;
+        }
+        if (num >= den)
+        {
+            return seg.point2;
+        }
+        cd_fx_shrink_ratio_v(&num, &den);
+        return cd_fx_vec2_make_v(seg.point1.x + (CD_S32)cd_fx_div_round_v(dx * num, den),
+                                 seg.point1.y + (CD_S32)cd_fx_div_round_v(dy * num, den));
+    }
+
+    /**
+     * @brief 点到整数线段的距离平方,向上取整到平方毫米,无参数检查
+     *        投影落在端点外时为到端点的整数距离平方;落在线段内部时为 cross^2 / |d|^2,按 128 位精确计算,
+     *        因此对整数安全距离 c, 返回值 <= c * c 当且仅当真实距离 <= c,不会因舍入漏报
+     * @param seg 线段
+     * @param point 点
+     * @return 距离平方,平方毫米
+     */
+    CD_INLINE CD_S64 cd_fx_segment_dis_sqr_to_point_v(CD_FX_SEGMENT seg, CD_FX_VEC2 point)
+    {
+        const CD_S64 dx = (CD_S64)seg.point2.x - seg.point1.x;
+        const CD_S64 dy = (CD_S64)seg.point2.y - seg.point1.y;
+        const CD_S64 wx = (CD_S64)point.x - seg.point1.x;
+        const CD_S64 wy = (CD_S64)point.y - seg.point1.y;
+        const CD_S64 dot = dx * wx + dy * wy;
+        const CD_S64 den = dx * dx + dy * dy;
+        if (dot <= 0 || den == 0)
+        {
+            return wx * wx + wy * wy;
+        }
+        if (dot >= den)
+        {
+            const CD_S64 ex = (CD_S64)point.x - seg.point2.x;
+            const CD_S64 ey = (CD_S64)point.y - seg.point2.y;
+            return ex * ex + ey * ey;
+        }
+        const CD_S64 cross = dx * wy - dy * wx;
+        return (CD_S64)cd_fx_sqr_div_ceil_v((CD_U64)CD_FX_ABS(cross), (CD_U64)den);
+    }
+
+    /**
+     * @brief 计算点到整数线段的距离,并找到最近点
+     * @param seg 线段
+     * @param point 点
+     * @param nearest_pt 最近点,可为null
+     * @param distance 距离,四舍五入到毫米,可为null
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_fx_segment_dis_to_point(const CD_FX_SEGMENT *seg, const CD_FX_VEC2 *point, CD_FX_VEC2 *nearest_pt, CD_S32 *distance)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(seg == CD_NULL || point == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_FX_VEC2 nearest = cd_fx_segment_nearest_point_v(*seg, *point);
+        if (nearest_pt != CD_NULL)
+        {
+            *nearest_pt = nearest;
+        }
+        if (distance != CD_NULL)
+        {
+            const CD_S64 ex = (CD_S64)point->x - nearest.x;
+            const CD_S64 ey = (CD_S64)point->y - nearest.y;
+            const CD_U64 sqr = (CD_U64)(ex * ex + ey * ey);
+            CD_U64 root = cd_fx_isqrt_v(sqr);
+            // (root + 0.5)^2 = root^2 + root + 0.25
+            if (sqr - root * root > root)
+            {
+                ++root;
+            }
+            *distance = (CD_S32)root;
+        }
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __COLLISION_DETECTION_FIXED_H__ */
@@ -0,0 +1,514 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-16 17:12:54
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-16 17:12:54
+ */
+
+#ifndef __COLLISION_DETECTION_GRID_H__
+#define __COLLISION_DETECTION_GRID_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_vec2.h"
+#include "collision_detection_circle.h"
+#include "collision_detection_obb.h"
+#include "collision_detection_allocator.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CD_GRID_FREE 0      // 空闲栅格
+#define CD_GRID_OCCUPIED 1  // 占据栅格
+#define CD_GRID_INF 1e20f   // 距离变换中的无穷大(栅格距离的平方)
+#define CD_GRID_SQRT2 1.41421356f
+
+// 距离变换需要的浮点临时内存大小: 窗口内的列变换结果 + 单行的 d/z 缓存
+#define CD_GRID_SCRATCH_SIZE(width, height) ((width) * (height) + 2 * CD_MAX(width, height) + 1)
+// 距离变换需要的下标临时内存大小
+#define CD_GRID_INDEX_SIZE(width, height) (CD_MAX(width, height))
+
+    // 占据栅格地图及其欧氏距离场,所有内存由调用者预先分配
+    typedef struct _CD_GRID_MAP_
+    {
+        CD_U08 *cells;          // 占据状态,行优先, width * height, 非0为占据
+        CD_F32 *distance;       // 栅格中心到最近占据栅格中心的距离(米),截断到 maxDistance
+        CD_F32 *scratch;        // 距离变换的浮点临时内存
+        CD_S32 *indices;        // 距离变换的下标临时内存
+        CD_S32 width;           // 列数
+        CD_S32 height;          // 行数
+        CD_F32 resolution;      // 栅格边长(米)
+        CD_F32 invResolution;   // 栅格边长的倒数
+        CD_VEC2 origin;         // 栅格(0, 0)左下角的世界坐标
+        CD_F32 maxDistance;     // 距离场截断距离,<= 0 表示不截断
+        CD_S32 dirtyMinX;       // 待更新距离场的栅格范围, dirtyMinX > dirtyMaxX 表示无
+        CD_S32 dirtyMinY;
+        CD_S32 dirtyMaxX;
+        CD_S32 dirtyMaxY;
+    } CD_GRID_MAP;
+
+    /**
+     * @brief 初始化栅格地图,所有栅格置为空闲,整个距离场标记为待更新
+     * @param map 栅格地图
+     * @param width 列数
+     * @param height 行数
+     * @param resolution 栅格边长(米)
+     * @param origin 栅格(0, 0)左下角的世界坐标
+     * @param maxDistance 距离场截断距离(米),<= 0 表示不截断;
+     *        截断后栅格变化只影响其周围 maxDistance 范围内的距离,增量更新只需重算局部窗口
+     * @param cells 占据状态数组,长度为 width * height
+     * @param distance 距离场数组,长度为 width * height
+     * @param scratch 浮点临时内存,长度为 CD_GRID_SCRATCH_SIZE(width, height)
+     * @param indices 下标临时内存,长度为 CD_GRID_INDEX_SIZE(width, height)
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_grid_map_init(CD_GRID_MAP *map, CD_S32 width, CD_S32 height, CD_F32 resolution,
+                                      const CD_VEC2 *origin, CD_F32 maxDistance,
+                                      CD_U08 *cells, CD_F32 *distance, CD_F32 *scratch, CD_S32 *indices)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(map == CD_NULL || origin == CD_NULL || cells == CD_NULL || distance == CD_NULL ||
+                           scratch == CD_NULL || indices == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(width <= 0 || height <= 0 || resolution <= CD_EPS, COLLISION_DETECTION_E_ZERO_NUM);
+        map->cells = cells;
+        map->distance = distance;
+        map->scratch = scratch;
+        map->indices = indices;
+        map->width = width;
+        map->height = height;
+        map->resolution = resolution;
+        map->invResolution = 1.0f / resolution;
+        map->origin = *origin;
+        map->maxDistance = maxDistance;
+        for (CD_S32 i = 0; i < width * height; ++i)
+        {
+            cells[i] = CD_GRID_FREE;
+        }
+        map->dirtyMinX = 0;
+        map->dirtyMinY = 0;
+        map->dirtyMaxX = width - 1;
+        map->dirtyMaxY = height - 1;
+        return ret;
+    }
+
+    /**
+     * @brief 在线性分配器上分配占据状态、距离场与临时内存并初始化栅格地图
+     * @param map 栅格地图
+     * @param arena 线性分配器
+     * @param width 列数
+     * @param height 行数
+     * @param resolution 栅格边长(米)
+     * @param origin 栅格(0, 0)左下角的世界坐标
+     * @param maxDistance 距离场截断距离(米),<= 0 表示不截断
+     * @return ok / 参数异常 / 线性分配器容量不足
+     */
+    CD_INLINE CD_RET cd_grid_map_init_from_arena(CD_GRID_MAP *map, CD_ARENA *arena, CD_S32 width, CD_S32 height,
+                                                 CD_F32 resolution, const CD_VEC2 *origin, CD_F32 maxDistance)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(map == CD_NULL || arena == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(width <= 0 || height <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        CD_U08 *cells = CD_NULL;
+        CD_F32 *distance = CD_NULL;
+        CD_F32 *scratch = CD_NULL;
+        CD_S32 *indices = CD_NULL;
+        ret = CD_ARENA_ALLOC_ARRAY(arena, CD_U08, width * height, &cells);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = CD_ARENA_ALLOC_ARRAY(arena, CD_F32, width * height, &distance);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = CD_ARENA_ALLOC_ARRAY(arena, CD_F32, CD_GRID_SCRATCH_SIZE(width, height), &scratch);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = CD_ARENA_ALLOC_ARRAY(arena, CD_S32, CD_GRID_INDEX_SIZE(width, height), &indices);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        return cd_grid_map_init(map, width, height, resolution, origin, maxDistance, cells, distance, scratch, indices);
+    }
+
+    /**
+     * @brief 把以栅格为单位的坐标向下取整为栅格下标,无参数检查
+     *        先在浮点域截断到 [-1, count] 再转换为整数,超出 CD_S32 范围的坐标与 NaN 不会产生未定义行为
+     * @param value 以栅格为单位的坐标
+     * @param count 该方向上的栅格数
+     * @return 栅格下标, -1 表示在下方之外(含 NaN), count 表示在上方之外
+     */
+    CD_INLINE CD_S32 cd_grid_map_coord_v(CD_F32 value, CD_S32 count)
+    {
+        const CD_F32 f = floorf(value);
+        if (!(f >= 0.0f))
+        {
+            return -1;
+        }
+        return f >= (CD_F32)count ? count : (CD_S32)f;
+    }
+
+    /**
+     * @brief 计算世界坐标所在的栅格坐标,无参数检查
+     * @param map 栅格地图
+     * @param point 世界坐标
+     * @param cell_x 栅格坐标x,地图范围外时截断到 [-1, width]
+     * @param cell_y 栅格坐标y,地图范围外时截断到 [-1, height]
+     * @return 1 在地图范围内, 0 在范围外
+     */
+    CD_INLINE CD_BOOL cd_grid_map_cell_v(const CD_GRID_MAP *map, CD_VEC2 point, CD_S32 *cell_x, CD_S32 *cell_y)
+    {
+        *cell_x = cd_grid_map_coord_v((point.x - map->origin.x) * map->invResolution, map->width);
+        *cell_y = cd_grid_map_coord_v((point.y - map->origin.y) * map->invResolution, map->height);
+        return *cell_x >= 0 && *cell_x < map->width && *cell_y >= 0 && *cell_y < map->height;
+    }
+
+    /**
+     * @brief 设置栅格的占据状态,并扩大待更新范围;距离场在 cd_grid_map_update_distance 时更新
+     * @param map 栅格地图
+     * @param cell_x 栅格坐标x
+     * @param cell_y 栅格坐标y
+     * @param occupied 非0为占据
+     * @return ok / 参数异常 / 栅格坐标在地图范围外
+     */
+    CD_INLINE CD_RET cd_grid_map_set_cell(CD_GRID_MAP *map, CD_S32 cell_x, CD_S32 cell_y, CD_BOOL occupied)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(map == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(cell_x < 0 || cell_x >= map->width || cell_y < 0 || cell_y >= map->height, COLLISION_DETECTION_E_CALC_ERROR);
+        const CD_U08 value = occupied ? CD_GRID_OCCUPIED : CD_GRID_FREE;
+        CD_U08 *cell = map->cells + cell_y * map->width + cell_x;
+        if ((*cell != CD_GRID_FREE) == (value != CD_GRID_FREE))
+        {
+            return ret;
+        }
+        *cell = value;
+        map->dirtyMinX = CD_MIN(map->dirtyMinX, cell_x);
+        map->dirtyMinY = CD_MIN(map->dirtyMinY, cell_y);
+        map->dirtyMaxX = CD_MAX(map->dirtyMaxX, cell_x);
+        map->dirtyMaxY = CD_MAX(map->dirtyMaxY, cell_y);
+        return ret;
+    }
+
+    /**
+     * @brief 一维平方距离变换(Felzenszwalb-Huttenlocher 下包络抛物线),无参数检查
+     * @param f 输入的平方距离,长度为 n, >= CD_GRID_INF 表示该处没有障碍
+     * @param n 长度
+     * @param d 输出的平方距离,长度为 n
+     * @param v 下包络抛物线的顶点下标,长度为 n
+     * @param z 相邻抛物线的交点,长度为 n + 1
+     */
+    CD_INLINE CD_VOID cd_grid_edt_1d_v(const CD_F32 *f, CD_S32 n, CD_F32 *d, CD_S32 *v, CD_F32 *z)
+    {
+        CD_S32 k = -1;
+        for (CD_S32 q = 0; q < n; ++q)
+        {
+            if (f[q] >= CD_GRID_INF)
+            {
+                continue;
+            }
+            const CD_F32 fq = f[q] + (CD_F32)q * (CD_F32)q;
+            CD_F32 s = -CD_GRID_INF;
+            while (k >= 0)
+            {
+                const CD_S32 p = v[k];
+                s = (fq - (f[p] + (CD_F32)p * (CD_F32)p)) / (CD_F32)(2 * (q - p));
+                if (s > z[k])
+                {
+                    break;
+                }
+                --k;
+            }
+            ++k;
+            v[k] = q;
+            z[k] = k == 0 ? -CD_GRID_INF : s;
+            z[k + 1] = CD_GRID_INF;
+        }
+        if (k < 0)
+        {
+            for (CD_S32 q = 0; q < n; ++q)
+            {
+                d[q] = CD_GRID_INF;
+            }
+            return;
+        }
+        k = 0;
+        for (CD_S32 q = 0; q < n; ++q)
+        {
+            while (z[k + 1] < (CD_F32)q)
+            {
+                ++k;
+            }
+            const CD_F32 dq = (CD_F32)(q - v[k]);
+            d[q] = dq * dq + f[v[k]];
+        }
+    }
+
+    /**
+     * @brief 按待更新范围重算距离场,没有待更新范围时直接返回
+     *        截断时只重算待更新范围外扩 maxDistance 的窗口,窗口再外扩 maxDistance 内的障碍参与计算;
+     *        不截断时重算整张地图。列、行各做一次一维变换,复杂度与窗口面积成线性
+     * @param map 栅格地图
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_grid_map_update_distance(CD_GRID_MAP *map)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(map == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        if (map->dirtyMinX > map->dirtyMaxX || map->dirtyMinY > map->dirtyMaxY)
+        {
+            return ret;
+        }
+        const CD_S32 width = map->width;
+        const CD_S32 height = map->height;
+        const CD_BOOL truncated = map->maxDistance > 0.0f;
+        const CD_S32 full = CD_MAX(width, height);
+        const CD_S32 reach = truncated ? (CD_S32)CD_MIN(ceilf(map->maxDistance * map->invResolution), (CD_F32)full) : full;
+
+        // 写回窗口 [ix0, ix1] x [iy0, iy1],计算窗口 [ox0, ox1] x [oy0, oy1]
+        const CD_S32 ix0 = CD_MAX(map->dirtyMinX - reach, 0);
+        const CD_S32 iy0 = CD_MAX(map->dirtyMinY - reach, 0);
+        const CD_S32 ix1 = CD_MIN(map->dirtyMaxX + reach, width - 1);
+        const CD_S32 iy1 = CD_MIN(map->dirtyMaxY + reach, height - 1);
+        const CD_S32 ox0 = CD_MAX(ix0 - reach, 0);
+        const CD_S32 oy0 = CD_MAX(iy0 - reach, 0);
+        const CD_S32 ox1 = CD_MIN(ix1 + reach, width - 1);
+        const CD_S32 oy1 = CD_MIN(iy1 + reach, height - 1);
+        const CD_S32 ow = ox1 - ox0 + 1;
+        const CD_S32 oh = oy1 - oy0 + 1;
+
+        CD_F32 *columns = map->scratch;
+        CD_F32 *d = columns + width * height;
+        CD_F32 *z = d + CD_MAX(width, height);
+
+        // 列变换: 输入只有0和无穷大,一维距离即到列内最近占据栅格的栅格数,
+        // 用向下、向上两次逐行扫描求得,按行连续访存
+        for (CD_S32 y = oy0; y <= oy1; ++y)
+        {
+            const CD_U08 *cells = map->cells + y * width + ox0;
+            CD_F32 *col = columns + (y - oy0) * ow;
+            const CD_F32 *prev = col - ow;
+            for (CD_S32 i = 0; i < ow; ++i)
+            {
+                col[i] = cells[i] != CD_GRID_FREE ? 0.0f : (y > oy0 ? prev[i] + 1.0f : CD_GRID_INF);
+            }
+        }
+        for (CD_S32 r = oh - 2; r >= 0; --r)
+        {
+            CD_F32 *col = columns + r * ow;
+            const CD_F32 *next = col + ow;
+            for (CD_S32 i = 0; i < ow; ++i)
+            {
+                col[i] = CD_MIN(col[i], next[i] + 1.0f);
+            }
+        }
+
+        // 行变换,只写回内层窗口
+        const CD_F32 max_distance = truncated ? map->maxDistance : CD_MAXABS_F;
+        for (CD_S32 y = iy0; y <= iy1; ++y)
+        {
+            CD_F32 *col = columns + (y - oy0) * ow;
+            for (CD_S32 i = 0; i < ow; ++i)
+            {
+                col[i] = col[i] >= CD_GRID_INF ? CD_GRID_INF : col[i] * col[i];
+            }
+            cd_grid_edt_1d_v(col, ow, d, map->indices, z);
+            CD_F32 *row = map->distance + y * width;
+            for (CD_S32 x = ix0; x <= ix1; ++x)
+            {
+                const CD_F32 sqr = d[x - ox0];
+                row[x] = sqr >= CD_GRID_INF ? max_distance : CD_MIN(sqrtf(sqr) * map->resolution, max_distance);
+            }
+        }
+
+        map->dirtyMinX = width;
+        map->dirtyMinY = height;
+        map->dirtyMaxX = -1;
+        map->dirtyMaxY = -1;
+        return ret;
+    }
+
+    /**
+     * @brief 查询点的净空距离,即所在栅格中心到最近占据栅格中心的距离,只读一次内存,无参数检查
+     *        地图范围外的点取最近的边界栅格
+     * @param map 栅格地图,距离场需已更新
+     * @param point 世界坐标
+     * @return 距离(米)
+     */
+    CD_INLINE CD_F32 cd_grid_map_clearance_v(const CD_GRID_MAP *map, CD_VEC2 point)
+    {
+        CD_S32 cell_x;
+        CD_S32 cell_y;
+        cd_grid_map_cell_v(map, point, &cell_x, &cell_y);
+        cell_x = CD_CLIP(cell_x, 0, map->width - 1);
+        cell_y = CD_CLIP(cell_y, 0, map->height - 1);
+        return map->distance[cell_y * map->width + cell_x];
+    }
+
+    /**
+     * @brief 查询点的净空距离
+     * @param map 栅格地图,距离场需已更新
+     * @param point 世界坐标
+     * @param result 距离(米)
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_grid_map_clearance(const CD_GRID_MAP *map, const CD_VEC2 *point, CD_F32 *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(map == CD_NULL || point == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_grid_map_clearance_v(map, *point);
+        return ret;
+    }
+
+    /**
+     * @brief 用距离场快速判断圆形与占据栅格(视为正方形)的关系,无参数检查
+     *        点到所在栅格中心、占据栅格中心到其边界各有半个对角线的误差
+     * @param map 栅格地图,距离场需已更新
+     * @param center 圆心
+     * @param radius 半径
+     * @return 1 一定碰撞, 0 一定不碰撞, -1 无法确定(含圆心在地图范围外)
+     */
+    CD_INLINE CD_S32 cd_grid_map_circle_bound_v(const CD_GRID_MAP *map, CD_VEC2 center, CD_F32 radius)
+    {
+        CD_S32 cell_x;
+        CD_S32 cell_y;
+        if (!cd_grid_map_cell_v(map, center, &cell_x, &cell_y))
+        {
+            return -1;
+        }
+        const CD_F32 clearance = map->distance[cell_y * map->width + cell_x];
+        const CD_F32 half_diagonal = 0.5f * CD_GRID_SQRT2 * map->resolution;
+        if (clearance - 2.0f * half_diagonal > radius)
+        {
+            return 0;
+        }
+        const CD_BOOL truncated = map->maxDistance > 0.0f && clearance >= map->maxDistance;
+        if (!truncated && clearance + half_diagonal - 0.5f * map->resolution < radius)
+        {
+            return 1;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief 逐个检查范围内的占据栅格是否与圆形重叠,无参数检查
+     * @param map 栅格地图
+     * @param circle 圆形
+     * @return 1 碰撞, 0 不碰撞
+     */
+    CD_INLINE CD_BOOL cd_grid_map_circle_scan_v(const CD_GRID_MAP *map, CD_CIRCLE circle)
+    {
+        const CD_F32 res = map->resolution;
+        const CD_S32 x0 = CD_MAX(cd_grid_map_coord_v((circle.center.x - circle.radius - map->origin.x) * map->invResolution, map->width), 0);
+        const CD_S32 y0 = CD_MAX(cd_grid_map_coord_v((circle.center.y - circle.radius - map->origin.y) * map->invResolution, map->height), 0);
+        const CD_S32 x1 = CD_MIN(cd_grid_map_coord_v((circle.center.x + circle.radius - map->origin.x) * map->invResolution, map->width), map->width - 1);
+        const CD_S32 y1 = CD_MIN(cd_grid_map_coord_v((circle.center.y + circle.radius - map->origin.y) * map->invResolution, map->height), map->height - 1);
+        const CD_F32 radius_sqr = circle.radius * circle.radius;
+        for (CD_S32 y = y0; y <= y1; ++y)
+        {
+            const CD_U08 *row = map->cells + y * map->width;
+            const CD_F32 lower_y = map->origin.y + (CD_F32)y * res;
+            const CD_F32 dy = circle.center.y - CD_CLIP(circle.center.y, lower_y, lower_y + res);
+            for (CD_S32 x = x0; x <= x1; ++x)
+            {
+                if (row[x] == CD_GRID_FREE)
+                {
+                    continue;
+                }
+                const CD_F32 lower_x = map->origin.x + (CD_F32)x * res;
+                const CD_F32 dx = circle.center.x - CD_CLIP(circle.center.x, lower_x, lower_x + res);
+                if (dx * dx + dy * dy <= radius_sqr)
+                {
+                    return CD_TRUE;
+                }
+            }
+        }
+        return CD_FALSE;
+    }
+
+    /**
+     * @brief 判断圆形是否与占据栅格碰撞,先用距离场 O(1) 判断,无法确定时再逐栅格检查;地图范围外视为空闲
+     * @param map 栅格地图,距离场需已更新
+     * @param circle 圆形
+     * @param result 1 碰撞, 0 不碰撞
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_grid_map_circle_collide(const CD_GRID_MAP *map, const CD_CIRCLE *circle, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(map == CD_NULL || circle == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_S32 bound = cd_grid_map_circle_bound_v(map, circle->center, circle->radius);
+        *result = bound >= 0 ? (CD_BOOL)bound : cd_grid_map_circle_scan_v(map, *circle);
+        return ret;
+    }
+
+    /**
+     * @brief 逐个检查obb包围盒范围内的占据栅格是否与obb重叠,无参数检查
+     *        栅格与obb的包围盒已在坐标轴上重叠,只需再检查obb的两个轴
+     * @param map 栅格地图
+     * @param obb obb
+     * @return 1 碰撞, 0 不碰撞
+     */
+    CD_INLINE CD_BOOL cd_grid_map_obb_scan_v(const CD_GRID_MAP *map, CD_OBB obb)
+    {
+        const CD_F32 res = map->resolution;
+        const CD_F32 half = 0.5f * res;
+        const CD_F32 hl = 0.5f * obb.length;
+        const CD_F32 hw = 0.5f * obb.width;
+        const CD_F32 c = obb.q.c;
+        const CD_F32 s = obb.q.s;
+        // 正方形栅格在obb两个轴上的投影半径
+        const CD_F32 extent_l = hl + half * (CD_FABS(c) + CD_FABS(s));
+        const CD_F32 extent_w = hw + half * (CD_FABS(c) + CD_FABS(s));
+        const CD_AABB aabb = cd_obb_to_aabb_v(obb);
+        const CD_S32 x0 = CD_MAX(cd_grid_map_coord_v((aabb.lowerBound.x - map->origin.x) * map->invResolution, map->width), 0);
+        const CD_S32 y0 = CD_MAX(cd_grid_map_coord_v((aabb.lowerBound.y - map->origin.y) * map->invResolution, map->height), 0);
+        const CD_S32 x1 = CD_MIN(cd_grid_map_coord_v((aabb.upperBound.x - map->origin.x) * map->invResolution, map->width), map->width - 1);
+        const CD_S32 y1 = CD_MIN(cd_grid_map_coord_v((aabb.upperBound.y - map->origin.y) * map->invResolution, map->height), map->height - 1);
+        for (CD_S32 y = y0; y <= y1; ++y)
+        {
+            const CD_U08 *row = map->cells + y * map->width;
+            const CD_F32 dy = map->origin.y + ((CD_F32)y + 0.5f) * res - obb.center.y;
+            for (CD_S32 x = x0; x <= x1; ++x)
+            {
+                if (row[x] == CD_GRID_FREE)
+                {
+                    continue;
+                }
+                const CD_F32 dx = map->origin.x + ((CD_F32)x + 0.5f) * res - obb.center.x;
+                if (CD_FABS(c * dx + s * dy) <= extent_l && CD_FABS(c * dy - s * dx) <= extent_w)
+                {
+                    return CD_TRUE;
+                }
+            }
+        }
+        return CD_FALSE;
+    }
+
+    /**
+     * @brief 判断obb是否与占据栅格碰撞;外接圆无碰撞或内切圆碰撞时由距离场 O(1) 得出结果,
+     *        否则逐栅格检查;地图范围外视为空闲
+     * @param map 栅格地图,距离场需已更新
+     * @param obb obb
+     * @param result 1 碰撞, 0 不碰撞
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_grid_map_obb_collide(const CD_GRID_MAP *map, const CD_OBB *obb, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(map == CD_NULL || obb == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_F32 outer = 0.5f * sqrtf(obb->length * obb->length + obb->width * obb->width);
+        if (cd_grid_map_circle_bound_v(map, obb->center, outer) == 0)
+        {
+            *result = CD_FALSE;
+            return ret;
+        }
+        const CD_F32 inner = 0.5f * CD_MIN(obb->length, obb->width);
+        if (cd_grid_map_circle_bound_v(map, obb->center, inner) == 1)
+        {
+            *result = CD_TRUE;
+            return ret;
+        }
+        *result = cd_grid_map_obb_scan_v(map, *obb);
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __COLLISION_DETECTION_GRID_H__ */
@@ -0,0 +1,468 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-17 09:12:40
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-17 09:12:40
+ */
+
+#ifndef __COLLISION_DETECTION_MANIFOLD_H__
+#define __COLLISION_DETECTION_MANIFOLD_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_vec2.h"
+#include "collision_detection_circle.h"
+#include "collision_detection_obb.h"
+#include "collision_detection_polygon.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CD_MAX_MANIFOLD_POINTS 2 // 接触流形的最大接触点数
+
+#define CD_MANIFOLD_REFERENCE_TOLERANCE 0.0005f // 两侧分离量相差小于该值时优先选A的边作为参考边,避免参考边来回切换
+
+#define CD_CONTACT_FEATURE_VERTEX 0 // 特征为顶点
+#define CD_CONTACT_FEATURE_FACE 1   // 特征为边
+
+    // 产生接触点的两个特征,两帧之间特征相同即可认为是同一个接触点
+    typedef struct _CD_CONTACT_FEATURE_
+    {
+        CD_U08 indexA; ///< 形状A上的特征索引
+        CD_U08 indexB; ///< 形状B上的特征索引
+        CD_U08 typeA;  ///< CD_CONTACT_FEATURE_VERTEX / CD_CONTACT_FEATURE_FACE
+        CD_U08 typeB;  ///< CD_CONTACT_FEATURE_VERTEX / CD_CONTACT_FEATURE_FACE
+    } CD_CONTACT_FEATURE;
+
+    // 接触点id,可以按 key 整体比较
+    typedef union _CD_CONTACT_ID_
+    {
+        CD_CONTACT_FEATURE cf;
+        CD_U32 key;
+    } CD_CONTACT_ID;
+
+    typedef struct _CD_MANIFOLD_POINT_
+    {
+        CD_VEC2 point;      ///< 接触点,两个表面上对应点的中点,世界坐标系
+        CD_F32 separation;  ///< 沿法向的间距(已减去圆角半径),穿透时为负
+        CD_CONTACT_ID id;   ///< 特征id,用于热启动
+    } CD_MANIFOLD_POINT;
+
+    typedef struct _CD_MANIFOLD_
+    {
+        CD_MANIFOLD_POINT points[CD_MAX_MANIFOLD_POINTS]; ///< 接触点
+        CD_VEC2 normal;                                   ///< 由A指向B的单位法向
+        CD_S32 pointCount;                                ///< 接触点数, 0 表示不接触
+    } CD_MANIFOLD;
+
+    // 裁剪过程中的顶点
+    typedef struct _CD_CLIP_VERTEX_
+    {
+        CD_VEC2 v;
+        CD_CONTACT_ID id;
+    } CD_CLIP_VERTEX;
+
+    CD_INLINE CD_CONTACT_ID cd_make_contact_id_v(CD_S32 index_a, CD_S32 type_a, CD_S32 index_b, CD_S32 type_b)
+    {
+        CD_CONTACT_ID id;
+        id.cf.indexA = (CD_U08)index_a;
+        id.cf.indexB = (CD_U08)index_b;
+        id.cf.typeA = (CD_U08)type_a;
+        id.cf.typeB = (CD_U08)type_b;
+        return id;
+    }
+
+    CD_INLINE CD_MANIFOLD cd_empty_manifold_v(CD_VOID)
+    {
+        CD_MANIFOLD m;
+        m.normal = Vec2_Zero;
+        m.pointCount = 0;
+        return m;
+    }
+
+    /**
+     * @brief 两个圆的接触流形,无参数检查
+     * @param a 圆a
+     * @param b 圆b
+     * @return 接触流形,圆心重合时法向取x轴
+     */
+    CD_INLINE CD_MANIFOLD cd_collide_circles_v(CD_CIRCLE a, CD_CIRCLE b)
+    {
+        CD_MANIFOLD m = cd_empty_manifold_v();
+        const CD_VEC2 d = cd_vec2_sub_v(b.center, a.center);
+        const CD_F32 dist_sqr = cd_vec2_len_sqr_v(d);
+        const CD_F32 radius = a.radius + b.radius;
+        if (dist_sqr > radius * radius)
+        {
+            return m;
+        }
+        const CD_F32 dist = sqrtf(dist_sqr);
+        m.normal = dist < CD_EPS ? cd_vec2_make_v(1.0f, 0.0f) : cd_vec2_scale_v(d, 1.0f / dist);
+        const CD_VEC2 point_a = cd_vec2_mul_add_v(a.center, a.radius, m.normal);
+        const CD_VEC2 point_b = cd_vec2_mul_add_v(b.center, -b.radius, m.normal);
+        m.points[0].point = cd_vec2_scale_v(cd_vec2_add_v(point_a, point_b), 0.5f);
+        m.points[0].separation = dist - radius;
+        m.points[0].id.key = 0;
+        m.pointCount = 1;
+        return m;
+    }
+
+    /**
+     * @brief 两个圆的接触流形
+     * @param a 圆a
+     * @param b 圆b
+     * @param result 接触流形
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_collide_circles(const CD_CIRCLE *a, const CD_CIRCLE *b, CD_MANIFOLD *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_collide_circles_v(*a, *b);
+        return ret;
+    }
+
+    /**
+     * @brief 凸多边形与圆的接触流形,无参数检查
+     *        先用多边形各边法向找到圆心分离量最大的边,圆心在多边形内时直接取该边法向,
+     *        否则按圆心落在该边两端点或边内部的 Voronoi 区域计算最近点
+     * @param polygon 凸多边形视图,逆时针,需已填好 normals,考虑圆角半径
+     * @param circle 圆
+     * @return 接触流形,法向由多边形指向圆
+     */
+    CD_INLINE CD_MANIFOLD cd_collide_polygon_view_circle_v(const CD_POLYGON_VIEW *polygon, CD_CIRCLE circle)
+    {
+        CD_MANIFOLD m = cd_empty_manifold_v();
+        const CD_F32 radius = polygon->radius + circle.radius;
+        const CD_VEC2 c = circle.center;
+
+        CD_S32 normal_index = 0;
+        CD_F32 separation = -CD_MAXABS_F;
+        for (CD_S32 i = 0; i < polygon->count; ++i)
+        {
+            const CD_F32 s = cd_vec2_dot_v(polygon->normals[i], cd_vec2_sub_v(c, polygon->vertices[i]));
+            if (s > separation)
+            {
+                separation = s;
+                normal_index = i;
+            }
+        }
+        if (separation > radius)
+        {
+            return m;
+        }
+
+        const CD_S32 i1 = normal_index;
+        const CD_S32 i2 = i1 + 1 < polygon->count ? i1 + 1 : 0;
+        const CD_VEC2 v1 = polygon->vertices[i1];
+        const CD_VEC2 v2 = polygon->vertices[i2];
+        CD_VEC2 closest;
+        CD_CONTACT_ID id;
+        const CD_F32 u1 = cd_vec2_dot_v(cd_vec2_sub_v(c, v1), cd_vec2_sub_v(v2, v1));
+        const CD_F32 u2 = cd_vec2_dot_v(cd_vec2_sub_v(c, v2), cd_vec2_sub_v(v1, v2));
+        if (separation < CD_EPS || (u1 > 0.0f && u2 > 0.0f))
+        {
+            // 圆心在多边形内或在边的正对区域
+            m.normal = polygon->normals[i1];
+            closest = cd_vec2_mul_add_v(c, -separation, m.normal);
+            id = cd_make_contact_id_v(i1, CD_CONTACT_FEATURE_FACE, 0, CD_CONTACT_FEATURE_VERTEX);
+        }
+        else
+        {
+            const CD_S32 vertex_index = u1 <= 0.0f ? i1 : i2;
+            closest = polygon->vertices[vertex_index];
+            const CD_F32 dist_sqr = cd_vec2_dis_sqr_v(c, closest);
+            if (dist_sqr > radius * radius)
+            {
+                return m;
+            }
+            CD_F32 dist;
+            m.normal = cd_vec2_get_len_and_norm_v(cd_vec2_sub_v(c, closest), &dist);
+            separation = dist;
+            id = cd_make_contact_id_v(vertex_index, CD_CONTACT_FEATURE_VERTEX, 0, CD_CONTACT_FEATURE_VERTEX);
+        }
+        const CD_VEC2 point_a = cd_vec2_mul_add_v(closest, polygon->radius, m.normal);
+        const CD_VEC2 point_b = cd_vec2_mul_add_v(c, -circle.radius, m.normal);
+        m.points[0].point = cd_vec2_scale_v(cd_vec2_add_v(point_a, point_b), 0.5f);
+        m.points[0].separation = separation - radius;
+        m.points[0].id = id;
+        m.pointCount = 1;
+        return m;
+    }
+
+    /**
+     * @brief 凸多边形与圆的接触流形,无参数检查
+     * @param polygon 凸多边形,逆时针,需已填好 normals,考虑圆角半径
+     * @param circle 圆
+     * @return 接触流形,法向由多边形指向圆
+     */
+    CD_INLINE CD_MANIFOLD cd_collide_polygon_circle_v(const CD_POLYGON *polygon, CD_CIRCLE circle)
+    {
+        const CD_POLYGON_VIEW view = cd_polygon_view_v(polygon);
+        return cd_collide_polygon_view_circle_v(&view, circle);
+    }
+
+    /**
+     * @brief 凸多边形与圆的接触流形
+     * @param polygon 凸多边形,逆时针,需已填好 normals
+     * @param circle 圆
+     * @param result 接触流形,法向由多边形指向圆
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_collide_polygon_circle(const CD_POLYGON *polygon, const CD_CIRCLE *circle, CD_MANIFOLD *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(polygon == CD_NULL || circle == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(polygon->count < 3, COLLISION_DETECTION_E_ZERO_NUM);
+        *result = cd_collide_polygon_circle_v(polygon, *circle);
+        return ret;
+    }
+
+    /**
+     * @brief 求多边形b的顶点相对多边形a各边的最大分离量,无参数检查
+     * @param a 多边形a,需已填好 normals
+     * @param b 多边形b
+     * @param edge_index 分离量最大的a的边
+     * @return 最大分离量,不考虑圆角半径
+     */
+    CD_INLINE CD_F32 cd_polygon_max_separation_v(const CD_POLYGON_VIEW *a, const CD_POLYGON_VIEW *b, CD_S32 *edge_index)
+    {
+        CD_S32 best_index = 0;
+        CD_F32 max_separation = -CD_MAXABS_F;
+        for (CD_S32 i = 0; i < a->count; ++i)
+        {
+            const CD_VEC2 n = a->normals[i];
+            const CD_VEC2 v = a->vertices[i];
+            CD_F32 si = CD_MAXABS_F;
+            for (CD_S32 j = 0; j < b->count; ++j)
+            {
+                si = CD_MIN(si, cd_vec2_dot_v(n, cd_vec2_sub_v(b->vertices[j], v)));
+            }
+            if (si > max_separation)
+            {
+                max_separation = si;
+                best_index = i;
+            }
+        }
+        *edge_index = best_index;
+        return max_separation;
+    }
+
+    /**
+     * @brief 用直线 dot(normal, v) <= offset 裁剪线段,无参数检查
+     * @param v_in 输入线段的两个端点
+     * @param normal 裁剪直线法向
+     * @param offset 裁剪直线偏移
+     * @param vertex_index 裁剪直线对应的参考多边形顶点,用于新交点的id
+     * @param v_out 裁剪后的端点
+     * @return 裁剪后的端点数
+     */
+    CD_INLINE CD_S32 cd_clip_segment_to_line_v(const CD_CLIP_VERTEX *v_in, CD_VEC2 normal, CD_F32 offset,
+                                               CD_S32 vertex_index, CD_CLIP_VERTEX *v_out)
+    {
+        CD_S32 count = 0;
+        const CD_F32 d0 = cd_vec2_dot_v(normal, v_in[0].v) - offset;
+        const CD_F32 d1 = cd_vec2_dot_v(normal, v_in[1].v) - offset;
+        if (d0 <= 0.0f)
+        {
+            v_out[count++] = v_in[0];
+        }
+        if (d1 <= 0.0f)
+        {
+            v_out[count++] = v_in[1];
+        }
+        // 两个端点分居直线两侧,补上交点
+        if (d0 * d1 < 0.0f)
+        {
+            const CD_F32 t = d0 / (d0 - d1);
+            v_out[count].v = cd_vec2_mul_add_v(v_in[0].v, t, cd_vec2_sub_v(v_in[1].v, v_in[0].v));
+            v_out[count].id = cd_make_contact_id_v(vertex_index, CD_CONTACT_FEATURE_VERTEX,
+                                                   v_in[0].id.cf.indexB, CD_CONTACT_FEATURE_FACE);
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * @brief 两个凸多边形的接触流形,无参数检查
+     *        用两侧存储的边法向求最大分离量,分离量较大的一侧(相差不足
+     *        CD_MANIFOLD_REFERENCE_TOLERANCE 时取a)的边作为参考边;另一侧法向与参考法向最反向的边为入射边,
+     *        入射边用参考边两端的侧面裁剪后,保留在参考面下方(含圆角半径)的点
+     * @param a 凸多边形视图a,逆时针,需已填好 normals,考虑圆角半径
+     * @param b 凸多边形视图b,逆时针,需已填好 normals,考虑圆角半径
+     * @return 接触流形,法向由a指向b,最多两个接触点;顶点数超过255时特征id按低8位记录
+     */
+    CD_INLINE CD_MANIFOLD cd_collide_polygon_views_v(const CD_POLYGON_VIEW *a, const CD_POLYGON_VIEW *b)
+    {
+        CD_MANIFOLD m = cd_empty_manifold_v();
+        const CD_F32 total_radius = a->radius + b->radius;
+
+        CD_S32 edge_a = 0;
+        const CD_F32 separation_a = cd_polygon_max_separation_v(a, b, &edge_a);
+        if (separation_a > total_radius)
+        {
+            return m;
+        }
+        CD_S32 edge_b = 0;
+        const CD_F32 separation_b = cd_polygon_max_separation_v(b, a, &edge_b);
+        if (separation_b > total_radius)
+        {
+            return m;
+        }
+
+        const CD_POLYGON_VIEW *poly1; // 参考多边形
+        const CD_POLYGON_VIEW *poly2; // 入射多边形
+        CD_S32 edge1;
+        CD_BOOL flip;
+        if (separation_b > separation_a + CD_MANIFOLD_REFERENCE_TOLERANCE)
+        {
+            poly1 = b;
+            poly2 = a;
+            edge1 = edge_b;
+            flip = CD_TRUE;
+        }
+        else
+        {
+            poly1 = a;
+            poly2 = b;
+            edge1 = edge_a;
+            flip = CD_FALSE;
+        }
+        const CD_F32 radius1 = poly1->radius;
+        const CD_F32 radius2 = poly2->radius;
+
+        // 入射边
+        const CD_VEC2 normal = poly1->normals[edge1];
+        CD_S32 incident = 0;
+        CD_F32 min_dot = CD_MAXABS_F;
+        for (CD_S32 i = 0; i < poly2->count; ++i)
+        {
+            const CD_F32 dot = cd_vec2_dot_v(normal, poly2->normals[i]);
+            if (dot < min_dot)
+            {
+                min_dot = dot;
+                incident = i;
+            }
+        }
+        const CD_S32 incident2 = incident + 1 < poly2->count ? incident + 1 : 0;
+        CD_CLIP_VERTEX incident_edge[2];
+        incident_edge[0].v = poly2->vertices[incident];
+        incident_edge[0].id = cd_make_contact_id_v(edge1, CD_CONTACT_FEATURE_FACE, incident, CD_CONTACT_FEATURE_VERTEX);
+        incident_edge[1].v = poly2->vertices[incident2];
+        incident_edge[1].id = cd_make_contact_id_v(edge1, CD_CONTACT_FEATURE_FACE, incident2, CD_CONTACT_FEATURE_VERTEX);
+
+        // 参考边的侧面,逆时针多边形的切向为法向左转90度
+        const CD_S32 edge2 = edge1 + 1 < poly1->count ? edge1 + 1 : 0;
+        const CD_VEC2 v11 = poly1->vertices[edge1];
+        const CD_VEC2 v12 = poly1->vertices[edge2];
+        const CD_VEC2 tangent = cd_vec2_left_perp_v(normal);
+        const CD_F32 front_offset = cd_vec2_dot_v(normal, v11);
+        const CD_F32 side_offset1 = -cd_vec2_dot_v(tangent, v11) + total_radius;
+        const CD_F32 side_offset2 = cd_vec2_dot_v(tangent, v12) + total_radius;
+
+        CD_CLIP_VERTEX clip1[2];
+        CD_CLIP_VERTEX clip2[2];
+        if (cd_clip_segment_to_line_v(incident_edge, cd_vec2_neg_v(tangent), side_offset1, edge1, clip1) < 2)
+        {
+            return m;
+        }
+        if (cd_clip_segment_to_line_v(clip1, tangent, side_offset2, edge2, clip2) < 2)
+        {
+            return m;
+        }
+
+        m.normal = flip ? cd_vec2_neg_v(normal) : normal;
+        for (CD_S32 i = 0; i < 2; ++i)
+        {
+            const CD_F32 separation = cd_vec2_dot_v(normal, clip2[i].v) - front_offset;
+            if (separation > total_radius)
+            {
+                continue;
+            }
+            // 入射点投影到参考面上再外扩参考侧的圆角,入射点沿法向内缩入射侧的圆角,取中点
+            const CD_VEC2 point1 = cd_vec2_mul_add_v(clip2[i].v, radius1 - separation, normal);
+            const CD_VEC2 point2 = cd_vec2_mul_add_v(clip2[i].v, -radius2, normal);
+            CD_MANIFOLD_POINT *mp = m.points + m.pointCount;
+            mp->point = cd_vec2_scale_v(cd_vec2_add_v(point1, point2), 0.5f);
+            mp->separation = separation - total_radius;
+            mp->id = clip2[i].id;
+            if (flip)
+            {
+                const CD_CONTACT_FEATURE cf = mp->id.cf;
+                mp->id.cf.indexA = cf.indexB;
+                mp->id.cf.indexB = cf.indexA;
+                mp->id.cf.typeA = cf.typeB;
+                mp->id.cf.typeB = cf.typeA;
+            }
+            m.pointCount += 1;
+        }
+        if (m.pointCount == 0)
+        {
+            m.normal = Vec2_Zero;
+        }
+        return m;
+    }
+
+    /**
+     * @brief 两个凸多边形的接触流形,无参数检查
+     * @param a 凸多边形a,逆时针,需已填好 normals,考虑圆角半径
+     * @param b 凸多边形b,逆时针,需已填好 normals,考虑圆角半径
+     * @return 接触流形,法向由a指向b,最多两个接触点
+     */
+    CD_INLINE CD_MANIFOLD cd_collide_polygons_v(const CD_POLYGON *a, const CD_POLYGON *b)
+    {
+        const CD_POLYGON_VIEW view_a = cd_polygon_view_v(a);
+        const CD_POLYGON_VIEW view_b = cd_polygon_view_v(b);
+        return cd_collide_polygon_views_v(&view_a, &view_b);
+    }
+
+    /**
+     * @brief 两个凸多边形的接触流形
+     * @param a 凸多边形a,逆时针,需已填好 normals
+     * @param b 凸多边形b,逆时针,需已填好 normals
+     * @param result 接触流形,法向由a指向b
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_collide_polygons(const CD_POLYGON *a, const CD_POLYGON *b, CD_MANIFOLD *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(a->count < 3 || b->count < 3, COLLISION_DETECTION_E_ZERO_NUM);
+        *result = cd_collide_polygons_v(a, b);
+        return ret;
+    }
+
+    /**
+     * @brief 两个obb的接触流形,obb转换成四边形后按多边形处理,无参数检查
+     * @param a obb a
+     * @param b obb b
+     * @return 接触流形,法向由a指向b
+     */
+    CD_INLINE CD_MANIFOLD cd_collide_obbs_v(CD_OBB a, CD_OBB b)
+    {
+        const CD_POLYGON pa = cd_obb_to_polygon_v(a);
+        const CD_POLYGON pb = cd_obb_to_polygon_v(b);
+        return cd_collide_polygons_v(&pa, &pb);
+    }
+
+    /**
+     * @brief 两个obb的接触流形
+     * @param a obb a
+     * @param b obb b
+     * @param result 接触流形,法向由a指向b
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_collide_obbs(const CD_OBB *a, const CD_OBB *b, CD_MANIFOLD *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_collide_obbs_v(*a, *b);
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __COLLISION_DETECTION_MANIFOLD_H__ */
@@ -21,6 +21,20 @@ extern "C"
         CD_VEC2 cy;
     } CD_MAT22;
 
+    /**
+     * @brief 2*2矩阵与2*1向量相乘,无参数检查
+     * @param A 矩阵
+     * @param v 向量
+     * @return 结果向量
+     */
+    CD_INLINE CD_VEC2 cd_mul_Mat_vec2_v(CD_MAT22 A, CD_VEC2 v)
+    {
+        CD_VEC2 r;
+        r.x = A.cx.x * v.x + A.cy.x * v.y;
+        r.y = A.cx.y * v.x + A.cy.y * v.y;
+        return r;
+    }
+
     /**
  * @brief 2*2矩阵与2*1向量相乘
  * 
@@ -34,12 +48,34 @@ extern "C"
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(A == CD_NULL || v == CD_NULL || result == CD_NULL,
                        COLLISION_DETECTION_E_PARAM_NULL);
-
-        result->x = A->cx.x * v->x + A->cy.x * v->y;
-        result->y = A->cx.y * v->x + A->cy.y * v->y;
+        *result = cd_mul_Mat_vec2_v(*A, *v);
         return ret;
     }
 
+    /**
+     * @brief 求2*2矩阵的逆,无参数检查
+     * @param A 矩阵
+     * @return 逆矩阵,矩阵奇异时返回0矩阵
+     */
+    CD_INLINE CD_MAT22 cd_get_inv_mat22_v(CD_MAT22 A)
+    {
+        const CD_F32 a = A.cx.x;
+        const CD_F32 b = A.cx.y;
+        const CD_F32 c = A.cy.x;
+        const CD_F32 d = A.cy.y;
+        CD_F32 det = a * d - b * c;
+        if (det != 0.0f)
+        {
+            det = 1.0f / det;
+        }
+        CD_MAT22 r;
+        r.cx.x = d * det;
+        r.cx.y = -b * det;
+        r.cy.x = -c * det;
+        r.cy.y = a * det;
+        return r;
+    }
+
     /**
  * @brief 求2*2矩阵的逆
  * 
@@ -51,20 +87,31 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(A == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_F32 a = A->cx.x;
-        CD_F32 b = A->cx.y;
-        CD_F32 c = A->cy.x;
-        CD_F32 d = A->cy.y;
-        CD_F32 det = a * d - b * c;
+        *result = cd_get_inv_mat22_v(*A);
+        return ret;
+    }
+
+    /**
+     * @brief 求解 A * x = b,无参数检查
+     * @param A 矩阵
+     * @param b 向量
+     * @return x,矩阵奇异时返回0向量
+     */
+    CD_INLINE CD_VEC2 cd_solve22_v(CD_MAT22 A, CD_VEC2 b)
+    {
+        const CD_F32 a11 = A.cx.x;
+        const CD_F32 a21 = A.cx.y;
+        const CD_F32 a12 = A.cy.x;
+        const CD_F32 a22 = A.cy.y;
+        CD_F32 det = a11 * a22 - a12 * a21;
         if (det != 0.0f)
         {
             det = 1.0f / det;
         }
-        result->cx.x = d * det;
-        result->cx.y = -b * det;
-        result->cy.x = -c * det;
-        result->cy.y = a * det;
-        return ret;
+        CD_VEC2 r;
+        r.x = (a22 * b.x - a12 * b.y) * det;
+        r.y = (a11 * b.y - a21 * b.x) * det;
+        return r;
     }
 
     /**
@@ -79,17 +126,7 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(A == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_F32 a11 = A->cx.x;
-        CD_F32 a21 = A->cx.y;
-        CD_F32 a12 = A->cy.x;
-        CD_F32 a22 = A->cy.y;
-        CD_F32 det = a11 * a22 - a12 * a21;
-        if (det != 0.0f)
-        {
-            det = 1.0f / det;
-        }
-        result->x = (a22 * b->x - a12 * b->y) * det;
-        result->y = (a11 * b->y - a21 * b->x) * det;
+        *result = cd_solve22_v(*A, *b);
         return ret;
     }
 
@@ -108,11 +108,6 @@ extern "C"
         return angle;
     }
 
-    CD_INLINE CD_BOOL cd_is_with_in(CD_F32 val, CD_F32 bound1, CD_F32 bound2)
-    {
-        return (val >= CD_MIN(bound1, bound2)) && (val <= CD_MAX(bound1, bound2));
-    }
-
 #ifdef __cplusplus
 }
 #endif
@@ -18,15 +18,7 @@ extern "C"
 {
 #endif
 
-    // 方向包围盒
-    typedef struct _CD_OBB_
-    {
-        CD_VEC2 center; // 中心
-        CD_F32 length;  // 长
-        CD_F32 width;   // 宽
-        CD_ROT q;       // 旋转量
-
-    } CD_OBB;
+    // CD_OBB 与 cd_create_obb_v、cd_obb_to_aabb_v、cd_is_point_in_obb_v、cd_obb_overlap_v 由 collision_detection_scalar.inl 实例化
 
     /**
  * @brief 构建obb
@@ -41,11 +33,7 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(center == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->center = *center;
-        result->length = length;
-        result->width = width;
-        ret = cd_rot_from_angle(&result->q, heading);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        *result = cd_create_obb_v(*center, length, width, heading);
         return ret;
     }
 
@@ -59,16 +47,49 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(obb == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_F32 half_length = obb->length * 0.5f;
-        CD_F32 half_width = obb->width * 0.5f;
-        CD_VEC2 half_extents = {half_length, half_width};
-        ret = cd_vec2_add(&obb->center, &half_extents, &result->lowerBound);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-        ret = cd_vec2_sub(&obb->center, &half_extents, &result->upperBound);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        *result = cd_obb_to_aabb_v(*obb);
         return ret;
     }
 
+    /**
+     * @brief 计算obb的四个顶点,逆时针顺序,无参数检查
+     * @param obb obb
+     * @param result 顶点数组,长度为4
+     */
+    CD_INLINE CD_VOID cd_obb_vertices_v(CD_OBB obb, CD_VEC2 *result)
+    {
+        const CD_VEC2 axis_l = cd_vec2_scale_v(cd_vec2_make_v(obb.q.c, obb.q.s), obb.length * 0.5f);
+        const CD_VEC2 axis_w = cd_vec2_scale_v(cd_vec2_make_v(-obb.q.s, obb.q.c), obb.width * 0.5f);
+        result[0] = cd_vec2_sub_v(cd_vec2_sub_v(obb.center, axis_l), axis_w);
+        result[1] = cd_vec2_sub_v(cd_vec2_add_v(obb.center, axis_l), axis_w);
+        result[2] = cd_vec2_add_v(cd_vec2_add_v(obb.center, axis_l), axis_w);
+        result[3] = cd_vec2_add_v(cd_vec2_sub_v(obb.center, axis_l), axis_w);
+    }
+
+    /**
+     * @brief 计算obb的四个顶点,逆时针顺序
+     * @param obb obb
+     * @param result 顶点数组,长度为4
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_obb_vertices(const CD_OBB *obb, CD_VEC2 *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(obb == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        cd_obb_vertices_v(*obb, result);
+        return ret;
+    }
+
+    /**
+     * @brief 获取obb的heading,无参数检查
+     * @param obb obb
+     * @return heading
+     */
+    CD_INLINE CD_F32 cd_obb_heading_v(CD_OBB obb)
+    {
+        return cd_rot_to_angle_v(obb.q);
+    }
+
     /**
  * @brief 获取obb的heading
  * @param obb 
@@ -79,8 +100,7 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(obb == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        ret = cd_rot_to_angle(&obb->q, result);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        *result = cd_obb_heading_v(*obb);
         return ret;
     }
 
@@ -95,11 +115,102 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(obb == CD_NULL || point == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        const CD_F32 x0 = point->x - obb->center.x;
-        const CD_F32 y0 = point->y - obb->center.y;
-        const CD_F32 dx = CD_FABS(x0 * obb->q.c + y0 * obb->q.s);
-        const CD_F32 dy = CD_FABS(y0 * obb->q.c - x0 * obb->q.s);
-        *result = (dx <= obb->length * 0.5f + CD_EPS) && (dy <= obb->width * 0.5f + CD_EPS);
+        *result = cd_is_point_in_obb_v(*obb, *point);
+        return ret;
+    }
+
+    /**
+ * @brief 分离轴检测两个obb是否重叠,依次检测a的两个轴与b的两个轴,找到分离轴立即返回
+ * @param a obb a
+ * @param b obb b
+ * @param result 1 重叠(含边界接触), 0 不重叠
+ * @return ok / 参数异常
+ */
+    CD_INLINE CD_RET cd_obb_overlap(const CD_OBB *a, const CD_OBB *b, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_obb_overlap_v(*a, *b);
+        return ret;
+    }
+
+    /**
+     * @brief 分离轴检测两个obb是否重叠,重叠时输出最小穿透方向与深度,无参数检查
+     * @param a obb a
+     * @param b obb b
+     * @param normal 最小穿透方向,由a指向b,将b沿该方向移动 depth 即可分离,不重叠时为0向量
+     * @param depth 穿透深度,不重叠时为0
+     * @return 1 重叠(含边界接触), 0 不重叠
+     */
+    CD_INLINE CD_BOOL cd_obb_overlap_mtv_v(CD_OBB a, CD_OBB b, CD_VEC2 *normal, CD_F32 *depth)
+    {
+        const CD_F32 hl_a = a.length * 0.5f;
+        const CD_F32 hw_a = a.width * 0.5f;
+        const CD_F32 hl_b = b.length * 0.5f;
+        const CD_F32 hw_b = b.width * 0.5f;
+        const CD_F32 tx = b.center.x - a.center.x;
+        const CD_F32 ty = b.center.y - a.center.y;
+        const CD_F32 r00 = CD_FABS(a.q.c * b.q.c + a.q.s * b.q.s);
+        const CD_F32 r01 = CD_FABS(a.q.s * b.q.c - a.q.c * b.q.s);
+
+        // 四个候选轴:a的x/y轴,b的x/y轴
+        const CD_VEC2 axes[4] = {{a.q.c, a.q.s}, {-a.q.s, a.q.c}, {b.q.c, b.q.s}, {-b.q.s, b.q.c}};
+        const CD_F32 radii[4] = {hl_a + hl_b * r00 + hw_b * r01,
+                                 hw_a + hl_b * r01 + hw_b * r00,
+                                 hl_a * r00 + hw_a * r01 + hl_b,
+                                 hl_a * r01 + hw_a * r00 + hw_b};
+
+        normal->x = 0.0f;
+        normal->y = 0.0f;
+        *depth = 0.0f;
+        CD_F32 min_depth = CD_MAXABS_F;
+        CD_S32 min_axis = 0;
+        CD_F32 min_sign = 1.0f;
+        for (CD_S32 i = 0; i < 4; ++i)
+        {
+            const CD_F32 dist = tx * axes[i].x + ty * axes[i].y;
+            const CD_F32 overlap = radii[i] - CD_FABS(dist);
+            if (overlap < 0.0f)
+            {
+                return CD_FALSE;
+            }
+            if (overlap < min_depth)
+            {
+                min_depth = overlap;
+                min_axis = i;
+                min_sign = dist < 0.0f ? -1.0f : 1.0f;
+            }
+        }
+        normal->x = axes[min_axis].x * min_sign;
+        normal->y = axes[min_axis].y * min_sign;
+        *depth = min_depth;
+        return CD_TRUE;
+    }
+
+    /**
+ * @brief 分离轴检测两个obb是否重叠,重叠时输出最小穿透方向与深度
+ * @param a obb a
+ * @param b obb b
+ * @param result 1 重叠(含边界接触), 0 不重叠
+ * @param normal 最小穿透方向,由a指向b,将b沿该方向移动 depth 即可分离,不重叠时不修改,可为null
+ * @param depth 穿透深度,不重叠时为0,可为null
+ * @return ok / 参数异常
+ */
+    CD_INLINE CD_RET cd_obb_overlap_mtv(const CD_OBB *a, const CD_OBB *b, CD_BOOL *result, CD_VEC2 *normal, CD_F32 *depth)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_VEC2 n;
+        CD_F32 d = 0.0f;
+        *result = cd_obb_overlap_mtv_v(*a, *b, &n, &d);
+        if (normal != CD_NULL && *result)
+        {
+            *normal = n;
+        }
+        if (depth != CD_NULL)
+        {
+            *depth = d;
+        }
         return ret;
     }
 
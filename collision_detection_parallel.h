@@ -0,0 +1,608 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-18 10:41:27
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-18 10:41:27
+ */
+
+#ifndef __COLLISION_DETECTION_PARALLEL_H__
+#define __COLLISION_DETECTION_PARALLEL_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_obb.h"
+#include "collision_detection_polygon.h"
+#include "collision_detection_dynamic_tree.h"
+#include "collision_detection_trajectory.h"
+#include "collision_detection_batch.h"
+
+// 线程池依赖 pthread 与 GCC/Clang 的 __atomic 内建函数,其余平台或定义了 CD_THREADS_DISABLE 时退化为调用线程串行执行
+#if !defined(CD_THREADS_DISABLE) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__unix__) || defined(__APPLE__))
+#define CD_PARALLEL_THREADS 1
+#include <pthread.h>
+#ifndef CD_PARALLEL_THREAD_CREATE
+#define CD_PARALLEL_THREAD_CREATE pthread_create // 创建后台线程的函数,测试中可替换以模拟创建失败
+#endif
+#else
+#define CD_PARALLEL_THREADS 0
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CD_MAX_WORKERS 64           // 线程池的最大工作线程数(含调用线程)
+#define CD_PARALLEL_CACHE_LINE 64   // 每个工作线程的任务队列独占一个缓存行,避免伪共享
+#define CD_PARALLEL_POINT_CHUNK 2048 // 点集查询的分块大小,必须是32的倍数,保证每块写入独立的掩码字
+
+    /**
+     * @brief 分块任务,处理 [begin, end) 范围内的查询,结果写入调用者预先分配的对应位置
+     * @param context 调用者上下文
+     * @param begin 起始下标
+     * @param end 结束下标(不含)
+     * @param worker 执行该分块的工作线程编号, 0 为调用线程,可用于索引每个线程独占的临时内存
+     */
+    typedef CD_VOID (*CD_PARALLEL_TASK)(CD_VOID *context, CD_S32 begin, CD_S32 end, CD_S32 worker);
+
+    // 工作线程的任务队列: 一段连续的分块 [head, tail),打包在一个64位字中整体做CAS;
+    // 所有者从 head 端逐块取出,窃取者从 tail 端一次拿走一半
+    typedef struct _CD_WORK_DEQUE_
+    {
+        CD_U64 range;                                    ///< (head << 32) | tail
+        CD_U08 pad[CD_PARALLEL_CACHE_LINE - sizeof(CD_U64)];
+    } CD_WORK_DEQUE;
+
+    struct _CD_WORKER_POOL_;
+
+    // 工作线程的启动参数
+    typedef struct _CD_WORKER_ARG_
+    {
+        struct _CD_WORKER_POOL_ *pool;
+        CD_S32 index;
+    } CD_WORKER_ARG;
+
+    // 固定大小的线程池,线程在初始化时创建,之后每次批量查询不再分配内存
+    typedef struct _CD_WORKER_POOL_
+    {
+        CD_WORK_DEQUE deques[CD_MAX_WORKERS]; ///< 每个工作线程的任务队列
+        CD_S32 workerCount;                   ///< 工作线程数,含调用线程
+        CD_PARALLEL_TASK task;                ///< 当前任务
+        CD_VOID *context;                     ///< 当前任务的上下文
+        CD_S32 count;                         ///< 当前任务的查询数量
+        CD_S32 chunkSize;                     ///< 当前任务的分块大小
+#if CD_PARALLEL_THREADS
+        pthread_t threads[CD_MAX_WORKERS];    ///< 工作线程, threads[0] 不使用
+        CD_WORKER_ARG args[CD_MAX_WORKERS];   ///< 工作线程的启动参数
+        pthread_mutex_t mutex;                ///< 保护以下状态,只在任务开始与结束时使用
+        pthread_cond_t startCond;             ///< 新任务或退出
+        pthread_cond_t doneCond;              ///< 所有工作线程完成
+        CD_U32 generation;                    ///< 任务序号
+        CD_S32 active;                        ///< 尚未完成当前任务的后台线程数
+        CD_BOOL stop;                         ///< 退出标志
+#endif
+    } CD_WORKER_POOL;
+
+    CD_INLINE CD_U64 cd_work_range_pack_v(CD_S32 head, CD_S32 tail)
+    {
+        return ((CD_U64)(CD_U32)head << 32) | (CD_U64)(CD_U32)tail;
+    }
+
+    CD_INLINE CD_S32 cd_work_range_head_v(CD_U64 range)
+    {
+        return (CD_S32)(range >> 32);
+    }
+
+    CD_INLINE CD_S32 cd_work_range_tail_v(CD_U64 range)
+    {
+        return (CD_S32)(range & 0xFFFFFFFFu);
+    }
+
+    /**
+     * @brief 执行第 chunk 个分块,无参数检查
+     * @param pool 线程池
+     * @param chunk 分块序号
+     * @param worker 工作线程编号
+     */
+    CD_INLINE CD_VOID cd_worker_execute_chunk_v(const CD_WORKER_POOL *pool, CD_S32 chunk, CD_S32 worker)
+    {
+        const CD_S32 begin = chunk * pool->chunkSize;
+        const CD_S32 end = CD_MIN(begin + pool->chunkSize, pool->count);
+        pool->task(pool->context, begin, end, worker);
+    }
+
+#if CD_PARALLEL_THREADS
+    /**
+     * @brief 从自己的队列头部取出一个分块,无参数检查
+     * @param deque 任务队列
+     * @param chunk 分块序号
+     * @return 1 成功, 0 队列为空
+     */
+    CD_INLINE CD_BOOL cd_work_deque_pop_v(CD_WORK_DEQUE *deque, CD_S32 *chunk)
+    {
+        CD_U64 range = __atomic_load_n(&deque->range, __ATOMIC_ACQUIRE);
+        for (;;)
+        {
+            const CD_S32 head = cd_work_range_head_v(range);
+            const CD_S32 tail = cd_work_range_tail_v(range);
+            if (head >= tail)
+            {
+                return CD_FALSE;
+            }
+            if (__atomic_compare_exchange_n(&deque->range, &range, cd_work_range_pack_v(head + 1, tail), CD_FALSE,
+                                            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            {
+                *chunk = head;
+                return CD_TRUE;
+            }
+        }
+    }
+
+    /**
+     * @brief 从其他工作线程的队列尾部窃取一半分块放入自己的队列,无参数检查
+     *        分块序号全局唯一,队列字相等即内容相同,CAS 不存在 ABA 问题
+     * @param pool 线程池
+     * @param worker 自己的编号,自己的队列此时为空
+     * @return 1 窃取成功, 0 所有队列均为空
+     */
+    CD_INLINE CD_BOOL cd_work_deque_steal_v(CD_WORKER_POOL *pool, CD_S32 worker)
+    {
+        const CD_S32 n = pool->workerCount;
+        for (CD_S32 k = 1; k < n; ++k)
+        {
+            CD_WORK_DEQUE *victim = &pool->deques[(worker + k) % n];
+            CD_U64 range = __atomic_load_n(&victim->range, __ATOMIC_ACQUIRE);
+            for (;;)
+            {
+                const CD_S32 head = cd_work_range_head_v(range);
+                const CD_S32 tail = cd_work_range_tail_v(range);
+                if (head >= tail)
+                {
+                    break;
+                }
+                const CD_S32 split = tail - (tail - head + 1) / 2;
+                if (__atomic_compare_exchange_n(&victim->range, &range, cd_work_range_pack_v(head, split), CD_FALSE,
+                                                __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+                {
+                    __atomic_store_n(&pool->deques[worker].range, cd_work_range_pack_v(split, tail), __ATOMIC_RELEASE);
+                    return CD_TRUE;
+                }
+            }
+        }
+        return CD_FALSE;
+    }
+
+    /**
+     * @brief 工作线程处理当前任务: 先取自己的分块,取完后窃取,所有队列都空时返回,无参数检查
+     * @param pool 线程池
+     * @param worker 工作线程编号
+     */
+    CD_INLINE CD_VOID cd_worker_run_v(CD_WORKER_POOL *pool, CD_S32 worker)
+    {
+        CD_WORK_DEQUE *own = &pool->deques[worker];
+        CD_S32 chunk = 0;
+        for (;;)
+        {
+            if (cd_work_deque_pop_v(own, &chunk))
+            {
+                cd_worker_execute_chunk_v(pool, chunk, worker);
+            }
+            else if (!cd_work_deque_steal_v(pool, worker))
+            {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief 后台工作线程入口,等待任务并执行,直到线程池销毁
+     * @param arg CD_WORKER_ARG
+     * @return null
+     */
+    CD_INLINE CD_VOID *cd_worker_thread_main(CD_VOID *arg)
+    {
+        const CD_WORKER_ARG *worker_arg = (const CD_WORKER_ARG *)arg;
+        CD_WORKER_POOL *pool = worker_arg->pool;
+        const CD_S32 index = worker_arg->index;
+        CD_U32 seen = 0;
+        for (;;)
+        {
+            pthread_mutex_lock(&pool->mutex);
+            while (pool->generation == seen && !pool->stop)
+            {
+                pthread_cond_wait(&pool->startCond, &pool->mutex);
+            }
+            if (pool->stop)
+            {
+                pthread_mutex_unlock(&pool->mutex);
+                break;
+            }
+            seen = pool->generation;
+            pthread_mutex_unlock(&pool->mutex);
+
+            cd_worker_run_v(pool, index);
+
+            pthread_mutex_lock(&pool->mutex);
+            pool->active -= 1;
+            if (pool->active == 0)
+            {
+                pthread_cond_signal(&pool->doneCond);
+            }
+            pthread_mutex_unlock(&pool->mutex);
+        }
+        return CD_NULL;
+    }
+#endif
+
+    /**
+     * @brief 通知后台线程退出并等待其结束
+     * @param pool 线程池
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_worker_pool_destroy(CD_WORKER_POOL *pool)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(pool == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+#if CD_PARALLEL_THREADS
+        pthread_mutex_lock(&pool->mutex);
+        pool->stop = CD_TRUE;
+        pthread_cond_broadcast(&pool->startCond);
+        pthread_mutex_unlock(&pool->mutex);
+        for (CD_S32 i = 1; i < pool->workerCount; ++i)
+        {
+            pthread_join(pool->threads[i], CD_NULL);
+        }
+        pthread_cond_destroy(&pool->doneCond);
+        pthread_cond_destroy(&pool->startCond);
+        pthread_mutex_destroy(&pool->mutex);
+#endif
+        pool->workerCount = 0;
+        return ret;
+    }
+
+    /**
+     * @brief 初始化线程池并创建 workerCount - 1 个后台线程,调用线程作为 0 号工作线程参与计算
+     * @param pool 线程池,初始化后地址不能改变
+     * @param workerCount 工作线程数,含调用线程,不超过 CD_MAX_WORKERS;不支持线程的平台上固定为1
+     * @return ok / 参数异常 / 线程数非法 / 创建线程失败(已创建的线程会被回收)
+     */
+    CD_INLINE CD_RET cd_worker_pool_init(CD_WORKER_POOL *pool, CD_S32 workerCount)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(pool == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(workerCount <= 0 || workerCount > CD_MAX_WORKERS, COLLISION_DETECTION_E_ZERO_NUM);
+        for (CD_S32 i = 0; i < CD_MAX_WORKERS; ++i)
+        {
+            pool->deques[i].range = 0;
+        }
+        pool->task = CD_NULL;
+        pool->context = CD_NULL;
+        pool->count = 0;
+        pool->chunkSize = 1;
+#if CD_PARALLEL_THREADS
+        pool->workerCount = 1;
+        pool->generation = 0;
+        pool->active = 0;
+        pool->stop = CD_FALSE;
+        pthread_mutex_init(&pool->mutex, CD_NULL);
+        pthread_cond_init(&pool->startCond, CD_NULL);
+        pthread_cond_init(&pool->doneCond, CD_NULL);
+        for (CD_S32 i = 1; i < workerCount; ++i)
+        {
+            pool->args[i].pool = pool;
+            pool->args[i].index = i;
+            if (CD_PARALLEL_THREAD_CREATE(&pool->threads[i], CD_NULL, cd_worker_thread_main, &pool->args[i]) != 0)
+            {
+                // 通知已创建的线程退出并等待其结束,释放同步对象,线程池回到未初始化状态
+                cd_worker_pool_destroy(pool);
+                return COLLISION_DETECTION_E_CALC_ERROR;
+            }
+            pool->workerCount = i + 1;
+        }
+#else
+        pool->workerCount = 1;
+#endif
+        return ret;
+    }
+
+    /**
+     * @brief 把 count 个独立查询按 chunkSize 分块,平均分给各工作线程的队列后并行执行,返回时全部完成
+     *        各线程取完自己的分块后从其他线程的队列尾部窃取一半;结果由任务写入按下标预先分配的位置,
+     *        输出不加锁。同一线程池不能被多个线程同时调用
+     * @param pool 线程池
+     * @param count 查询数量
+     * @param chunkSize 分块大小,过小时调度开销占比高,过大时负载不均
+     * @param task 分块任务
+     * @param context 任务上下文
+     * @return ok / 参数异常 / 分块大小非法
+     */
+    CD_INLINE CD_RET cd_worker_pool_run(CD_WORKER_POOL *pool, CD_S32 count, CD_S32 chunkSize,
+                                        CD_PARALLEL_TASK task, CD_VOID *context)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(pool == CD_NULL || task == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(chunkSize <= 0 || pool->workerCount <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        if (count <= 0)
+        {
+            return ret;
+        }
+        pool->task = task;
+        pool->context = context;
+        pool->count = count;
+        pool->chunkSize = chunkSize;
+        const CD_S32 chunk_count = (CD_S32)(((CD_S64)count + chunkSize - 1) / chunkSize);
+#if CD_PARALLEL_THREADS
+        const CD_S32 n = CD_MIN(pool->workerCount, chunk_count);
+        if (n > 1)
+        {
+            for (CD_S32 i = 0; i < pool->workerCount; ++i)
+            {
+                const CD_S32 head = (CD_S32)((CD_S64)chunk_count * CD_MIN(i, n) / n);
+                const CD_S32 tail = (CD_S32)((CD_S64)chunk_count * CD_MIN(i + 1, n) / n);
+                __atomic_store_n(&pool->deques[i].range, cd_work_range_pack_v(head, tail), __ATOMIC_RELAXED);
+            }
+            // 互斥锁同时发布上面的队列与任务参数
+            pthread_mutex_lock(&pool->mutex);
+            pool->generation += 1;
+            pool->active = pool->workerCount - 1;
+            pthread_cond_broadcast(&pool->startCond);
+            pthread_mutex_unlock(&pool->mutex);
+
+            cd_worker_run_v(pool, 0);
+
+            pthread_mutex_lock(&pool->mutex);
+            while (pool->active > 0)
+            {
+                pthread_cond_wait(&pool->doneCond, &pool->mutex);
+            }
+            pthread_mutex_unlock(&pool->mutex);
+            return ret;
+        }
+#endif
+        for (CD_S32 c = 0; c < chunk_count; ++c)
+        {
+            cd_worker_execute_chunk_v(pool, c, 0);
+        }
+        return ret;
+    }
+
+    // 批量点在多边形内的上下文
+    typedef struct _CD_PARALLEL_POINTS_POLYGON_
+    {
+        const CD_F32 *xs;
+        const CD_F32 *ys;
+        const CD_POLYGON_VIEW *polygon;
+        CD_F32 radius;
+        CD_U32 *mask;
+        CD_S32 counts[CD_MAX_WORKERS * (CD_PARALLEL_CACHE_LINE / sizeof(CD_S32))]; // 每个线程独占一个缓存行的计数
+    } CD_PARALLEL_POINTS_POLYGON;
+
+    CD_INLINE CD_VOID cd_parallel_points_in_polygon_task(CD_VOID *context, CD_S32 begin, CD_S32 end, CD_S32 worker)
+    {
+        CD_PARALLEL_POINTS_POLYGON *c = (CD_PARALLEL_POINTS_POLYGON *)context;
+        CD_S32 count = 0;
+        cd_points_in_polygon_view_batch(c->xs + begin, c->ys + begin, end - begin, c->polygon, c->radius,
+                                        c->mask != CD_NULL ? c->mask + begin / 32 : CD_NULL, &count);
+        c->counts[worker * (CD_PARALLEL_CACHE_LINE / sizeof(CD_S32))] += count;
+    }
+
+    /**
+     * @brief 多线程批量判断点是否在凸多边形内,结果与 cd_points_in_polygon_view_batch 一致
+     * @param pool 线程池
+     * @param xs 点的x坐标
+     * @param ys 点的y坐标
+     * @param count 点数量
+     * @param polygon 凸多边形视图,需已填好 normals
+     * @param radius 圆角半径
+     * @param mask 结果位掩码,长度不小于 (count + 31) / 32,可为null
+     * @param result_count 在多边形内的点数
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_parallel_points_in_polygon(CD_WORKER_POOL *pool, const CD_F32 *xs, const CD_F32 *ys, CD_S32 count,
+                                                   const CD_POLYGON_VIEW *polygon, CD_F32 radius,
+                                                   CD_U32 *mask, CD_S32 *result_count)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(pool == CD_NULL || xs == CD_NULL || ys == CD_NULL || polygon == CD_NULL || result_count == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        CD_PARALLEL_POINTS_POLYGON context;
+        context.xs = xs;
+        context.ys = ys;
+        context.polygon = polygon;
+        context.radius = radius;
+        context.mask = mask;
+        for (CD_S32 i = 0; i < pool->workerCount; ++i)
+        {
+            context.counts[i * (CD_PARALLEL_CACHE_LINE / sizeof(CD_S32))] = 0;
+        }
+        ret = cd_worker_pool_run(pool, count, CD_PARALLEL_POINT_CHUNK, cd_parallel_points_in_polygon_task, &context);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        *result_count = 0;
+        for (CD_S32 i = 0; i < pool->workerCount; ++i)
+        {
+            *result_count += context.counts[i * (CD_PARALLEL_CACHE_LINE / sizeof(CD_S32))];
+        }
+        return ret;
+    }
+
+#define CD_PARALLEL_ERROR_SLOT(worker) ((worker) * (CD_PARALLEL_CACHE_LINE / sizeof(CD_RET))) // 每个线程独占一个缓存行的错误码
+
+    /**
+     * @brief 记录工作线程遇到的第一个错误,无参数检查
+     * @param errors 按 CD_PARALLEL_ERROR_SLOT 排布的错误码
+     * @param worker 工作线程编号
+     * @param ret 子查询的返回值
+     */
+    CD_INLINE CD_VOID cd_parallel_record_error_v(CD_RET *errors, CD_S32 worker, CD_RET ret)
+    {
+        CD_RET *slot = &errors[CD_PARALLEL_ERROR_SLOT(worker)];
+        if (ret != CD_RET_OK && *slot == CD_RET_OK)
+        {
+            *slot = ret;
+        }
+    }
+
+    /**
+     * @brief 按工作线程编号顺序返回第一个记录的错误,无参数检查
+     * @param errors 按 CD_PARALLEL_ERROR_SLOT 排布的错误码
+     * @param workerCount 工作线程数
+     * @return ok / 第一个错误
+     */
+    CD_INLINE CD_RET cd_parallel_first_error_v(const CD_RET *errors, CD_S32 workerCount)
+    {
+        for (CD_S32 i = 0; i < workerCount; ++i)
+        {
+            if (errors[CD_PARALLEL_ERROR_SLOT(i)] != CD_RET_OK)
+            {
+                return errors[CD_PARALLEL_ERROR_SLOT(i)];
+            }
+        }
+        return CD_RET_OK;
+    }
+
+    // 批量轨迹检测的上下文
+    typedef struct _CD_PARALLEL_TRAJECTORIES_
+    {
+        const CD_TRANSFORM *poses;
+        CD_S32 poseCount;
+        const CD_OBB *footprint;
+        const CD_OBB *obstacles;
+        CD_S32 obstacleCount;
+        CD_S32 *resultPoses;
+        CD_S32 *resultObstacles;
+        CD_RET errors[CD_PARALLEL_ERROR_SLOT(CD_MAX_WORKERS)]; // 每个线程遇到的第一个错误
+    } CD_PARALLEL_TRAJECTORIES;
+
+    CD_INLINE CD_VOID cd_parallel_trajectories_task(CD_VOID *context, CD_S32 begin, CD_S32 end, CD_S32 worker)
+    {
+        CD_PARALLEL_TRAJECTORIES *c = (CD_PARALLEL_TRAJECTORIES *)context;
+        for (CD_S32 t = begin; t < end; ++t)
+        {
+            const CD_RET ret = cd_trajectory_check_obb(c->poses + (CD_S64)t * c->poseCount, c->poseCount, c->footprint,
+                                                       c->obstacles, c->obstacleCount, &c->resultPoses[t],
+                                                       c->resultObstacles != CD_NULL ? &c->resultObstacles[t] : CD_NULL);
+            cd_parallel_record_error_v(c->errors, worker, ret);
+        }
+    }
+
+    /**
+     * @brief 多线程检测多条候选轨迹,每条轨迹的结果与 cd_trajectory_check_obb 一致
+     * @param pool 线程池
+     * @param poses 所有轨迹的位姿,第t条轨迹为 poses[t * poseCount, (t + 1) * poseCount)
+     * @param poseCount 每条轨迹的位姿数量
+     * @param trajectoryCount 轨迹数量
+     * @param footprint 车体坐标系下的obb足迹
+     * @param obstacles 障碍物数组
+     * @param obstacleCount 障碍物数量
+     * @param resultPoses 每条轨迹第一个碰撞位姿的下标,长度为 trajectoryCount
+     * @param resultObstacles 每条轨迹与之碰撞的障碍物下标,长度为 trajectoryCount,可为null
+     * @return ok / 参数异常 / 任一条轨迹检测返回的错误(按工作线程编号取第一个)
+     */
+    CD_INLINE CD_RET cd_parallel_trajectories_check_obb(CD_WORKER_POOL *pool, const CD_TRANSFORM *poses, CD_S32 poseCount,
+                                                        CD_S32 trajectoryCount, const CD_OBB *footprint,
+                                                        const CD_OBB *obstacles, CD_S32 obstacleCount,
+                                                        CD_S32 *resultPoses, CD_S32 *resultObstacles)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(pool == CD_NULL || poses == CD_NULL || footprint == CD_NULL || resultPoses == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(obstacles == CD_NULL && obstacleCount > 0, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_PARALLEL_TRAJECTORIES context;
+        context.poses = poses;
+        context.poseCount = poseCount;
+        context.footprint = footprint;
+        context.obstacles = obstacles;
+        context.obstacleCount = obstacleCount;
+        context.resultPoses = resultPoses;
+        context.resultObstacles = resultObstacles;
+        for (CD_S32 i = 0; i < pool->workerCount; ++i)
+        {
+            context.errors[CD_PARALLEL_ERROR_SLOT(i)] = CD_RET_OK;
+        }
+        // 单条轨迹的耗时差异大,每块一条,靠窃取均衡负载
+        ret = cd_worker_pool_run(pool, trajectoryCount, 1, cd_parallel_trajectories_task, &context);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        return cd_parallel_first_error_v(context.errors, pool->workerCount);
+    }
+
+    // 批量足迹与场景检测的上下文
+    typedef struct _CD_PARALLEL_TREE_OBBS_
+    {
+        const CD_DYNAMIC_TREE *tree;
+        const CD_OBB *obstacles;
+        const CD_OBB *queries;
+        CD_S32 *results;
+        CD_RET errors[CD_PARALLEL_ERROR_SLOT(CD_MAX_WORKERS)]; // 每个线程遇到的第一个错误
+    } CD_PARALLEL_TREE_OBBS;
+
+    // 单个足迹的树查询状态
+    typedef struct _CD_TREE_OBB_HIT_
+    {
+        const CD_OBB *obstacles;
+        CD_OBB query;
+        CD_S32 hit;
+    } CD_TREE_OBB_HIT;
+
+    CD_INLINE CD_BOOL cd_tree_obb_hit_callback(CD_S32 proxyId, CD_S32 userData, CD_VOID *context)
+    {
+        CD_TREE_OBB_HIT *c = (CD_TREE_OBB_HIT *)context;
+        (CD_VOID) proxyId;
+        if (cd_obb_overlap_v(c->query, c->obstacles[userData]))
+        {
+            c->hit = userData;
+            return CD_FALSE;
+        }
+        return CD_TRUE;
+    }
+
+    CD_INLINE CD_VOID cd_parallel_tree_obbs_task(CD_VOID *context, CD_S32 begin, CD_S32 end, CD_S32 worker)
+    {
+        CD_PARALLEL_TREE_OBBS *c = (CD_PARALLEL_TREE_OBBS *)context;
+        CD_TREE_OBB_HIT hit;
+        hit.obstacles = c->obstacles;
+        for (CD_S32 i = begin; i < end; ++i)
+        {
+            hit.query = c->queries[i];
+            hit.hit = CD_TREE_NULL_NODE;
+            const CD_AABB box = cd_obb_to_aabb_v(hit.query);
+            const CD_RET ret = cd_dynamic_tree_query(c->tree, &box, cd_tree_obb_hit_callback, &hit);
+            cd_parallel_record_error_v(c->errors, worker, ret);
+            c->results[i] = hit.hit;
+        }
+    }
+
+    /**
+     * @brief 多线程检测一批obb足迹与动态树中的obb障碍物是否碰撞,查询期间树不能被修改
+     * @param pool 线程池
+     * @param tree 动态树,叶子节点的 userData 为障碍物下标
+     * @param obstacles 障碍物数组
+     * @param queries 足迹数组
+     * @param count 足迹数量
+     * @param results 每个足迹碰到的任意一个障碍物下标,无碰撞时为 CD_TREE_NULL_NODE,长度为 count
+     * @return ok / 参数异常 / 任一次树查询返回的错误(按工作线程编号取第一个)
+     */
+    CD_INLINE CD_RET cd_parallel_tree_overlap_obbs(CD_WORKER_POOL *pool, const CD_DYNAMIC_TREE *tree, const CD_OBB *obstacles,
+                                                   const CD_OBB *queries, CD_S32 count, CD_S32 *results)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(pool == CD_NULL || tree == CD_NULL || obstacles == CD_NULL || queries == CD_NULL || results == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        CD_PARALLEL_TREE_OBBS context;
+        context.tree = tree;
+        context.obstacles = obstacles;
+        context.queries = queries;
+        context.results = results;
+        for (CD_S32 i = 0; i < pool->workerCount; ++i)
+        {
+            context.errors[CD_PARALLEL_ERROR_SLOT(i)] = CD_RET_OK;
+        }
+        ret = cd_worker_pool_run(pool, count, 16, cd_parallel_tree_obbs_task, &context);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        return cd_parallel_first_error_v(context.errors, pool->workerCount);
+    }
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __COLLISION_DETECTION_PARALLEL_H__ */
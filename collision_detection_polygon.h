@@ -13,6 +13,7 @@
 #include "collision_detection_distance.h"
 #include "collision_detection_transform.h"
 #include "collision_detection_aabb.h"
+#include "collision_detection_obb.h"
 #ifdef __cplusplus
 extern "C"
 {
@@ -29,6 +30,12 @@ extern "C"
         /// The centroid of the polygon
         CD_VEC2 centroid;
 
+        /// The cached bounding box, including the external radius
+        CD_AABB aabb;
+
+        /// The cached bounding radius about the centroid, including the external radius
+        CD_F32 boundRadius;
+
         /// The external radius for rounded polygons
         CD_F32 radius;
 
@@ -36,46 +43,630 @@ extern "C"
         CD_S32 count;
     } CD_POLYGON;
 
+    /// 凸多边形视图,顶点与法向存放在外部的连续存储中(如顶点池),顶点数不受 MAX_POLYGON_VERTICES 限制
+    typedef struct _CD_POLYGON_VIEW_
+    {
+        const CD_VEC2 *vertices; ///< 逆时针顶点
+        const CD_VEC2 *normals;  ///< 各边的外法向
+        CD_S32 count;            ///< 顶点数量
+        CD_F32 radius;           ///< 圆角半径
+    } CD_POLYGON_VIEW;
+
+    /**
+     * @brief 定长多边形的视图,无参数检查
+     * @param polygon 多边形,生命周期需覆盖视图的使用
+     * @return 视图
+     */
+    CD_INLINE CD_POLYGON_VIEW cd_polygon_view_v(const CD_POLYGON *polygon)
+    {
+        CD_POLYGON_VIEW r;
+        r.vertices = polygon->vertices;
+        r.normals = polygon->normals;
+        r.count = polygon->count;
+        r.radius = polygon->radius;
+        return r;
+    }
+
+#define CD_HULL_WELD_DISTANCE 0.005f          // 凸包中距离小于该值的点合并为一个点,单位米
+#define CD_HULL_SCRATCH_SIZE(count) (2 * (count)) // 构建凸包所需的临时点数组长度: 点的划分区与未清理的凸包各占 count
+
     /**
-     * @brief 判断点是否在多边形内
-     * @param point
-     * @param polygon
-     * @param result
-     * @return
+     * @brief 计算逆时针凸多边形的面积形心,以第一个顶点为参考点减小舍入误差,无参数检查
+     * @param vertices 顶点
+     * @param count 顶点数量, >= 3
+     * @return 形心,面积为0时返回顶点均值
      */
-    CD_INLINE CD_RET cd_point_in_polygon(CD_VEC2 *point, CD_POLYGON *polygon, CD_BOOL *result)
+    CD_INLINE CD_VEC2 cd_polygon_centroid_v(const CD_VEC2 *vertices, CD_S32 count)
+    {
+        const CD_VEC2 origin = vertices[0];
+        CD_F32 area = 0.0f;
+        CD_VEC2 center = Vec2_Zero;
+        for (CD_S32 i = 1; i < count - 1; ++i)
+        {
+            // 以参考点为顶点的三角形扇
+            const CD_VEC2 e1 = cd_vec2_sub_v(vertices[i], origin);
+            const CD_VEC2 e2 = cd_vec2_sub_v(vertices[i + 1], origin);
+            const CD_F32 a = 0.5f * cd_vec2_cross_v(e1, e2);
+            center = cd_vec2_mul_add_v(center, a * (1.0f / 3.0f), cd_vec2_add_v(e1, e2));
+            area += a;
+        }
+        if (area < CD_EPS)
+        {
+            CD_VEC2 mean = Vec2_Zero;
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                mean = cd_vec2_add_v(mean, vertices[i]);
+            }
+            return cd_vec2_scale_v(mean, 1.0f / (CD_F32)count);
+        }
+        return cd_vec2_add_v(origin, cd_vec2_scale_v(center, 1.0f / area));
+    }
+
+    /**
+     * @brief 计算逆时针凸多边形各边的单位外法向,无参数检查
+     * @param vertices 顶点
+     * @param count 顶点数量
+     * @param normals 输出的法向,长度为 count
+     */
+    CD_INLINE CD_VOID cd_polygon_normals_v(const CD_VEC2 *vertices, CD_S32 count, CD_VEC2 *normals)
+    {
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            const CD_VEC2 v1 = vertices[i];
+            const CD_VEC2 v2 = vertices[i + 1 < count ? i + 1 : 0];
+            normals[i] = cd_vec2_norm_v(cd_vec2_right_perp_v(cd_vec2_sub_v(v2, v1)));
+        }
+    }
+
+    /**
+     * @brief 计算多边形的包围盒与绕形心的包围半径,均包含圆角半径,无参数检查
+     * @param vertices 顶点
+     * @param count 顶点数量
+     * @param centroid 形心
+     * @param radius 圆角半径
+     * @param aabb 输出的包围盒
+     * @return 包围半径
+     */
+    CD_INLINE CD_F32 cd_polygon_bounds_v(const CD_VEC2 *vertices, CD_S32 count, CD_VEC2 centroid, CD_F32 radius, CD_AABB *aabb)
+    {
+        CD_VEC2 lower = vertices[0];
+        CD_VEC2 upper = vertices[0];
+        CD_F32 max_sqr = 0.0f;
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            lower = cd_vec2_min_v(lower, vertices[i]);
+            upper = cd_vec2_max_v(upper, vertices[i]);
+            max_sqr = CD_MAX(max_sqr, cd_vec2_dis_sqr_v(vertices[i], centroid));
+        }
+        const CD_VEC2 extent = cd_vec2_make_v(radius, radius);
+        aabb->lowerBound = cd_vec2_sub_v(lower, extent);
+        aabb->upperBound = cd_vec2_add_v(upper, extent);
+        return sqrtf(max_sqr) + radius;
+    }
+
+    /**
+     * @brief 根据顶点重新计算多边形的边法向、形心、包围盒与包围半径,无参数检查
+     *        顶点需已是逆时针的凸多边形,顶点或圆角半径改变后调用
+     * @param polygon 多边形
+     */
+    CD_INLINE CD_VOID cd_polygon_update_v(CD_POLYGON *polygon)
+    {
+        cd_polygon_normals_v(polygon->vertices, polygon->count, polygon->normals);
+        polygon->centroid = cd_polygon_centroid_v(polygon->vertices, polygon->count);
+        polygon->boundRadius = cd_polygon_bounds_v(polygon->vertices, polygon->count, polygon->centroid,
+                                                   polygon->radius, &polygon->aabb);
+    }
+
+    /**
+     * @brief 根据顶点重新计算多边形的边法向、形心、包围盒与包围半径
+     * @param polygon 多边形,顶点需已是逆时针的凸多边形
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_polygon_update(CD_POLYGON *polygon)
     {
         CD_RET ret = CD_RET_OK;
-        CD_CHECK_ERROR(point == CD_NULL || polygon == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_DISTANCE_INPUT input = {0};
-        ret = cd_make_proxy(polygon->vertices, polygon->count, 0.0f, &input.proxyA);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-        ret = cd_make_proxy(point, 1, 0.0f, &input.proxyB);
+        CD_CHECK_ERROR(polygon == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(polygon->count < 3 || polygon->count > MAX_POLYGON_VERTICES, COLLISION_DETECTION_E_ZERO_NUM);
+        cd_polygon_update_v(polygon);
+        return ret;
+    }
+
+    /**
+     * @brief 快速凸包的递归步骤,在 A->B 右侧(凸包外侧)的点中找距离最远的点 C,
+     *        原地把点划分为 A->C 右侧与 C->B 右侧两组后分别递归,按逆时针顺序输出 A 与 B 之间的凸包顶点,无参数检查
+     *        每个点至多输出一次,因此 hull 的长度不小于全部点数即不会越界
+     * @param a 边起点
+     * @param b 边终点
+     * @param points 位于 A->B 右侧的点,会被原地重排
+     * @param count 点数量
+     * @param hull 输出的凸包顶点
+     * @param hull_count 已输出的顶点数量
+     */
+    CD_INLINE CD_VOID cd_quickhull_recurse_v(CD_VEC2 a, CD_VEC2 b, CD_VEC2 *points, CD_S32 count,
+                                             CD_VEC2 *hull, CD_S32 *hull_count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        CD_S32 best = 0;
+        CD_F32 best_cross = 0.0f;
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            const CD_F32 cross = cd_points_cross_v(a, b, points[i]);
+            if (cross < best_cross)
+            {
+                best_cross = cross;
+                best = i;
+            }
+        }
+        const CD_VEC2 c = points[best];
+
+        // 距离超过合并距离才算作 A->C 或 C->B 外侧的点,其余点在三角形 ABC 内或贴近其边,直接丢弃
+        const CD_F32 weld_ac = CD_HULL_WELD_DISTANCE * cd_vec2_dis_v(a, c);
+        const CD_F32 weld_cb = CD_HULL_WELD_DISTANCE * cd_vec2_dis_v(c, b);
+        CD_S32 n1 = 0;
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            if (cd_points_cross_v(a, c, points[i]) < -weld_ac)
+            {
+                const CD_VEC2 t = points[n1];
+                points[n1++] = points[i];
+                points[i] = t;
+            }
+        }
+        CD_S32 n2 = n1;
+        for (CD_S32 i = n1; i < count; ++i)
+        {
+            if (cd_points_cross_v(c, b, points[i]) < -weld_cb)
+            {
+                const CD_VEC2 t = points[n2];
+                points[n2++] = points[i];
+                points[i] = t;
+            }
+        }
+
+        cd_quickhull_recurse_v(a, c, points, n1, hull, hull_count);
+        hull[(*hull_count)++] = c;
+        cd_quickhull_recurse_v(c, b, points + n1, n2 - n1, hull, hull_count);
+    }
+
+    /**
+     * @brief 求任意点集的凸包: 快速凸包求逆时针凸包顶点,丢弃到凸包边的距离不超过 CD_HULL_WELD_DISTANCE 的点,
+     *        再合并相距不足该距离的相邻顶点、去掉近共线顶点;原始凸包先写入 scratch,清理后才按 capacity 检查并拷贝到 hull,
+     *        因此只有清理后的顶点数超过 capacity 才报错;期望时间复杂度 O(n log h), h 为凸包顶点数,不分配内存
+     * @param points 点集,顺序任意
+     * @param count 点数量
+     * @param scratch 临时点数组,长度不小于 CD_HULL_SCRATCH_SIZE(count)
+     * @param hull 输出的逆时针凸包顶点
+     * @param capacity hull 的容量
+     * @param hull_count 凸包顶点数
+     * @return ok / 参数异常 / 凸包退化成点或线段 / 凸包顶点数超过 capacity
+     */
+    CD_INLINE CD_RET cd_make_hull(const CD_VEC2 *points, CD_S32 count, CD_VEC2 *scratch,
+                                  CD_VEC2 *hull, CD_S32 capacity, CD_S32 *hull_count)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(points == CD_NULL || scratch == CD_NULL || hull == CD_NULL || hull_count == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(count < 3 || capacity < 3, COLLISION_DETECTION_E_ZERO_NUM);
+        const CD_F32 weld_sqr = CD_HULL_WELD_DISTANCE * CD_HULL_WELD_DISTANCE;
+
+        // x 最小与最大(x 相同时比较 y)的点一定是凸包顶点
+        CD_S32 left = 0;
+        CD_S32 right = 0;
+        for (CD_S32 i = 1; i < count; ++i)
+        {
+            const CD_VEC2 p = points[i];
+            if (p.x < points[left].x || (p.x == points[left].x && p.y < points[left].y))
+            {
+                left = i;
+            }
+            if (p.x > points[right].x || (p.x == points[right].x && p.y > points[right].y))
+            {
+                right = i;
+            }
+        }
+        const CD_VEC2 l = points[left];
+        const CD_VEC2 r = points[right];
+        CD_CHECK_ERROR(cd_vec2_dis_sqr_v(l, r) <= weld_sqr, COLLISION_DETECTION_E_CALC_ERROR);
+
+        // L->R 右侧为下半部分,R->L 右侧为上半部分
+        const CD_F32 weld_lr = CD_HULL_WELD_DISTANCE * cd_vec2_dis_v(l, r);
+        CD_S32 lower_count = 0;
+        CD_S32 upper_count = 0;
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            const CD_F32 cross = cd_points_cross_v(l, r, points[i]);
+            if (cross < -weld_lr)
+            {
+                scratch[lower_count++] = points[i];
+            }
+            else if (cross > weld_lr)
+            {
+                scratch[count - 1 - upper_count++] = points[i];
+            }
+        }
+
+        // scratch 后半部分存放未清理的凸包,顶点数不超过 count
+        CD_VEC2 *raw = scratch + count;
+        CD_S32 m = 0;
+        raw[m++] = l;
+        cd_quickhull_recurse_v(l, r, scratch, lower_count, raw, &m);
+        raw[m++] = r;
+        cd_quickhull_recurse_v(r, l, scratch + count - upper_count, upper_count, raw, &m);
+
+        // 合并相邻的近重合点,再去掉到相邻两点连线距离不足合并距离的近共线点
+        const CD_S32 k = m;
+        m = 1;
+        for (CD_S32 i = 1; i < k; ++i)
+        {
+            if (cd_vec2_dis_sqr_v(raw[i], raw[m - 1]) > weld_sqr)
+            {
+                raw[m++] = raw[i];
+            }
+        }
+        if (m > 1 && cd_vec2_dis_sqr_v(raw[m - 1], raw[0]) <= weld_sqr)
+        {
+            --m;
+        }
+        for (CD_BOOL removed = CD_TRUE; removed && m >= 3;)
+        {
+            removed = CD_FALSE;
+            for (CD_S32 i = 0; i < m && m >= 3; ++i)
+            {
+                const CD_VEC2 prev = raw[i > 0 ? i - 1 : m - 1];
+                const CD_VEC2 next = raw[i + 1 < m ? i + 1 : 0];
+                const CD_F32 base_sqr = cd_vec2_dis_sqr_v(prev, next);
+                const CD_F32 cross = cd_points_cross_v(prev, next, raw[i]);
+                // 点到 prev-next 连线的距离 = |cross| / |next - prev|
+                if (cross * cross <= weld_sqr * base_sqr)
+                {
+                    for (CD_S32 j = i; j + 1 < m; ++j)
+                    {
+                        raw[j] = raw[j + 1];
+                    }
+                    --m;
+                    removed = CD_TRUE;
+                    --i;
+                }
+            }
+        }
+        CD_CHECK_ERROR(m < 3, COLLISION_DETECTION_E_CALC_ERROR);
+        CD_CHECK_ERROR(m > capacity, COLLISION_DETECTION_E_MEM_FULL);
+        for (CD_S32 i = 0; i < m; ++i)
+        {
+            hull[i] = raw[i];
+        }
+        *hull_count = m;
+        return ret;
+    }
+
+    /**
+     * @brief 由任意点集构建凸多边形: cd_make_hull 求凸包后计算边法向、形心、包围盒与包围半径
+     * @param points 点集,顺序任意
+     * @param count 点数量
+     * @param radius 多边形的圆角半径
+     * @param scratch 临时点数组,长度不小于 CD_HULL_SCRATCH_SIZE(count)
+     * @param result 逆时针凸多边形
+     * @return ok / 参数异常 / 凸包退化成点或线段 / 凸包顶点数超过 MAX_POLYGON_VERTICES
+     */
+    CD_INLINE CD_RET cd_make_polygon(const CD_VEC2 *points, CD_S32 count, CD_F32 radius, CD_VEC2 *scratch, CD_POLYGON *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_S32 hull_count = 0;
+        ret = cd_make_hull(points, count, scratch, result->vertices, MAX_POLYGON_VERTICES, &hull_count);
         CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-        input.transformA = TRANSFORM_IDENTITY;
-        input.transformB = TRANSFORM_IDENTITY;
-        input.useRadii = CD_FALSE;
-        CD_DISTANCE_CACHE cache = {0};
-        CD_DISTANCE_OUTPUT output = {0};
+        result->count = hull_count;
+        result->radius = radius;
+        cd_polygon_update_v(result);
+        return ret;
+    }
+
+    /**
+     * @brief 点相对多边形第i条边的分离量 dot(n, p) - dot(n, v),无参数检查
+     *        批量版本按同样的运算顺序计算,保证两者判定一致
+     * @param polygon 凸多边形
+     * @param i 边的索引
+     * @param point 点
+     * @return 分离量,在边内侧时为负
+     */
+    CD_INLINE CD_F32 cd_polygon_edge_separation_v(const CD_POLYGON_VIEW *polygon, CD_S32 i, CD_VEC2 point)
+    {
+        const CD_VEC2 n = polygon->normals[i];
+        const CD_F32 offset = n.x * polygon->vertices[i].x + n.y * polygon->vertices[i].y;
+        return n.x * point.x + n.y * point.y - offset;
+    }
+
+    /**
+     * @brief 点在多边形外且分离量不超过 radius 时,精确判断点到多边形边界的距离是否不超过 radius,无参数检查
+     * @param polygon 凸多边形
+     * @param point 点
+     * @param radius 外扩距离
+     * @return 1 距离不超过 radius, 0 超过
+     */
+    CD_INLINE CD_BOOL cd_point_near_polygon_v(const CD_POLYGON_VIEW *polygon, CD_VEC2 point, CD_F32 radius)
+    {
+        const CD_F32 radius_sqr = CD_SQUARE(radius + CD_EPS);
+        for (CD_S32 i = 0; i < polygon->count; ++i)
+        {
+            const CD_VEC2 v1 = polygon->vertices[i];
+            const CD_VEC2 v2 = polygon->vertices[i + 1 < polygon->count ? i + 1 : 0];
+            const CD_VEC2 e = cd_vec2_sub_v(v2, v1);
+            const CD_VEC2 d = cd_vec2_sub_v(point, v1);
+            const CD_F32 len_sqr = cd_vec2_len_sqr_v(e);
+            const CD_F32 t = len_sqr > CD_EPS ? CD_CLIP(cd_vec2_dot_v(d, e) / len_sqr, 0.0f, 1.0f) : 0.0f;
+            if (cd_vec2_len_sqr_v(cd_vec2_mul_sub_v(d, t, e)) <= radius_sqr)
+            {
+                return CD_TRUE;
+            }
+        }
+        return CD_FALSE;
+    }
+
+    /**
+     * @brief 判断点是否在外扩 radius 后的凸多边形内,无参数检查
+     *        先用预计算的边法向做半平面测试,分离量落在 (0, radius] 之间时再精确计算到边界的距离,
+     *        因此角点处按圆角而不是尖角外扩
+     * @param polygon 凸多边形视图,逆时针,需已填好 normals
+     * @param point 点
+     * @param radius 外扩距离, 0 表示不外扩
+     * @return 1 在多边形内(含边界), 0 不在
+     */
+    CD_INLINE CD_BOOL cd_point_in_polygon_view_v(const CD_POLYGON_VIEW *polygon, CD_VEC2 point, CD_F32 radius)
+    {
+        CD_F32 separation = -CD_MAXABS_F;
+        for (CD_S32 i = 0; i < polygon->count; ++i)
+        {
+            separation = CD_MAX(separation, cd_polygon_edge_separation_v(polygon, i, point));
+        }
+        if (separation <= CD_EPS)
+        {
+            return CD_TRUE;
+        }
+        if (separation > radius + CD_EPS)
+        {
+            return CD_FALSE;
+        }
+        return cd_point_near_polygon_v(polygon, point, radius);
+    }
+
+    /**
+     * @brief 判断点是否在外扩 radius 后的凸多边形内,无参数检查
+     * @param polygon 凸多边形,逆时针,需已填好 normals
+     * @param point 点
+     * @param radius 外扩距离, 0 表示不外扩
+     * @return 1 在多边形内(含边界), 0 不在
+     */
+    CD_INLINE CD_BOOL cd_point_in_polygon_v(const CD_POLYGON *polygon, CD_VEC2 point, CD_F32 radius)
+    {
+        const CD_POLYGON_VIEW view = cd_polygon_view_v(polygon);
+        return cd_point_in_polygon_view_v(&view, point, radius);
+    }
+
+    /**
+     * @brief 判断点是否在多边形内,多边形的圆角半径作为外扩距离
+     * @param point 点
+     * @param polygon 凸多边形,逆时针,需已填好 normals
+     * @param result 1 在多边形内(含边界), 0 不在
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_point_in_polygon(const CD_VEC2 *point, const CD_POLYGON *polygon, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(point == CD_NULL || polygon == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(polygon->count < 3, COLLISION_DETECTION_E_ZERO_NUM);
+        *result = cd_point_in_polygon_v(polygon, *point, polygon->radius);
         return ret;
     }
 
+    /**
+     * @brief 多边形的aabb(含圆角半径),由顶点计算,不依赖 aabb 缓存,因此也适用于手工填写顶点的多边形,无参数检查
+     * @param polygon 多边形
+     * @return aabb
+     */
+    CD_INLINE CD_AABB cd_polygon_to_aabb_v(const CD_POLYGON *polygon)
+    {
+        CD_VEC2 lower = polygon->vertices[0];
+        CD_VEC2 upper = polygon->vertices[0];
+        for (CD_S32 i = 1; i < polygon->count; ++i)
+        {
+            lower = cd_vec2_min_v(lower, polygon->vertices[i]);
+            upper = cd_vec2_max_v(upper, polygon->vertices[i]);
+        }
+        const CD_VEC2 extent = cd_vec2_make_v(polygon->radius, polygon->radius);
+        CD_AABB r;
+        r.lowerBound = cd_vec2_sub_v(lower, extent);
+        r.upperBound = cd_vec2_add_v(upper, extent);
+        return r;
+    }
+
+    /**
+     * @brief 多边形的aabb(含圆角半径),由顶点计算
+     * @param polygon 多边形
+     * @param result aabb
+     * @return ok / 参数异常
+     */
     CD_INLINE CD_RET cd_polygon_to_aabb(const CD_POLYGON *polygon, CD_AABB *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(polygon == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_CHECK_ERROR(polygon->count < 3, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(polygon->count < 3 || polygon->count > MAX_POLYGON_VERTICES, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_polygon_to_aabb_v(polygon);
+        return ret;
+    }
 
-        result->lowerBound = polygon->vertices[0];
-        result->upperBound = polygon->vertices[0];
+    /**
+     * @brief 将obb转换成逆时针的四边形,并填好边法向、形心与包围盒缓存,无参数检查
+     * @param obb obb
+     * @return 四边形,圆角半径为0
+     */
+    CD_INLINE CD_POLYGON cd_obb_to_polygon_v(CD_OBB obb)
+    {
+        CD_POLYGON r;
+        cd_obb_vertices_v(obb, r.vertices);
+        const CD_VEC2 axis_l = cd_vec2_make_v(obb.q.c, obb.q.s);
+        const CD_VEC2 axis_w = cd_vec2_make_v(-obb.q.s, obb.q.c);
+        // 顶点0->1的边位于 -axis_w 一侧,依次逆时针
+        r.normals[0] = cd_vec2_neg_v(axis_w);
+        r.normals[1] = axis_l;
+        r.normals[2] = axis_w;
+        r.normals[3] = cd_vec2_neg_v(axis_l);
+        r.centroid = obb.center;
+        r.aabb = cd_obb_to_aabb_v(obb);
+        r.boundRadius = 0.5f * sqrtf(obb.length * obb.length + obb.width * obb.width);
+        r.radius = 0.0f;
+        r.count = 4;
+        return r;
+    }
 
-        for (CD_S32 i = 0; i < polygon->count; ++i)
+    /**
+     * @brief 将obb转换成逆时针的四边形,并填好边法向与形心
+     * @param obb obb
+     * @param result 四边形
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_obb_to_polygon(const CD_OBB *obb, CD_POLYGON *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(obb == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_obb_to_polygon_v(*obb);
+        return ret;
+    }
+
+    /**
+     * @brief 分离轴检测凸多边形顶点与obb是否重叠,无参数检查
+     *        候选轴为多边形各边的法向(未归一化)与obb的两个轴,找到分离轴立即返回
+     * @param vertices 凸多边形顶点,逆时针或顺时针均可
+     * @param count 顶点数量
+     * @param obb obb
+     * @return 1 重叠(含边界接触), 0 不重叠
+     */
+    CD_INLINE CD_BOOL cd_vertices_obb_overlap_v(const CD_VEC2 *vertices, CD_S32 count, CD_OBB obb)
+    {
+        const CD_F32 hl = obb.length * 0.5f;
+        const CD_F32 hw = obb.width * 0.5f;
+        // obb的两个轴
+        for (CD_S32 k = 0; k < 2; ++k)
+        {
+            const CD_F32 ax = k == 0 ? obb.q.c : -obb.q.s;
+            const CD_F32 ay = k == 0 ? obb.q.s : obb.q.c;
+            const CD_F32 extent = k == 0 ? hl : hw;
+            const CD_F32 center = obb.center.x * ax + obb.center.y * ay;
+            CD_F32 lo = CD_MAXABS_F;
+            CD_F32 hi = -CD_MAXABS_F;
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                const CD_F32 d = vertices[i].x * ax + vertices[i].y * ay;
+                lo = CD_MIN(lo, d);
+                hi = CD_MAX(hi, d);
+            }
+            if (hi < center - extent || lo > center + extent)
+            {
+                return CD_FALSE;
+            }
+        }
+        // 多边形各边的法向
+        for (CD_S32 j = 0; j < count; ++j)
+        {
+            const CD_VEC2 v1 = vertices[j];
+            const CD_VEC2 v2 = vertices[j + 1 < count ? j + 1 : 0];
+            const CD_F32 nx = v2.y - v1.y;
+            const CD_F32 ny = v1.x - v2.x;
+            const CD_F32 center = obb.center.x * nx + obb.center.y * ny;
+            const CD_F32 extent = hl * CD_FABS(obb.q.c * nx + obb.q.s * ny) + hw * CD_FABS(obb.q.c * ny - obb.q.s * nx);
+            CD_F32 lo = CD_MAXABS_F;
+            CD_F32 hi = -CD_MAXABS_F;
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                const CD_F32 d = vertices[i].x * nx + vertices[i].y * ny;
+                lo = CD_MIN(lo, d);
+                hi = CD_MAX(hi, d);
+            }
+            if (hi < center - extent || lo > center + extent)
+            {
+                return CD_FALSE;
+            }
+        }
+        return CD_TRUE;
+    }
+
+    /**
+     * @brief 分离轴检测凸多边形与obb是否重叠,不考虑多边形的圆角半径
+     * @param polygon 凸多边形
+     * @param obb obb
+     * @param result 1 重叠(含边界接触), 0 不重叠
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_polygon_obb_overlap(const CD_POLYGON *polygon, const CD_OBB *obb, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(polygon == CD_NULL || obb == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(polygon->count <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        *result = cd_vertices_obb_overlap_v(polygon->vertices, polygon->count, *obb);
+        return ret;
+    }
+
+    /**
+     * @brief 凸多边形b的顶点相对a各边的最大分离量,无参数检查
+     * @param a 凸多边形视图a,需已填好 normals
+     * @param b 凸多边形视图b
+     * @return 最大分离量,不含圆角半径
+     */
+    CD_INLINE CD_F32 cd_polygon_view_separation_v(const CD_POLYGON_VIEW *a, const CD_POLYGON_VIEW *b)
+    {
+        CD_F32 max_separation = -CD_MAXABS_F;
+        for (CD_S32 i = 0; i < a->count; ++i)
+        {
+            const CD_VEC2 n = a->normals[i];
+            const CD_VEC2 v = a->vertices[i];
+            CD_F32 si = CD_MAXABS_F;
+            for (CD_S32 j = 0; j < b->count; ++j)
+            {
+                si = CD_MIN(si, cd_vec2_dot_v(n, cd_vec2_sub_v(b->vertices[j], v)));
+            }
+            if (si > max_separation)
+            {
+                max_separation = si;
+            }
+        }
+        return max_separation;
+    }
+
+    /**
+     * @brief 分离轴检测两个凸多边形视图是否重叠,考虑圆角半径,无参数检查
+     *        候选轴为两个多边形各边的外法向,顶点数不受 MAX_POLYGON_VERTICES 限制;
+     *        圆角按沿法向外扩处理,角点附近的判定偏保守
+     * @param a 凸多边形视图a,需已填好 normals
+     * @param b 凸多边形视图b,需已填好 normals
+     * @return 1 重叠(含边界接触), 0 不重叠
+     */
+    CD_INLINE CD_BOOL cd_polygon_views_overlap_v(const CD_POLYGON_VIEW *a, const CD_POLYGON_VIEW *b)
+    {
+        const CD_F32 radius = a->radius + b->radius;
+        if (cd_polygon_view_separation_v(a, b) > radius)
         {
-            ret = cd_vec2_min(&result->lowerBound, &polygon->vertices[i], &result->lowerBound);
-            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-            ret = cd_vec2_max(&result->upperBound, &polygon->vertices[i], &result->upperBound);
-            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            return CD_FALSE;
         }
+        return cd_polygon_view_separation_v(b, a) <= radius;
+    }
+
+    /**
+     * @brief 分离轴检测两个凸多边形是否重叠,考虑圆角半径
+     * @param a 凸多边形a,需已填好 normals
+     * @param b 凸多边形b,需已填好 normals
+     * @param result 1 重叠(含边界接触), 0 不重叠
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_polygons_overlap(const CD_POLYGON *a, const CD_POLYGON *b, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(a->count < 3 || b->count < 3, COLLISION_DETECTION_E_ZERO_NUM);
+        const CD_POLYGON_VIEW view_a = cd_polygon_view_v(a);
+        const CD_POLYGON_VIEW view_b = cd_polygon_view_v(b);
+        *result = cd_polygon_views_overlap_v(&view_a, &view_b);
         return ret;
     }
 
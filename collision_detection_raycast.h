@@ -0,0 +1,706 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-18 15:32:08
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-18 15:32:08
+ */
+
+#ifndef __COLLISION_DETECTION_RAYCAST_H__
+#define __COLLISION_DETECTION_RAYCAST_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_vec2.h"
+#include "collision_detection_transform.h"
+#include "collision_detection_segment.h"
+#include "collision_detection_circle.h"
+#include "collision_detection_aabb.h"
+#include "collision_detection_obb.h"
+#include "collision_detection_polygon.h"
+#include "collision_detection_dynamic_tree.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CD_RAY_PACKET_SIZE 16 // 共享起点的射线包大小,一次树遍历服务一个包
+
+    // 射线 origin + t * translation, t ∈ [0, maxFraction]
+    typedef struct _CD_RAY_INPUT_
+    {
+        CD_VEC2 origin;      ///< 起点
+        CD_VEC2 translation; ///< 方向与长度
+        CD_F32 maxFraction;  ///< 最大比例,一般为1
+    } CD_RAY_INPUT;
+
+    // 射线检测结果;起点在形状内部时不算命中
+    typedef struct _CD_RAY_OUTPUT_
+    {
+        CD_VEC2 point;   ///< 命中点
+        CD_VEC2 normal;  ///< 命中点处形状表面的单位外法向
+        CD_F32 fraction; ///< 命中比例, point = origin + fraction * translation
+        CD_BOOL hit;     ///< 是否命中
+    } CD_RAY_OUTPUT;
+
+    /**
+     * @brief 射线与树节点的回调
+     * @param input 射线,maxFraction 为当前已裁剪的值
+     * @param proxyId 叶子节点索引
+     * @param userData 用户数据
+     * @param context 调用者上下文
+     * @return < 0 忽略该叶子, 0 终止遍历, > 0 把射线裁剪到该比例(只会变短)
+     */
+    typedef CD_F32 (*CD_TREE_RAY_CALLBACK)(const CD_RAY_INPUT *input, CD_S32 proxyId, CD_S32 userData, CD_VOID *context);
+
+    CD_INLINE CD_RAY_OUTPUT cd_ray_no_hit_v(CD_VOID)
+    {
+        CD_RAY_OUTPUT r;
+        r.point = Vec2_Zero;
+        r.normal = Vec2_Zero;
+        r.fraction = 0.0f;
+        r.hit = CD_FALSE;
+        return r;
+    }
+
+    CD_INLINE CD_RAY_OUTPUT cd_ray_hit_v(const CD_RAY_INPUT *input, CD_F32 fraction, CD_VEC2 normal)
+    {
+        CD_RAY_OUTPUT r;
+        r.point = cd_vec2_mul_add_v(input->origin, fraction, input->translation);
+        r.normal = normal;
+        r.fraction = fraction;
+        r.hit = CD_TRUE;
+        return r;
+    }
+
+    /**
+     * @brief 射线与线段,双面,无参数检查
+     * @param input 射线
+     * @param segment 线段
+     * @return 检测结果,法向朝向射线起点一侧;与线段平行时不命中
+     */
+    CD_INLINE CD_RAY_OUTPUT cd_ray_cast_segment_v(const CD_RAY_INPUT *input, CD_SEGMENT segment)
+    {
+        const CD_VEC2 d = input->translation;
+        const CD_VEC2 e = cd_vec2_sub_v(segment.point2, segment.point1);
+        const CD_F32 denom = cd_vec2_cross_v(d, e);
+        if (CD_FABS(denom) < CD_EPS)
+        {
+            return cd_ray_no_hit_v();
+        }
+        const CD_VEC2 m = cd_vec2_sub_v(segment.point1, input->origin);
+        const CD_F32 t = cd_vec2_cross_v(m, e) / denom;
+        const CD_F32 u = cd_vec2_cross_v(m, d) / denom;
+        if (t < 0.0f || t > input->maxFraction || u < 0.0f || u > 1.0f)
+        {
+            return cd_ray_no_hit_v();
+        }
+        CD_VEC2 normal = cd_vec2_norm_v(cd_vec2_left_perp_v(e));
+        if (cd_vec2_dot_v(normal, d) > 0.0f)
+        {
+            normal = cd_vec2_neg_v(normal);
+        }
+        return cd_ray_hit_v(input, t, normal);
+    }
+
+    /**
+     * @brief 射线与圆,无参数检查
+     * @param input 射线
+     * @param circle 圆
+     * @return 检测结果
+     */
+    CD_INLINE CD_RAY_OUTPUT cd_ray_cast_circle_v(const CD_RAY_INPUT *input, CD_CIRCLE circle)
+    {
+        const CD_VEC2 d = input->translation;
+        const CD_VEC2 m = cd_vec2_sub_v(input->origin, circle.center);
+        const CD_F32 b = cd_vec2_dot_v(m, d);
+        const CD_F32 c = cd_vec2_dot_v(m, m) - circle.radius * circle.radius;
+        const CD_F32 a = cd_vec2_dot_v(d, d);
+        // 起点在圆内,或背离圆心运动
+        if (c < 0.0f || b > 0.0f || a < CD_EPS)
+        {
+            return cd_ray_no_hit_v();
+        }
+        const CD_F32 disc = b * b - a * c;
+        if (disc < 0.0f)
+        {
+            return cd_ray_no_hit_v();
+        }
+        const CD_F32 t = (-b - sqrtf(disc)) / a;
+        if (t > input->maxFraction)
+        {
+            return cd_ray_no_hit_v();
+        }
+        const CD_VEC2 point = cd_vec2_mul_add_v(input->origin, t, d);
+        return cd_ray_hit_v(input, t, cd_vec2_norm_v(cd_vec2_sub_v(point, circle.center)));
+    }
+
+    /**
+     * @brief 局部坐标系下射线与中心在原点、半边长为 (hx, hy) 的矩形的 slab 检测,无参数检查
+     * @param origin 起点
+     * @param d 方向与长度
+     * @param hx 半边长x
+     * @param hy 半边长y
+     * @param max_fraction 最大比例
+     * @param fraction 命中比例
+     * @param normal 命中法向
+     * @return 1 命中, 0 未命中或起点在矩形内
+     */
+    CD_INLINE CD_BOOL cd_ray_cast_box_v(CD_VEC2 origin, CD_VEC2 d, CD_F32 hx, CD_F32 hy, CD_F32 max_fraction,
+                                        CD_F32 *fraction, CD_VEC2 *normal)
+    {
+        CD_F32 lower = -CD_MAXABS_F;
+        CD_F32 upper = CD_MAXABS_F;
+        CD_VEC2 n = Vec2_Zero;
+        for (CD_S32 axis = 0; axis < 2; ++axis)
+        {
+            const CD_F32 o = axis == 0 ? origin.x : origin.y;
+            const CD_F32 v = axis == 0 ? d.x : d.y;
+            const CD_F32 h = axis == 0 ? hx : hy;
+            if (CD_FABS(v) < CD_EPS)
+            {
+                if (o < -h || o > h)
+                {
+                    return CD_FALSE;
+                }
+                continue;
+            }
+            const CD_F32 inv = 1.0f / v;
+            CD_F32 t1 = (-h - o) * inv;
+            CD_F32 t2 = (h - o) * inv;
+            const CD_F32 s = v > 0.0f ? -1.0f : 1.0f;
+            if (t1 > t2)
+            {
+                const CD_F32 tmp = t1;
+                t1 = t2;
+                t2 = tmp;
+            }
+            if (t1 > lower)
+            {
+                lower = t1;
+                n = axis == 0 ? cd_vec2_make_v(s, 0.0f) : cd_vec2_make_v(0.0f, s);
+            }
+            upper = CD_MIN(upper, t2);
+        }
+        if (lower < 0.0f || lower > upper || lower > max_fraction)
+        {
+            return CD_FALSE;
+        }
+        *fraction = lower;
+        *normal = n;
+        return CD_TRUE;
+    }
+
+    /**
+     * @brief 射线与aabb,无参数检查
+     * @param input 射线
+     * @param aabb aabb
+     * @return 检测结果
+     */
+    CD_INLINE CD_RAY_OUTPUT cd_ray_cast_aabb_v(const CD_RAY_INPUT *input, CD_AABB aabb)
+    {
+        const CD_VEC2 center = cd_vec2_scale_v(cd_vec2_add_v(aabb.lowerBound, aabb.upperBound), 0.5f);
+        const CD_VEC2 half = cd_vec2_scale_v(cd_vec2_sub_v(aabb.upperBound, aabb.lowerBound), 0.5f);
+        CD_F32 t;
+        CD_VEC2 normal;
+        if (!cd_ray_cast_box_v(cd_vec2_sub_v(input->origin, center), input->translation, half.x, half.y,
+                               input->maxFraction, &t, &normal))
+        {
+            return cd_ray_no_hit_v();
+        }
+        return cd_ray_hit_v(input, t, normal);
+    }
+
+    /**
+     * @brief 射线与obb,把射线变换到obb局部坐标系后做 slab 检测,无参数检查
+     * @param input 射线
+     * @param obb obb
+     * @return 检测结果
+     */
+    CD_INLINE CD_RAY_OUTPUT cd_ray_cast_obb_v(const CD_RAY_INPUT *input, CD_OBB obb)
+    {
+        const CD_VEC2 origin = cd_inv_rot_vector_v(obb.q, cd_vec2_sub_v(input->origin, obb.center));
+        const CD_VEC2 d = cd_inv_rot_vector_v(obb.q, input->translation);
+        CD_F32 t;
+        CD_VEC2 normal;
+        if (!cd_ray_cast_box_v(origin, d, obb.length * 0.5f, obb.width * 0.5f, input->maxFraction, &t, &normal))
+        {
+            return cd_ray_no_hit_v();
+        }
+        return cd_ray_hit_v(input, t, cd_rot_vector_v(obb.q, normal));
+    }
+
+    /**
+     * @brief 射线与凸多边形视图,无参数检查
+     *        无圆角时逐边收缩 [lower, upper];有圆角时取外扩各边与各顶点圆的最近命中
+     * @param input 射线
+     * @param polygon 凸多边形视图,逆时针,需已填好 normals
+     * @return 检测结果
+     */
+    CD_INLINE CD_RAY_OUTPUT cd_ray_cast_polygon_view_v(const CD_RAY_INPUT *input, const CD_POLYGON_VIEW *polygon)
+    {
+        const CD_VEC2 d = input->translation;
+        if (polygon->radius <= 0.0f)
+        {
+            CD_F32 lower = 0.0f;
+            CD_F32 upper = input->maxFraction;
+            CD_S32 index = -1;
+            for (CD_S32 i = 0; i < polygon->count; ++i)
+            {
+                // 边所在直线上 dot(n, p - v) = 0
+                const CD_F32 numerator = cd_vec2_dot_v(polygon->normals[i], cd_vec2_sub_v(polygon->vertices[i], input->origin));
+                const CD_F32 denominator = cd_vec2_dot_v(polygon->normals[i], d);
+                if (denominator == 0.0f)
+                {
+                    if (numerator < 0.0f)
+                    {
+                        return cd_ray_no_hit_v();
+                    }
+                }
+                else if (denominator < 0.0f && numerator < lower * denominator)
+                {
+                    // 进入该边的半平面
+                    lower = numerator / denominator;
+                    index = i;
+                }
+                else if (denominator > 0.0f && numerator < upper * denominator)
+                {
+                    // 离开该边的半平面
+                    upper = numerator / denominator;
+                }
+                if (upper < lower)
+                {
+                    return cd_ray_no_hit_v();
+                }
+            }
+            // index < 0 表示起点在多边形内
+            return index >= 0 ? cd_ray_hit_v(input, lower, polygon->normals[index]) : cd_ray_no_hit_v();
+        }
+
+        if (cd_point_in_polygon_view_v(polygon, input->origin, polygon->radius))
+        {
+            return cd_ray_no_hit_v();
+        }
+        CD_RAY_INPUT clipped = *input;
+        CD_RAY_OUTPUT best = cd_ray_no_hit_v();
+        for (CD_S32 i = 0; i < polygon->count; ++i)
+        {
+            const CD_VEC2 v1 = polygon->vertices[i];
+            const CD_VEC2 v2 = polygon->vertices[i + 1 < polygon->count ? i + 1 : 0];
+            const CD_VEC2 n = polygon->normals[i];
+            CD_SEGMENT edge;
+            edge.point1 = cd_vec2_mul_add_v(v1, polygon->radius, n);
+            edge.point2 = cd_vec2_mul_add_v(v2, polygon->radius, n);
+            CD_RAY_OUTPUT out = cd_ray_cast_segment_v(&clipped, edge);
+            if (out.hit && cd_vec2_dot_v(n, d) < 0.0f)
+            {
+                out.normal = n;
+                best = out;
+                clipped.maxFraction = out.fraction;
+            }
+            CD_CIRCLE corner;
+            corner.center = v1;
+            corner.radius = polygon->radius;
+            out = cd_ray_cast_circle_v(&clipped, corner);
+            if (out.hit)
+            {
+                best = out;
+                clipped.maxFraction = out.fraction;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief 射线与凸多边形,考虑圆角半径,无参数检查
+     * @param input 射线
+     * @param polygon 凸多边形,需已填好 normals
+     * @return 检测结果
+     */
+    CD_INLINE CD_RAY_OUTPUT cd_ray_cast_polygon_v(const CD_RAY_INPUT *input, const CD_POLYGON *polygon)
+    {
+        const CD_POLYGON_VIEW view = cd_polygon_view_v(polygon);
+        return cd_ray_cast_polygon_view_v(input, &view);
+    }
+
+    /**
+     * @brief 射线与线段
+     * @param input 射线
+     * @param segment 线段
+     * @param result 检测结果
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_ray_cast_segment(const CD_RAY_INPUT *input, const CD_SEGMENT *segment, CD_RAY_OUTPUT *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(input == CD_NULL || segment == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_ray_cast_segment_v(input, *segment);
+        return ret;
+    }
+
+    /**
+     * @brief 射线与圆
+     * @param input 射线
+     * @param circle 圆
+     * @param result 检测结果
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_ray_cast_circle(const CD_RAY_INPUT *input, const CD_CIRCLE *circle, CD_RAY_OUTPUT *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(input == CD_NULL || circle == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_ray_cast_circle_v(input, *circle);
+        return ret;
+    }
+
+    /**
+     * @brief 射线与aabb
+     * @param input 射线
+     * @param aabb aabb
+     * @param result 检测结果
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_ray_cast_aabb(const CD_RAY_INPUT *input, const CD_AABB *aabb, CD_RAY_OUTPUT *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(input == CD_NULL || aabb == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_ray_cast_aabb_v(input, *aabb);
+        return ret;
+    }
+
+    /**
+     * @brief 射线与obb
+     * @param input 射线
+     * @param obb obb
+     * @param result 检测结果
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_ray_cast_obb(const CD_RAY_INPUT *input, const CD_OBB *obb, CD_RAY_OUTPUT *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(input == CD_NULL || obb == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_ray_cast_obb_v(input, *obb);
+        return ret;
+    }
+
+    /**
+     * @brief 射线与凸多边形,考虑圆角半径
+     * @param input 射线
+     * @param polygon 凸多边形,需已填好 normals
+     * @param result 检测结果
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_ray_cast_polygon(const CD_RAY_INPUT *input, const CD_POLYGON *polygon, CD_RAY_OUTPUT *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(input == CD_NULL || polygon == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(polygon->count < 3, COLLISION_DETECTION_E_ZERO_NUM);
+        *result = cd_ray_cast_polygon_v(input, polygon);
+        return ret;
+    }
+
+    /**
+     * @brief 射线进入aabb的比例,起点在aabb内时为0,无参数检查
+     * @param origin 起点
+     * @param inv_d 方向各分量的倒数,分量为0时取 CD_MAXABS_F
+     * @param aabb aabb
+     * @param max_fraction 最大比例
+     * @param entry 进入比例
+     * @return 1 在 [0, max_fraction] 内与aabb相交, 0 不相交
+     */
+    CD_INLINE CD_BOOL cd_ray_aabb_entry_v(CD_VEC2 origin, CD_VEC2 inv_d, const CD_AABB *aabb, CD_F32 max_fraction, CD_F32 *entry)
+    {
+        const CD_F32 tx1 = (aabb->lowerBound.x - origin.x) * inv_d.x;
+        const CD_F32 tx2 = (aabb->upperBound.x - origin.x) * inv_d.x;
+        const CD_F32 ty1 = (aabb->lowerBound.y - origin.y) * inv_d.y;
+        const CD_F32 ty2 = (aabb->upperBound.y - origin.y) * inv_d.y;
+        const CD_F32 lower = CD_MAX(CD_MAX(CD_MIN(tx1, tx2), CD_MIN(ty1, ty2)), 0.0f);
+        const CD_F32 upper = CD_MIN(CD_MIN(CD_MAX(tx1, tx2), CD_MAX(ty1, ty2)), max_fraction);
+        *entry = lower;
+        return lower <= upper;
+    }
+
+    CD_INLINE CD_VEC2 cd_ray_inv_direction_v(CD_VEC2 d)
+    {
+        return cd_vec2_make_v(d.x != 0.0f ? 1.0f / d.x : CD_MAXABS_F, d.y != 0.0f ? 1.0f / d.y : CD_MAXABS_F);
+    }
+
+    // 射线遍历栈中的节点及其进入比例,出栈时比例已超过裁剪后的 maxFraction 则跳过
+    typedef struct _CD_TREE_RAY_ENTRY_
+    {
+        CD_S32 node;
+        CD_F32 entry;
+    } CD_TREE_RAY_ENTRY;
+
+    /**
+     * @brief 射线遍历动态树,近的子节点先遍历,回调命中后裁剪射线,进入比例超过当前 maxFraction 的子树直接跳过
+     * @param tree 动态树
+     * @param input 射线
+     * @param callback 叶子回调,返回值见 CD_TREE_RAY_CALLBACK
+     * @param context 回调上下文
+     * @return ok / 参数异常 / 栈溢出
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_ray_cast(const CD_DYNAMIC_TREE *tree, const CD_RAY_INPUT *input,
+                                              CD_TREE_RAY_CALLBACK callback, CD_VOID *context)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL || input == CD_NULL || callback == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        if (tree->root == CD_TREE_NULL_NODE)
+        {
+            return ret;
+        }
+        CD_RAY_INPUT ray = *input;
+        const CD_VEC2 inv_d = cd_ray_inv_direction_v(ray.translation);
+        CD_TREE_RAY_ENTRY stack[CD_TREE_STACK_SIZE];
+        CD_S32 stack_count = 0;
+        CD_F32 entry;
+        if (!cd_ray_aabb_entry_v(ray.origin, inv_d, &tree->nodes[tree->root].aabb, ray.maxFraction, &entry))
+        {
+            return ret;
+        }
+        stack[stack_count].node = tree->root;
+        stack[stack_count].entry = entry;
+        ++stack_count;
+        while (stack_count > 0)
+        {
+            const CD_TREE_RAY_ENTRY top = stack[--stack_count];
+            if (top.entry > ray.maxFraction)
+            {
+                continue;
+            }
+            const CD_TREE_NODE *node = tree->nodes + top.node;
+            if (node->height == 0)
+            {
+                const CD_F32 value = callback(&ray, top.node, node->userData, context);
+                if (value == 0.0f)
+                {
+                    return ret;
+                }
+                if (value > 0.0f)
+                {
+                    ray.maxFraction = CD_MIN(ray.maxFraction, value);
+                }
+                continue;
+            }
+            CD_F32 entry1, entry2;
+            const CD_BOOL hit1 = cd_ray_aabb_entry_v(ray.origin, inv_d, &tree->nodes[node->child1].aabb, ray.maxFraction, &entry1);
+            const CD_BOOL hit2 = cd_ray_aabb_entry_v(ray.origin, inv_d, &tree->nodes[node->child2].aabb, ray.maxFraction, &entry2);
+            CD_CHECK_ERROR(stack_count + 2 > CD_TREE_STACK_SIZE, COLLISION_DETECTION_E_MEM_FULL);
+            // 远的先入栈,近的先出栈
+            const CD_BOOL near1 = entry1 <= entry2;
+            if (hit1 && hit2)
+            {
+                stack[stack_count].node = near1 ? node->child2 : node->child1;
+                stack[stack_count].entry = near1 ? entry2 : entry1;
+                ++stack_count;
+                stack[stack_count].node = near1 ? node->child1 : node->child2;
+                stack[stack_count].entry = near1 ? entry1 : entry2;
+                ++stack_count;
+            }
+            else if (hit1 || hit2)
+            {
+                stack[stack_count].node = hit1 ? node->child1 : node->child2;
+                stack[stack_count].entry = hit1 ? entry1 : entry2;
+                ++stack_count;
+            }
+        }
+        return ret;
+    }
+
+    // 射线与obb障碍物的最近命中
+    typedef struct _CD_RAY_OBBS_HIT_
+    {
+        const CD_OBB *obstacles;
+        CD_RAY_OUTPUT output;
+        CD_S32 id;
+    } CD_RAY_OBBS_HIT;
+
+    CD_INLINE CD_F32 cd_ray_obbs_callback(const CD_RAY_INPUT *input, CD_S32 proxyId, CD_S32 userData, CD_VOID *context)
+    {
+        CD_RAY_OBBS_HIT *c = (CD_RAY_OBBS_HIT *)context;
+        (CD_VOID) proxyId;
+        const CD_RAY_OUTPUT out = cd_ray_cast_obb_v(input, c->obstacles[userData]);
+        if (!out.hit)
+        {
+            return -1.0f;
+        }
+        c->output = out;
+        c->id = userData;
+        return out.fraction;
+    }
+
+    /**
+     * @brief 批量射线与动态树中的obb障碍物,每条射线输出最近的命中
+     * @param tree 动态树,叶子节点的 userData 为障碍物下标
+     * @param obstacles 障碍物数组
+     * @param rays 射线数组
+     * @param count 射线数量
+     * @param outputs 检测结果,长度为 count
+     * @param hit_ids 命中的障碍物下标,未命中为 CD_TREE_NULL_NODE,长度为 count,可为null
+     * @return ok / 参数异常 / 栈溢出
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_ray_cast_obbs(const CD_DYNAMIC_TREE *tree, const CD_OBB *obstacles,
+                                                   const CD_RAY_INPUT *rays, CD_S32 count,
+                                                   CD_RAY_OUTPUT *outputs, CD_S32 *hit_ids)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL || obstacles == CD_NULL || rays == CD_NULL || outputs == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        CD_RAY_OBBS_HIT hit;
+        hit.obstacles = obstacles;
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            hit.output = cd_ray_no_hit_v();
+            hit.id = CD_TREE_NULL_NODE;
+            ret = cd_dynamic_tree_ray_cast(tree, &rays[i], cd_ray_obbs_callback, &hit);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            outputs[i] = hit.output;
+            if (hit_ids != CD_NULL)
+            {
+                hit_ids[i] = hit.id;
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 共享起点的射线包遍历动态树,节点对包内所有射线做 slab 检测,任一射线命中即下探,
+     *        子节点按沿包平均方向的远近排序;叶子上逐条射线检测obb并裁剪各自的 maxFraction,无参数检查
+     * @param tree 动态树,非空
+     * @param obstacles 障碍物数组
+     * @param origin 共享起点
+     * @param dxs 各射线 translation 的x分量
+     * @param dys 各射线 translation 的y分量
+     * @param n 射线数量,不超过 CD_RAY_PACKET_SIZE
+     * @param outputs 检测结果
+     * @param hit_ids 命中的障碍物下标,可为null
+     * @return ok / 栈溢出
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_ray_packet_v(const CD_DYNAMIC_TREE *tree, const CD_OBB *obstacles, CD_VEC2 origin,
+                                                  const CD_F32 *dxs, const CD_F32 *dys, CD_S32 n,
+                                                  CD_RAY_OUTPUT *outputs, CD_S32 *hit_ids)
+    {
+        CD_F32 inv_x[CD_RAY_PACKET_SIZE];
+        CD_F32 inv_y[CD_RAY_PACKET_SIZE];
+        CD_F32 max_fraction[CD_RAY_PACKET_SIZE];
+        CD_VEC2 mean = Vec2_Zero;
+        for (CD_S32 k = 0; k < n; ++k)
+        {
+            inv_x[k] = dxs[k] != 0.0f ? 1.0f / dxs[k] : CD_MAXABS_F;
+            inv_y[k] = dys[k] != 0.0f ? 1.0f / dys[k] : CD_MAXABS_F;
+            max_fraction[k] = 1.0f;
+            mean.x += dxs[k];
+            mean.y += dys[k];
+            outputs[k] = cd_ray_no_hit_v();
+            if (hit_ids != CD_NULL)
+            {
+                hit_ids[k] = CD_TREE_NULL_NODE;
+            }
+        }
+
+        CD_S32 stack[CD_TREE_STACK_SIZE];
+        CD_S32 stack_count = 0;
+        stack[stack_count++] = tree->root;
+        while (stack_count > 0)
+        {
+            const CD_S32 index = stack[--stack_count];
+            const CD_TREE_NODE *node = tree->nodes + index;
+            const CD_F32 lx = node->aabb.lowerBound.x - origin.x;
+            const CD_F32 ux = node->aabb.upperBound.x - origin.x;
+            const CD_F32 ly = node->aabb.lowerBound.y - origin.y;
+            const CD_F32 uy = node->aabb.upperBound.y - origin.y;
+            CD_S32 any = 0;
+            for (CD_S32 k = 0; k < n; ++k)
+            {
+                const CD_F32 tx1 = lx * inv_x[k];
+                const CD_F32 tx2 = ux * inv_x[k];
+                const CD_F32 ty1 = ly * inv_y[k];
+                const CD_F32 ty2 = uy * inv_y[k];
+                const CD_F32 lower = CD_MAX(CD_MAX(CD_MIN(tx1, tx2), CD_MIN(ty1, ty2)), 0.0f);
+                const CD_F32 upper = CD_MIN(CD_MIN(CD_MAX(tx1, tx2), CD_MAX(ty1, ty2)), max_fraction[k]);
+                any |= lower <= upper;
+            }
+            if (!any)
+            {
+                continue;
+            }
+            if (node->height == 0)
+            {
+                const CD_OBB obb = obstacles[node->userData];
+                CD_RAY_INPUT ray;
+                ray.origin = origin;
+                for (CD_S32 k = 0; k < n; ++k)
+                {
+                    ray.translation = cd_vec2_make_v(dxs[k], dys[k]);
+                    ray.maxFraction = max_fraction[k];
+                    const CD_RAY_OUTPUT out = cd_ray_cast_obb_v(&ray, obb);
+                    if (out.hit)
+                    {
+                        outputs[k] = out;
+                        max_fraction[k] = out.fraction;
+                        if (hit_ids != CD_NULL)
+                        {
+                            hit_ids[k] = node->userData;
+                        }
+                    }
+                }
+                continue;
+            }
+            CD_CHECK_ERROR(stack_count + 2 > CD_TREE_STACK_SIZE, COLLISION_DETECTION_E_MEM_FULL);
+            const CD_AABB *a1 = &tree->nodes[node->child1].aabb;
+            const CD_AABB *a2 = &tree->nodes[node->child2].aabb;
+            const CD_F32 d1 = mean.x * (a1->lowerBound.x + a1->upperBound.x) + mean.y * (a1->lowerBound.y + a1->upperBound.y);
+            const CD_F32 d2 = mean.x * (a2->lowerBound.x + a2->upperBound.x) + mean.y * (a2->lowerBound.y + a2->upperBound.y);
+            stack[stack_count++] = d1 <= d2 ? node->child2 : node->child1;
+            stack[stack_count++] = d1 <= d2 ? node->child1 : node->child2;
+        }
+        return CD_RET_OK;
+    }
+
+    /**
+     * @brief 共享起点的批量射线(如激光雷达的一帧)与动态树中的obb障碍物,
+     *        相邻的 CD_RAY_PACKET_SIZE 条射线组成一个包,一次树遍历服务整个包
+     * @param tree 动态树,叶子节点的 userData 为障碍物下标
+     * @param obstacles 障碍物数组
+     * @param origin 共享起点
+     * @param dxs 各射线 translation 的x分量,长度即射程(比例范围 [0, 1]),相邻射线方向应相近
+     * @param dys 各射线 translation 的y分量
+     * @param count 射线数量
+     * @param outputs 检测结果,长度为 count
+     * @param hit_ids 命中的障碍物下标,未命中为 CD_TREE_NULL_NODE,长度为 count,可为null
+     * @return ok / 参数异常 / 栈溢出
+     */
+    CD_INLINE CD_RET cd_dynamic_tree_ray_cast_obbs_packet(const CD_DYNAMIC_TREE *tree, const CD_OBB *obstacles,
+                                                          const CD_VEC2 *origin, const CD_F32 *dxs, const CD_F32 *dys,
+                                                          CD_S32 count, CD_RAY_OUTPUT *outputs, CD_S32 *hit_ids)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(tree == CD_NULL || obstacles == CD_NULL || origin == CD_NULL || dxs == CD_NULL || dys == CD_NULL ||
+                           outputs == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        for (CD_S32 i = 0; i < count; i += CD_RAY_PACKET_SIZE)
+        {
+            const CD_S32 n = CD_MIN(CD_RAY_PACKET_SIZE, count - i);
+            if (tree->root == CD_TREE_NULL_NODE)
+            {
+                for (CD_S32 k = 0; k < n; ++k)
+                {
+                    outputs[i + k] = cd_ray_no_hit_v();
+                    if (hit_ids != CD_NULL)
+                    {
+                        hit_ids[i + k] = CD_TREE_NULL_NODE;
+                    }
+                }
+                continue;
+            }
+            ret = cd_dynamic_tree_ray_packet_v(tree, obstacles, *origin, dxs + i, dys + i, n, outputs + i,
+                                               hit_ids != CD_NULL ? hit_ids + i : CD_NULL);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        }
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __COLLISION_DETECTION_RAYCAST_H__ */
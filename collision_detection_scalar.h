@@ -0,0 +1,210 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-18 09:12:37
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 17:05:14
+ */
+
+#ifndef __COLLISION_DETECTION_SCALAR_H__
+#define __COLLISION_DETECTION_SCALAR_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+
+/*
+ * 按精度实例化的基础几何
+ *
+ * collision_detection_scalar.inl 是向量、旋转、变换、aabb、obb、圆、线段这些基础类型与
+ * 无检查函数的唯一实现,此处按单精度与双精度各包含一次:
+ * - 单精度: CD_VEC2 / CD_OBB / cd_obb_overlap_v / cd_segments_intersect_core 等现有名称,eps 为 CD_EPS
+ * - 双精度: CD_VEC2_D / CD_OBB_D / cd_obb_overlap_d_v / cd_segments_intersect_core_d 等,eps 为 CD_EPS_D
+ * 两个实例在 C 与 C++ 中都可用;带参数检查的接口仍在各自的头文件中,只有单精度版本
+ *
+ * CD_REAL 及 CD_*_R / CD_REAL_FN 在编译期选择其中一个实例: 定义 CD_SCALAR_DOUBLE 时为双精度,否则为单精度。
+ * GJK、动态树、接触流形、toi 等算法只有单精度实现,不受 CD_SCALAR_DOUBLE 影响
+ */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CD_SCALAR CD_F32
+#define CD_SCALAR_TYPE(name) name
+#define CD_SCALAR_TAG(name) _##name##_
+#define CD_SCALAR_FN(name) name##_v
+#define CD_SCALAR_NAME(name) name
+#define CD_SCALAR_LIT(x) x##f
+#define CD_SCALAR_EPS CD_EPS
+#define CD_SCALAR_ABS(x) CD_FABS(x)
+#define CD_SCALAR_SQRT(x) sqrtf(x)
+#define CD_SCALAR_COS(x) cosf(x)
+#define CD_SCALAR_SIN(x) sinf(x)
+#include "collision_detection_scalar.inl"
+#undef CD_SCALAR
+#undef CD_SCALAR_TYPE
+#undef CD_SCALAR_TAG
+#undef CD_SCALAR_FN
+#undef CD_SCALAR_NAME
+#undef CD_SCALAR_LIT
+#undef CD_SCALAR_EPS
+#undef CD_SCALAR_ABS
+#undef CD_SCALAR_SQRT
+#undef CD_SCALAR_COS
+#undef CD_SCALAR_SIN
+
+#define CD_SCALAR CD_F64
+#define CD_SCALAR_TYPE(name) name##_D
+#define CD_SCALAR_TAG(name) _##name##_D_
+#define CD_SCALAR_FN(name) name##_d_v
+#define CD_SCALAR_NAME(name) name##_d
+#define CD_SCALAR_LIT(x) x
+#define CD_SCALAR_EPS CD_EPS_D
+#define CD_SCALAR_ABS(x) CD_DABS(x)
+#define CD_SCALAR_SQRT(x) sqrt(x)
+#define CD_SCALAR_COS(x) cos(x)
+#define CD_SCALAR_SIN(x) sin(x)
+#include "collision_detection_scalar.inl"
+#undef CD_SCALAR
+#undef CD_SCALAR_TYPE
+#undef CD_SCALAR_TAG
+#undef CD_SCALAR_FN
+#undef CD_SCALAR_NAME
+#undef CD_SCALAR_LIT
+#undef CD_SCALAR_EPS
+#undef CD_SCALAR_ABS
+#undef CD_SCALAR_SQRT
+#undef CD_SCALAR_COS
+#undef CD_SCALAR_SIN
+
+#ifdef CD_SCALAR_DOUBLE
+    typedef CD_F64 CD_REAL;
+#define CD_REAL_EPS CD_EPS_D
+#define CD_REAL_MAXABS CD_MAXABS_D
+#define CD_REAL_TYPE(name) name##_D // CD_REAL_TYPE(CD_OBB) 为 CD_OBB_D
+#define CD_REAL_FN(name) name##_d_v // CD_REAL_FN(cd_obb_overlap) 为 cd_obb_overlap_d_v
+#else
+    typedef CD_F32 CD_REAL;
+#define CD_REAL_EPS CD_EPS
+#define CD_REAL_MAXABS CD_MAXABS_F
+#define CD_REAL_TYPE(name) name
+#define CD_REAL_FN(name) name##_v
+#endif
+
+    typedef CD_REAL_TYPE(CD_VEC2) CD_VEC2_R;
+    typedef CD_REAL_TYPE(CD_ROT) CD_ROT_R;
+    typedef CD_REAL_TYPE(CD_TRANSFORM) CD_TRANSFORM_R;
+    typedef CD_REAL_TYPE(CD_AABB) CD_AABB_R;
+    typedef CD_REAL_TYPE(CD_OBB) CD_OBB_R;
+    typedef CD_REAL_TYPE(CD_CIRCLE) CD_CIRCLE_R;
+    typedef CD_REAL_TYPE(CD_SEGMENT) CD_SEGMENT_R;
+
+    /**
+     * @brief 单精度向量转双精度,无参数检查
+     * @param v 向量
+     * @return 双精度向量
+     */
+    CD_INLINE CD_VEC2_D cd_vec2_to_d_v(CD_VEC2 v)
+    {
+        return cd_vec2_make_d_v(v.x, v.y);
+    }
+
+    /**
+     * @brief 双精度向量转单精度,无参数检查
+     * @param v 双精度向量
+     * @return 向量
+     */
+    CD_INLINE CD_VEC2 cd_vec2_to_f_v(CD_VEC2_D v)
+    {
+        return cd_vec2_make_v((CD_F32)v.x, (CD_F32)v.y);
+    }
+
+    /**
+     * @brief 单精度aabb转双精度,无参数检查
+     * @param a aabb
+     * @return 双精度aabb
+     */
+    CD_INLINE CD_AABB_D cd_aabb_to_d_v(CD_AABB a)
+    {
+        CD_AABB_D r;
+        r.lowerBound = cd_vec2_to_d_v(a.lowerBound);
+        r.upperBound = cd_vec2_to_d_v(a.upperBound);
+        return r;
+    }
+
+    /**
+     * @brief 双精度aabb转单精度,无参数检查
+     * @param a 双精度aabb
+     * @return aabb
+     */
+    CD_INLINE CD_AABB cd_aabb_to_f_v(CD_AABB_D a)
+    {
+        CD_AABB r;
+        r.lowerBound = cd_vec2_to_f_v(a.lowerBound);
+        r.upperBound = cd_vec2_to_f_v(a.upperBound);
+        return r;
+    }
+
+    /**
+     * @brief 单精度obb转双精度,旋转量直接转换不重新计算,无参数检查
+     * @param obb obb
+     * @return 双精度obb
+     */
+    CD_INLINE CD_OBB_D cd_obb_to_d_v(CD_OBB obb)
+    {
+        CD_OBB_D r;
+        r.center = cd_vec2_to_d_v(obb.center);
+        r.length = obb.length;
+        r.width = obb.width;
+        r.q.c = obb.q.c;
+        r.q.s = obb.q.s;
+        return r;
+    }
+
+    /**
+     * @brief 双精度obb转单精度,无参数检查
+     * @param obb 双精度obb
+     * @return obb
+     */
+    CD_INLINE CD_OBB cd_obb_to_f_v(CD_OBB_D obb)
+    {
+        CD_OBB r;
+        r.center = cd_vec2_to_f_v(obb.center);
+        r.length = (CD_F32)obb.length;
+        r.width = (CD_F32)obb.width;
+        r.q.c = (CD_F32)obb.q.c;
+        r.q.s = (CD_F32)obb.q.s;
+        return r;
+    }
+
+    /**
+     * @brief 单精度线段转双精度,无参数检查
+     * @param seg 线段
+     * @return 双精度线段
+     */
+    CD_INLINE CD_SEGMENT_D cd_segment_to_d_v(CD_SEGMENT seg)
+    {
+        CD_SEGMENT_D r;
+        r.point1 = cd_vec2_to_d_v(seg.point1);
+        r.point2 = cd_vec2_to_d_v(seg.point2);
+        return r;
+    }
+
+    /**
+     * @brief 双精度线段转单精度,无参数检查
+     * @param seg 双精度线段
+     * @return 线段
+     */
+    CD_INLINE CD_SEGMENT cd_segment_to_f_v(CD_SEGMENT_D seg)
+    {
+        CD_SEGMENT r;
+        r.point1 = cd_vec2_to_f_v(seg.point1);
+        r.point2 = cd_vec2_to_f_v(seg.point2);
+        return r;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __COLLISION_DETECTION_SCALAR_H__ */
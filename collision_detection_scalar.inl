@@ -0,0 +1,533 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 17:05:14
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 17:05:14
+ */
+
+/*
+ * 基础几何的唯一实现,由 collision_detection_scalar.h 按精度各包含一次,没有包含保护。
+ * 包含前需定义:
+ * - CD_SCALAR: 标量类型
+ * - CD_SCALAR_TYPE(name) / CD_SCALAR_TAG(name): 类型名与结构体标签
+ * - CD_SCALAR_FN(name) / CD_SCALAR_NAME(name): 带 _v 后缀的函数名与其余函数名
+ * - CD_SCALAR_LIT(x): 浮点字面量
+ * - CD_SCALAR_EPS / CD_SCALAR_ABS / CD_SCALAR_SQRT / CD_SCALAR_COS / CD_SCALAR_SIN
+ * 单精度实例即 CD_VEC2、cd_obb_overlap_v 等现有名称,双精度实例为 CD_VEC2_D、cd_obb_overlap_d_v 等
+ */
+
+// 向量
+typedef struct CD_SCALAR_TAG(CD_VEC2)
+{
+    CD_SCALAR x;
+    CD_SCALAR y;
+} CD_SCALAR_TYPE(CD_VEC2);
+
+// 2d平面旋转量,包含三角函数的cos与sin
+typedef struct CD_SCALAR_TAG(CD_ROT)
+{
+    CD_SCALAR c; // 三角函数cos值
+    CD_SCALAR s; // 三角函数sin值
+} CD_SCALAR_TYPE(CD_ROT);
+
+// 坐标变换，旋转+平移
+typedef struct CD_SCALAR_TAG(CD_TRANSFORM)
+{
+    CD_SCALAR_TYPE(CD_VEC2) p; // 平移量
+    CD_SCALAR_TYPE(CD_ROT) q;  // 旋转量
+} CD_SCALAR_TYPE(CD_TRANSFORM);
+
+// 轴对齐包围盒
+typedef struct CD_SCALAR_TAG(CD_AABB)
+{
+    CD_SCALAR_TYPE(CD_VEC2) lowerBound; // 坐标轴最小值
+    CD_SCALAR_TYPE(CD_VEC2) upperBound; // 坐标轴最大值
+} CD_SCALAR_TYPE(CD_AABB);
+
+// 方向包围盒
+typedef struct CD_SCALAR_TAG(CD_OBB)
+{
+    CD_SCALAR_TYPE(CD_VEC2) center; // 中心
+    CD_SCALAR length;               // 长
+    CD_SCALAR width;                // 宽
+    CD_SCALAR_TYPE(CD_ROT) q;       // 旋转量
+
+} CD_SCALAR_TYPE(CD_OBB);
+
+// 圆
+typedef struct CD_SCALAR_TAG(CD_CIRCLE)
+{
+    CD_SCALAR_TYPE(CD_VEC2) center; // 中心
+    CD_SCALAR radius;               // 半径
+} CD_SCALAR_TYPE(CD_CIRCLE);
+
+// 线段
+typedef struct CD_SCALAR_TAG(CD_SEGMENT)
+{
+    CD_SCALAR_TYPE(CD_VEC2) point1; // 线段起点
+    CD_SCALAR_TYPE(CD_VEC2) point2; // 线段终点
+} CD_SCALAR_TYPE(CD_SEGMENT);
+
+/**
+ * @brief 判断值是否在两个边界之间(含边界),边界不分大小
+ * @param val 值
+ * @param bound1 边界1
+ * @param bound2 边界2
+ * @return 1 在范围内, 0 不在
+ */
+CD_INLINE CD_BOOL CD_SCALAR_NAME(cd_is_with_in)(CD_SCALAR val, CD_SCALAR bound1, CD_SCALAR bound2)
+{
+    return (val >= CD_MIN(bound1, bound2)) && (val <= CD_MAX(bound1, bound2));
+}
+
+/**
+ * @brief 构建向量,无参数检查
+ * @param x x坐标
+ * @param y y坐标
+ * @return 向量
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_VEC2) CD_SCALAR_FN(cd_vec2_make)(CD_SCALAR x, CD_SCALAR y)
+{
+    CD_SCALAR_TYPE(CD_VEC2) r;
+    r.x = x;
+    r.y = y;
+    return r;
+}
+
+/**
+ * @brief 计算向量的长度,无参数检查
+ * @param v 向量
+ * @return 向量的长度
+ */
+CD_INLINE CD_SCALAR CD_SCALAR_FN(cd_vec2_len)(CD_SCALAR_TYPE(CD_VEC2) v)
+{
+    return CD_SCALAR_SQRT(v.x * v.x + v.y * v.y);
+}
+
+/**
+ * @brief 计算向量长度的平方,无参数检查
+ * @param v 向量
+ * @return 向量长度的平方
+ */
+CD_INLINE CD_SCALAR CD_SCALAR_FN(cd_vec2_len_sqr)(CD_SCALAR_TYPE(CD_VEC2) v)
+{
+    return v.x * v.x + v.y * v.y;
+}
+
+/**
+ * @brief 向量点积,无参数检查
+ * @param a 向量a
+ * @param b 向量b
+ * @return 点积结果
+ */
+CD_INLINE CD_SCALAR CD_SCALAR_FN(cd_vec2_dot)(CD_SCALAR_TYPE(CD_VEC2) a, CD_SCALAR_TYPE(CD_VEC2) b)
+{
+    return a.x * b.x + a.y * b.y;
+}
+
+/**
+ * @brief 向量叉积,无参数检查
+ * @param a 向量a
+ * @param b 向量b
+ * @return 叉积结果
+ */
+CD_INLINE CD_SCALAR CD_SCALAR_FN(cd_vec2_cross)(CD_SCALAR_TYPE(CD_VEC2) a, CD_SCALAR_TYPE(CD_VEC2) b)
+{
+    return a.x * b.y - a.y * b.x;
+}
+
+/**
+ * @brief 向量加法,无参数检查
+ * @param a 向量a
+ * @param b 向量b
+ * @return 向量a + 向量b
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_VEC2) CD_SCALAR_FN(cd_vec2_add)(CD_SCALAR_TYPE(CD_VEC2) a, CD_SCALAR_TYPE(CD_VEC2) b)
+{
+    CD_SCALAR_TYPE(CD_VEC2) r;
+    r.x = a.x + b.x;
+    r.y = a.y + b.y;
+    return r;
+}
+
+/**
+ * @brief 向量减法,无参数检查
+ * @param a 向量a
+ * @param b 向量b
+ * @return 向量a - 向量b
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_VEC2) CD_SCALAR_FN(cd_vec2_sub)(CD_SCALAR_TYPE(CD_VEC2) a, CD_SCALAR_TYPE(CD_VEC2) b)
+{
+    CD_SCALAR_TYPE(CD_VEC2) r;
+    r.x = a.x - b.x;
+    r.y = a.y - b.y;
+    return r;
+}
+
+/**
+ * @brief 向量的缩放,无参数检查
+ * @param a 向量a
+ * @param scale 缩放因子
+ * @return 缩放结果
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_VEC2) CD_SCALAR_FN(cd_vec2_scale)(CD_SCALAR_TYPE(CD_VEC2) a, CD_SCALAR scale)
+{
+    CD_SCALAR_TYPE(CD_VEC2) r;
+    r.x = a.x * scale;
+    r.y = a.y * scale;
+    return r;
+}
+
+/**
+ * @brief 向量加上一个缩放的向量,无参数检查
+ * @param a 向量a
+ * @param scale 向量b缩放因子
+ * @param b 向量b
+ * @return a + scale * b
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_VEC2) CD_SCALAR_FN(cd_vec2_mul_add)(CD_SCALAR_TYPE(CD_VEC2) a, CD_SCALAR scale, CD_SCALAR_TYPE(CD_VEC2) b)
+{
+    CD_SCALAR_TYPE(CD_VEC2) r;
+    r.x = a.x + b.x * scale;
+    r.y = a.y + b.y * scale;
+    return r;
+}
+
+/**
+ * @brief 求两个点之间的距离,无参数检查
+ * @param a 点a
+ * @param b 点b
+ * @return 两个点之间的距离
+ */
+CD_INLINE CD_SCALAR CD_SCALAR_FN(cd_vec2_dis)(CD_SCALAR_TYPE(CD_VEC2) a, CD_SCALAR_TYPE(CD_VEC2) b)
+{
+    const CD_SCALAR dx = a.x - b.x;
+    const CD_SCALAR dy = a.y - b.y;
+    return CD_SCALAR_SQRT(dx * dx + dy * dy);
+}
+
+/**
+ * @brief 求两个点之间的距离平方,无参数检查
+ * @param a 点a
+ * @param b 点b
+ * @return 两个点之间的距离平方
+ */
+CD_INLINE CD_SCALAR CD_SCALAR_FN(cd_vec2_dis_sqr)(CD_SCALAR_TYPE(CD_VEC2) a, CD_SCALAR_TYPE(CD_VEC2) b)
+{
+    const CD_SCALAR dx = a.x - b.x;
+    const CD_SCALAR dy = a.y - b.y;
+    return dx * dx + dy * dy;
+}
+
+/**
+ * @brief 通过角度计算旋转量,无参数检查
+ * @param angle 角度
+ * @return 旋转量
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_ROT) CD_SCALAR_FN(cd_rot_from_angle)(CD_SCALAR angle)
+{
+    CD_SCALAR_TYPE(CD_ROT) r;
+    r.c = CD_SCALAR_COS(angle);
+    r.s = CD_SCALAR_SIN(angle);
+    return r;
+}
+
+/**
+ * @brief 旋转一个向量,无参数检查
+ * @param q 旋转量
+ * @param v 向量
+ * @return 旋转后的结果
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_VEC2) CD_SCALAR_FN(cd_rot_vector)(CD_SCALAR_TYPE(CD_ROT) q, CD_SCALAR_TYPE(CD_VEC2) v)
+{
+    CD_SCALAR_TYPE(CD_VEC2) r;
+    r.x = q.c * v.x - q.s * v.y;
+    r.y = q.s * v.x + q.c * v.y;
+    return r;
+}
+
+/**
+ * @brief 求向量旋转前的结果,无参数检查
+ * @param q 旋转量
+ * @param v 旋转后的向量
+ * @return 旋转前的向量
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_VEC2) CD_SCALAR_FN(cd_inv_rot_vector)(CD_SCALAR_TYPE(CD_ROT) q, CD_SCALAR_TYPE(CD_VEC2) v)
+{
+    CD_SCALAR_TYPE(CD_VEC2) r;
+    r.x = q.c * v.x + q.s * v.y;
+    r.y = -q.s * v.x + q.c * v.y;
+    return r;
+}
+
+/**
+ * @brief 对一个点进行旋转+平移,无参数检查
+ * @param t 旋转平移量
+ * @param p 转换前的点
+ * @return 转换后的点
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_VEC2) CD_SCALAR_FN(cd_transforms_point)(CD_SCALAR_TYPE(CD_TRANSFORM) t, CD_SCALAR_TYPE(CD_VEC2) p)
+{
+    CD_SCALAR_TYPE(CD_VEC2) r;
+    r.x = (t.q.c * p.x - t.q.s * p.y) + t.p.x;
+    r.y = (t.q.s * p.x + t.q.c * p.y) + t.p.y;
+    return r;
+}
+
+/**
+ * @brief 求一个点旋转平移前的结果,无参数检查
+ * @param t 旋转平移量
+ * @param p 转换的点
+ * @return 转换前的点
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_VEC2) CD_SCALAR_FN(cd_inv_transforms_point)(CD_SCALAR_TYPE(CD_TRANSFORM) t, CD_SCALAR_TYPE(CD_VEC2) p)
+{
+    const CD_SCALAR vx = p.x - t.p.x;
+    const CD_SCALAR vy = p.y - t.p.y;
+    CD_SCALAR_TYPE(CD_VEC2) r;
+    r.x = t.q.c * vx + t.q.s * vy;
+    r.y = -t.q.s * vx + t.q.c * vy;
+    return r;
+}
+
+/**
+ * @brief 判断两个aabb是否重叠,无参数检查
+ * @param a aabb a
+ * @param b aabb b
+ * @return 1 重叠(含边界接触), 0 不重叠
+ */
+CD_INLINE CD_BOOL CD_SCALAR_FN(cd_aabb_overlap)(CD_SCALAR_TYPE(CD_AABB) a, CD_SCALAR_TYPE(CD_AABB) b)
+{
+    return (a.lowerBound.x <= b.upperBound.x && a.upperBound.x >= b.lowerBound.x &&
+            a.lowerBound.y <= b.upperBound.y && a.upperBound.y >= b.lowerBound.y);
+}
+
+/**
+ * @brief 求两个aabb的并集包围盒,无参数检查
+ * @param a aabb a
+ * @param b aabb b
+ * @return 并集包围盒
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_AABB) CD_SCALAR_FN(cd_aabb_union)(CD_SCALAR_TYPE(CD_AABB) a, CD_SCALAR_TYPE(CD_AABB) b)
+{
+    CD_SCALAR_TYPE(CD_AABB) r;
+    r.lowerBound.x = CD_MIN(a.lowerBound.x, b.lowerBound.x);
+    r.lowerBound.y = CD_MIN(a.lowerBound.y, b.lowerBound.y);
+    r.upperBound.x = CD_MAX(a.upperBound.x, b.upperBound.x);
+    r.upperBound.y = CD_MAX(a.upperBound.y, b.upperBound.y);
+    return r;
+}
+
+/**
+ * @brief 判断点是否在aabb内,无参数检查
+ * @param a aabb
+ * @param point 点
+ * @return 1 在aabb内(含边界), 0 不在
+ */
+CD_INLINE CD_BOOL CD_SCALAR_FN(cd_is_point_in_aabb)(CD_SCALAR_TYPE(CD_AABB) a, CD_SCALAR_TYPE(CD_VEC2) point)
+{
+    return (point.x >= a.lowerBound.x && point.x <= a.upperBound.x &&
+            point.y >= a.lowerBound.y && point.y <= a.upperBound.y);
+}
+
+/**
+ * @brief 构建obb,无参数检查
+ * @param center obb中心
+ * @param length obb长
+ * @param width obb宽
+ * @param heading obb朝向
+ * @return obb结构
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_OBB) CD_SCALAR_FN(cd_create_obb)(CD_SCALAR_TYPE(CD_VEC2) center, CD_SCALAR length, CD_SCALAR width, CD_SCALAR heading)
+{
+    CD_SCALAR_TYPE(CD_OBB) r;
+    r.center = center;
+    r.length = length;
+    r.width = width;
+    r.q = CD_SCALAR_FN(cd_rot_from_angle)(heading);
+    return r;
+}
+
+/**
+ * @brief 将obb转换成aabb,无参数检查
+ * @param obb obb
+ * @return aabb
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_AABB) CD_SCALAR_FN(cd_obb_to_aabb)(CD_SCALAR_TYPE(CD_OBB) obb)
+{
+    const CD_SCALAR half_length = obb.length * CD_SCALAR_LIT(0.5);
+    const CD_SCALAR half_width = obb.width * CD_SCALAR_LIT(0.5);
+    // 旋转后的半长宽在坐标轴上的投影
+    CD_SCALAR_TYPE(CD_VEC2) half_extents;
+    half_extents.x = CD_SCALAR_ABS(obb.q.c) * half_length + CD_SCALAR_ABS(obb.q.s) * half_width;
+    half_extents.y = CD_SCALAR_ABS(obb.q.s) * half_length + CD_SCALAR_ABS(obb.q.c) * half_width;
+    CD_SCALAR_TYPE(CD_AABB) r;
+    r.lowerBound = CD_SCALAR_FN(cd_vec2_sub)(obb.center, half_extents);
+    r.upperBound = CD_SCALAR_FN(cd_vec2_add)(obb.center, half_extents);
+    return r;
+}
+
+/**
+ * @brief 判断点是否在obb内,容差为当前精度的 eps,无参数检查
+ * @param obb obb
+ * @param point 点
+ * @return 1 在obb内, 0 不在
+ */
+CD_INLINE CD_BOOL CD_SCALAR_FN(cd_is_point_in_obb)(CD_SCALAR_TYPE(CD_OBB) obb, CD_SCALAR_TYPE(CD_VEC2) point)
+{
+    const CD_SCALAR x0 = point.x - obb.center.x;
+    const CD_SCALAR y0 = point.y - obb.center.y;
+    const CD_SCALAR dx = CD_SCALAR_ABS(x0 * obb.q.c + y0 * obb.q.s);
+    const CD_SCALAR dy = CD_SCALAR_ABS(y0 * obb.q.c - x0 * obb.q.s);
+    return (dx <= obb.length * CD_SCALAR_LIT(0.5) + CD_SCALAR_EPS) && (dy <= obb.width * CD_SCALAR_LIT(0.5) + CD_SCALAR_EPS);
+}
+
+/**
+ * @brief 分离轴检测两个obb是否重叠,依次检测a的两个轴与b的两个轴,找到分离轴立即返回,无参数检查
+ * @param a obb a
+ * @param b obb b
+ * @return 1 重叠(含边界接触), 0 不重叠
+ */
+CD_INLINE CD_BOOL CD_SCALAR_FN(cd_obb_overlap)(CD_SCALAR_TYPE(CD_OBB) a, CD_SCALAR_TYPE(CD_OBB) b)
+{
+    const CD_SCALAR hl_a = a.length * CD_SCALAR_LIT(0.5);
+    const CD_SCALAR hw_a = a.width * CD_SCALAR_LIT(0.5);
+    const CD_SCALAR hl_b = b.length * CD_SCALAR_LIT(0.5);
+    const CD_SCALAR hw_b = b.width * CD_SCALAR_LIT(0.5);
+    const CD_SCALAR tx = b.center.x - a.center.x;
+    const CD_SCALAR ty = b.center.y - a.center.y;
+    // a的轴(x轴 (c, s), y轴 (-s, c))与b的轴之间的夹角余弦的绝对值
+    const CD_SCALAR r00 = CD_SCALAR_ABS(a.q.c * b.q.c + a.q.s * b.q.s);
+    const CD_SCALAR r01 = CD_SCALAR_ABS(a.q.s * b.q.c - a.q.c * b.q.s);
+    const CD_SCALAR r10 = r01;
+    const CD_SCALAR r11 = r00;
+
+    // a的x轴
+    if (CD_SCALAR_ABS(tx * a.q.c + ty * a.q.s) > hl_a + hl_b * r00 + hw_b * r01)
+    {
+        return CD_FALSE;
+    }
+    // a的y轴
+    if (CD_SCALAR_ABS(ty * a.q.c - tx * a.q.s) > hw_a + hl_b * r10 + hw_b * r11)
+    {
+        return CD_FALSE;
+    }
+    // b的x轴
+    if (CD_SCALAR_ABS(tx * b.q.c + ty * b.q.s) > hl_a * r00 + hw_a * r10 + hl_b)
+    {
+        return CD_FALSE;
+    }
+    // b的y轴
+    if (CD_SCALAR_ABS(ty * b.q.c - tx * b.q.s) > hl_a * r01 + hw_a * r11 + hw_b)
+    {
+        return CD_FALSE;
+    }
+    return CD_TRUE;
+}
+
+/**
+ * @brief 判断点是否在圆内,无参数检查
+ * @param point 点
+ * @param circle 圆
+ * @return 1 在圆内，0不在圆内
+ */
+CD_INLINE CD_BOOL CD_SCALAR_FN(cd_point_in_circle)(CD_SCALAR_TYPE(CD_VEC2) point, CD_SCALAR_TYPE(CD_CIRCLE) circle)
+{
+    return CD_SCALAR_FN(cd_vec2_dis_sqr)(point, circle.center) <= CD_SQUARE(circle.radius);
+}
+
+/**
+ * @brief 求线段上离点最近的点,退化线段返回起点,无参数检查
+ * @param seg 线段
+ * @param point 点
+ * @return 最近点
+ */
+CD_INLINE CD_SCALAR_TYPE(CD_VEC2) CD_SCALAR_FN(cd_segment_nearest_point)(CD_SCALAR_TYPE(CD_SEGMENT) seg, CD_SCALAR_TYPE(CD_VEC2) point)
+{
+    const CD_SCALAR_TYPE(CD_VEC2) d = CD_SCALAR_FN(cd_vec2_sub)(seg.point2, seg.point1);
+    const CD_SCALAR len_sqr = CD_SCALAR_FN(cd_vec2_len_sqr)(d);
+    if (len_sqr <= CD_SCALAR_EPS * CD_SCALAR_EPS)
+    {
+        return seg.point1;
+    }
+    // 点在线段上的投影比例,限制在[0, 1]
+    CD_SCALAR t = CD_SCALAR_FN(cd_vec2_dot)(CD_SCALAR_FN(cd_vec2_sub)(point, seg.point1), d) / len_sqr;
+    t = CD_CLIP(t, CD_SCALAR_LIT(0.0), CD_SCALAR_LIT(1.0));
+    return CD_SCALAR_FN(cd_vec2_mul_add)(seg.point1, t, d);
+}
+
+/**
+ * @brief 基于方向判定的线段相交核心计算,无开方、无参数检查,供单次与批量接口共用
+ *        端点在另一条线段上(叉积绝对值不超过当前精度的 eps)视为相交
+ * @param x1 线段1起点x
+ * @param y1 线段1起点y
+ * @param x2 线段1终点x
+ * @param y2 线段1终点y
+ * @param x3 线段2起点x
+ * @param y3 线段2起点y
+ * @param x4 线段2终点x
+ * @param y4 线段2终点y
+ * @param point 交点,可为null
+ * @return 1 相交, 0 不相交
+ */
+CD_INLINE CD_BOOL CD_SCALAR_NAME(cd_segments_intersect_core)(CD_SCALAR x1, CD_SCALAR y1, CD_SCALAR x2, CD_SCALAR y2,
+                                                             CD_SCALAR x3, CD_SCALAR y3, CD_SCALAR x4, CD_SCALAR y4,
+                                                             CD_SCALAR_TYPE(CD_VEC2) *point)
+{
+    const CD_SCALAR ex1 = x2 - x1;
+    const CD_SCALAR ey1 = y2 - y1;
+    const CD_SCALAR ex2 = x4 - x3;
+    const CD_SCALAR ey2 = y4 - y3;
+    // 线段1端点相对线段2的方向,线段2端点相对线段1的方向
+    const CD_SCALAR d1 = ex2 * (y1 - y3) - ey2 * (x1 - x3);
+    const CD_SCALAR d2 = ex2 * (y2 - y3) - ey2 * (x2 - x3);
+    const CD_SCALAR d3 = ex1 * (y3 - y1) - ey1 * (x3 - x1);
+    const CD_SCALAR d4 = ex1 * (y4 - y1) - ey1 * (x4 - x1);
+
+    // 严格相交:两条线段的端点都分居另一条线段两侧
+    if (((d1 > CD_SCALAR_EPS && d2 < -CD_SCALAR_EPS) || (d1 < -CD_SCALAR_EPS && d2 > CD_SCALAR_EPS)) &&
+        ((d3 > CD_SCALAR_EPS && d4 < -CD_SCALAR_EPS) || (d3 < -CD_SCALAR_EPS && d4 > CD_SCALAR_EPS)))
+    {
+        if (point != CD_NULL)
+        {
+            const CD_SCALAR t = d1 / (d1 - d2);
+            point->x = x1 + ex1 * t;
+            point->y = y1 + ey1 * t;
+        }
+        return CD_TRUE;
+    }
+
+    // 端点接触或共线重叠
+    CD_SCALAR px;
+    CD_SCALAR py;
+    if (CD_SCALAR_ABS(d3) <= CD_SCALAR_EPS && CD_SCALAR_NAME(cd_is_with_in)(x3, x1, x2) && CD_SCALAR_NAME(cd_is_with_in)(y3, y1, y2))
+    {
+        px = x3;
+        py = y3;
+    }
+    else if (CD_SCALAR_ABS(d4) <= CD_SCALAR_EPS && CD_SCALAR_NAME(cd_is_with_in)(x4, x1, x2) && CD_SCALAR_NAME(cd_is_with_in)(y4, y1, y2))
+    {
+        px = x4;
+        py = y4;
+    }
+    else if (CD_SCALAR_ABS(d1) <= CD_SCALAR_EPS && CD_SCALAR_NAME(cd_is_with_in)(x1, x3, x4) && CD_SCALAR_NAME(cd_is_with_in)(y1, y3, y4))
+    {
+        px = x1;
+        py = y1;
+    }
+    else if (CD_SCALAR_ABS(d2) <= CD_SCALAR_EPS && CD_SCALAR_NAME(cd_is_with_in)(x2, x3, x4) && CD_SCALAR_NAME(cd_is_with_in)(y2, y3, y4))
+    {
+        px = x2;
+        py = y2;
+    }
+    else
+    {
+        return CD_FALSE;
+    }
+    if (point != CD_NULL)
+    {
+        point->x = px;
+        point->y = py;
+    }
+    return CD_TRUE;
+}
@@ -0,0 +1,981 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-19 10:03:18
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-19 10:03:18
+ */
+
+#ifndef __COLLISION_DETECTION_SHAPE_H__
+#define __COLLISION_DETECTION_SHAPE_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_vec2.h"
+#include "collision_detection_transform.h"
+#include "collision_detection_segment.h"
+#include "collision_detection_circle.h"
+#include "collision_detection_aabb.h"
+#include "collision_detection_obb.h"
+#include "collision_detection_polygon.h"
+#include "collision_detection_capsule.h"
+#include "collision_detection_distance.h"
+#include "collision_detection_manifold.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CD_SHAPE_CIRCLE 0     // 圆
+#define CD_SHAPE_AABB 1       // aabb
+#define CD_SHAPE_OBB 2        // obb
+#define CD_SHAPE_POLYGON 3    // 凸多边形(视图)
+#define CD_SHAPE_SEGMENT 4    // 线段
+#define CD_SHAPE_CAPSULE 5    // 胶囊体
+#define CD_SHAPE_TYPE_COUNT 6 // 形状种类数
+
+// 分派表在 C++ 中为 constexpr,形状类型在编译期已知时可直接选出成对例程
+#ifdef __cplusplus
+#define CD_SHAPE_TABLE static constexpr
+#else
+#define CD_SHAPE_TABLE static const
+#endif
+
+    // 带类型标签的形状,多边形只保存视图,顶点存储的生命周期需覆盖形状的使用
+    typedef struct _CD_SHAPE_
+    {
+        CD_S32 type; ///< CD_SHAPE_CIRCLE ~ CD_SHAPE_CAPSULE
+        union
+        {
+            CD_CIRCLE circle;
+            CD_AABB aabb;
+            CD_OBB obb;
+            CD_POLYGON_VIEW polygon;
+            CD_SEGMENT segment;
+            CD_CAPSULE capsule;
+        } data;
+    } CD_SHAPE;
+
+    // aabb/obb/线段/胶囊体转换为多边形视图时使用的顶点与法向存储
+    typedef struct _CD_SHAPE_SCRATCH_
+    {
+        CD_VEC2 vertices[4];
+        CD_VEC2 normals[4];
+    } CD_SHAPE_SCRATCH;
+
+    typedef CD_BOOL (*CD_SHAPE_OVERLAP_FCN)(const CD_SHAPE *a, const CD_SHAPE *b);
+    typedef CD_VOID (*CD_SHAPE_DISTANCE_FCN)(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output);
+    typedef CD_MANIFOLD (*CD_SHAPE_MANIFOLD_FCN)(const CD_SHAPE *a, const CD_SHAPE *b);
+
+    CD_INLINE CD_SHAPE cd_make_circle_shape_v(CD_CIRCLE circle)
+    {
+        CD_SHAPE r;
+        r.type = CD_SHAPE_CIRCLE;
+        r.data.circle = circle;
+        return r;
+    }
+
+    CD_INLINE CD_SHAPE cd_make_aabb_shape_v(CD_AABB aabb)
+    {
+        CD_SHAPE r;
+        r.type = CD_SHAPE_AABB;
+        r.data.aabb = aabb;
+        return r;
+    }
+
+    CD_INLINE CD_SHAPE cd_make_obb_shape_v(CD_OBB obb)
+    {
+        CD_SHAPE r;
+        r.type = CD_SHAPE_OBB;
+        r.data.obb = obb;
+        return r;
+    }
+
+    /**
+     * @brief 由多边形视图构建形状,视图需已填好 normals
+     */
+    CD_INLINE CD_SHAPE cd_make_polygon_view_shape_v(CD_POLYGON_VIEW polygon)
+    {
+        CD_SHAPE r;
+        r.type = CD_SHAPE_POLYGON;
+        r.data.polygon = polygon;
+        return r;
+    }
+
+    /**
+     * @brief 由定长多边形构建形状,形状引用多边形的顶点,多边形需比形状存活更久
+     */
+    CD_INLINE CD_SHAPE cd_make_polygon_shape_v(const CD_POLYGON *polygon)
+    {
+        return cd_make_polygon_view_shape_v(cd_polygon_view_v(polygon));
+    }
+
+    CD_INLINE CD_SHAPE cd_make_segment_shape_v(CD_SEGMENT segment)
+    {
+        CD_SHAPE r;
+        r.type = CD_SHAPE_SEGMENT;
+        r.data.segment = segment;
+        return r;
+    }
+
+    CD_INLINE CD_SHAPE cd_make_capsule_shape_v(CD_CAPSULE capsule)
+    {
+        CD_SHAPE r;
+        r.type = CD_SHAPE_CAPSULE;
+        r.data.capsule = capsule;
+        return r;
+    }
+
+    /**
+     * @brief 形状的aabb,无参数检查
+     * @param shape 形状
+     * @return aabb,包含圆角半径
+     */
+    CD_INLINE CD_AABB cd_shape_to_aabb_v(const CD_SHAPE *shape)
+    {
+        CD_AABB r;
+        switch (shape->type)
+        {
+        case CD_SHAPE_CIRCLE:
+            return cd_circle_to_aabb_v(shape->data.circle);
+        case CD_SHAPE_AABB:
+            return shape->data.aabb;
+        case CD_SHAPE_OBB:
+            return cd_obb_to_aabb_v(shape->data.obb);
+        case CD_SHAPE_POLYGON:
+        {
+            const CD_POLYGON_VIEW *p = &shape->data.polygon;
+            r.lowerBound = p->vertices[0];
+            r.upperBound = p->vertices[0];
+            for (CD_S32 i = 1; i < p->count; ++i)
+            {
+                r.lowerBound = cd_vec2_min_v(r.lowerBound, p->vertices[i]);
+                r.upperBound = cd_vec2_max_v(r.upperBound, p->vertices[i]);
+            }
+            return cd_aabb_extend_v(r, p->radius);
+        }
+        case CD_SHAPE_CAPSULE:
+            return cd_capsule_to_aabb_v(shape->data.capsule);
+        default:
+            r.lowerBound = cd_vec2_min_v(shape->data.segment.point1, shape->data.segment.point2);
+            r.upperBound = cd_vec2_max_v(shape->data.segment.point1, shape->data.segment.point2);
+            return r;
+        }
+    }
+
+    /**
+     * @brief 形状的aabb
+     * @param shape 形状
+     * @param result aabb,包含圆角半径
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_shape_to_aabb(const CD_SHAPE *shape, CD_AABB *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(shape == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(shape->type < 0 || shape->type >= CD_SHAPE_TYPE_COUNT, COLLISION_DETECTION_E_CALC_ERROR);
+        *result = cd_shape_to_aabb_v(shape);
+        return ret;
+    }
+
+    /**
+     * @brief 线段的二边形视图,两条边方向相反,radius 为圆角半径(胶囊体),无参数检查
+     */
+    CD_INLINE CD_POLYGON_VIEW cd_segment_polygon_view_v(CD_SEGMENT seg, CD_F32 radius, CD_SHAPE_SCRATCH *scratch)
+    {
+        // 退化线段任取法向,分离轴测试仍然成立
+        const CD_VEC2 d = cd_vec2_sub_v(seg.point2, seg.point1);
+        const CD_VEC2 n = cd_vec2_len_sqr_v(d) > CD_EPS * CD_EPS ? cd_vec2_norm_v(cd_vec2_right_perp_v(d))
+                                                                : cd_vec2_make_v(0.0f, 1.0f);
+        CD_POLYGON_VIEW r;
+        scratch->vertices[0] = seg.point1;
+        scratch->vertices[1] = seg.point2;
+        scratch->normals[0] = n;
+        scratch->normals[1] = cd_vec2_neg_v(n);
+        r.vertices = scratch->vertices;
+        r.normals = scratch->normals;
+        r.count = 2;
+        r.radius = radius;
+        return r;
+    }
+
+    /**
+     * @brief 非圆形状的多边形视图,aabb/obb 为逆时针四边形,线段为两条反向边的二边形,胶囊体为带圆角半径的二边形,无参数检查
+     * @param shape 形状,不能是圆
+     * @param scratch aabb/obb/线段/胶囊体的顶点与法向存储,生命周期需覆盖视图的使用
+     * @return 多边形视图
+     */
+    CD_INLINE CD_POLYGON_VIEW cd_shape_polygon_view_v(const CD_SHAPE *shape, CD_SHAPE_SCRATCH *scratch)
+    {
+        CD_POLYGON_VIEW r;
+        r.vertices = scratch->vertices;
+        r.normals = scratch->normals;
+        r.radius = 0.0f;
+        switch (shape->type)
+        {
+        case CD_SHAPE_POLYGON:
+            return shape->data.polygon;
+        case CD_SHAPE_AABB:
+        {
+            const CD_AABB a = shape->data.aabb;
+            scratch->vertices[0] = a.lowerBound;
+            scratch->vertices[1] = cd_vec2_make_v(a.upperBound.x, a.lowerBound.y);
+            scratch->vertices[2] = a.upperBound;
+            scratch->vertices[3] = cd_vec2_make_v(a.lowerBound.x, a.upperBound.y);
+            scratch->normals[0] = cd_vec2_make_v(0.0f, -1.0f);
+            scratch->normals[1] = cd_vec2_make_v(1.0f, 0.0f);
+            scratch->normals[2] = cd_vec2_make_v(0.0f, 1.0f);
+            scratch->normals[3] = cd_vec2_make_v(-1.0f, 0.0f);
+            r.count = 4;
+            return r;
+        }
+        case CD_SHAPE_OBB:
+        {
+            const CD_OBB obb = shape->data.obb;
+            const CD_VEC2 axis_l = cd_vec2_make_v(obb.q.c, obb.q.s);
+            const CD_VEC2 axis_w = cd_vec2_make_v(-obb.q.s, obb.q.c);
+            cd_obb_vertices_v(obb, scratch->vertices);
+            scratch->normals[0] = cd_vec2_neg_v(axis_w);
+            scratch->normals[1] = axis_l;
+            scratch->normals[2] = axis_w;
+            scratch->normals[3] = cd_vec2_neg_v(axis_l);
+            r.count = 4;
+            return r;
+        }
+        case CD_SHAPE_CAPSULE:
+            return cd_segment_polygon_view_v(shape->data.capsule.seg, shape->data.capsule.radius, scratch);
+        default:
+            return cd_segment_polygon_view_v(shape->data.segment, 0.0f, scratch);
+        }
+    }
+
+    /**
+     * @brief 形状的 GJK 点集,圆为带半径的单点,无参数检查
+     * @param shape 形状
+     * @param scratch aabb/obb/线段/胶囊体的顶点存储
+     * @return 点集
+     */
+    CD_INLINE CD_DISTANCE_SPAN cd_shape_span_v(const CD_SHAPE *shape, CD_SHAPE_SCRATCH *scratch)
+    {
+        if (shape->type == CD_SHAPE_CIRCLE)
+        {
+            return cd_make_span_v(&shape->data.circle.center, 1, shape->data.circle.radius);
+        }
+        const CD_POLYGON_VIEW view = cd_shape_polygon_view_v(shape, scratch);
+        return cd_make_span_v(view.vertices, view.count, view.radius);
+    }
+
+    /**
+     * @brief 把obb视为以原点为中心、与坐标轴对齐的盒子,求点在其局部坐标系下的最近点并变回世界坐标系
+     */
+    CD_INLINE CD_VEC2 cd_obb_nearest_point_v(CD_OBB obb, CD_VEC2 point)
+    {
+        const CD_VEC2 d = cd_vec2_sub_v(point, obb.center);
+        const CD_F32 hl = obb.length * 0.5f;
+        const CD_F32 hw = obb.width * 0.5f;
+        const CD_F32 x = CD_CLIP(d.x * obb.q.c + d.y * obb.q.s, -hl, hl);
+        const CD_F32 y = CD_CLIP(d.y * obb.q.c - d.x * obb.q.s, -hw, hw);
+        return cd_vec2_make_v(obb.center.x + x * obb.q.c - y * obb.q.s, obb.center.y + x * obb.q.s + y * obb.q.c);
+    }
+
+    CD_INLINE CD_VEC2 cd_aabb_nearest_point_v(CD_AABB aabb, CD_VEC2 point)
+    {
+        return cd_vec2_make_v(CD_CLIP(point.x, aabb.lowerBound.x, aabb.upperBound.x),
+                              CD_CLIP(point.y, aabb.lowerBound.y, aabb.upperBound.y));
+    }
+
+    /**
+     * @brief 由两侧的核心最近点与圆角半径填写距离结果,与 cd_shape_distance_span 的约定一致:
+     *        圆角重叠时最近点仍在外轮廓上,核心点重合时两个最近点取中点
+     */
+    CD_INLINE CD_VOID cd_shape_finish_distance_v(CD_VEC2 point_a, CD_VEC2 point_b, CD_F32 radius_a, CD_F32 radius_b,
+                                                 CD_DISTANCE_OUTPUT *output)
+    {
+        const CD_F32 core = cd_vec2_dis_v(point_a, point_b);
+        output->iterations = 0;
+        output->simplexCount = 0;
+        if (core < CD_EPS)
+        {
+            output->pointA = cd_vec2_scale_v(cd_vec2_add_v(point_a, point_b), 0.5f);
+            output->pointB = output->pointA;
+            output->distance = 0.0f;
+            return;
+        }
+        const CD_VEC2 n = cd_vec2_scale_v(cd_vec2_sub_v(point_b, point_a), 1.0f / core);
+        output->pointA = cd_vec2_mul_add_v(point_a, radius_a, n);
+        output->pointB = cd_vec2_mul_add_v(point_b, -radius_b, n);
+        output->distance = CD_MAX(0.0f, core - radius_a - radius_b);
+    }
+
+    /**
+     * @brief 交换接触流形的a、b两侧,法向取反,特征id互换
+     */
+    CD_INLINE CD_MANIFOLD cd_manifold_flip_v(CD_MANIFOLD m)
+    {
+        m.normal = cd_vec2_neg_v(m.normal);
+        for (CD_S32 i = 0; i < m.pointCount; ++i)
+        {
+            const CD_CONTACT_FEATURE cf = m.points[i].id.cf;
+            m.points[i].id.cf.indexA = cf.indexB;
+            m.points[i].id.cf.indexB = cf.indexA;
+            m.points[i].id.cf.typeA = cf.typeB;
+            m.points[i].id.cf.typeB = cf.typeA;
+        }
+        return m;
+    }
+
+    // ---------------- 重叠 ----------------
+
+    CD_INLINE CD_BOOL cd_shape_overlap_circle_circle_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        const CD_F32 r = a->data.circle.radius + b->data.circle.radius;
+        return cd_vec2_dis_sqr_v(a->data.circle.center, b->data.circle.center) <= r * r;
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_circle_aabb_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        const CD_CIRCLE c = a->data.circle;
+        return cd_vec2_dis_sqr_v(c.center, cd_aabb_nearest_point_v(b->data.aabb, c.center)) <= c.radius * c.radius;
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_circle_obb_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        const CD_CIRCLE c = a->data.circle;
+        return cd_vec2_dis_sqr_v(c.center, cd_obb_nearest_point_v(b->data.obb, c.center)) <= c.radius * c.radius;
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_circle_polygon_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        const CD_POLYGON_VIEW *p = &b->data.polygon;
+        return cd_point_in_polygon_view_v(p, a->data.circle.center, p->radius + a->data.circle.radius);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_circle_segment_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        const CD_CIRCLE c = a->data.circle;
+        return cd_vec2_dis_sqr_v(c.center, cd_segment_nearest_point_v(b->data.segment, c.center)) <= c.radius * c.radius;
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_aabb_aabb_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_aabb_overlap_v(a->data.aabb, b->data.aabb);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_aabb_obb_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        const CD_AABB box = a->data.aabb;
+        CD_OBB obb;
+        obb.center = cd_aabb_center_v(box);
+        obb.length = box.upperBound.x - box.lowerBound.x;
+        obb.width = box.upperBound.y - box.lowerBound.y;
+        obb.q = TRANSFORM_IDENTITY.q;
+        return cd_obb_overlap_v(obb, b->data.obb);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_aabb_segment_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        const CD_AABB box = a->data.aabb;
+        const CD_VEC2 half = cd_vec2_scale_v(cd_vec2_sub_v(box.upperBound, box.lowerBound), 0.5f);
+        return cd_box_segment_overlap_v(cd_aabb_center_v(box), half, b->data.segment.point1, b->data.segment.point2);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_obb_obb_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_obb_overlap_v(a->data.obb, b->data.obb);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_obb_segment_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        // 线段变换到obb局部坐标系后按轴对齐盒子处理
+        const CD_OBB obb = a->data.obb;
+        const CD_VEC2 d1 = cd_vec2_sub_v(b->data.segment.point1, obb.center);
+        const CD_VEC2 d2 = cd_vec2_sub_v(b->data.segment.point2, obb.center);
+        const CD_VEC2 p1 = cd_vec2_make_v(d1.x * obb.q.c + d1.y * obb.q.s, d1.y * obb.q.c - d1.x * obb.q.s);
+        const CD_VEC2 p2 = cd_vec2_make_v(d2.x * obb.q.c + d2.y * obb.q.s, d2.y * obb.q.c - d2.x * obb.q.s);
+        return cd_box_segment_overlap_v(Vec2_Zero, cd_vec2_make_v(obb.length * 0.5f, obb.width * 0.5f), p1, p2);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_segment_segment_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        const CD_SEGMENT s1 = a->data.segment;
+        const CD_SEGMENT s2 = b->data.segment;
+        return cd_segments_intersect_core(s1.point1.x, s1.point1.y, s1.point2.x, s1.point2.y,
+                                          s2.point1.x, s2.point1.y, s2.point2.x, s2.point2.y, CD_NULL);
+    }
+
+    // 胶囊体使用闭式精确测试,不走分离轴通用路径(后者在圆角处偏保守)
+
+    CD_INLINE CD_BOOL cd_shape_overlap_circle_capsule_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_capsule_circle_overlap_v(b->data.capsule, a->data.circle);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_aabb_capsule_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_capsule_aabb_overlap_v(b->data.capsule, a->data.aabb);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_obb_capsule_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_capsule_obb_overlap_v(b->data.capsule, a->data.obb);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_polygon_capsule_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_capsule_polygon_view_overlap_v(b->data.capsule, &a->data.polygon);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_segment_capsule_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        const CD_F32 r = b->data.capsule.radius;
+        return cd_segments_distance_v(a->data.segment, b->data.capsule.seg).distanceSquared <= r * r;
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_capsule_capsule_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_capsules_overlap_v(a->data.capsule, b->data.capsule);
+    }
+
+    /**
+     * @brief 通用路径: 两侧都转成多边形视图做分离轴测试
+     *        带圆角时分离轴测试在角点处偏保守,通过后再精确判断: 核心相交则重叠,
+     *        否则两核心的最近点对中至少有一个是顶点,比较各顶点到对方核心的距离与圆角半径之和
+     */
+    CD_INLINE CD_BOOL cd_shape_overlap_polygonal_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        CD_SHAPE_SCRATCH scratch_a;
+        CD_SHAPE_SCRATCH scratch_b;
+        const CD_POLYGON_VIEW view_a = cd_shape_polygon_view_v(a, &scratch_a);
+        const CD_POLYGON_VIEW view_b = cd_shape_polygon_view_v(b, &scratch_b);
+        if (!cd_polygon_views_overlap_v(&view_a, &view_b))
+        {
+            return CD_FALSE;
+        }
+        const CD_F32 radius = view_a.radius + view_b.radius;
+        if (radius <= 0.0f)
+        {
+            return CD_TRUE;
+        }
+        CD_POLYGON_VIEW core_a = view_a;
+        CD_POLYGON_VIEW core_b = view_b;
+        core_a.radius = 0.0f;
+        core_b.radius = 0.0f;
+        if (cd_polygon_view_separation_v(&core_a, &core_b) <= 0.0f && cd_polygon_view_separation_v(&core_b, &core_a) <= 0.0f)
+        {
+            return CD_TRUE;
+        }
+        for (CD_S32 i = 0; i < core_a.count; ++i)
+        {
+            if (cd_point_in_polygon_view_v(&core_b, core_a.vertices[i], radius))
+            {
+                return CD_TRUE;
+            }
+        }
+        for (CD_S32 i = 0; i < core_b.count; ++i)
+        {
+            if (cd_point_in_polygon_view_v(&core_a, core_b.vertices[i], radius))
+            {
+                return CD_TRUE;
+            }
+        }
+        return CD_FALSE;
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_aabb_circle_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_shape_overlap_circle_aabb_v(b, a);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_obb_circle_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_shape_overlap_circle_obb_v(b, a);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_polygon_circle_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_shape_overlap_circle_polygon_v(b, a);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_segment_circle_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_shape_overlap_circle_segment_v(b, a);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_obb_aabb_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_shape_overlap_aabb_obb_v(b, a);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_segment_aabb_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_shape_overlap_aabb_segment_v(b, a);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_segment_obb_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_shape_overlap_obb_segment_v(b, a);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_capsule_circle_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_shape_overlap_circle_capsule_v(b, a);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_capsule_aabb_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_shape_overlap_aabb_capsule_v(b, a);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_capsule_obb_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_shape_overlap_obb_capsule_v(b, a);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_capsule_polygon_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_shape_overlap_polygon_capsule_v(b, a);
+    }
+
+    CD_INLINE CD_BOOL cd_shape_overlap_capsule_segment_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_shape_overlap_segment_capsule_v(b, a);
+    }
+
+    // 行为形状a的类型,列为形状b的类型
+    CD_SHAPE_TABLE CD_SHAPE_OVERLAP_FCN cdShapeOverlapTable[CD_SHAPE_TYPE_COUNT][CD_SHAPE_TYPE_COUNT] = {
+        {cd_shape_overlap_circle_circle_v, cd_shape_overlap_circle_aabb_v, cd_shape_overlap_circle_obb_v,
+         cd_shape_overlap_circle_polygon_v, cd_shape_overlap_circle_segment_v, cd_shape_overlap_circle_capsule_v},
+        {cd_shape_overlap_aabb_circle_v, cd_shape_overlap_aabb_aabb_v, cd_shape_overlap_aabb_obb_v,
+         cd_shape_overlap_polygonal_v, cd_shape_overlap_aabb_segment_v, cd_shape_overlap_aabb_capsule_v},
+        {cd_shape_overlap_obb_circle_v, cd_shape_overlap_obb_aabb_v, cd_shape_overlap_obb_obb_v,
+         cd_shape_overlap_polygonal_v, cd_shape_overlap_obb_segment_v, cd_shape_overlap_obb_capsule_v},
+        {cd_shape_overlap_polygon_circle_v, cd_shape_overlap_polygonal_v, cd_shape_overlap_polygonal_v,
+         cd_shape_overlap_polygonal_v, cd_shape_overlap_polygonal_v, cd_shape_overlap_polygon_capsule_v},
+        {cd_shape_overlap_segment_circle_v, cd_shape_overlap_segment_aabb_v, cd_shape_overlap_segment_obb_v,
+         cd_shape_overlap_polygonal_v, cd_shape_overlap_segment_segment_v, cd_shape_overlap_segment_capsule_v},
+        {cd_shape_overlap_capsule_circle_v, cd_shape_overlap_capsule_aabb_v, cd_shape_overlap_capsule_obb_v,
+         cd_shape_overlap_capsule_polygon_v, cd_shape_overlap_capsule_segment_v, cd_shape_overlap_capsule_capsule_v},
+    };
+
+    // ---------------- 距离 ----------------
+
+    CD_INLINE CD_VOID cd_shape_distance_circle_circle_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        cd_shape_finish_distance_v(a->data.circle.center, b->data.circle.center, a->data.circle.radius, b->data.circle.radius, output);
+    }
+
+    CD_INLINE CD_VOID cd_shape_distance_circle_aabb_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        const CD_CIRCLE c = a->data.circle;
+        cd_shape_finish_distance_v(c.center, cd_aabb_nearest_point_v(b->data.aabb, c.center), c.radius, 0.0f, output);
+    }
+
+    CD_INLINE CD_VOID cd_shape_distance_circle_obb_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        const CD_CIRCLE c = a->data.circle;
+        cd_shape_finish_distance_v(c.center, cd_obb_nearest_point_v(b->data.obb, c.center), c.radius, 0.0f, output);
+    }
+
+    CD_INLINE CD_VOID cd_shape_distance_circle_segment_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        const CD_CIRCLE c = a->data.circle;
+        cd_shape_finish_distance_v(c.center, cd_segment_nearest_point_v(b->data.segment, c.center), c.radius, 0.0f, output);
+    }
+
+    CD_INLINE CD_VOID cd_shape_distance_circle_capsule_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        const CD_CIRCLE c = a->data.circle;
+        const CD_CAPSULE cap = b->data.capsule;
+        cd_shape_finish_distance_v(c.center, cd_segment_nearest_point_v(cap.seg, c.center), c.radius, cap.radius, output);
+    }
+
+    CD_INLINE CD_VOID cd_shape_distance_segment_segment_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        const CD_SEGMENT_DISTANCE_RESULT d = cd_segments_distance_v(a->data.segment, b->data.segment);
+        cd_shape_finish_distance_v(d.closest1, d.closest2, 0.0f, 0.0f, output);
+    }
+
+    CD_INLINE CD_VOID cd_shape_distance_segment_capsule_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        const CD_SEGMENT_DISTANCE_RESULT d = cd_segments_distance_v(a->data.segment, b->data.capsule.seg);
+        cd_shape_finish_distance_v(d.closest1, d.closest2, 0.0f, b->data.capsule.radius, output);
+    }
+
+    CD_INLINE CD_VOID cd_shape_distance_capsule_capsule_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        const CD_SEGMENT_DISTANCE_RESULT d = cd_segments_distance_v(a->data.capsule.seg, b->data.capsule.seg);
+        cd_shape_finish_distance_v(d.closest1, d.closest2, a->data.capsule.radius, b->data.capsule.radius, output);
+    }
+
+    CD_INLINE CD_VOID cd_shape_distance_aabb_aabb_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        // 每个轴上:分离时取两侧相对的边界,重叠时两侧都取重叠区间的中点
+        const CD_AABB p = a->data.aabb;
+        const CD_AABB q = b->data.aabb;
+        CD_VEC2 point_a;
+        CD_VEC2 point_b;
+        if (p.upperBound.x < q.lowerBound.x)
+        {
+            point_a.x = p.upperBound.x;
+            point_b.x = q.lowerBound.x;
+        }
+        else if (q.upperBound.x < p.lowerBound.x)
+        {
+            point_a.x = p.lowerBound.x;
+            point_b.x = q.upperBound.x;
+        }
+        else
+        {
+            point_a.x = 0.5f * (CD_MAX(p.lowerBound.x, q.lowerBound.x) + CD_MIN(p.upperBound.x, q.upperBound.x));
+            point_b.x = point_a.x;
+        }
+        if (p.upperBound.y < q.lowerBound.y)
+        {
+            point_a.y = p.upperBound.y;
+            point_b.y = q.lowerBound.y;
+        }
+        else if (q.upperBound.y < p.lowerBound.y)
+        {
+            point_a.y = p.lowerBound.y;
+            point_b.y = q.upperBound.y;
+        }
+        else
+        {
+            point_a.y = 0.5f * (CD_MAX(p.lowerBound.y, q.lowerBound.y) + CD_MIN(p.upperBound.y, q.upperBound.y));
+            point_b.y = point_a.y;
+        }
+        cd_shape_finish_distance_v(point_a, point_b, 0.0f, 0.0f, output);
+    }
+
+    /**
+     * @brief 通用路径: GJK
+     */
+    CD_INLINE CD_VOID cd_shape_distance_gjk_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        CD_SHAPE_SCRATCH scratch_a;
+        CD_SHAPE_SCRATCH scratch_b;
+        CD_DISTANCE_SPAN_INPUT input;
+        input.proxyA = cd_shape_span_v(a, &scratch_a);
+        input.proxyB = cd_shape_span_v(b, &scratch_b);
+        input.transformA = TRANSFORM_IDENTITY;
+        input.transformB = TRANSFORM_IDENTITY;
+        input.useRadii = CD_TRUE;
+        CD_DISTANCE_CACHE cache = emptyDistanceCache;
+        cd_shape_distance_span(&cache, &input, CD_NULL, 0, output);
+    }
+
+    /**
+     * @brief 交换距离结果的两侧
+     */
+    CD_INLINE CD_VOID cd_distance_output_flip_v(CD_DISTANCE_OUTPUT *output)
+    {
+        const CD_VEC2 p = output->pointA;
+        output->pointA = output->pointB;
+        output->pointB = p;
+    }
+
+    CD_INLINE CD_VOID cd_shape_distance_aabb_circle_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        cd_shape_distance_circle_aabb_v(b, a, output);
+        cd_distance_output_flip_v(output);
+    }
+
+    CD_INLINE CD_VOID cd_shape_distance_obb_circle_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        cd_shape_distance_circle_obb_v(b, a, output);
+        cd_distance_output_flip_v(output);
+    }
+
+    CD_INLINE CD_VOID cd_shape_distance_segment_circle_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        cd_shape_distance_circle_segment_v(b, a, output);
+        cd_distance_output_flip_v(output);
+    }
+
+    CD_INLINE CD_VOID cd_shape_distance_capsule_circle_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        cd_shape_distance_circle_capsule_v(b, a, output);
+        cd_distance_output_flip_v(output);
+    }
+
+    CD_INLINE CD_VOID cd_shape_distance_capsule_segment_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        cd_shape_distance_segment_capsule_v(b, a, output);
+        cd_distance_output_flip_v(output);
+    }
+
+    CD_SHAPE_TABLE CD_SHAPE_DISTANCE_FCN cdShapeDistanceTable[CD_SHAPE_TYPE_COUNT][CD_SHAPE_TYPE_COUNT] = {
+        {cd_shape_distance_circle_circle_v, cd_shape_distance_circle_aabb_v, cd_shape_distance_circle_obb_v,
+         cd_shape_distance_gjk_v, cd_shape_distance_circle_segment_v, cd_shape_distance_circle_capsule_v},
+        {cd_shape_distance_aabb_circle_v, cd_shape_distance_aabb_aabb_v, cd_shape_distance_gjk_v,
+         cd_shape_distance_gjk_v, cd_shape_distance_gjk_v, cd_shape_distance_gjk_v},
+        {cd_shape_distance_obb_circle_v, cd_shape_distance_gjk_v, cd_shape_distance_gjk_v,
+         cd_shape_distance_gjk_v, cd_shape_distance_gjk_v, cd_shape_distance_gjk_v},
+        {cd_shape_distance_gjk_v, cd_shape_distance_gjk_v, cd_shape_distance_gjk_v,
+         cd_shape_distance_gjk_v, cd_shape_distance_gjk_v, cd_shape_distance_gjk_v},
+        {cd_shape_distance_segment_circle_v, cd_shape_distance_gjk_v, cd_shape_distance_gjk_v,
+         cd_shape_distance_gjk_v, cd_shape_distance_segment_segment_v, cd_shape_distance_segment_capsule_v},
+        {cd_shape_distance_capsule_circle_v, cd_shape_distance_gjk_v, cd_shape_distance_gjk_v,
+         cd_shape_distance_gjk_v, cd_shape_distance_capsule_segment_v, cd_shape_distance_capsule_capsule_v},
+    };
+
+    // ---------------- 接触流形 ----------------
+
+    CD_INLINE CD_MANIFOLD cd_shape_manifold_circle_circle_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_collide_circles_v(a->data.circle, b->data.circle);
+    }
+
+    /**
+     * @brief 多边形类形状(a)与圆(b)的接触流形,法向由a指向b
+     */
+    CD_INLINE CD_MANIFOLD cd_shape_manifold_polygonal_circle_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        CD_SHAPE_SCRATCH scratch;
+        const CD_POLYGON_VIEW view = cd_shape_polygon_view_v(a, &scratch);
+        return cd_collide_polygon_view_circle_v(&view, b->data.circle);
+    }
+
+    CD_INLINE CD_MANIFOLD cd_shape_manifold_circle_polygonal_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_manifold_flip_v(cd_shape_manifold_polygonal_circle_v(b, a));
+    }
+
+    /**
+     * @brief 多边形类形状之间的接触流形,法向由a指向b
+     *        带圆角时裁剪在角点处偏保守,与胶囊体相同,先用精确的重叠测试排除假接触
+     */
+    CD_INLINE CD_MANIFOLD cd_shape_manifold_polygonal_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        CD_SHAPE_SCRATCH scratch_a;
+        CD_SHAPE_SCRATCH scratch_b;
+        const CD_POLYGON_VIEW view_a = cd_shape_polygon_view_v(a, &scratch_a);
+        const CD_POLYGON_VIEW view_b = cd_shape_polygon_view_v(b, &scratch_b);
+        if (view_a.radius + view_b.radius > 0.0f && !cd_shape_overlap_polygonal_v(a, b))
+        {
+            return cd_empty_manifold_v();
+        }
+        return cd_collide_polygon_views_v(&view_a, &view_b);
+    }
+
+    /**
+     * @brief 胶囊体(a)与任意形状(b)的接触流形,法向由a指向b
+     *        带圆角的二边形裁剪在圆角处偏保守,先用闭式重叠测试排除假接触;退化成点的胶囊体按圆处理
+     */
+    CD_INLINE CD_MANIFOLD cd_shape_manifold_capsule_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        const CD_CAPSULE cap = a->data.capsule;
+        if (!cdShapeOverlapTable[CD_SHAPE_CAPSULE][b->type](a, b))
+        {
+            return cd_empty_manifold_v();
+        }
+        if (cd_vec2_dis_sqr_v(cap.seg.point1, cap.seg.point2) < CD_EPS * CD_EPS)
+        {
+            CD_CIRCLE circle;
+            circle.center = cap.seg.point1;
+            circle.radius = cap.radius;
+            const CD_SHAPE c = cd_make_circle_shape_v(circle);
+            return b->type == CD_SHAPE_CIRCLE ? cd_shape_manifold_circle_circle_v(&c, b)
+                                              : cd_shape_manifold_circle_polygonal_v(&c, b);
+        }
+        return b->type == CD_SHAPE_CIRCLE ? cd_shape_manifold_polygonal_circle_v(a, b) : cd_shape_manifold_polygonal_v(a, b);
+    }
+
+    CD_INLINE CD_MANIFOLD cd_shape_manifold_to_capsule_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cd_manifold_flip_v(cd_shape_manifold_capsule_v(b, a));
+    }
+
+    CD_SHAPE_TABLE CD_SHAPE_MANIFOLD_FCN cdShapeManifoldTable[CD_SHAPE_TYPE_COUNT][CD_SHAPE_TYPE_COUNT] = {
+        {cd_shape_manifold_circle_circle_v, cd_shape_manifold_circle_polygonal_v, cd_shape_manifold_circle_polygonal_v,
+         cd_shape_manifold_circle_polygonal_v, cd_shape_manifold_circle_polygonal_v, cd_shape_manifold_to_capsule_v},
+        {cd_shape_manifold_polygonal_circle_v, cd_shape_manifold_polygonal_v, cd_shape_manifold_polygonal_v,
+         cd_shape_manifold_polygonal_v, cd_shape_manifold_polygonal_v, cd_shape_manifold_to_capsule_v},
+        {cd_shape_manifold_polygonal_circle_v, cd_shape_manifold_polygonal_v, cd_shape_manifold_polygonal_v,
+         cd_shape_manifold_polygonal_v, cd_shape_manifold_polygonal_v, cd_shape_manifold_to_capsule_v},
+        {cd_shape_manifold_polygonal_circle_v, cd_shape_manifold_polygonal_v, cd_shape_manifold_polygonal_v,
+         cd_shape_manifold_polygonal_v, cd_shape_manifold_polygonal_v, cd_shape_manifold_to_capsule_v},
+        {cd_shape_manifold_polygonal_circle_v, cd_shape_manifold_polygonal_v, cd_shape_manifold_polygonal_v,
+         cd_shape_manifold_polygonal_v, cd_shape_manifold_polygonal_v, cd_shape_manifold_to_capsule_v},
+        {cd_shape_manifold_capsule_v, cd_shape_manifold_capsule_v, cd_shape_manifold_capsule_v,
+         cd_shape_manifold_capsule_v, cd_shape_manifold_capsule_v, cd_shape_manifold_capsule_v},
+    };
+
+    // ---------------- 分派 ----------------
+
+    /**
+     * @brief 查表选择成对例程判断两个形状是否重叠,无参数检查
+     * @param a 形状a
+     * @param b 形状b
+     * @return 1 重叠(含边界接触), 0 不重叠
+     */
+    CD_INLINE CD_BOOL cd_shapes_overlap_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cdShapeOverlapTable[a->type][b->type](a, b);
+    }
+
+    /**
+     * @brief 查表选择成对例程判断两个形状是否重叠
+     * @param a 形状a
+     * @param b 形状b
+     * @param result 1 重叠(含边界接触), 0 不重叠
+     * @return ok / 参数异常 / 形状类型非法
+     */
+    CD_INLINE CD_RET cd_shapes_overlap(const CD_SHAPE *a, const CD_SHAPE *b, CD_BOOL *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(a->type < 0 || a->type >= CD_SHAPE_TYPE_COUNT || b->type < 0 || b->type >= CD_SHAPE_TYPE_COUNT,
+                       COLLISION_DETECTION_E_CALC_ERROR);
+        *result = cd_shapes_overlap_v(a, b);
+        return ret;
+    }
+
+    /**
+     * @brief 查表选择成对例程计算两个形状的距离与最近点,没有专门例程的组合使用 GJK,无参数检查
+     * @param a 形状a
+     * @param b 形状b
+     * @param output 最近点与距离,重叠时距离为0;专门例程的迭代次数为0
+     */
+    CD_INLINE CD_VOID cd_shapes_distance_v(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        cdShapeDistanceTable[a->type][b->type](a, b, output);
+    }
+
+    /**
+     * @brief 查表选择成对例程计算两个形状的距离与最近点
+     * @param a 形状a
+     * @param b 形状b
+     * @param output 最近点与距离,重叠时距离为0
+     * @return ok / 参数异常 / 形状类型非法
+     */
+    CD_INLINE CD_RET cd_shapes_distance(const CD_SHAPE *a, const CD_SHAPE *b, CD_DISTANCE_OUTPUT *output)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || output == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(a->type < 0 || a->type >= CD_SHAPE_TYPE_COUNT || b->type < 0 || b->type >= CD_SHAPE_TYPE_COUNT,
+                       COLLISION_DETECTION_E_CALC_ERROR);
+        cd_shapes_distance_v(a, b, output);
+        return ret;
+    }
+
+    /**
+     * @brief 查表选择成对例程计算两个形状的接触流形,无参数检查
+     * @param a 形状a
+     * @param b 形状b
+     * @return 接触流形,法向由a指向b
+     */
+    CD_INLINE CD_MANIFOLD cd_shapes_manifold_v(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        return cdShapeManifoldTable[a->type][b->type](a, b);
+    }
+
+    /**
+     * @brief 查表选择成对例程计算两个形状的接触流形
+     * @param a 形状a
+     * @param b 形状b
+     * @param result 接触流形,法向由a指向b
+     * @return ok / 参数异常 / 形状类型非法
+     */
+    CD_INLINE CD_RET cd_shapes_manifold(const CD_SHAPE *a, const CD_SHAPE *b, CD_MANIFOLD *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(a->type < 0 || a->type >= CD_SHAPE_TYPE_COUNT || b->type < 0 || b->type >= CD_SHAPE_TYPE_COUNT,
+                       COLLISION_DETECTION_E_CALC_ERROR);
+        *result = cd_shapes_manifold_v(a, b);
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+
+namespace cd
+{
+    /**
+     * @brief 具体形状类型到标签的映射,两侧类型在编译期已知时由 shape_overlap 等模板直接选出成对例程
+     */
+    template <typename T>
+    struct ShapeTag;
+
+    template <>
+    struct ShapeTag<CD_CIRCLE>
+    {
+        static const CD_S32 type = CD_SHAPE_CIRCLE;
+        static CD_SHAPE make(const CD_CIRCLE &s) { return cd_make_circle_shape_v(s); }
+    };
+
+    template <>
+    struct ShapeTag<CD_AABB>
+    {
+        static const CD_S32 type = CD_SHAPE_AABB;
+        static CD_SHAPE make(const CD_AABB &s) { return cd_make_aabb_shape_v(s); }
+    };
+
+    template <>
+    struct ShapeTag<CD_OBB>
+    {
+        static const CD_S32 type = CD_SHAPE_OBB;
+        static CD_SHAPE make(const CD_OBB &s) { return cd_make_obb_shape_v(s); }
+    };
+
+    template <>
+    struct ShapeTag<CD_POLYGON>
+    {
+        static const CD_S32 type = CD_SHAPE_POLYGON;
+        static CD_SHAPE make(const CD_POLYGON &s) { return cd_make_polygon_shape_v(&s); }
+    };
+
+    template <>
+    struct ShapeTag<CD_POLYGON_VIEW>
+    {
+        static const CD_S32 type = CD_SHAPE_POLYGON;
+        static CD_SHAPE make(const CD_POLYGON_VIEW &s) { return cd_make_polygon_view_shape_v(s); }
+    };
+
+    template <>
+    struct ShapeTag<CD_SEGMENT>
+    {
+        static const CD_S32 type = CD_SHAPE_SEGMENT;
+        static CD_SHAPE make(const CD_SEGMENT &s) { return cd_make_segment_shape_v(s); }
+    };
+
+    template <>
+    struct ShapeTag<CD_CAPSULE>
+    {
+        static const CD_S32 type = CD_SHAPE_CAPSULE;
+        static CD_SHAPE make(const CD_CAPSULE &s) { return cd_make_capsule_shape_v(s); }
+    };
+
+    template <typename A, typename B>
+    inline CD_BOOL shape_overlap(const A &a, const B &b)
+    {
+        constexpr CD_SHAPE_OVERLAP_FCN fcn = cdShapeOverlapTable[ShapeTag<A>::type][ShapeTag<B>::type];
+        const CD_SHAPE sa = ShapeTag<A>::make(a);
+        const CD_SHAPE sb = ShapeTag<B>::make(b);
+        return fcn(&sa, &sb);
+    }
+
+    template <typename A, typename B>
+    inline CD_DISTANCE_OUTPUT shape_distance(const A &a, const B &b)
+    {
+        constexpr CD_SHAPE_DISTANCE_FCN fcn = cdShapeDistanceTable[ShapeTag<A>::type][ShapeTag<B>::type];
+        const CD_SHAPE sa = ShapeTag<A>::make(a);
+        const CD_SHAPE sb = ShapeTag<B>::make(b);
+        CD_DISTANCE_OUTPUT output;
+        fcn(&sa, &sb, &output);
+        return output;
+    }
+
+    template <typename A, typename B>
+    inline CD_MANIFOLD shape_manifold(const A &a, const B &b)
+    {
+        constexpr CD_SHAPE_MANIFOLD_FCN fcn = cdShapeManifoldTable[ShapeTag<A>::type][ShapeTag<B>::type];
+        const CD_SHAPE sa = ShapeTag<A>::make(a);
+        const CD_SHAPE sb = ShapeTag<B>::make(b);
+        return fcn(&sa, &sb);
+    }
+} // namespace cd
+#endif
+
+#endif /* __COLLISION_DETECTION_SHAPE_H__ */
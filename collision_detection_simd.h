@@ -0,0 +1,69 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-16 11:30:52
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-16 11:30:52
+ */
+
+#ifndef __COLLISION_DETECTION_SIMD_H__
+#define __COLLISION_DETECTION_SIMD_H__
+
+#include "collision_detection_type.h"
+
+// 根据编译选项选择指令集,定义 CD_SIMD_DISABLE 可强制使用标量实现
+#if !defined(CD_SIMD_DISABLE) && defined(__AVX2__)
+#include <immintrin.h>
+#define CD_SIMD_AVX2 1
+#define CD_SIMD_WIDTH 8
+#elif !defined(CD_SIMD_DISABLE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define CD_SIMD_SSE2 1
+#define CD_SIMD_WIDTH 4
+#else
+#define CD_SIMD_SCALAR 1
+#define CD_SIMD_WIDTH 1
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief 统计32位整数中1的个数
+     * @param v 整数
+     * @return 1的个数
+     */
+    CD_INLINE CD_S32 cd_popcount32(CD_U32 v)
+    {
+        v = v - ((v >> 1) & 0x55555555u);
+        v = (v & 0x33333333u) + ((v >> 2) & 0x33333333u);
+        v = (v + (v >> 4)) & 0x0F0F0F0Fu;
+        return (CD_S32)((v * 0x01010101u) >> 24);
+    }
+
+    /**
+     * @brief 求32位整数最低位的1的位置
+     * @param v 整数,不能为0
+     * @return 最低位的1的位置
+     */
+    CD_INLINE CD_S32 cd_ctz32(CD_U32 v)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctz(v);
+#else
+        CD_S32 n = 0;
+        while ((v & 1u) == 0)
+        {
+            v >>= 1;
+            n += 1;
+        }
+        return n;
+#endif
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __COLLISION_DETECTION_SIMD_H__ */
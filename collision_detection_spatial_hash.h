@@ -0,0 +1,374 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-16 10:03:41
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-16 10:03:41
+ */
+
+#ifndef __COLLISION_DETECTION_SPATIAL_HASH_H__
+#define __COLLISION_DETECTION_SPATIAL_HASH_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_aabb.h"
+#include "collision_detection_circle.h"
+#include "collision_detection_obb.h"
+#include "collision_detection_polygon.h"
+#include "collision_detection_allocator.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CD_HASH_NULL_ENTRY (-1) // 空链表
+#define CD_HASH_CELL_LIMIT (1073741824.0f) // 栅格坐标的绝对值上限 2^30,保证转换为 CD_S32 以及相减不溢出
+
+    // 哈希表中的一项,一个障碍物覆盖几个栅格就有几项
+    typedef struct _CD_HASH_ENTRY_
+    {
+        CD_S32 cellX; // 栅格坐标x
+        CD_S32 cellY; // 栅格坐标y
+        CD_S32 id;    // 障碍物id
+        CD_S32 next;  // 同一个桶内的下一项
+    } CD_HASH_ENTRY;
+
+    // 均匀栅格空间哈希,所有内存由调用者预先分配
+    typedef struct _CD_SPATIAL_HASH_
+    {
+        CD_F32 cellSize;        // 栅格边长
+        CD_F32 invCellSize;     // 栅格边长的倒数
+        CD_S32 *buckets;        // 每个桶的链表表头
+        CD_U32 bucketMask;      // 桶数量 - 1,桶数量必须是2的幂
+        CD_HASH_ENTRY *entries; // 表项池
+        CD_S32 entryCount;      // 已使用的表项数
+        CD_S32 entryCapacity;   // 表项池容量
+        CD_U32 *stamps;         // 每个id最近一次被查询到的查询序号,用于去重
+        CD_S32 idCapacity;      // id的上限(不含)
+        CD_U32 queryStamp;      // 当前查询序号
+    } CD_SPATIAL_HASH;
+
+    /**
+     * @brief 初始化空间哈希
+     * @param hash 空间哈希
+     * @param cellSize 栅格边长,一般取障碍物的典型尺寸
+     * @param buckets 桶数组
+     * @param bucketCount 桶数量,必须是2的幂
+     * @param entries 表项池
+     * @param entryCapacity 表项池容量
+     * @param stamps 去重数组,长度为 idCapacity
+     * @param idCapacity 障碍物id的上限(不含)
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_spatial_hash_init(CD_SPATIAL_HASH *hash, CD_F32 cellSize,
+                                          CD_S32 *buckets, CD_S32 bucketCount,
+                                          CD_HASH_ENTRY *entries, CD_S32 entryCapacity,
+                                          CD_U32 *stamps, CD_S32 idCapacity)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(hash == CD_NULL || buckets == CD_NULL || entries == CD_NULL || stamps == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(cellSize <= CD_EPS || bucketCount <= 0 || entryCapacity <= 0 || idCapacity <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        CD_CHECK_ERROR((bucketCount & (bucketCount - 1)) != 0, COLLISION_DETECTION_E_MEM_ALIGN);
+        hash->cellSize = cellSize;
+        hash->invCellSize = 1.0f / cellSize;
+        hash->buckets = buckets;
+        hash->bucketMask = (CD_U32)bucketCount - 1;
+        hash->entries = entries;
+        hash->entryCount = 0;
+        hash->entryCapacity = entryCapacity;
+        hash->stamps = stamps;
+        hash->idCapacity = idCapacity;
+        hash->queryStamp = 0;
+        for (CD_S32 i = 0; i < bucketCount; ++i)
+        {
+            buckets[i] = CD_HASH_NULL_ENTRY;
+        }
+        for (CD_S32 i = 0; i < idCapacity; ++i)
+        {
+            stamps[i] = 0;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 在线性分配器上分配桶、表项池与查询标记并初始化空间哈希
+     * @param hash 空间哈希
+     * @param arena 线性分配器
+     * @param cellSize 栅格边长
+     * @param bucketCount 桶数量,必须是2的幂
+     * @param entryCapacity 表项池容量
+     * @param idCapacity id的上限(不含)
+     * @return ok / 参数异常 / 桶数量不是2的幂 / 线性分配器容量不足
+     */
+    CD_INLINE CD_RET cd_spatial_hash_init_from_arena(CD_SPATIAL_HASH *hash, CD_ARENA *arena, CD_F32 cellSize,
+                                                     CD_S32 bucketCount, CD_S32 entryCapacity, CD_S32 idCapacity)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(hash == CD_NULL || arena == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(bucketCount <= 0 || entryCapacity <= 0 || idCapacity <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        CD_S32 *buckets = CD_NULL;
+        CD_HASH_ENTRY *entries = CD_NULL;
+        CD_U32 *stamps = CD_NULL;
+        ret = CD_ARENA_ALLOC_ARRAY(arena, CD_S32, bucketCount, &buckets);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = CD_ARENA_ALLOC_ARRAY(arena, CD_HASH_ENTRY, entryCapacity, &entries);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = CD_ARENA_ALLOC_ARRAY(arena, CD_U32, idCapacity, &stamps);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        return cd_spatial_hash_init(hash, cellSize, buckets, bucketCount, entries, entryCapacity, stamps, idCapacity);
+    }
+
+    /**
+     * @brief 计算栅格坐标对应的桶
+     * @param hash 空间哈希
+     * @param cell_x 栅格坐标x
+     * @param cell_y 栅格坐标y
+     * @param result 桶索引
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_spatial_hash_bucket(const CD_SPATIAL_HASH *hash, CD_S32 cell_x, CD_S32 cell_y, CD_U32 *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(hash == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_U32 key = ((CD_U32)cell_x * 73856093u) ^ ((CD_U32)cell_y * 19349663u);
+        *result = key & hash->bucketMask;
+        return ret;
+    }
+
+    /**
+     * @brief 清空空间哈希,每帧重建前调用,不释放内存
+     * @param hash 空间哈希
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_spatial_hash_clear(CD_SPATIAL_HASH *hash)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(hash == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        // 只需重置被使用过的桶
+        for (CD_S32 i = 0; i < hash->entryCount; ++i)
+        {
+            const CD_HASH_ENTRY *entry = hash->entries + i;
+            CD_U32 bucket;
+            ret = cd_spatial_hash_bucket(hash, entry->cellX, entry->cellY, &bucket);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            hash->buckets[bucket] = CD_HASH_NULL_ENTRY;
+        }
+        hash->entryCount = 0;
+        return ret;
+    }
+
+    /**
+     * @brief 计算点所在的栅格坐标
+     * @param hash 空间哈希
+     * @param point 点
+     * @param cell_x 栅格坐标x
+     * @param cell_y 栅格坐标y
+     * @return ok / 参数异常 / 坐标为 NaN 或栅格坐标超过 CD_HASH_CELL_LIMIT
+     */
+    CD_INLINE CD_RET cd_spatial_hash_cell(const CD_SPATIAL_HASH *hash, const CD_VEC2 *point, CD_S32 *cell_x, CD_S32 *cell_y)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(hash == CD_NULL || point == CD_NULL || cell_x == CD_NULL || cell_y == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_F32 fx = floorf(point->x * hash->invCellSize);
+        const CD_F32 fy = floorf(point->y * hash->invCellSize);
+        // 取反的比较使 NaN 也被拒绝,超出范围的浮点数转换为整数是未定义行为
+        CD_CHECK_ERROR(!(CD_FABS(fx) <= CD_HASH_CELL_LIMIT && CD_FABS(fy) <= CD_HASH_CELL_LIMIT), COLLISION_DETECTION_E_CALC_ERROR);
+        *cell_x = (CD_S32)fx;
+        *cell_y = (CD_S32)fy;
+        return ret;
+    }
+
+    /**
+     * @brief 按aabb将障碍物插入其覆盖的所有栅格
+     * @param hash 空间哈希
+     * @param aabb 障碍物的aabb
+     * @param id 障碍物id,范围 [0, idCapacity)
+     * @return ok / 参数异常 / 坐标为 NaN 或超出范围 / 容量已满
+     */
+    CD_INLINE CD_RET cd_spatial_hash_insert_aabb(CD_SPATIAL_HASH *hash, const CD_AABB *aabb, CD_S32 id)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(hash == CD_NULL || aabb == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(id < 0 || id >= hash->idCapacity, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_S32 x0, y0, x1, y1;
+        ret = cd_spatial_hash_cell(hash, &aabb->lowerBound, &x0, &y0);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = cd_spatial_hash_cell(hash, &aabb->upperBound, &x1, &y1);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        // 覆盖的栅格数可能超过 CD_S32,在 CD_S64 中计算后再与剩余容量比较
+        const CD_S64 span = (CD_S64)CD_MAX(x1 - x0 + 1, 0) * (CD_S64)CD_MAX(y1 - y0 + 1, 0);
+        CD_CHECK_ERROR(span > (CD_S64)(hash->entryCapacity - hash->entryCount), COLLISION_DETECTION_E_MEM_FULL);
+        for (CD_S32 y = y0; y <= y1; ++y)
+        {
+            for (CD_S32 x = x0; x <= x1; ++x)
+            {
+                CD_U32 bucket;
+                ret = cd_spatial_hash_bucket(hash, x, y, &bucket);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                CD_HASH_ENTRY *entry = hash->entries + hash->entryCount;
+                entry->cellX = x;
+                entry->cellY = y;
+                entry->id = id;
+                entry->next = hash->buckets[bucket];
+                hash->buckets[bucket] = hash->entryCount;
+                hash->entryCount += 1;
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 插入圆形障碍物
+     * @param hash 空间哈希
+     * @param circle 圆
+     * @param id 障碍物id
+     * @return ok / 参数异常 / 容量已满
+     */
+    CD_INLINE CD_RET cd_spatial_hash_insert_circle(CD_SPATIAL_HASH *hash, const CD_CIRCLE *circle, CD_S32 id)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(hash == CD_NULL || circle == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_AABB aabb;
+        ret = cd_circle_to_aabb(circle, &aabb);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        return cd_spatial_hash_insert_aabb(hash, &aabb, id);
+    }
+
+    /**
+     * @brief 插入obb障碍物
+     * @param hash 空间哈希
+     * @param obb obb
+     * @param id 障碍物id
+     * @return ok / 参数异常 / 容量已满
+     */
+    CD_INLINE CD_RET cd_spatial_hash_insert_obb(CD_SPATIAL_HASH *hash, const CD_OBB *obb, CD_S32 id)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(hash == CD_NULL || obb == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_AABB aabb;
+        ret = cd_obb_to_aabb(obb, &aabb);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        return cd_spatial_hash_insert_aabb(hash, &aabb, id);
+    }
+
+    /**
+     * @brief 插入多边形障碍物
+     * @param hash 空间哈希
+     * @param polygon 多边形
+     * @param id 障碍物id
+     * @return ok / 参数异常 / 容量已满
+     */
+    CD_INLINE CD_RET cd_spatial_hash_insert_polygon(CD_SPATIAL_HASH *hash, const CD_POLYGON *polygon, CD_S32 id)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(hash == CD_NULL || polygon == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_AABB aabb;
+        ret = cd_polygon_to_aabb(polygon, &aabb);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        return cd_spatial_hash_insert_aabb(hash, &aabb, id);
+    }
+
+    /**
+     * @brief 表项未被本次查询记录过时输出其id,无参数检查
+     * @param hash 空间哈希
+     * @param entry 表项
+     * @param stamp 本次查询序号
+     * @param result_ids 输出的候选id
+     * @param capacity result_ids 的容量
+     * @param result_count 输出的候选id数量
+     * @return ok / 结果超过容量
+     */
+    CD_INLINE CD_RET cd_spatial_hash_emit_v(CD_SPATIAL_HASH *hash, const CD_HASH_ENTRY *entry, CD_U32 stamp,
+                                            CD_S32 *result_ids, CD_S32 capacity, CD_S32 *result_count)
+    {
+        if (hash->stamps[entry->id] == stamp)
+        {
+            return CD_RET_OK;
+        }
+        hash->stamps[entry->id] = stamp;
+        CD_CHECK_ERROR(*result_count >= capacity, COLLISION_DETECTION_E_MEM_FULL);
+        result_ids[*result_count] = entry->id;
+        *result_count += 1;
+        return CD_RET_OK;
+    }
+
+    /**
+     * @brief 查询与aabb覆盖的栅格中的障碍物id,结果不重复
+     *        覆盖的栅格数多于已插入的表项数时改为逐个检查表项的栅格坐标,
+     *        因此查询的开销不超过 O(min(栅格数, 表项数)),超大的aabb也不会长时间循环
+     * @param hash 空间哈希
+     * @param aabb 查询的aabb
+     * @param result_ids 输出的候选id
+     * @param capacity result_ids 的容量
+     * @param result_count 输出的候选id数量
+     * @return ok / 参数异常 / 坐标为 NaN 或超出范围 / 结果超过容量(已输出前 capacity 个)
+     */
+    CD_INLINE CD_RET cd_spatial_hash_query(CD_SPATIAL_HASH *hash, const CD_AABB *aabb,
+                                           CD_S32 *result_ids, CD_S32 capacity, CD_S32 *result_count)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(hash == CD_NULL || aabb == CD_NULL || result_ids == CD_NULL || result_count == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result_count = 0;
+        hash->queryStamp += 1;
+        if (hash->queryStamp == 0)
+        {
+            // 查询序号回绕,重置去重数组
+            for (CD_S32 i = 0; i < hash->idCapacity; ++i)
+            {
+                hash->stamps[i] = 0;
+            }
+            hash->queryStamp = 1;
+        }
+        const CD_U32 stamp = hash->queryStamp;
+        CD_S32 x0, y0, x1, y1;
+        ret = cd_spatial_hash_cell(hash, &aabb->lowerBound, &x0, &y0);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = cd_spatial_hash_cell(hash, &aabb->upperBound, &x1, &y1);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+
+        const CD_S64 span = (CD_S64)CD_MAX(x1 - x0 + 1, 0) * (CD_S64)CD_MAX(y1 - y0 + 1, 0);
+        if (span > (CD_S64)hash->entryCount)
+        {
+            for (CD_S32 i = 0; i < hash->entryCount; ++i)
+            {
+                const CD_HASH_ENTRY *entry = hash->entries + i;
+                if (entry->cellX < x0 || entry->cellX > x1 || entry->cellY < y0 || entry->cellY > y1)
+                {
+                    continue;
+                }
+                ret = cd_spatial_hash_emit_v(hash, entry, stamp, result_ids, capacity, result_count);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            }
+            return ret;
+        }
+
+        for (CD_S32 y = y0; y <= y1; ++y)
+        {
+            for (CD_S32 x = x0; x <= x1; ++x)
+            {
+                CD_U32 bucket;
+                ret = cd_spatial_hash_bucket(hash, x, y, &bucket);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                CD_S32 index = hash->buckets[bucket];
+                while (index != CD_HASH_NULL_ENTRY)
+                {
+                    const CD_HASH_ENTRY *entry = hash->entries + index;
+                    index = entry->next;
+                    // 不同栅格可能哈希到同一个桶
+                    if (entry->cellX != x || entry->cellY != y)
+                    {
+                        continue;
+                    }
+                    ret = cd_spatial_hash_emit_v(hash, entry, stamp, result_ids, capacity, result_count);
+                    CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                }
+            }
+        }
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __COLLISION_DETECTION_SPATIAL_HASH_H__ */
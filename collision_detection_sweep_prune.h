@@ -0,0 +1,551 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-16 10:47:19
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-16 10:47:19
+ */
+
+#ifndef __COLLISION_DETECTION_SWEEP_PRUNE_H__
+#define __COLLISION_DETECTION_SWEEP_PRUNE_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_aabb.h"
+#include "collision_detection_allocator.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CD_SAP_NULL_PROXY (-1) // 空代理
+
+    // 端点,data 低位为1表示最大值端点,其余位为代理索引
+    typedef struct _CD_SAP_ENDPOINT_
+    {
+        CD_F32 value; // 端点坐标
+        CD_S32 data;  // (proxyId << 1) | is_max
+    } CD_SAP_ENDPOINT;
+
+    // 代理
+    typedef struct _CD_SAP_PROXY_
+    {
+        CD_AABB aabb;        // 当前aabb
+        CD_S32 minIndex[2];  // x/y 轴上最小值端点的下标
+        CD_S32 maxIndex[2];  // x/y 轴上最大值端点的下标
+        CD_S32 userData;     // 用户数据,空闲时为空闲链表的下一个代理
+        CD_BOOL active;      // 是否在使用
+    } CD_SAP_PROXY;
+
+    // 重叠对,proxyA < proxyB,空槽位的 proxyA 为 CD_SAP_NULL_PROXY
+    typedef struct _CD_SAP_PAIR_
+    {
+        CD_S32 proxyA;
+        CD_S32 proxyB;
+    } CD_SAP_PAIR;
+
+    /**
+     * @brief 重叠对变化回调
+     * @param userDataA 代理A的用户数据
+     * @param userDataB 代理B的用户数据
+     * @param added 1 新增重叠对, 0 移除重叠对
+     * @param context 调用者上下文
+     */
+    typedef CD_VOID (*CD_SAP_PAIR_CALLBACK)(CD_S32 userDataA, CD_S32 userDataB, CD_BOOL added, CD_VOID *context);
+
+    // 增量式扫描剪枝,所有内存由调用者预先分配
+    typedef struct _CD_SWEEP_PRUNE_
+    {
+        CD_SAP_PROXY *proxies;          // 代理池
+        CD_S32 proxyCapacity;           // 代理池容量
+        CD_S32 proxyCount;              // 使用中的代理数
+        CD_S32 freeList;                // 空闲代理链表表头
+        CD_SAP_ENDPOINT *endpoints[2];  // x/y 轴上按坐标排序的端点,容量为 2 * proxyCapacity
+        CD_SAP_PAIR *pairs;             // 重叠对哈希表(线性探测)
+        CD_U32 pairMask;                // 哈希表容量 - 1,容量必须是2的幂
+        CD_S32 pairCount;               // 重叠对数量
+        CD_SAP_PAIR_CALLBACK callback;  // 重叠对变化回调,可为null
+        CD_VOID *context;               // 回调上下文
+    } CD_SWEEP_PRUNE;
+
+    /**
+     * @brief 初始化扫描剪枝
+     * @param sap 扫描剪枝
+     * @param proxies 代理池
+     * @param proxyCapacity 代理池容量
+     * @param endpointsX x轴端点数组,长度为 2 * proxyCapacity
+     * @param endpointsY y轴端点数组,长度为 2 * proxyCapacity
+     * @param pairs 重叠对哈希表
+     * @param pairCapacity 哈希表容量,必须是2的幂
+     * @param callback 重叠对变化回调,可为null
+     * @param context 回调上下文,可为null
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_sap_init(CD_SWEEP_PRUNE *sap, CD_SAP_PROXY *proxies, CD_S32 proxyCapacity,
+                                 CD_SAP_ENDPOINT *endpointsX, CD_SAP_ENDPOINT *endpointsY,
+                                 CD_SAP_PAIR *pairs, CD_S32 pairCapacity,
+                                 CD_SAP_PAIR_CALLBACK callback, CD_VOID *context)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(sap == CD_NULL || proxies == CD_NULL || endpointsX == CD_NULL || endpointsY == CD_NULL || pairs == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(proxyCapacity <= 0 || pairCapacity <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        CD_CHECK_ERROR((pairCapacity & (pairCapacity - 1)) != 0, COLLISION_DETECTION_E_MEM_ALIGN);
+        sap->proxies = proxies;
+        sap->proxyCapacity = proxyCapacity;
+        sap->proxyCount = 0;
+        sap->endpoints[0] = endpointsX;
+        sap->endpoints[1] = endpointsY;
+        sap->pairs = pairs;
+        sap->pairMask = (CD_U32)pairCapacity - 1;
+        sap->pairCount = 0;
+        sap->callback = callback;
+        sap->context = context;
+        for (CD_S32 i = 0; i < proxyCapacity; ++i)
+        {
+            proxies[i].userData = i + 1 < proxyCapacity ? i + 1 : CD_SAP_NULL_PROXY;
+            proxies[i].active = CD_FALSE;
+        }
+        sap->freeList = 0;
+        for (CD_S32 i = 0; i < pairCapacity; ++i)
+        {
+            pairs[i].proxyA = CD_SAP_NULL_PROXY;
+            pairs[i].proxyB = CD_SAP_NULL_PROXY;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 在线性分配器上分配代理池、端点数组与重叠对哈希表并初始化扫描剪枝
+     * @param sap 扫描剪枝
+     * @param arena 线性分配器
+     * @param proxyCapacity 代理池容量
+     * @param pairCapacity 哈希表容量,必须是2的幂
+     * @param callback 重叠对变化回调,可为null
+     * @param context 回调上下文,可为null
+     * @return ok / 参数异常 / 哈希表容量不是2的幂 / 线性分配器容量不足
+     */
+    CD_INLINE CD_RET cd_sap_init_from_arena(CD_SWEEP_PRUNE *sap, CD_ARENA *arena, CD_S32 proxyCapacity, CD_S32 pairCapacity,
+                                            CD_SAP_PAIR_CALLBACK callback, CD_VOID *context)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(sap == CD_NULL || arena == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(proxyCapacity <= 0 || pairCapacity <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        CD_SAP_PROXY *proxies = CD_NULL;
+        CD_SAP_ENDPOINT *endpoints_x = CD_NULL;
+        CD_SAP_ENDPOINT *endpoints_y = CD_NULL;
+        CD_SAP_PAIR *pairs = CD_NULL;
+        ret = CD_ARENA_ALLOC_ARRAY(arena, CD_SAP_PROXY, proxyCapacity, &proxies);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = CD_ARENA_ALLOC_ARRAY(arena, CD_SAP_ENDPOINT, 2 * proxyCapacity, &endpoints_x);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = CD_ARENA_ALLOC_ARRAY(arena, CD_SAP_ENDPOINT, 2 * proxyCapacity, &endpoints_y);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = CD_ARENA_ALLOC_ARRAY(arena, CD_SAP_PAIR, pairCapacity, &pairs);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        return cd_sap_init(sap, proxies, proxyCapacity, endpoints_x, endpoints_y, pairs, pairCapacity, callback, context);
+    }
+
+    /**
+     * @brief 计算重叠对在哈希表中的起始槽位
+     * @param sap 扫描剪枝
+     * @param proxy_a 代理A,需小于代理B
+     * @param proxy_b 代理B
+     * @param result 槽位
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_sap_pair_slot(const CD_SWEEP_PRUNE *sap, CD_S32 proxy_a, CD_S32 proxy_b, CD_U32 *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(sap == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_U32 key = ((CD_U32)proxy_a * 73856093u) ^ ((CD_U32)proxy_b * 19349663u);
+        *result = key & sap->pairMask;
+        return ret;
+    }
+
+    /**
+     * @brief 新增重叠对,已存在时不做处理
+     * @param sap 扫描剪枝
+     * @param proxy_a 代理A
+     * @param proxy_b 代理B
+     * @return ok / 参数异常 / 哈希表已满
+     */
+    CD_INLINE CD_RET cd_sap_add_pair(CD_SWEEP_PRUNE *sap, CD_S32 proxy_a, CD_S32 proxy_b)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(sap == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_S32 a = CD_MIN(proxy_a, proxy_b);
+        const CD_S32 b = CD_MAX(proxy_a, proxy_b);
+        CD_U32 slot;
+        ret = cd_sap_pair_slot(sap, a, b, &slot);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        while (sap->pairs[slot].proxyA != CD_SAP_NULL_PROXY)
+        {
+            if (sap->pairs[slot].proxyA == a && sap->pairs[slot].proxyB == b)
+            {
+                return ret;
+            }
+            slot = (slot + 1) & sap->pairMask;
+        }
+        // 保留一个空槽位,保证探测能够终止
+        CD_CHECK_ERROR((CD_U32)sap->pairCount + 1 > sap->pairMask, COLLISION_DETECTION_E_MEM_FULL);
+        sap->pairs[slot].proxyA = a;
+        sap->pairs[slot].proxyB = b;
+        sap->pairCount += 1;
+        if (sap->callback != CD_NULL)
+        {
+            sap->callback(sap->proxies[a].userData, sap->proxies[b].userData, CD_TRUE, sap->context);
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 移除重叠对,不存在时不做处理
+     * @param sap 扫描剪枝
+     * @param proxy_a 代理A
+     * @param proxy_b 代理B
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_sap_remove_pair(CD_SWEEP_PRUNE *sap, CD_S32 proxy_a, CD_S32 proxy_b)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(sap == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        const CD_S32 a = CD_MIN(proxy_a, proxy_b);
+        const CD_S32 b = CD_MAX(proxy_a, proxy_b);
+        CD_U32 slot;
+        ret = cd_sap_pair_slot(sap, a, b, &slot);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        while (sap->pairs[slot].proxyA != CD_SAP_NULL_PROXY)
+        {
+            if (sap->pairs[slot].proxyA == a && sap->pairs[slot].proxyB == b)
+            {
+                break;
+            }
+            slot = (slot + 1) & sap->pairMask;
+        }
+        if (sap->pairs[slot].proxyA == CD_SAP_NULL_PROXY)
+        {
+            return ret;
+        }
+
+        // 向后移位删除,保持线性探测链完整
+        CD_U32 hole = slot;
+        CD_U32 next = (hole + 1) & sap->pairMask;
+        while (sap->pairs[next].proxyA != CD_SAP_NULL_PROXY)
+        {
+            CD_U32 home;
+            ret = cd_sap_pair_slot(sap, sap->pairs[next].proxyA, sap->pairs[next].proxyB, &home);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            // home 不在 (hole, next] 区间内时可以移入空洞
+            if (((next - home) & sap->pairMask) >= ((next - hole) & sap->pairMask))
+            {
+                sap->pairs[hole] = sap->pairs[next];
+                hole = next;
+            }
+            next = (next + 1) & sap->pairMask;
+        }
+        sap->pairs[hole].proxyA = CD_SAP_NULL_PROXY;
+        sap->pairs[hole].proxyB = CD_SAP_NULL_PROXY;
+        sap->pairCount -= 1;
+        if (sap->callback != CD_NULL)
+        {
+            sap->callback(sap->proxies[a].userData, sap->proxies[b].userData, CD_FALSE, sap->context);
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 交换同一轴上相邻的两个端点,并更新代理中的端点下标
+     * @param sap 扫描剪枝
+     * @param axis 0 x轴, 1 y轴
+     * @param i 端点下标
+     * @param j 端点下标
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_sap_swap_endpoints(CD_SWEEP_PRUNE *sap, CD_S32 axis, CD_S32 i, CD_S32 j)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(sap == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_SAP_ENDPOINT *endpoints = sap->endpoints[axis];
+        const CD_SAP_ENDPOINT tmp = endpoints[i];
+        endpoints[i] = endpoints[j];
+        endpoints[j] = tmp;
+        CD_SAP_PROXY *proxy_i = sap->proxies + (endpoints[i].data >> 1);
+        CD_SAP_PROXY *proxy_j = sap->proxies + (endpoints[j].data >> 1);
+        if (endpoints[i].data & 1)
+        {
+            proxy_i->maxIndex[axis] = i;
+        }
+        else
+        {
+            proxy_i->minIndex[axis] = i;
+        }
+        if (endpoints[j].data & 1)
+        {
+            proxy_j->maxIndex[axis] = j;
+        }
+        else
+        {
+            proxy_j->minIndex[axis] = j;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 端点 a 是否应排在端点 b 之后;坐标相同时最小值端点排在最大值端点之前,
+     *        使边界接触的两个区间也按重叠处理,与 cd_aabb_overlap 一致
+     */
+    CD_INLINE CD_BOOL cd_sap_endpoint_after_v(CD_SAP_ENDPOINT a, CD_SAP_ENDPOINT b)
+    {
+        return a.value > b.value || (a.value == b.value && (a.data & 1) && !(b.data & 1));
+    }
+
+    /**
+     * @brief 插入排序移动一个端点,跨过其他代理的端点时更新重叠对
+     *        最小值端点向左跨过最大值端点、最大值端点向右跨过最小值端点时开始重叠,
+     *        反方向跨过时结束重叠
+     *        哈希表已满时仍完成排序,保持端点顺序与代理下标一致,放不下的重叠对被丢弃,最后返回哈希表已满
+     * @param sap 扫描剪枝
+     * @param axis 0 x轴, 1 y轴
+     * @param index 端点下标
+     * @return ok / 参数异常 / 哈希表已满
+     */
+    CD_INLINE CD_RET cd_sap_sort_endpoint(CD_SWEEP_PRUNE *sap, CD_S32 axis, CD_S32 index)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(sap == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_SAP_ENDPOINT *endpoints = sap->endpoints[axis];
+        const CD_S32 count = 2 * sap->proxyCount;
+        const CD_S32 proxy_id = endpoints[index].data >> 1;
+        const CD_S32 is_max = endpoints[index].data & 1;
+        CD_RET full = CD_RET_OK;
+
+        // 向左移动
+        while (index > 0 && cd_sap_endpoint_after_v(endpoints[index - 1], endpoints[index]))
+        {
+            const CD_S32 other_id = endpoints[index - 1].data >> 1;
+            const CD_S32 other_is_max = endpoints[index - 1].data & 1;
+            if (other_id != proxy_id && other_is_max != is_max)
+            {
+                if (is_max)
+                {
+                    ret = cd_sap_remove_pair(sap, proxy_id, other_id);
+                    CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                }
+                else
+                {
+                    CD_BOOL overlap;
+                    ret = cd_aabb_overlap(&sap->proxies[proxy_id].aabb, &sap->proxies[other_id].aabb, &overlap);
+                    CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                    if (overlap)
+                    {
+                        ret = cd_sap_add_pair(sap, proxy_id, other_id);
+                        if (ret == COLLISION_DETECTION_E_MEM_FULL)
+                        {
+                            full = ret;
+                            ret = CD_RET_OK;
+                        }
+                        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                    }
+                }
+            }
+            ret = cd_sap_swap_endpoints(sap, axis, index - 1, index);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            index -= 1;
+        }
+
+        // 向右移动
+        while (index + 1 < count && cd_sap_endpoint_after_v(endpoints[index], endpoints[index + 1]))
+        {
+            const CD_S32 other_id = endpoints[index + 1].data >> 1;
+            const CD_S32 other_is_max = endpoints[index + 1].data & 1;
+            if (other_id != proxy_id && other_is_max != is_max)
+            {
+                if (is_max)
+                {
+                    CD_BOOL overlap;
+                    ret = cd_aabb_overlap(&sap->proxies[proxy_id].aabb, &sap->proxies[other_id].aabb, &overlap);
+                    CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                    if (overlap)
+                    {
+                        ret = cd_sap_add_pair(sap, proxy_id, other_id);
+                        if (ret == COLLISION_DETECTION_E_MEM_FULL)
+                        {
+                            full = ret;
+                            ret = CD_RET_OK;
+                        }
+                        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                    }
+                }
+                else
+                {
+                    ret = cd_sap_remove_pair(sap, proxy_id, other_id);
+                    CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+                }
+            }
+            ret = cd_sap_swap_endpoints(sap, axis, index, index + 1);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            index += 1;
+        }
+        return full;
+    }
+
+    /**
+     * @brief 更新代理的aabb并重新排序端点,代价与移动量成正比
+     *        哈希表已满时端点仍全部排好,只是放不下的重叠对没有记录
+     * @param sap 扫描剪枝
+     * @param proxyId 代理索引
+     * @param aabb 新的aabb
+     * @return ok / 参数异常 / 哈希表已满
+     */
+    CD_INLINE CD_RET cd_sap_move_proxy(CD_SWEEP_PRUNE *sap, CD_S32 proxyId, const CD_AABB *aabb)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(sap == CD_NULL || aabb == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(proxyId < 0 || proxyId >= sap->proxyCapacity || !sap->proxies[proxyId].active, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_SAP_PROXY *proxy = sap->proxies + proxyId;
+        proxy->aabb = *aabb;
+        const CD_F32 lower[2] = {aabb->lowerBound.x, aabb->lowerBound.y};
+        const CD_F32 upper[2] = {aabb->upperBound.x, aabb->upperBound.y};
+        CD_RET full = CD_RET_OK;
+        for (CD_S32 axis = 0; axis < 2; ++axis)
+        {
+            CD_SAP_ENDPOINT *endpoints = sap->endpoints[axis];
+            const CD_BOOL min_down = lower[axis] < endpoints[proxy->minIndex[axis]].value;
+            endpoints[proxy->minIndex[axis]].value = lower[axis];
+            endpoints[proxy->maxIndex[axis]].value = upper[axis];
+            // 先移动运动方向前方的端点,避免最小值端点跨过自身的最大值端点
+            const CD_S32 first = min_down ? proxy->minIndex[axis] : proxy->maxIndex[axis];
+            ret = cd_sap_sort_endpoint(sap, axis, first);
+            if (ret == COLLISION_DETECTION_E_MEM_FULL)
+            {
+                full = ret;
+                ret = CD_RET_OK;
+            }
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            const CD_S32 second = min_down ? proxy->maxIndex[axis] : proxy->minIndex[axis];
+            ret = cd_sap_sort_endpoint(sap, axis, second);
+            if (ret == COLLISION_DETECTION_E_MEM_FULL)
+            {
+                full = ret;
+                ret = CD_RET_OK;
+            }
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        }
+        return full;
+    }
+
+    /**
+     * @brief 新增代理,新产生的重叠对通过回调上报
+     * @param sap 扫描剪枝
+     * @param aabb 代理的aabb
+     * @param userData 用户数据
+     * @param result 代理索引,哈希表已满时代理仍已创建
+     * @return ok / 参数异常 / 容量已满 / 哈希表已满
+     */
+    CD_INLINE CD_RET cd_sap_create_proxy(CD_SWEEP_PRUNE *sap, const CD_AABB *aabb, CD_S32 userData, CD_S32 *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(sap == CD_NULL || aabb == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(sap->freeList == CD_SAP_NULL_PROXY, COLLISION_DETECTION_E_MEM_FULL);
+        const CD_S32 proxy_id = sap->freeList;
+        CD_SAP_PROXY *proxy = sap->proxies + proxy_id;
+        sap->freeList = proxy->userData;
+        proxy->userData = userData;
+        proxy->active = CD_TRUE;
+        proxy->aabb.lowerBound.x = CD_MAXABS_F;
+        proxy->aabb.lowerBound.y = CD_MAXABS_F;
+        proxy->aabb.upperBound = proxy->aabb.lowerBound;
+
+        // 端点先放在数组末尾的无穷远处,再按移动处理
+        const CD_S32 count = 2 * sap->proxyCount;
+        for (CD_S32 axis = 0; axis < 2; ++axis)
+        {
+            CD_SAP_ENDPOINT *endpoints = sap->endpoints[axis];
+            endpoints[count].value = CD_MAXABS_F;
+            endpoints[count].data = proxy_id << 1;
+            endpoints[count + 1].value = CD_MAXABS_F;
+            endpoints[count + 1].data = (proxy_id << 1) | 1;
+            proxy->minIndex[axis] = count;
+            proxy->maxIndex[axis] = count + 1;
+        }
+        sap->proxyCount += 1;
+        ret = cd_sap_move_proxy(sap, proxy_id, aabb);
+        CD_CHECK_ERROR(ret != CD_RET_OK && ret != COLLISION_DETECTION_E_MEM_FULL, ret);
+        *result = proxy_id;
+        return ret;
+    }
+
+    /**
+     * @brief 删除代理,其所有重叠对通过回调上报移除
+     * @param sap 扫描剪枝
+     * @param proxyId 代理索引
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_sap_destroy_proxy(CD_SWEEP_PRUNE *sap, CD_S32 proxyId)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(sap == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(proxyId < 0 || proxyId >= sap->proxyCapacity || !sap->proxies[proxyId].active, COLLISION_DETECTION_E_PARAM_NULL);
+        // 移动到无穷远处,移除所有重叠对,端点随之排到数组末尾
+        CD_AABB far_aabb;
+        far_aabb.lowerBound.x = CD_MAXABS_F;
+        far_aabb.lowerBound.y = CD_MAXABS_F;
+        far_aabb.upperBound = far_aabb.lowerBound;
+        ret = cd_sap_move_proxy(sap, proxyId, &far_aabb);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+
+        // 末尾可能还有其他在无穷远处的端点,把本代理的端点交换到最后
+        const CD_S32 last = 2 * sap->proxyCount - 1;
+        CD_SAP_PROXY *proxy = sap->proxies + proxyId;
+        for (CD_S32 axis = 0; axis < 2; ++axis)
+        {
+            if (proxy->maxIndex[axis] != last)
+            {
+                ret = cd_sap_swap_endpoints(sap, axis, proxy->maxIndex[axis], last);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            }
+            if (proxy->minIndex[axis] != last - 1)
+            {
+                ret = cd_sap_swap_endpoints(sap, axis, proxy->minIndex[axis], last - 1);
+                CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            }
+        }
+        sap->proxyCount -= 1;
+        proxy->active = CD_FALSE;
+        proxy->userData = sap->freeList;
+        sap->freeList = proxyId;
+        return ret;
+    }
+
+    /**
+     * @brief 获取当前所有的重叠对
+     * @param sap 扫描剪枝
+     * @param result 输出的重叠对
+     * @param capacity result 的容量
+     * @param result_count 输出的重叠对数量
+     * @return ok / 参数异常 / 结果超过容量(已输出前 capacity 个)
+     */
+    CD_INLINE CD_RET cd_sap_get_pairs(const CD_SWEEP_PRUNE *sap, CD_SAP_PAIR *result, CD_S32 capacity, CD_S32 *result_count)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(sap == CD_NULL || result == CD_NULL || result_count == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result_count = 0;
+        for (CD_U32 i = 0; i <= sap->pairMask; ++i)
+        {
+            if (sap->pairs[i].proxyA == CD_SAP_NULL_PROXY)
+            {
+                continue;
+            }
+            CD_CHECK_ERROR(*result_count >= capacity, COLLISION_DETECTION_E_MEM_FULL);
+            result[*result_count] = sap->pairs[i];
+            *result_count += 1;
+        }
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __COLLISION_DETECTION_SWEEP_PRUNE_H__ */
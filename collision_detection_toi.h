@@ -0,0 +1,205 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-16 16:20:11
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-16 16:20:11
+ */
+
+#ifndef __COLLISION_DETECTION_TOI_H__
+#define __COLLISION_DETECTION_TOI_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_vec2.h"
+#include "collision_detection_transform.h"
+#include "collision_detection_distance.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CD_TOI_MAX_ITERS 32 // 保守前进默认最大迭代次数
+
+#define CD_TOI_STATE_FAILED 0     // 迭代次数用完仍未收敛,t 为最后一次计算距离的时刻,是保守的下界
+#define CD_TOI_STATE_OVERLAPPED 1 // 起始时刻已经接触或重叠
+#define CD_TOI_STATE_HIT 2        // 在 [0, tMax] 内首次接触
+#define CD_TOI_STATE_SEPARATED 3  // 在 [0, tMax] 内不会接触
+
+    // 形状在一个时间步内的运动: 绕局部旋转中心以恒定角速度旋转,同时旋转中心匀速平移
+    typedef struct _CD_SWEEP_
+    {
+        CD_TRANSFORM transform; ///< t = 0 时的位姿
+        CD_VEC2 localCenter;    ///< 旋转中心,形状局部坐标系
+        CD_VEC2 velocity;       ///< 旋转中心的线速度
+        CD_F32 angularVelocity; ///< 角速度(弧度/单位时间)
+    } CD_SWEEP;
+
+    typedef struct _CD_TOI_INPUT_
+    {
+        CD_DISTANCE_PROXY proxyA; ///< 形状A的点集
+        CD_DISTANCE_PROXY proxyB; ///< 形状B的点集
+        CD_SWEEP sweepA;          ///< 形状A的运动
+        CD_SWEEP sweepB;          ///< 形状B的运动
+        CD_F32 tMax;              ///< 时间区间上限,与速度使用同一时间单位
+        CD_F32 tolerance;         ///< 距离容差,间距小于该值即视为接触
+        CD_S32 maxIterations;     ///< 最大迭代次数,<= 0 时使用 CD_TOI_MAX_ITERS
+    } CD_TOI_INPUT;
+
+    typedef struct _CD_TOI_OUTPUT_
+    {
+        CD_S32 state;      ///< CD_TOI_STATE_*
+        CD_F32 t;          ///< 首次接触时刻;未接触时为 tMax
+        CD_VEC2 normal;    ///< t 时刻由A指向B的单位法向,重叠时为零向量
+        CD_VEC2 point;     ///< t 时刻两形状最近点的中点
+        CD_F32 distance;   ///< t 时刻的间距(已减去两个点集的半径)
+        CD_S32 iterations; ///< 距离计算次数
+    } CD_TOI_OUTPUT;
+
+    /**
+     * @brief 计算运动形状在 t 时刻的位姿,无参数检查
+     *        旋转按 cd_rot_integrate_angle 的方式积分,实际转角 atan(w*t) 不超过 |w|*t
+     * @param sweep 运动
+     * @param t 时刻
+     * @return t 时刻的位姿
+     */
+    CD_INLINE CD_TRANSFORM cd_sweep_transform_v(CD_SWEEP sweep, CD_F32 t)
+    {
+        const CD_VEC2 c0 = cd_transforms_point_v(sweep.transform, sweep.localCenter);
+        CD_TRANSFORM xf;
+        xf.q = cd_rot_integrate_angle_v(sweep.transform.q, sweep.angularVelocity * t);
+        const CD_VEC2 c = cd_vec2_mul_add_v(c0, t, sweep.velocity);
+        xf.p = cd_vec2_sub_v(c, cd_rot_vector_v(xf.q, sweep.localCenter));
+        return xf;
+    }
+
+    /**
+     * @brief 计算运动形状在 t 时刻的位姿
+     * @param sweep 运动
+     * @param t 时刻
+     * @param result t 时刻的位姿
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_sweep_transform(const CD_SWEEP *sweep, CD_F32 t, CD_TRANSFORM *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(sweep == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_sweep_transform_v(*sweep, t);
+        return ret;
+    }
+
+    /**
+     * @brief 点集到旋转中心的最大距离,无参数检查
+     * @param proxy 点集
+     * @param localCenter 旋转中心,局部坐标系
+     * @return 最大距离
+     */
+    CD_INLINE CD_F32 cd_proxy_max_extent_v(const CD_DISTANCE_PROXY *proxy, CD_VEC2 localCenter)
+    {
+        CD_F32 max_sqr = 0.0f;
+        for (CD_S32 i = 0; i < proxy->count; ++i)
+        {
+            max_sqr = CD_MAX(max_sqr, cd_vec2_dis_sqr_v(proxy->points[i], localCenter));
+        }
+        return sqrtf(max_sqr);
+    }
+
+    /**
+     * @brief 保守前进法计算两个运动凸形状的首次接触时刻
+     *        每次迭代用 GJK 求当前间距 d 与法向 n,沿 n 的接近速度上界为
+     *        (vA - vB)·n + |wA|*rA + |wB|*rB,按 d / 上界 前进,保证不会越过接触时刻;
+     *        GJK 单纯形在迭代间热启动
+     * @param input 两个形状的点集、运动与求解参数
+     * @param output 接触状态、时刻、法向与接触点
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_time_of_impact(const CD_TOI_INPUT *input, CD_TOI_OUTPUT *output)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(input == CD_NULL || output == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(input->proxyA.count <= 0 || input->proxyB.count <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+
+        const CD_SWEEP sweep_a = input->sweepA;
+        const CD_SWEEP sweep_b = input->sweepB;
+        const CD_F32 t_max = CD_MAX(input->tMax, 0.0f);
+        const CD_F32 tolerance = CD_MAX(input->tolerance, CD_EPS);
+        const CD_S32 max_iters = input->maxIterations > 0 ? input->maxIterations : CD_TOI_MAX_ITERS;
+        const CD_F32 total_radius = input->proxyA.radius + input->proxyB.radius;
+
+        // 旋转带来的最大点速度
+        const CD_F32 angular_bound = CD_FABS(sweep_a.angularVelocity) * cd_proxy_max_extent_v(&input->proxyA, sweep_a.localCenter) +
+                                     CD_FABS(sweep_b.angularVelocity) * cd_proxy_max_extent_v(&input->proxyB, sweep_b.localCenter);
+        const CD_VEC2 relative_velocity = cd_vec2_sub_v(sweep_a.velocity, sweep_b.velocity);
+
+        CD_DISTANCE_INPUT distance_input;
+        distance_input.proxyA = input->proxyA;
+        distance_input.proxyB = input->proxyB;
+        distance_input.useRadii = CD_FALSE;
+        CD_DISTANCE_CACHE cache = emptyDistanceCache;
+        CD_DISTANCE_OUTPUT distance_output;
+
+        output->state = CD_TOI_STATE_FAILED;
+        output->t = 0.0f;
+        output->normal = Vec2_Zero;
+        output->point = Vec2_Zero;
+        output->distance = 0.0f;
+        output->iterations = 0;
+
+        CD_F32 t = 0.0f;
+        for (CD_S32 iter = 0; iter < max_iters; ++iter)
+        {
+            distance_input.transformA = cd_sweep_transform_v(sweep_a, t);
+            distance_input.transformB = cd_sweep_transform_v(sweep_b, t);
+            ret = cd_shape_distance(&cache, &distance_input, CD_NULL, 0, &distance_output);
+            CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+            output->iterations += 1;
+
+            const CD_F32 separation = distance_output.distance - total_radius;
+            output->t = t;
+            output->distance = CD_MAX(separation, 0.0f);
+            output->point = cd_vec2_scale_v(cd_vec2_add_v(distance_output.pointA, distance_output.pointB), 0.5f);
+
+            // 核心形状重叠,无法给出法向
+            if (distance_output.distance < CD_EPS)
+            {
+                output->normal = Vec2_Zero;
+                output->state = iter == 0 ? CD_TOI_STATE_OVERLAPPED : CD_TOI_STATE_HIT;
+                return ret;
+            }
+
+            const CD_VEC2 normal = cd_vec2_scale_v(cd_vec2_sub_v(distance_output.pointB, distance_output.pointA),
+                                                   1.0f / distance_output.distance);
+            output->normal = normal;
+
+            if (separation < tolerance)
+            {
+                output->state = iter == 0 ? CD_TOI_STATE_OVERLAPPED : CD_TOI_STATE_HIT;
+                return ret;
+            }
+
+            // 沿法向的间距在整个区间上以该速率为下界递减,速率非正时永远不会接触
+            const CD_F32 approach_bound = cd_vec2_dot_v(relative_velocity, normal) + angular_bound;
+            if (approach_bound <= CD_EPS)
+            {
+                output->state = CD_TOI_STATE_SEPARATED;
+                output->t = t_max;
+                return ret;
+            }
+
+            // 前进到间距恰好剩下半个容差,避免在容差带外来回逼近
+            t += (separation - 0.5f * tolerance) / approach_bound;
+            if (t >= t_max)
+            {
+                output->state = CD_TOI_STATE_SEPARATED;
+                output->t = t_max;
+                return ret;
+            }
+        }
+        // 迭代用完: 输出保持最后一次距离计算时的 t、间距、法向与接触点,该 t 仍未越过接触时刻
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __COLLISION_DETECTION_TOI_H__ */
@@ -0,0 +1,361 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-16 15:02:37
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-16 15:02:37
+ */
+
+#ifndef __COLLISION_DETECTION_TRAJECTORY_H__
+#define __COLLISION_DETECTION_TRAJECTORY_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_vec2.h"
+#include "collision_detection_transform.h"
+#include "collision_detection_obb.h"
+#include "collision_detection_polygon.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CD_TRAJECTORY_CHUNK 256      // 一次处理的候选障碍物数量(栈上缓存)
+#define CD_TRAJECTORY_NO_HIT (-1)    // 无碰撞时输出的下标
+
+    // 通过胶囊体剔除的候选障碍物,以包围圆表示
+    typedef struct _CD_TRAJECTORY_CANDIDATES_
+    {
+        CD_S32 index[CD_TRAJECTORY_CHUNK]; // 障碍物下标
+        CD_F32 x[CD_TRAJECTORY_CHUNK];     // 包围圆中心x
+        CD_F32 y[CD_TRAJECTORY_CHUNK];     // 包围圆中心y
+        CD_F32 radius[CD_TRAJECTORY_CHUNK]; // 包围圆半径
+        CD_S32 count;                      // 候选数量
+    } CD_TRAJECTORY_CANDIDATES;
+
+    // 整条轨迹的包围胶囊体
+    typedef struct _CD_TRAJECTORY_CAPSULE_
+    {
+        CD_VEC2 point1; // 轴线起点,第一个位姿
+        CD_VEC2 point2; // 轴线终点,最后一个位姿
+        CD_F32 radius;  // 半径,覆盖所有位姿上的足迹
+    } CD_TRAJECTORY_CAPSULE;
+
+    /**
+     * @brief 将 x/y/heading 形式的位姿转换成旋转平移量,每个位姿只计算一次 sinf/cosf
+     * @param xs x坐标数组
+     * @param ys y坐标数组
+     * @param headings 朝向数组
+     * @param count 位姿数量
+     * @param result 旋转平移量数组,长度为 count
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_trajectory_poses_from_xyh(const CD_F32 *xs, const CD_F32 *ys, const CD_F32 *headings,
+                                                  CD_S32 count, CD_TRANSFORM *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(xs == CD_NULL || ys == CD_NULL || headings == CD_NULL || result == CD_NULL,
+                       COLLISION_DETECTION_E_PARAM_NULL);
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            result[i].p.x = xs[i];
+            result[i].p.y = ys[i];
+            result[i].q = cd_rot_from_angle_v(headings[i]);
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 点到线段距离的平方,无参数检查
+     * @param a 线段起点
+     * @param b 线段终点
+     * @param p 点
+     * @return 距离的平方
+     */
+    CD_INLINE CD_F32 cd_trajectory_dis_sqr_to_axis_v(CD_VEC2 a, CD_VEC2 b, CD_VEC2 p)
+    {
+        const CD_VEC2 d = cd_vec2_sub_v(b, a);
+        const CD_VEC2 ap = cd_vec2_sub_v(p, a);
+        const CD_F32 len_sqr = cd_vec2_len_sqr_v(d);
+        CD_F32 t = len_sqr > CD_EPS ? cd_vec2_dot_v(ap, d) / len_sqr : 0.0f;
+        t = CD_CLIP(t, 0.0f, 1.0f);
+        return cd_vec2_len_sqr_v(cd_vec2_mul_sub_v(ap, t, d));
+    }
+
+    /**
+     * @brief 计算覆盖整条轨迹的胶囊体,轴线为首尾位姿的连线
+     * @param poses 位姿数组
+     * @param pose_count 位姿数量
+     * @param footprint_radius 足迹相对位姿原点的包围半径
+     * @param result 胶囊体
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_trajectory_capsule(const CD_TRANSFORM *poses, CD_S32 pose_count, CD_F32 footprint_radius,
+                                           CD_TRAJECTORY_CAPSULE *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(poses == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(pose_count <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        result->point1 = poses[0].p;
+        result->point2 = poses[pose_count - 1].p;
+        CD_F32 max_dis_sqr = 0.0f;
+        for (CD_S32 i = 1; i + 1 < pose_count; ++i)
+        {
+            max_dis_sqr = CD_MAX(max_dis_sqr, cd_trajectory_dis_sqr_to_axis_v(result->point1, result->point2, poses[i].p));
+        }
+        result->radius = sqrtf(max_dis_sqr) + footprint_radius;
+        return ret;
+    }
+
+    /**
+     * @brief 求obb足迹相对位姿原点的包围半径
+     * @param footprint 车体坐标系下的obb足迹
+     * @return 包围半径
+     */
+    CD_INLINE CD_F32 cd_trajectory_obb_radius_v(CD_OBB footprint)
+    {
+        return cd_vec2_len_v(footprint.center) +
+               0.5f * sqrtf(footprint.length * footprint.length + footprint.width * footprint.width);
+    }
+
+    /**
+     * @brief 胶囊体剔除障碍物,把通过的障碍物追加到候选集中
+     * @param capsule 胶囊体
+     * @param obstacles 障碍物数组
+     * @param obstacle_count 障碍物数量
+     * @param start 从该下标开始剔除
+     * @param candidates 候选集,满 CD_TRAJECTORY_CHUNK 个时停止
+     * @return 下一次剔除的起始下标
+     */
+    CD_INLINE CD_S32 cd_trajectory_cull_v(const CD_TRAJECTORY_CAPSULE *capsule, const CD_OBB *obstacles,
+                                          CD_S32 obstacle_count, CD_S32 start, CD_TRAJECTORY_CANDIDATES *candidates)
+    {
+        // 胶囊体的aabb,先做廉价的坐标比较再计算到轴线的距离
+        const CD_F32 lower_x = CD_MIN(capsule->point1.x, capsule->point2.x) - capsule->radius;
+        const CD_F32 lower_y = CD_MIN(capsule->point1.y, capsule->point2.y) - capsule->radius;
+        const CD_F32 upper_x = CD_MAX(capsule->point1.x, capsule->point2.x) + capsule->radius;
+        const CD_F32 upper_y = CD_MAX(capsule->point1.y, capsule->point2.y) + capsule->radius;
+        CD_S32 j = start;
+        for (; j < obstacle_count && candidates->count < CD_TRAJECTORY_CHUNK; ++j)
+        {
+            const CD_OBB *obb = &obstacles[j];
+            // 半长 + 半宽 不小于半对角线,作为粗略的包围半径
+            const CD_F32 coarse = 0.5f * (obb->length + obb->width);
+            if (obb->center.x + coarse < lower_x || obb->center.x - coarse > upper_x ||
+                obb->center.y + coarse < lower_y || obb->center.y - coarse > upper_y)
+            {
+                continue;
+            }
+            const CD_F32 radius = 0.5f * sqrtf(obb->length * obb->length + obb->width * obb->width);
+            const CD_F32 reach = capsule->radius + radius;
+            if (cd_trajectory_dis_sqr_to_axis_v(capsule->point1, capsule->point2, obb->center) > reach * reach)
+            {
+                continue;
+            }
+            const CD_S32 k = candidates->count;
+            candidates->index[k] = j;
+            candidates->x[k] = obb->center.x;
+            candidates->y[k] = obb->center.y;
+            candidates->radius[k] = radius;
+            candidates->count = k + 1;
+        }
+        return j;
+    }
+
+    /**
+     * @brief 在 [0, *first_pose) 范围内检测obb足迹与候选障碍物,找到碰撞时缩小 *first_pose
+     * @param poses 位姿数组
+     * @param footprint 车体坐标系下的obb足迹
+     * @param footprint_radius 足迹相对位姿原点的包围半径
+     * @param obstacles 障碍物数组
+     * @param candidates 候选集
+     * @param first_pose 输入为待检测的位姿数量,输出为第一个碰撞位姿
+     * @param first_obstacle 与第一个碰撞位姿碰撞的障碍物
+     */
+    CD_INLINE CD_VOID cd_trajectory_check_obb_chunk_v(const CD_TRANSFORM *poses, CD_OBB footprint,
+                                                      CD_F32 footprint_radius, const CD_OBB *obstacles,
+                                                      const CD_TRAJECTORY_CANDIDATES *candidates,
+                                                      CD_S32 *first_pose, CD_S32 *first_obstacle)
+    {
+        const CD_S32 pose_count = *first_pose;
+        for (CD_S32 i = 0; i < pose_count; ++i)
+        {
+            // 足迹变换到世界坐标系,只用旋转量相乘,不重新计算三角函数
+            CD_OBB world = footprint;
+            world.center = cd_transforms_point_v(poses[i], footprint.center);
+            world.q = cd_rot_mul_v(poses[i].q, footprint.q);
+            const CD_F32 px = poses[i].p.x;
+            const CD_F32 py = poses[i].p.y;
+            for (CD_S32 k = 0; k < candidates->count; ++k)
+            {
+                const CD_F32 dx = candidates->x[k] - px;
+                const CD_F32 dy = candidates->y[k] - py;
+                const CD_F32 reach = footprint_radius + candidates->radius[k];
+                if (dx * dx + dy * dy > reach * reach)
+                {
+                    continue;
+                }
+                if (cd_obb_overlap_v(world, obstacles[candidates->index[k]]))
+                {
+                    *first_pose = i;
+                    *first_obstacle = candidates->index[k];
+                    return;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief 检测obb足迹沿轨迹运动时与obb障碍物的碰撞,输出第一个碰撞的位姿
+     *        先用整条轨迹的包围胶囊体剔除障碍物,再逐个位姿用包围圆和分离轴检测,找到碰撞立即返回
+     * @param poses 位姿数组,可由 cd_trajectory_poses_from_xyh 生成
+     * @param pose_count 位姿数量
+     * @param footprint 车体坐标系下的obb足迹
+     * @param obstacles 障碍物数组
+     * @param obstacle_count 障碍物数量
+     * @param result_pose 第一个碰撞位姿的下标,无碰撞时为 CD_TRAJECTORY_NO_HIT
+     * @param result_obstacle 与之碰撞的障碍物下标,无碰撞时为 CD_TRAJECTORY_NO_HIT,可为null
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_trajectory_check_obb(const CD_TRANSFORM *poses, CD_S32 pose_count, const CD_OBB *footprint,
+                                             const CD_OBB *obstacles, CD_S32 obstacle_count,
+                                             CD_S32 *result_pose, CD_S32 *result_obstacle)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(poses == CD_NULL || footprint == CD_NULL || result_pose == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(obstacles == CD_NULL && obstacle_count > 0, COLLISION_DETECTION_E_PARAM_NULL);
+        *result_pose = CD_TRAJECTORY_NO_HIT;
+        if (result_obstacle != CD_NULL)
+        {
+            *result_obstacle = CD_TRAJECTORY_NO_HIT;
+        }
+        if (pose_count <= 0 || obstacle_count <= 0)
+        {
+            return ret;
+        }
+
+        const CD_F32 footprint_radius = cd_trajectory_obb_radius_v(*footprint);
+        CD_TRAJECTORY_CAPSULE capsule;
+        ret = cd_trajectory_capsule(poses, pose_count, footprint_radius, &capsule);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+
+        CD_S32 first_pose = pose_count;
+        CD_S32 first_obstacle = CD_TRAJECTORY_NO_HIT;
+        CD_TRAJECTORY_CANDIDATES candidates;
+        CD_S32 next = 0;
+        while (next < obstacle_count && first_pose > 0)
+        {
+            candidates.count = 0;
+            next = cd_trajectory_cull_v(&capsule, obstacles, obstacle_count, next, &candidates);
+            // 后续的分块只需检测更早的位姿
+            cd_trajectory_check_obb_chunk_v(poses, *footprint, footprint_radius, obstacles, &candidates,
+                                            &first_pose, &first_obstacle);
+        }
+        if (first_pose < pose_count)
+        {
+            *result_pose = first_pose;
+            if (result_obstacle != CD_NULL)
+            {
+                *result_obstacle = first_obstacle;
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief 检测凸多边形足迹沿轨迹运动时与obb障碍物的碰撞,输出第一个碰撞的位姿
+     *        先用整条轨迹的包围胶囊体剔除障碍物,再逐个位姿用包围圆和分离轴检测,找到碰撞立即返回
+     * @param poses 位姿数组,可由 cd_trajectory_poses_from_xyh 生成
+     * @param pose_count 位姿数量
+     * @param footprint 车体坐标系下的凸多边形足迹,不考虑圆角半径
+     * @param obstacles 障碍物数组
+     * @param obstacle_count 障碍物数量
+     * @param result_pose 第一个碰撞位姿的下标,无碰撞时为 CD_TRAJECTORY_NO_HIT
+     * @param result_obstacle 与之碰撞的障碍物下标,无碰撞时为 CD_TRAJECTORY_NO_HIT,可为null
+     * @return ok / 参数异常
+     */
+    CD_INLINE CD_RET cd_trajectory_check_polygon(const CD_TRANSFORM *poses, CD_S32 pose_count, const CD_POLYGON *footprint,
+                                                 const CD_OBB *obstacles, CD_S32 obstacle_count,
+                                                 CD_S32 *result_pose, CD_S32 *result_obstacle)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(poses == CD_NULL || footprint == CD_NULL || result_pose == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(obstacles == CD_NULL && obstacle_count > 0, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(footprint->count <= 0 || footprint->count > MAX_POLYGON_VERTICES, COLLISION_DETECTION_E_ZERO_NUM);
+        *result_pose = CD_TRAJECTORY_NO_HIT;
+        if (result_obstacle != CD_NULL)
+        {
+            *result_obstacle = CD_TRAJECTORY_NO_HIT;
+        }
+        if (pose_count <= 0 || obstacle_count <= 0)
+        {
+            return ret;
+        }
+
+        const CD_S32 vertex_count = footprint->count;
+        CD_F32 max_len_sqr = 0.0f;
+        for (CD_S32 v = 0; v < vertex_count; ++v)
+        {
+            max_len_sqr = CD_MAX(max_len_sqr, cd_vec2_len_sqr_v(footprint->vertices[v]));
+        }
+        const CD_F32 footprint_radius = sqrtf(max_len_sqr);
+        CD_TRAJECTORY_CAPSULE capsule;
+        ret = cd_trajectory_capsule(poses, pose_count, footprint_radius, &capsule);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+
+        CD_S32 first_pose = pose_count;
+        CD_S32 first_obstacle = CD_TRAJECTORY_NO_HIT;
+        CD_TRAJECTORY_CANDIDATES candidates;
+        CD_VEC2 world[MAX_POLYGON_VERTICES];
+        CD_S32 next = 0;
+        while (next < obstacle_count && first_pose > 0)
+        {
+            candidates.count = 0;
+            next = cd_trajectory_cull_v(&capsule, obstacles, obstacle_count, next, &candidates);
+            const CD_S32 pose_limit = first_pose;
+            for (CD_S32 i = 0; i < pose_limit && first_pose == pose_limit; ++i)
+            {
+                // 足迹顶点只在位姿附近有候选障碍物时才变换
+                CD_BOOL transformed = CD_FALSE;
+                for (CD_S32 k = 0; k < candidates.count; ++k)
+                {
+                    const CD_F32 dx = candidates.x[k] - poses[i].p.x;
+                    const CD_F32 dy = candidates.y[k] - poses[i].p.y;
+                    const CD_F32 reach = footprint_radius + candidates.radius[k];
+                    if (dx * dx + dy * dy > reach * reach)
+                    {
+                        continue;
+                    }
+                    if (!transformed)
+                    {
+                        for (CD_S32 v = 0; v < vertex_count; ++v)
+                        {
+                            world[v] = cd_transforms_point_v(poses[i], footprint->vertices[v]);
+                        }
+                        transformed = CD_TRUE;
+                    }
+                    if (cd_vertices_obb_overlap_v(world, vertex_count, obstacles[candidates.index[k]]))
+                    {
+                        first_pose = i;
+                        first_obstacle = candidates.index[k];
+                        break;
+                    }
+                }
+            }
+        }
+        if (first_pose < pose_count)
+        {
+            *result_pose = first_pose;
+            if (result_obstacle != CD_NULL)
+            {
+                *result_obstacle = first_obstacle;
+            }
+        }
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __COLLISION_DETECTION_TRAJECTORY_H__ */
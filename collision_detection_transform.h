@@ -14,20 +14,7 @@ extern "C"
 {
 #endif
 
-    // 2d平面旋转量,包含三角函数的cos与sin
-    typedef struct _CD_ROT_
-    {
-        CD_F32 c; // 三角函数cos值
-        CD_F32 s; // 三角函数sin值
-    } CD_ROT;
-
-    // 坐标变换，旋转+平移
-    typedef struct _CD_TRANSFORM_
-    {
-        CD_VEC2 p; // 平移量
-        CD_ROT q;  // 旋转量
-    } CD_TRANSFORM;
-
+    // CD_ROT、CD_TRANSFORM 与 cd_rot_from_angle_v、cd_rot_vector_v、cd_transforms_point_v 等由 collision_detection_scalar.inl 实例化
     static const CD_TRANSFORM TRANSFORM_IDENTITY = {{0.0f, 0.0f}, {1.0f, 0.0f}};
 
     /**
@@ -40,11 +27,20 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(q == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        q->s = sinf(angle);
-        q->c = cosf(angle);
+        *q = cd_rot_from_angle_v(angle);
         return ret;
     }
 
+    /**
+     * @brief 通过旋转量,计算角度,无参数检查
+     * @param q 旋转量
+     * @return 角度
+     */
+    CD_INLINE CD_F32 cd_rot_to_angle_v(CD_ROT q)
+    {
+        return atan2f(q.s, q.c);
+    }
+
     /**
      * @brief 通过旋转量,计算角度
      * @param q 旋转量
@@ -55,10 +51,25 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(q == CD_NULL || angle == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        *angle = atan2f(q->s, q->c);
+        *angle = cd_rot_to_angle_v(*q);
         return ret;
     }
 
+    /**
+     * @brief 归一化旋转量,无参数检查
+     * @param q 归一化前的旋转量
+     * @return 归一化后的旋转量
+     */
+    CD_INLINE CD_ROT cd_rot_norm_v(CD_ROT q)
+    {
+        const CD_F32 mag = sqrtf(q.c * q.c + q.s * q.s);
+        const CD_F32 invMag = mag > 0.0f ? 1.0f / mag : 0.0f;
+        CD_ROT r;
+        r.c = q.c * invMag;
+        r.s = q.s * invMag;
+        return r;
+    }
+
     /**
     * @brief 归一化旋转量
     * @param q 归一化前的旋转量
@@ -69,13 +80,24 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(q == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_F32 mag = sqrtf(q->c * q->c + q->s * q->s);
-        CD_F32 invMag = mag > 0.0 ? 1.0f / mag : 0.0f;
-        result->c = q->c * invMag;
-        result->s = q->s * invMag;
+        *result = cd_rot_norm_v(*q);
         return ret;
     }
 
+    /**
+     * @brief 旋转量相乘  q * r,无参数检查
+     * @param q 旋转量q
+     * @param r 旋转量r
+     * @return q * r
+     */
+    CD_INLINE CD_ROT cd_rot_mul_v(CD_ROT q, CD_ROT r)
+    {
+        CD_ROT qr;
+        qr.c = q.c * r.c - q.s * r.s;
+        qr.s = q.c * r.s + q.s * r.c;
+        return qr;
+    }
+
     /**
      * @brief 旋转量相乘  q * r
      * @param q 旋转量q
@@ -83,15 +105,28 @@ extern "C"
      * @param result
      * @return  ok / 参数异常
      */
-    CD_INLINE CD_RET cd_rot_mul(CD_ROT *q, CD_ROT *r, CD_ROT *result)
+    CD_INLINE CD_RET cd_rot_mul(const CD_ROT *q, const CD_ROT *r, CD_ROT *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(q == CD_NULL || r == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->c = q->c * r->c - q->s * r->s;
-        result->s = q->c * r->s + q->s * r->c;
+        *result = cd_rot_mul_v(*q, *r);
         return ret;
     }
 
+    /**
+     * @brief 旋转量逆相乘 qT * r,无参数检查
+     * @param q 旋转量q
+     * @param r 旋转量r
+     * @return qT * r
+     */
+    CD_INLINE CD_ROT cd_rot_inv_mul_v(CD_ROT q, CD_ROT r)
+    {
+        CD_ROT qr;
+        qr.c = q.c * r.c + q.s * r.s;
+        qr.s = q.c * r.s - q.s * r.c;
+        return qr;
+    }
+
     /**
      * @brief 旋转量逆相乘 qT * r
      * @param q 旋转量q
@@ -99,15 +134,25 @@ extern "C"
      * @param result
      * @return  ok / 参数异常
      */
-    CD_INLINE CD_RET cd_rot_inv_mul(CD_ROT *q, CD_ROT *r, CD_ROT *result)
+    CD_INLINE CD_RET cd_rot_inv_mul(const CD_ROT *q, const CD_ROT *r, CD_ROT *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(q == CD_NULL || r == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->s = q->c * r->s - q->s * r->c;
-        result->c = q->c * r->c + q->s * r->s;
+        *result = cd_rot_inv_mul_v(*q, *r);
         return ret;
     }
 
+    /**
+     * @brief 判断旋转量是否已经归一化,无参数检查
+     * @param q 旋转量
+     * @return 是否归一化
+     */
+    CD_INLINE CD_BOOL cd_rot_is_norm_v(CD_ROT q)
+    {
+        const CD_F32 qq = q.s * q.s + q.c * q.c;
+        return (1.0f - 0.0006f < qq && qq < 1.0f + 0.0006f);
+    }
+
     /**
  * @brief 判断旋转量是否已经归一化
  * @param q 旋转量
@@ -118,11 +163,28 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(q == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_F32 qq = q->s * q->s + q->c * q->c;
-        *result = (1.0f - 0.0006f < qq && qq < 1.0f + 0.0006f);
+        *result = cd_rot_is_norm_v(*q);
         return ret;
     }
 
+    /**
+     * @brief 根据角速度,计算增量后的旋转量,无参数检查
+     * @param q 增量前的旋转量
+     * @param deltaAngle 角速增加量(弧度)
+     * @return 增量后的旋转量
+     */
+    CD_INLINE CD_ROT cd_rot_integrate_angle_v(CD_ROT q, CD_F32 deltaAngle)
+    {
+        // dc/dt = -omega * sin(t)
+        // ds/dt = omega * cos(t)
+        // c2 = c1 - omega * h * s1
+        // s2 = s1 + omega * h * c1
+        CD_ROT q2;
+        q2.c = q.c - deltaAngle * q.s;
+        q2.s = q.s + deltaAngle * q.c;
+        return cd_rot_norm_v(q2);
+    }
+
     /**
      * @brief 根据角速度,计算增量后的旋转量
      * @param q 增量前的旋转量
@@ -130,7 +192,7 @@ extern "C"
      * @param result 增量后的旋转量
      * @return ok / 参数异常
      */
-    CD_INLINE CD_RET cd_rot_integrate_angle(CD_ROT *q, CD_F32 deltaAngle, CD_ROT *result)
+    CD_INLINE CD_RET cd_rot_integrate_angle(const CD_ROT *q, CD_F32 deltaAngle, CD_ROT *result)
     {
         // dc/dt = -omega * sin(t)
         // ds/dt = omega * cos(t)
@@ -138,16 +200,26 @@ extern "C"
         // s2 = s1 + omega * h * c1
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(q == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_ROT q2;
-        q2.c = q->c - deltaAngle * q->s;
-        q2.s = q->s + deltaAngle * q->c;
-        CD_F32 mag = sqrtf(q2.s * q2.s + q2.c * q2.c);
-        CD_F32 invMag = mag > 0.0 ? 1.0f / mag : 0.0f;
-        result->c = q2.c * invMag;
-        result->s = q2.s * invMag;
+        *result = cd_rot_integrate_angle_v(*q, deltaAngle);
         return ret;
     }
 
+    /**
+     * @brief 旋转量进行线性插值,无参数检查
+     * @param q1 旋转量 q1
+     * @param q2 旋转量 q2
+     * @param t 偏移量
+     * @return 插值结果
+     */
+    CD_INLINE CD_ROT cd_rot_nlerp_v(CD_ROT q1, CD_ROT q2, CD_F32 t)
+    {
+        const CD_F32 omt = 1.0f - t;
+        CD_ROT q;
+        q.c = omt * q1.c + t * q2.c;
+        q.s = omt * q1.s + t * q2.s;
+        return cd_rot_norm_v(q);
+    }
+
     /**
      * @brief 旋转量进行线性插值
      * @param q1 旋转量 q1
@@ -156,18 +228,26 @@ extern "C"
      * @param result 插值结果
      * @return  ok / 参数异常
      */
-    CD_INLINE CD_RET cd_rot_nlerp(CD_ROT *q1, CD_ROT *q2, CD_F32 t, CD_ROT *result)
+    CD_INLINE CD_RET cd_rot_nlerp(const CD_ROT *q1, const CD_ROT *q2, CD_F32 t, CD_ROT *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(q1 == CD_NULL || q2 == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_F32 omt = 1.0f - t;
-        result->c = omt * q1->s + t * q2->c;
-        result->s = omt * q1->c + t * q2->s;
-        ret = cd_rot_norm(result, result);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        *result = cd_rot_nlerp_v(*q1, *q2, t);
         return ret;
     }
 
+    /**
+     * @brief 根据两个旋转量和时间倒数,计算角速度,无参数检查
+     * @param q1 旋转量q1
+     * @param q2 旋转量q2
+     * @param inv_h 时间倒数
+     * @return 角速度
+     */
+    CD_INLINE CD_F32 cd_rot_compute_angular_velocity_v(CD_ROT q1, CD_ROT q2, CD_F32 inv_h)
+    {
+        return inv_h * (q2.s * q1.c - q2.c * q1.s);
+    }
+
     /**
      * @brief 根据两个旋转量和时间倒数,计算角速度
      * @param q1 旋转量q1
@@ -176,44 +256,81 @@ extern "C"
      * @param result 角速度
      * @return  ok / 参数异常
      */
-    CD_INLINE CD_RET cd_rot_compute_angular_velocity(CD_ROT *q1, CD_ROT *q2, CD_F32 inv_h, CD_F32 *result)
+    CD_INLINE CD_RET cd_rot_compute_angular_velocity(const CD_ROT *q1, const CD_ROT *q2, CD_F32 inv_h, CD_F32 *result)
     {
         CD_RET ret = CD_RET_OK;
-        CD_CHECK_ERROR(q1 == CD_NULL || q2 == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        *result = inv_h * (q2->s * q1->c - q2->c * q1->s);
+        CD_CHECK_ERROR(q1 == CD_NULL || q2 == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_rot_compute_angular_velocity_v(*q1, *q2, inv_h);
         return ret;
     }
 
+    /**
+     * @brief 计算旋转量x轴单位向量,无参数检查
+     * @param q1 旋转量
+     * @return x轴单位向量
+     */
+    CD_INLINE CD_VEC2 cd_rot_get_x_axis_v(CD_ROT q1)
+    {
+        CD_VEC2 r;
+        r.x = q1.c;
+        r.y = q1.s;
+        return r;
+    }
+
     /**
      * @brief 计算旋转量x轴单位向量
      * @param q1 旋转量
      * @param result x轴单位向量
      * @return ok / 参数异常
      */
-    CD_INLINE CD_RET cd_rot_get_x_axis(CD_ROT *q1, CD_VEC2 *result)
+    CD_INLINE CD_RET cd_rot_get_x_axis(const CD_ROT *q1, CD_VEC2 *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(q1 == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = q1->c;
-        result->y = q1->s;
+        *result = cd_rot_get_x_axis_v(*q1);
         return ret;
     }
 
+    /**
+     * @brief 计算旋转量y轴单位向量,无参数检查
+     * @param q1 旋转量
+     * @return y轴单位向量
+     */
+    CD_INLINE CD_VEC2 cd_rot_get_y_axis_v(CD_ROT q1)
+    {
+        CD_VEC2 r;
+        r.x = -q1.s;
+        r.y = q1.c;
+        return r;
+    }
+
     /**
      * @brief 计算旋转量y轴单位向量
      * @param q1 旋转量
      * @param result y轴单位向量
      * @return ok / 参数异常
      */
-    CD_INLINE CD_RET cd_rot_get_y_axis(CD_ROT *q1, CD_VEC2 *result)
+    CD_INLINE CD_RET cd_rot_get_y_axis(const CD_ROT *q1, CD_VEC2 *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(q1 == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = -q1->s;
-        result->y = q1->c;
+        *result = cd_rot_get_y_axis_v(*q1);
         return ret;
     }
 
+    /**
+     * @brief 旋转量b到旋转量a的夹角 (rot_b * inv(rot_a)),无参数检查
+     * @param b 旋转量b
+     * @param a 旋转量a
+     * @return 两个旋转量之间的夹角
+     */
+    CD_INLINE CD_F32 cd_rot_relative_angle_v(CD_ROT b, CD_ROT a)
+    {
+        const CD_F32 s = b.s * a.c - b.c * a.s;
+        const CD_F32 c = b.c * a.c + b.s * a.s;
+        return atan2f(s, c);
+    }
+
     /**
      * @brief 旋转量b到旋转量a的夹角 (rot_b * inv(rot_a))
      * @param b 旋转量b
@@ -221,13 +338,11 @@ extern "C"
      * @param result 两个旋转量之间的夹角
      * @return ok / 参数异常
      */
-    CD_INLINE CD_RET cd_rot_relative_angle(CD_ROT *b, CD_ROT *a, CD_F32 *result)
+    CD_INLINE CD_RET cd_rot_relative_angle(const CD_ROT *b, const CD_ROT *a, CD_F32 *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(b == CD_NULL || a == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_F32 s = b->s * a->c - b->c * a->s;
-        CD_F32 c = b->c * a->c + b->s * a->s;
-        *result = atan2f(s, c);
+        *result = cd_rot_relative_angle_v(*b, *a);
         return ret;
     }
 
@@ -238,12 +353,11 @@ extern "C"
      * @param result 旋转后的结果
      * @return ok / 参数异常
      */
-    CD_INLINE CD_RET cd_rot_vector(CD_ROT *q, CD_VEC2 *v, CD_VEC2 *result)
+    CD_INLINE CD_RET cd_rot_vector(const CD_ROT *q, const CD_VEC2 *v, CD_VEC2 *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(q == CD_NULL || v == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = q->c * v->x - q->s * v->y;
-        result->y = q->s * v->x + q->c * v->y;
+        *result = cd_rot_vector_v(*q, *v);
         return ret;
     }
 
@@ -254,12 +368,11 @@ extern "C"
      * @param result 旋转前的向量
      * @return ok / 参数异常
      */
-    CD_INLINE CD_RET cd_inv_rot_vector(CD_ROT *q, CD_VEC2 *v, CD_VEC2 *result)
+    CD_INLINE CD_RET cd_inv_rot_vector(const CD_ROT *q, const CD_VEC2 *v, CD_VEC2 *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(q == CD_NULL || v == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = q->c * v->x + q->s * v->y;
-        result->y = -q->s * v->x + q->c * v->y;
+        *result = cd_inv_rot_vector_v(*q, *v);
         return ret;
     }
 
@@ -270,13 +383,11 @@ extern "C"
      * @param result 转换后的点
      * @return ok / 参数异常
      */
-
-    CD_INLINE CD_RET cd_transforms_point(CD_TRANSFORM *t, CD_VEC2 *p, CD_VEC2 *result)
+    CD_INLINE CD_RET cd_transforms_point(const CD_TRANSFORM *t, const CD_VEC2 *p, CD_VEC2 *result)
     {
         CD_RET ret = CD_RET_OK;
-        // CD_CHECK_ERROR(t == CD_NULL || p == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        // result->x = (t->q.c * p->x - t->q.s * p->y) + t->p.x;
-        // result->y = (t->q.s * p->x + t->q.c * p->y) + t->p.y;
+        CD_CHECK_ERROR(t == CD_NULL || p == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        *result = cd_transforms_point_v(*t, *p);
         return ret;
     }
 
@@ -287,17 +398,28 @@ extern "C"
      * @param result 转换前的点
      * @return ok / 参数异常
      */
-    CD_INLINE CD_RET cd_inv_transforms_point(CD_TRANSFORM *t, CD_VEC2 *p, CD_VEC2 *result)
+    CD_INLINE CD_RET cd_inv_transforms_point(const CD_TRANSFORM *t, const CD_VEC2 *p, CD_VEC2 *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(t == CD_NULL || p == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_F32 vx = p->x - t->p.x;
-        CD_F32 vy = p->y - t->p.y;
-        result->x = (t->q.c * vx + t->q.s * vy);
-        result->y = (-t->q.s * vx + t->q.c * vy);
+        *result = cd_inv_transforms_point_v(*t, *p);
         return ret;
     }
 
+    /**
+     * @brief a 叠加转换b,无参数检查
+     * @param a 转换量a
+     * @param b 转换量b
+     * @return 叠加后的转换量
+     */
+    CD_INLINE CD_TRANSFORM cd_transforms_mul_v(CD_TRANSFORM a, CD_TRANSFORM b)
+    {
+        CD_TRANSFORM r;
+        r.q = cd_rot_mul_v(a.q, b.q);
+        r.p = cd_vec2_add_v(cd_rot_vector_v(a.q, b.p), a.p);
+        return r;
+    }
+
     /**
      * @brief a 叠加转换b
      * @param a  转换量a
@@ -305,30 +427,33 @@ extern "C"
      * @param result 叠加后的转换量
      * @return ok / 参数异常
      */
-    CD_INLINE CD_RET cd_transforms_mul(CD_TRANSFORM *a, CD_TRANSFORM *b, CD_TRANSFORM *result)
+    CD_INLINE CD_RET cd_transforms_mul(const CD_TRANSFORM *a, const CD_TRANSFORM *b, CD_TRANSFORM *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        ret = cd_rot_mul(&a->q, &b->q, &result->q);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-        CD_VEC2 add_vec;
-        ret = cd_rot_vector(&a->q, &b->p, &add_vec);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-        ret = cd_vec2_add(&add_vec, &b->p, &result->p);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        *result = cd_transforms_mul_v(*a, *b);
         return ret;
     }
 
-    CD_INLINE CD_RET cd_transforms_inv_mul(CD_TRANSFORM *a, CD_TRANSFORM *b, CD_TRANSFORM *result)
+    /**
+     * @brief a 的逆叠加转换b, inv(a) * b,无参数检查
+     * @param a 转换量a
+     * @param b 转换量b
+     * @return 叠加后的转换量
+     */
+    CD_INLINE CD_TRANSFORM cd_transforms_inv_mul_v(CD_TRANSFORM a, CD_TRANSFORM b)
+    {
+        CD_TRANSFORM r;
+        r.q = cd_rot_inv_mul_v(a.q, b.q);
+        r.p = cd_inv_rot_vector_v(a.q, cd_vec2_sub_v(b.p, a.p));
+        return r;
+    }
+
+    CD_INLINE CD_RET cd_transforms_inv_mul(const CD_TRANSFORM *a, const CD_TRANSFORM *b, CD_TRANSFORM *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        ret = cd_rot_inv_mul(&a->q, &b->q, &result->q);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-        CD_VEC2 sub_vec;
-        ret = cd_vec2_sub(&b->p, &a->p, &sub_vec);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-        ret = cd_inv_rot_vector(&a->q, &sub_vec, &result->p);
+        *result = cd_transforms_inv_mul_v(*a, *b);
         return ret;
     }
 
@@ -23,9 +23,10 @@
         return error_code;                \
     }
 
-#define COLLISION_DETECTION_E_MEM_NULL 0x0000   // 内存地址为空
+#define COLLISION_DETECTION_E_MEM_NULL 0x0004   // 内存地址为空
 #define COLLISION_DETECTION_E_MEM_ALIGN 0x0001  // 内存对齐错误
 #define COLLISION_DETECTION_E_CALC_ERROR 0x0002 // 内存不足
+#define COLLISION_DETECTION_E_MEM_FULL 0x0003   // 预分配的容量已用完
 #define COLLISION_DETECTION_E_PARAM_NULL 0x0010 // 输入参数为空
 #define COLLISION_DETECTION_E_ZERO_NUM   0x0020 // 输入参数为空
 
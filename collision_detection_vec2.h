@@ -10,20 +10,29 @@
 
 #include "collision_detection_type.h"
 #include "collision_detection_math.h"
+#include "collision_detection_scalar.h"
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
-    typedef struct _CD_VEC2_
-    {
-        CD_F32 x;
-        CD_F32 y;
-    } CD_VEC2;
-
+    // CD_VEC2 与 cd_vec2_make_v、cd_vec2_add_v 等无检查函数由 collision_detection_scalar.inl 实例化
     static const CD_VEC2 Vec2_Zero = {0.0f, 0.0f}; // 0向量
 
+    /**
+     * @brief 根据朝向构建单位向量,无参数检查
+     * @param heading 向量朝向
+     * @return 单位向量
+     */
+    CD_INLINE CD_VEC2 cd_create_unit_vec2_v(CD_F32 heading)
+    {
+        CD_VEC2 r;
+        r.x = cosf(heading);
+        r.y = sinf(heading);
+        return r;
+    }
+
     /**
      * @brief 根据朝向构建单位向量
      * @param heading 向量朝向
@@ -34,8 +43,7 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = cosf(heading);
-        result->y = sinf(heading);
+        *result = cd_create_unit_vec2_v(heading);
         return ret;
     }
 
@@ -49,7 +57,7 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(v == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        *result = sqrtf(v->x * v->x + v->y * v->y);
+        *result = cd_vec2_len_v(*v);
         return ret;
     }
 
@@ -63,7 +71,7 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(v == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        *result = v->x * v->x + v->y * v->y;
+        *result = cd_vec2_len_sqr_v(*v);
         return ret;
     }
 
@@ -78,7 +86,7 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        *result = a->x * b->x + a->y * b->y;
+        *result = cd_vec2_dot_v(*a, *b);
         return ret;
     }
 
@@ -93,10 +101,20 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        *result = a->x * b->y - a->y * b->x;
+        *result = cd_vec2_cross_v(*a, *b);
         return ret;
     }
 
+    /**
+     * @brief 求向量的朝向,无参数检查
+     * @param v 向量
+     * @return 向量朝向
+     */
+    CD_INLINE CD_F32 cd_vec2_heading_v(CD_VEC2 v)
+    {
+        return atan2f(v.y, v.x);
+    }
+
     /**
      * @brief 求向量的朝向
      * @param v 向量
@@ -107,10 +125,23 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(v == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        *result = atan2f(v->y, v->x);
+        *result = cd_vec2_heading_v(*v);
         return ret;
     }
 
+    /**
+     * @brief 求向左的垂直向量,无参数检查
+     * @param v 向量
+     * @return 向左的垂直向量
+     */
+    CD_INLINE CD_VEC2 cd_vec2_left_perp_v(CD_VEC2 v)
+    {
+        CD_VEC2 r;
+        r.x = -v.y;
+        r.y = v.x;
+        return r;
+    }
+
     /**
      * @brief 求向左的垂直向量
      * @param v 向量
@@ -121,11 +152,23 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(v == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = -v->y;
-        result->y = v->x;
+        *result = cd_vec2_left_perp_v(*v);
         return ret;
     }
 
+    /**
+     * @brief 求向右的垂直向量,无参数检查
+     * @param v 向量
+     * @return 向右的垂直向量
+     */
+    CD_INLINE CD_VEC2 cd_vec2_right_perp_v(CD_VEC2 v)
+    {
+        CD_VEC2 r;
+        r.x = v.y;
+        r.y = -v.x;
+        return r;
+    }
+
     /**
      * @brief 求向右的垂直向量
      * @param v 向量
@@ -136,8 +179,7 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(v == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = v->y;
-        result->y = -v->x;
+        *result = cd_vec2_right_perp_v(*v);
         return ret;
     }
 
@@ -152,8 +194,7 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = a->x + b->x;
-        result->y = a->y + b->y;
+        *result = cd_vec2_add_v(*a, *b);
         return ret;
     }
 
@@ -168,11 +209,23 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = a->x - b->x;
-        result->y = a->y - b->y;
+        *result = cd_vec2_sub_v(*a, *b);
         return ret;
     }
 
+    /**
+     * @brief 求向量的负数,无参数检查
+     * @param a 向量
+     * @return 向量的负数
+     */
+    CD_INLINE CD_VEC2 cd_vec2_neg_v(CD_VEC2 a)
+    {
+        CD_VEC2 r;
+        r.x = -a.x;
+        r.y = -a.y;
+        return r;
+    }
+
     /**
      * @brief 求向量的负数
      * @param a 向量
@@ -183,11 +236,25 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = -a->x;
-        result->y = -a->y;
+        *result = cd_vec2_neg_v(*a);
         return ret;
     }
 
+    /**
+     * @brief 从向量a到向量b,进行线性插值,无参数检查
+     * @param a 向量a
+     * @param b 向量b
+     * @param t 插值距离
+     * @return 插值的结果
+     */
+    CD_INLINE CD_VEC2 cd_vec2_nlerp_v(CD_VEC2 a, CD_VEC2 b, CD_F32 t)
+    {
+        CD_VEC2 r;
+        r.x = a.x + t * (b.x - a.x);
+        r.y = a.y + t * (b.y - a.y);
+        return r;
+    }
+
     /**
      * @brief 从向量a到向量b,进行线性插值
      * @param a 向量a
@@ -200,11 +267,24 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = a->x + t * (b->x - a->x);
-        result->y = a->y + t * (b->y - a->y);
+        *result = cd_vec2_nlerp_v(*a, *b, t);
         return ret;
     }
 
+    /**
+     * @brief 向量的对应元素乘积,无参数检查
+     * @param a 向量a
+     * @param b 向量b
+     * @return 乘积结果
+     */
+    CD_INLINE CD_VEC2 cd_vec2_mul_v(CD_VEC2 a, CD_VEC2 b)
+    {
+        CD_VEC2 r;
+        r.x = a.x * b.x;
+        r.y = a.y * b.y;
+        return r;
+    }
+
     /**
      * @brief 向量的对应元素乘积
      * @param a 向量a
@@ -216,8 +296,7 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = a->x * b->x;
-        result->y = a->y * b->y;
+        *result = cd_vec2_mul_v(*a, *b);
         return ret;
     }
 
@@ -232,8 +311,7 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = a->x * scale;
-        result->y = a->y * scale;
+        *result = cd_vec2_scale_v(*a, scale);
         return ret;
     }
 
@@ -249,11 +327,25 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = a->x + b->x * scale;
-        result->y = a->y + b->y * scale;
+        *result = cd_vec2_mul_add_v(*a, scale, *b);
         return ret;
     }
 
+    /**
+     * @brief 向量减去一个缩放的向量,无参数检查
+     * @param a 向量a
+     * @param scale 向量b缩放因子
+     * @param b 向量b
+     * @return a - scale * b
+     */
+    CD_INLINE CD_VEC2 cd_vec2_mul_sub_v(CD_VEC2 a, CD_F32 scale, CD_VEC2 b)
+    {
+        CD_VEC2 r;
+        r.x = a.x - b.x * scale;
+        r.y = a.y - b.y * scale;
+        return r;
+    }
+
     /**
      * @brief 向量减去一个缩放的向量
      * @param a 向量a
@@ -266,11 +358,31 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = a->x - b->x * scale;
-        result->y = a->y - b->y * scale;
+        *result = cd_vec2_mul_sub_v(*a, scale, *b);
         return ret;
     }
 
+    /**
+     * @brief 向量的单位化,无参数检查
+     * @param a 向量a
+     * @return 单位化结果,长度小于 CD_EPS 时返回0向量
+     */
+    CD_INLINE CD_VEC2 cd_vec2_norm_v(CD_VEC2 a)
+    {
+        const CD_F32 len = sqrtf(a.x * a.x + a.y * a.y);
+        CD_VEC2 r;
+        if (len < CD_EPS)
+        {
+            r.x = 0.0f;
+            r.y = 0.0f;
+            return r;
+        }
+        const CD_F32 inv_len = 1.0f / len;
+        r.x = a.x * inv_len;
+        r.y = a.y * inv_len;
+        return r;
+    }
+
     /**
      * @brief 向量的单位化
      * @param a 向量a
@@ -281,20 +393,23 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_F32 len;
-        ret = cd_vec2_len(a, &len);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-        if (len < CD_EPS)
-        {
-            result->x = 0.0f;
-            result->y = 0.0f;
-            return CD_RET_OK;
-        }
-        result->x = a->x / len;
-        result->y = a->y / len;
+        *result = cd_vec2_norm_v(*a);
         return ret;
     }
 
+    /**
+     * @brief 向量绝对值,无参数检查
+     * @param a 向量a
+     * @return 绝对值向量
+     */
+    CD_INLINE CD_VEC2 cd_vec2_abs_v(CD_VEC2 a)
+    {
+        CD_VEC2 r;
+        r.x = CD_FABS(a.x);
+        r.y = CD_FABS(a.y);
+        return r;
+    }
+
     /**
      * @brief 向量绝对值
      * @param a 向量a
@@ -305,11 +420,24 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = CD_FABS(a->x);
-        result->y = CD_FABS(a->y);
+        *result = cd_vec2_abs_v(*a);
         return ret;
     }
 
+    /**
+     * @brief 求两个向量的每个元素的大值,无参数检查
+     * @param a 向量a
+     * @param b 向量b
+     * @return 每个元素的大值
+     */
+    CD_INLINE CD_VEC2 cd_vec2_max_v(CD_VEC2 a, CD_VEC2 b)
+    {
+        CD_VEC2 r;
+        r.x = CD_MAX(a.x, b.x);
+        r.y = CD_MAX(a.y, b.y);
+        return r;
+    }
+
     /**
      * @brief 求两个向量的每个元素的大值
      * @param a 向量a
@@ -321,11 +449,24 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = CD_MAX(a->x, b->x);
-        result->y = CD_MAX(a->y, b->y);
+        *result = cd_vec2_max_v(*a, *b);
         return ret;
     }
 
+    /**
+     * @brief 求两个向量的每个元素的小值,无参数检查
+     * @param a 向量a
+     * @param b 向量b
+     * @return 每个元素的小值
+     */
+    CD_INLINE CD_VEC2 cd_vec2_min_v(CD_VEC2 a, CD_VEC2 b)
+    {
+        CD_VEC2 r;
+        r.x = CD_MIN(a.x, b.x);
+        r.y = CD_MIN(a.y, b.y);
+        return r;
+    }
+
     /**
      * @brief 求两个向量的每个元素的小值
      * @param a 向量a
@@ -337,11 +478,25 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = CD_MIN(a->x, b->x);
-        result->y = CD_MIN(a->y, b->y);
+        *result = cd_vec2_min_v(*a, *b);
         return ret;
     }
 
+    /**
+     * @brief 向量v的值限制在向量a b之间,无参数检查
+     * @param v 向量v
+     * @param a 向量a
+     * @param b 向量b
+     * @return 限制后的向量
+     */
+    CD_INLINE CD_VEC2 cd_vec2_clamp_v(CD_VEC2 v, CD_VEC2 a, CD_VEC2 b)
+    {
+        CD_VEC2 r;
+        r.x = CD_CLIP(v.x, a.x, b.x);
+        r.y = CD_CLIP(v.y, a.y, b.y);
+        return r;
+    }
+
     /**
      * @brief 向量v的值限制在向量a b之间
      * @param v 向量v
@@ -354,8 +509,7 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(v == CD_NULL || a == CD_NULL || b == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        result->x = CD_CLIP(v->x, a->x, b->x);
-        result->y = CD_CLIP(v->y, a->y, b->y);
+        *result = cd_vec2_clamp_v(*v, *a, *b);
         return ret;
     }
 
@@ -371,9 +525,7 @@ extern "C"
 
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == NULL || b == NULL || result == NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_F32 dx = a->x - b->x;
-        CD_F32 dy = a->y - b->y;
-        *result = sqrtf(dx * dx + dy * dy);
+        *result = cd_vec2_dis_v(*a, *b);
         return ret;
     }
 
@@ -389,12 +541,33 @@ extern "C"
 
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == NULL || b == NULL || result == NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_F32 dx = a->x - b->x;
-        CD_F32 dy = a->y - b->y;
-        *result = dx * dx + dy * dy;
+        *result = cd_vec2_dis_sqr_v(*a, *b);
         return ret;
     }
 
+    /**
+     * @brief 求向量a的长度并归一化,无参数检查
+     * @param a 向量a
+     * @param result_len 向量长度
+     * @return 单位向量,长度小于 CD_EPS 时返回0向量
+     */
+    CD_INLINE CD_VEC2 cd_vec2_get_len_and_norm_v(CD_VEC2 a, CD_F32 *result_len)
+    {
+        const CD_F32 len = sqrtf(a.x * a.x + a.y * a.y);
+        *result_len = len;
+        CD_VEC2 r;
+        if (len < CD_EPS)
+        {
+            r.x = 0.0f;
+            r.y = 0.0f;
+            return r;
+        }
+        const CD_F32 inv_len = 1.0f / len;
+        r.x = a.x * inv_len;
+        r.y = a.y * inv_len;
+        return r;
+    }
+
     /**
      * @brief 求向量a的长度并归一化
      * @param a 向量a
@@ -406,26 +579,28 @@ extern "C"
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(a == NULL || result_len == NULL || result_v == NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        ret = cd_vec2_len(a, result_len);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-        ret = cd_vec2_norm(a, result_v);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-
+        *result_v = cd_vec2_get_len_and_norm_v(*a, result_len);
         return ret;
     }
 
+    /**
+     * @brief 以start_point为起点,两个端点构成的向量的叉积,无参数检查
+     * @param start_point 起点
+     * @param end_point_1 端点1
+     * @param end_point_2 端点2
+     * @return 叉积结果
+     */
+    CD_INLINE CD_F32 cd_points_cross_v(CD_VEC2 start_point, CD_VEC2 end_point_1, CD_VEC2 end_point_2)
+    {
+        return (end_point_1.x - start_point.x) * (end_point_2.y - start_point.y) -
+               (end_point_1.y - start_point.y) * (end_point_2.x - start_point.x);
+    }
+
     CD_INLINE CD_RET cd_points_cross(const CD_VEC2 *start_point, const CD_VEC2 *end_point_1, const CD_VEC2 *end_point_2, CD_F32 *result)
     {
         CD_RET ret = CD_RET_OK;
         CD_CHECK_ERROR(start_point == CD_NULL || end_point_1 == CD_NULL || end_point_2 == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
-        CD_VEC2 vec1;
-        ret = cd_vec2_sub(end_point_1, start_point, &vec1);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-        CD_VEC2 vec2;
-        ret = cd_vec2_sub(end_point_2, start_point, &vec2);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
-        ret = cd_vec2_cross(&vec1, &vec2, result);
-        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        *result = cd_points_cross_v(*start_point, *end_point_1, *end_point_2);
         return ret;
     }
 
@@ -0,0 +1,205 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-17 15:06:52
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-17 15:06:52
+ */
+
+#ifndef __COLLISION_DETECTION_VERTEX_ARENA_H__
+#define __COLLISION_DETECTION_VERTEX_ARENA_H__
+
+#include "collision_detection_type.h"
+#include "collision_detection_math.h"
+#include "collision_detection_vec2.h"
+#include "collision_detection_polygon.h"
+#include "collision_detection_distance.h"
+#include "collision_detection_allocator.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // 顶点池: 多个变长多边形的顶点与边法向顺序存放在调用方提供的两块连续存储中
+    typedef struct _CD_VERTEX_ARENA_
+    {
+        CD_VEC2 *vertices; ///< 顶点存储,长度为 capacity
+        CD_VEC2 *normals;  ///< 法向存储,与 vertices 一一对应
+        CD_S32 capacity;   ///< 存储容量
+        CD_S32 count;      ///< 已使用数量
+    } CD_VERTEX_ARENA;
+
+    // 存放在顶点池中的变长凸多边形,只记录偏移与数量
+    typedef struct _CD_ARENA_POLYGON_
+    {
+        CD_S32 offset;      ///< 第一个顶点在顶点池中的位置
+        CD_S32 count;       ///< 顶点数量
+        CD_VEC2 centroid;   ///< 形心
+        CD_AABB aabb;       ///< 包围盒,包含圆角半径
+        CD_F32 boundRadius; ///< 相对形心的包围半径,包含圆角半径
+        CD_F32 radius;      ///< 圆角半径
+    } CD_ARENA_POLYGON;
+
+    /**
+     * @brief 初始化顶点池
+     * @param vertices 顶点存储
+     * @param normals 法向存储
+     * @param capacity 两块存储的长度
+     * @param arena 顶点池
+     * @return ok / 参数异常 / 容量为0
+     */
+    CD_INLINE CD_RET cd_vertex_arena_init(CD_VEC2 *vertices, CD_VEC2 *normals, CD_S32 capacity, CD_VERTEX_ARENA *arena)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(vertices == CD_NULL || normals == CD_NULL || arena == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(capacity <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        arena->vertices = vertices;
+        arena->normals = normals;
+        arena->capacity = capacity;
+        arena->count = 0;
+        return ret;
+    }
+
+    /**
+     * @brief 在线性分配器上分配顶点与法向存储并初始化顶点池
+     * @param memory 线性分配器
+     * @param capacity 顶点容量
+     * @param arena 顶点池
+     * @return ok / 参数异常 / 容量为0 / 线性分配器容量不足
+     */
+    CD_INLINE CD_RET cd_vertex_arena_init_from_arena(CD_ARENA *memory, CD_S32 capacity, CD_VERTEX_ARENA *arena)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(memory == CD_NULL || arena == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(capacity <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        CD_VEC2 *vertices = CD_NULL;
+        CD_VEC2 *normals = CD_NULL;
+        ret = CD_ARENA_ALLOC_ARRAY(memory, CD_VEC2, capacity, &vertices);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        ret = CD_ARENA_ALLOC_ARRAY(memory, CD_VEC2, capacity, &normals);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        return cd_vertex_arena_init(vertices, normals, capacity, arena);
+    }
+
+    /**
+     * @brief 清空顶点池,之前分配的多边形全部失效,无参数检查
+     * @param arena 顶点池
+     */
+    CD_INLINE CD_VOID cd_vertex_arena_reset_v(CD_VERTEX_ARENA *arena)
+    {
+        arena->count = 0;
+    }
+
+    /**
+     * @brief 从顶点池中分配连续的顶点与法向
+     * @param arena 顶点池
+     * @param count 顶点数量
+     * @param offset 分配到的第一个顶点的位置
+     * @return ok / 参数异常 / 数量为0 / 顶点池已满
+     */
+    CD_INLINE CD_RET cd_vertex_arena_alloc(CD_VERTEX_ARENA *arena, CD_S32 count, CD_S32 *offset)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(arena == CD_NULL || offset == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(count <= 0, COLLISION_DETECTION_E_ZERO_NUM);
+        CD_CHECK_ERROR(count > arena->capacity - arena->count, COLLISION_DETECTION_E_MEM_FULL);
+        *offset = arena->count;
+        arena->count += count;
+        return ret;
+    }
+
+    /**
+     * @brief 顶点池中多边形的视图,用于点在多边形内、SAT 与接触流形,无参数检查
+     * @param arena 顶点池
+     * @param polygon 多边形
+     * @return 视图
+     */
+    CD_INLINE CD_POLYGON_VIEW cd_arena_polygon_view_v(const CD_VERTEX_ARENA *arena, const CD_ARENA_POLYGON *polygon)
+    {
+        CD_POLYGON_VIEW r;
+        r.vertices = arena->vertices + polygon->offset;
+        r.normals = arena->normals + polygon->offset;
+        r.count = polygon->count;
+        r.radius = polygon->radius;
+        return r;
+    }
+
+    /**
+     * @brief 顶点池中多边形的 GJK 点集,无参数检查
+     * @param arena 顶点池
+     * @param polygon 多边形
+     * @return 点集
+     */
+    CD_INLINE CD_DISTANCE_SPAN cd_arena_polygon_span_v(const CD_VERTEX_ARENA *arena, const CD_ARENA_POLYGON *polygon)
+    {
+        return cd_make_span_v(arena->vertices + polygon->offset, polygon->count, polygon->radius);
+    }
+
+    /**
+     * @brief 由任意点集构建存放在顶点池中的凸多边形,凸包直接写入顶点池的剩余空间,只占用凸包实际的顶点数
+     * @param arena 顶点池
+     * @param points 点集,顺序任意
+     * @param count 点数量
+     * @param radius 多边形的圆角半径
+     * @param scratch 临时点数组,长度不小于 CD_HULL_SCRATCH_SIZE(count)
+     * @param result 逆时针凸多边形
+     * @return ok / 参数异常 / 凸包退化成点或线段 / 顶点池剩余空间不足
+     */
+    CD_INLINE CD_RET cd_make_arena_polygon(CD_VERTEX_ARENA *arena, const CD_VEC2 *points, CD_S32 count, CD_F32 radius,
+                                           CD_VEC2 *scratch, CD_ARENA_POLYGON *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(arena == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        // 凸包至少3个顶点,剩余空间不足时是顶点池已满而不是点数不足
+        CD_CHECK_ERROR(arena->capacity - arena->count < 3, COLLISION_DETECTION_E_MEM_FULL);
+        CD_VEC2 *vertices = arena->vertices + arena->count;
+        CD_S32 hull_count = 0;
+        ret = cd_make_hull(points, count, scratch, vertices, arena->capacity - arena->count, &hull_count);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+
+        CD_S32 offset = 0;
+        ret = cd_vertex_arena_alloc(arena, hull_count, &offset);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        cd_polygon_normals_v(vertices, hull_count, arena->normals + offset);
+        result->offset = offset;
+        result->count = hull_count;
+        result->radius = radius;
+        result->centroid = cd_polygon_centroid_v(vertices, hull_count);
+        result->boundRadius = cd_polygon_bounds_v(vertices, hull_count, result->centroid, radius, &result->aabb);
+        return ret;
+    }
+
+    /**
+     * @brief 把定长多边形复制到顶点池中
+     *        只复制顶点,法向、形心与包围盒由顶点重新计算,不依赖多边形中可能过期的缓存
+     * @param arena 顶点池
+     * @param polygon 定长逆时针凸多边形
+     * @param result 顶点池中的多边形
+     * @return ok / 参数异常 / 顶点数不在 3 ~ MAX_POLYGON_VERTICES 内 / 顶点池剩余空间不足
+     */
+    CD_INLINE CD_RET cd_arena_polygon_from_polygon(CD_VERTEX_ARENA *arena, const CD_POLYGON *polygon, CD_ARENA_POLYGON *result)
+    {
+        CD_RET ret = CD_RET_OK;
+        CD_CHECK_ERROR(arena == CD_NULL || polygon == CD_NULL || result == CD_NULL, COLLISION_DETECTION_E_PARAM_NULL);
+        CD_CHECK_ERROR(polygon->count < 3 || polygon->count > MAX_POLYGON_VERTICES, COLLISION_DETECTION_E_ZERO_NUM);
+        CD_S32 offset = 0;
+        ret = cd_vertex_arena_alloc(arena, polygon->count, &offset);
+        CD_CHECK_ERROR(ret != CD_RET_OK, ret);
+        CD_VEC2 *vertices = arena->vertices + offset;
+        for (CD_S32 i = 0; i < polygon->count; ++i)
+        {
+            vertices[i] = polygon->vertices[i];
+        }
+        cd_polygon_normals_v(vertices, polygon->count, arena->normals + offset);
+        result->offset = offset;
+        result->count = polygon->count;
+        result->radius = polygon->radius;
+        result->centroid = cd_polygon_centroid_v(vertices, polygon->count);
+        result->boundRadius = cd_polygon_bounds_v(vertices, polygon->count, result->centroid, polygon->radius, &result->aabb);
+        return ret;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __COLLISION_DETECTION_VERTEX_ARENA_H__ */
@@ -0,0 +1,80 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 09:12:40
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 09:12:40
+ */
+
+// 测试用的断言与固定种子随机数,每个测试程序以失败数作为返回码,由 ctest 运行
+
+#ifndef __CD_TEST_H__
+#define __CD_TEST_H__
+
+#include "collision_detection.h"
+
+#include <math.h>
+#include <stdio.h>
+
+namespace cd_test
+{
+    inline CD_S32 &failures()
+    {
+        static CD_S32 count = 0;
+        return count;
+    }
+
+    inline CD_VOID fail(const char *file, CD_S32 line, const char *expr)
+    {
+        // 随机用例可能连续失败,只打印前若干条
+        if (failures() < 20)
+        {
+            printf("%s:%d: check failed: %s\n", file, line, expr);
+        }
+        ++failures();
+    }
+
+    // 固定种子的 xorshift,保证每次运行的用例一致
+    inline CD_U32 &rand_state()
+    {
+        static CD_U32 state = 0x2545F491u;
+        return state;
+    }
+
+    inline CD_U32 rand_u32()
+    {
+        CD_U32 &s = rand_state();
+        s ^= s << 13;
+        s ^= s >> 17;
+        s ^= s << 5;
+        return s;
+    }
+
+    inline CD_F32 rand_f(CD_F32 lo, CD_F32 hi)
+    {
+        return lo + (hi - lo) * (CD_F32)(rand_u32() & 0xFFFFFF) / (CD_F32)0xFFFFFF;
+    }
+
+    inline CD_S32 rand_s(CD_S32 lo, CD_S32 hi)
+    {
+        return lo + (CD_S32)(rand_u32() % (CD_U32)(hi - lo + 1));
+    }
+
+    inline CD_S32 report(const char *name)
+    {
+        printf("%s: %s (%d failures)\n", name, failures() == 0 ? "passed" : "FAILED", failures());
+        return failures() == 0 ? 0 : 1;
+    }
+} // namespace cd_test
+
+#define CD_TEST_CHECK(cond)                                \
+    do                                                     \
+    {                                                      \
+        if (!(cond))                                       \
+        {                                                  \
+            cd_test::fail(__FILE__, __LINE__, #cond);      \
+        }                                                  \
+    } while (0)
+
+#define CD_TEST_CHECK_NEAR(a, b, tol) CD_TEST_CHECK(fabs((CD_F64)(a) - (CD_F64)(b)) <= (CD_F64)(tol))
+
+#endif /* __CD_TEST_H__ */
@@ -0,0 +1,364 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 16:52:30
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 16:52:30
+ */
+
+// 分配器: 线性分配器的地址、填充与偏移和逐字节模型一致,耗尽时不修改状态,标记回退与重置后复用同一地址;
+// 定长块分配器的块互不重叠、对齐、后进先出复用,耗尽、非法释放与重置的行为正确
+
+#include "cd_test.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+namespace
+{
+    // 模型: 在调用方内存上按实际地址对齐
+    CD_U32 model_padding(const CD_U08 *base, CD_U32 offset, CD_U32 align)
+    {
+        const uintptr_t address = (uintptr_t)(base + offset);
+        return (CD_U32)((align - address % align) % align);
+    }
+
+    struct Span
+    {
+        CD_U08 *ptr;
+        CD_U32 size;
+        CD_U08 tag;
+    };
+
+    CD_VOID fill(const Span &s)
+    {
+        for (CD_U32 i = 0; i < s.size; ++i)
+        {
+            s.ptr[i] = s.tag;
+        }
+    }
+
+    CD_BOOL intact(const Span &s)
+    {
+        for (CD_U32 i = 0; i < s.size; ++i)
+        {
+            if (s.ptr[i] != s.tag)
+            {
+                return CD_FALSE;
+            }
+        }
+        return CD_TRUE;
+    }
+
+    CD_VOID test_arena_random()
+    {
+        std::vector<CD_U08> storage(4096 + 64);
+        for (CD_S32 iter = 0; iter < 400; ++iter)
+        {
+            // 起始地址故意不对齐,容量随机
+            CD_U08 *buffer = storage.data() + cd_test::rand_s(0, 15);
+            const CD_U32 capacity = (CD_U32)cd_test::rand_s(1, 4096);
+            CD_ARENA arena;
+            CD_TEST_CHECK(cd_arena_init(buffer, capacity, &arena) == CD_RET_OK);
+            CD_U32 offset = 0;
+            CD_U32 peak = 0;
+            std::vector<Span> live;
+            std::vector<CD_U32> marks;
+            for (CD_S32 step = 0; step < 200; ++step)
+            {
+                const CD_U32 op = cd_test::rand_u32() % 10;
+                if (op == 0)
+                {
+                    marks.push_back(cd_arena_mark_v(&arena));
+                    CD_TEST_CHECK(marks.back() == offset);
+                    continue;
+                }
+                if (op == 1 && !marks.empty())
+                {
+                    // 回退到记录的位置,之后的分配全部失效
+                    const CD_U32 mark = marks.back();
+                    marks.pop_back();
+                    cd_arena_rewind_v(&arena, mark);
+                    offset = mark;
+                    while (!live.empty() && live.back().ptr >= buffer + mark)
+                    {
+                        live.pop_back();
+                    }
+                    CD_TEST_CHECK(arena.offset == offset);
+                    continue;
+                }
+                const CD_U32 size = (CD_U32)cd_test::rand_s(1, 300);
+                const CD_U32 align = 1u << cd_test::rand_s(0, 6);
+                const CD_U32 padding = model_padding(buffer, offset, align);
+                const CD_BOOL fits = (CD_U64)offset + padding + size <= capacity;
+                CD_VOID *p = CD_NULL;
+                const CD_RET ret = cd_arena_alloc(&arena, size, align, &p);
+                if (!fits)
+                {
+                    // 容量不足: 返回 E_MEM_FULL,状态不变
+                    CD_TEST_CHECK(ret == COLLISION_DETECTION_E_MEM_FULL);
+                    CD_TEST_CHECK(arena.offset == offset);
+                    continue;
+                }
+                CD_TEST_CHECK(ret == CD_RET_OK);
+                CD_TEST_CHECK(((uintptr_t)p & (align - 1)) == 0);
+                if (p != buffer + offset + padding)
+                {
+                    // 与模型不一致,后续比较已无意义
+                    CD_TEST_CHECK(CD_FALSE);
+                    break;
+                }
+                offset += padding + size;
+                peak = CD_MAX(peak, offset);
+                CD_TEST_CHECK(arena.offset == offset && arena.peak == peak);
+                const Span s = {(CD_U08 *)p, size, (CD_U08)(live.size() * 37 + 1)};
+                fill(s);
+                live.push_back(s);
+            }
+            // 所有仍有效的分配互不覆盖
+            for (size_t k = 0; k < live.size(); ++k)
+            {
+                CD_TEST_CHECK(intact(live[k]));
+            }
+            // 重置后从头分配,峰值保留
+            cd_arena_reset_v(&arena);
+            CD_TEST_CHECK(arena.offset == 0 && arena.peak == peak);
+            CD_VOID *first = CD_NULL;
+            CD_TEST_CHECK(cd_arena_alloc(&arena, 1, 1, &first) == CD_RET_OK);
+            CD_TEST_CHECK(first == buffer);
+        }
+    }
+
+    CD_VOID test_arena_known()
+    {
+        // 16字节对齐的64字节内存
+        union
+        {
+            CD_U08 bytes[64];
+            CD_F64 align;
+        } storage[2];
+        CD_U08 *buffer = storage[0].bytes;
+        while (((uintptr_t)buffer & 15) != 0)
+        {
+            ++buffer;
+        }
+        CD_ARENA arena;
+        CD_TEST_CHECK(cd_arena_init(buffer, 64, &arena) == CD_RET_OK);
+
+        // 恰好用完,再分配1字节失败
+        CD_VOID *p = CD_NULL;
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 64, 16, &p) == CD_RET_OK && p == buffer);
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 1, 1, &p) == COLLISION_DETECTION_E_MEM_FULL);
+
+        // 填充本身超过剩余容量: 剩2字节,按8对齐需填充4字节
+        CD_TEST_CHECK(cd_arena_init(buffer, 62, &arena) == CD_RET_OK);
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 60, 1, &p) == CD_RET_OK);
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 1, 8, &p) == COLLISION_DETECTION_E_MEM_FULL);
+        CD_TEST_CHECK(arena.offset == 60);
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 2, 2, &p) == CD_RET_OK && p == buffer + 60);
+        CD_TEST_CHECK(arena.offset == 62 && arena.peak == 62);
+        CD_TEST_CHECK(cd_arena_init(buffer, 64, &arena) == CD_RET_OK);
+
+        // 标记与回退: 回退后再分配得到同一地址;回退到更大的标记不生效
+        cd_arena_reset_v(&arena);
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 3, 1, &p) == CD_RET_OK);
+        const CD_U32 mark = cd_arena_mark_v(&arena);
+        CD_VOID *q = CD_NULL;
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 8, 8, &q) == CD_RET_OK && q == buffer + 8);
+        cd_arena_rewind_v(&arena, mark);
+        CD_TEST_CHECK(arena.offset == 3);
+        cd_arena_rewind_v(&arena, 40);
+        CD_TEST_CHECK(arena.offset == 3);
+        CD_VOID *r = CD_NULL;
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 8, 8, &r) == CD_RET_OK && r == q);
+
+        // 按类型分配数组
+        cd_arena_reset_v(&arena);
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 1, 1, &p) == CD_RET_OK);
+        CD_F64 *doubles = CD_NULL;
+        CD_TEST_CHECK(CD_ARENA_ALLOC_ARRAY(&arena, CD_F64, 3, &doubles) == CD_RET_OK);
+        CD_TEST_CHECK((CD_U08 *)doubles == buffer + CD_ALIGNOF(CD_F64) && arena.offset == CD_ALIGNOF(CD_F64) + 24);
+
+        // 参数检查
+        CD_TEST_CHECK(cd_arena_init(CD_NULL, 64, &arena) == COLLISION_DETECTION_E_MEM_NULL);
+        CD_TEST_CHECK(cd_arena_init(buffer, 0, &arena) == COLLISION_DETECTION_E_ZERO_NUM);
+        CD_TEST_CHECK(cd_arena_init(buffer, 64, CD_NULL) == COLLISION_DETECTION_E_PARAM_NULL);
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 0, 4, &p) == COLLISION_DETECTION_E_ZERO_NUM);
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 4, 0, &p) == COLLISION_DETECTION_E_MEM_ALIGN);
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 4, 12, &p) == COLLISION_DETECTION_E_MEM_ALIGN);
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 4, 4, CD_NULL) == COLLISION_DETECTION_E_PARAM_NULL);
+    }
+
+    CD_VOID test_pool_random()
+    {
+        std::vector<CD_U08> storage(8192 + 64);
+        for (CD_S32 iter = 0; iter < 300; ++iter)
+        {
+            const CD_U32 align = 1u << cd_test::rand_s(0, 6);
+            const CD_U32 block_size = (CD_U32)cd_test::rand_s(1, 100);
+            CD_U08 *buffer = storage.data();
+            while (((uintptr_t)buffer & 63) != 0)
+            {
+                ++buffer;
+            }
+            const CD_U32 size = (CD_U32)cd_test::rand_s(128, 8192);
+            CD_POOL pool;
+            memset(&pool, 0, sizeof(pool));
+            CD_TEST_CHECK(cd_pool_init(buffer, size, block_size, align, &pool) == CD_RET_OK);
+            // 块大小至少一个指针,按对齐向上取整
+            const CD_U32 block_align = CD_MAX(align, (CD_U32)CD_ALIGNOF(CD_VOID *));
+            const CD_U32 expected_block = (CD_MAX(block_size, (CD_U32)sizeof(CD_VOID *)) + block_align - 1) / block_align * block_align;
+            CD_TEST_CHECK(pool.blockSize == expected_block);
+            CD_TEST_CHECK(pool.capacity == (CD_S32)(size / expected_block));
+            if (pool.blockSize != expected_block)
+            {
+                // 块布局与模型不一致时写入会破坏空闲链表
+                continue;
+            }
+
+            std::vector<Span> live;
+            std::vector<CD_U08 *> freed; // 已释放的块,后进先出
+            CD_U32 bumped = 0;
+            for (CD_S32 step = 0; step < 600; ++step)
+            {
+                const CD_BOOL do_alloc = live.empty() || cd_test::rand_u32() % 5 < 3;
+                if (do_alloc)
+                {
+                    CD_VOID *p = CD_NULL;
+                    const CD_RET ret = cd_pool_alloc(&pool, &p);
+                    if ((CD_S32)live.size() == pool.capacity)
+                    {
+                        CD_TEST_CHECK(ret == COLLISION_DETECTION_E_MEM_FULL);
+                        CD_TEST_CHECK(pool.count == pool.capacity);
+                        continue;
+                    }
+                    CD_TEST_CHECK(ret == CD_RET_OK);
+                    if (ret != CD_RET_OK)
+                    {
+                        break;
+                    }
+                    CD_U08 *block = (CD_U08 *)p;
+                    if (!freed.empty())
+                    {
+                        CD_TEST_CHECK(block == freed.back());
+                        freed.pop_back();
+                    }
+                    else
+                    {
+                        // 从未分配过的块按地址顺序给出
+                        CD_TEST_CHECK(block == buffer + bumped * expected_block);
+                        ++bumped;
+                    }
+                    CD_TEST_CHECK(((uintptr_t)block & (block_align - 1)) == 0);
+                    if (block < buffer || block + expected_block > buffer + size)
+                    {
+                        CD_TEST_CHECK(CD_FALSE);
+                        break;
+                    }
+                    const Span s = {block, expected_block, (CD_U08)(step * 13 + 7)};
+                    fill(s);
+                    live.push_back(s);
+                }
+                else
+                {
+                    const size_t k = (size_t)cd_test::rand_s(0, (CD_S32)live.size() - 1);
+                    CD_TEST_CHECK(cd_pool_free(&pool, live[k].ptr) == CD_RET_OK);
+                    freed.push_back(live[k].ptr);
+                    live.erase(live.begin() + k);
+                }
+                CD_TEST_CHECK(pool.count == (CD_S32)live.size());
+            }
+            for (size_t k = 0; k < live.size(); ++k)
+            {
+                CD_TEST_CHECK(intact(live[k]));
+            }
+
+            // 非法释放: 空指针、块内部、未分配过的区域、范围外
+            CD_TEST_CHECK(cd_pool_free(&pool, CD_NULL) == COLLISION_DETECTION_E_MEM_NULL);
+            if (!live.empty())
+            {
+                CD_TEST_CHECK(cd_pool_free(&pool, live[0].ptr + 1) == COLLISION_DETECTION_E_MEM_ALIGN);
+            }
+            CD_TEST_CHECK(cd_pool_free(&pool, buffer + pool.bumpIndex * expected_block) == COLLISION_DETECTION_E_MEM_ALIGN);
+            CD_TEST_CHECK(cd_pool_free(&pool, buffer - expected_block) == COLLISION_DETECTION_E_MEM_ALIGN);
+            CD_TEST_CHECK(pool.count == (CD_S32)live.size());
+
+            // 重置后所有块重新可用,从首块开始
+            cd_pool_reset_v(&pool);
+            CD_TEST_CHECK(pool.count == 0);
+            for (CD_S32 k = 0; k < pool.capacity; ++k)
+            {
+                CD_VOID *p = CD_NULL;
+                CD_TEST_CHECK(cd_pool_alloc(&pool, &p) == CD_RET_OK && p == buffer + k * expected_block);
+            }
+            CD_VOID *p = CD_NULL;
+            CD_TEST_CHECK(cd_pool_alloc(&pool, &p) == COLLISION_DETECTION_E_MEM_FULL);
+        }
+    }
+
+    CD_VOID test_pool_known()
+    {
+        union
+        {
+            CD_U08 bytes[256];
+            CD_F64 align;
+        } storage;
+        CD_U08 *buffer = storage.bytes;
+        CD_POOL pool;
+        memset(&pool, 0, sizeof(pool));
+
+        // 块大小 20 按 16 对齐为 32,100 字节放得下 3 块
+        CD_U08 *aligned = buffer;
+        while (((uintptr_t)aligned & 15) != 0)
+        {
+            ++aligned;
+        }
+        CD_TEST_CHECK(cd_pool_init(aligned, 100, 20, 16, &pool) == CD_RET_OK);
+        CD_TEST_CHECK(pool.blockSize == 32 && pool.capacity == 3);
+
+        // 参数检查
+        CD_TEST_CHECK(cd_pool_init(aligned + 1, 100, 20, 16, &pool) == COLLISION_DETECTION_E_MEM_ALIGN);
+        CD_TEST_CHECK(cd_pool_init(aligned, 100, 20, 24, &pool) == COLLISION_DETECTION_E_MEM_ALIGN);
+        CD_TEST_CHECK(cd_pool_init(aligned, 100, 0, 16, &pool) == COLLISION_DETECTION_E_ZERO_NUM);
+        CD_TEST_CHECK(cd_pool_init(aligned, 16, 20, 16, &pool) == COLLISION_DETECTION_E_ZERO_NUM);
+        CD_TEST_CHECK(cd_pool_init(CD_NULL, 100, 20, 16, &pool) == COLLISION_DETECTION_E_MEM_NULL);
+        // 对齐小于指针时按指针对齐,起始地址也要满足
+        CD_TEST_CHECK(cd_pool_init(aligned + 1, 100, 4, 1, &pool) == COLLISION_DETECTION_E_MEM_ALIGN);
+        CD_TEST_CHECK(cd_pool_alloc(CD_NULL, CD_NULL) == COLLISION_DETECTION_E_PARAM_NULL);
+
+        // 在线性分配器上初始化: 占用 块大小 * 块数 字节,线性分配器不足时失败且不修改
+        CD_ARENA arena;
+        CD_TEST_CHECK(cd_arena_init(buffer + 1, 200, &arena) == CD_RET_OK);
+        CD_VOID *p = CD_NULL;
+        CD_TEST_CHECK(cd_arena_alloc(&arena, 1, 1, &p) == CD_RET_OK);
+        CD_TEST_CHECK(cd_pool_init_from_arena(&arena, 10, 8, 4, &pool) == CD_RET_OK);
+        CD_TEST_CHECK(pool.blockSize == 16 && pool.capacity == 4);
+        CD_TEST_CHECK(((uintptr_t)pool.base & 7) == 0 && pool.base >= buffer + 2);
+        CD_TEST_CHECK(arena.offset == (CD_U32)(pool.base - (buffer + 1)) + 64);
+        const CD_U32 offset = arena.offset;
+        CD_POOL big;
+        memset(&big, 0, sizeof(big));
+        CD_TEST_CHECK(cd_pool_init_from_arena(&arena, 10, 8, 100, &big) == COLLISION_DETECTION_E_MEM_FULL);
+        CD_TEST_CHECK(arena.offset == offset);
+        CD_TEST_CHECK(cd_pool_init_from_arena(&arena, 0x10000, 8, 0x10000, &big) == COLLISION_DETECTION_E_MEM_FULL);
+        CD_TEST_CHECK(cd_pool_init_from_arena(&arena, 10, 3, 4, &big) == COLLISION_DETECTION_E_MEM_ALIGN);
+        CD_TEST_CHECK(cd_pool_init_from_arena(&arena, 10, 8, 0, &big) == COLLISION_DETECTION_E_ZERO_NUM);
+
+        // 块在线性分配器的内存内,用完后 E_MEM_FULL
+        for (CD_S32 k = 0; k < 4; ++k)
+        {
+            CD_TEST_CHECK(cd_pool_alloc(&pool, &p) == CD_RET_OK);
+            CD_TEST_CHECK((CD_U08 *)p >= buffer + 1 && (CD_U08 *)p + 16 <= buffer + 1 + offset);
+        }
+        CD_TEST_CHECK(cd_pool_alloc(&pool, &p) == COLLISION_DETECTION_E_MEM_FULL);
+    }
+} // namespace
+
+int main()
+{
+    test_arena_known();
+    test_arena_random();
+    test_pool_known();
+    test_pool_random();
+    return cd_test::report("test_allocator");
+}
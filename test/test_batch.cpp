@@ -0,0 +1,440 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 15:14:26
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 15:14:26
+ */
+
+// 批量检测: SIMD 实现(以及定义 CD_SIMD_DISABLE 时的标量实现)与逐个调用的 _v 判定结果逐位一致,
+// 覆盖不是向量宽度整数倍的剩余点与恰好落在边界上的输入;点在多边形内另与双精度距离比较
+
+#include "cd_test.h"
+
+#include <algorithm>
+#include <math.h>
+#include <vector>
+
+namespace
+{
+#if defined(CD_SIMD_AVX2)
+    const char *kName = "test_batch (avx2)";
+#elif defined(CD_SIMD_SSE2)
+    const char *kName = "test_batch (sse2)";
+#else
+    const char *kName = "test_batch (scalar)";
+#endif
+
+    CD_VEC2 rand_vec(CD_F32 range)
+    {
+        return cd_vec2_make_v(cd_test::rand_f(-range, range), cd_test::rand_f(-range, range));
+    }
+
+    // 随机obb,一半为轴对齐,便于构造恰好落在边界上的点
+    CD_OBB rand_obb()
+    {
+        const CD_F32 heading = (cd_test::rand_u32() & 1) ? 0.0f : cd_test::rand_f(-3.2f, 3.2f);
+        return cd_create_obb_v(rand_vec(2.0f), cd_test::rand_f(0.1f, 3.0f), cd_test::rand_f(0.1f, 2.0f), heading);
+    }
+
+    // obb局部坐标系下的点转到世界坐标系
+    CD_VEC2 obb_point(const CD_OBB &obb, CD_F32 u, CD_F32 v)
+    {
+        return cd_vec2_make_v(obb.center.x + u * obb.q.c - v * obb.q.s, obb.center.y + u * obb.q.s + v * obb.q.c);
+    }
+
+    // 随机点: 一部分在obb的边上、角上或边界外 CD_EPS 处
+    CD_VEC2 rand_point_near(const CD_OBB *obbs, CD_S32 obb_count)
+    {
+        const CD_OBB &obb = obbs[cd_test::rand_s(0, obb_count - 1)];
+        const CD_F32 hl = obb.length * 0.5f;
+        const CD_F32 hw = obb.width * 0.5f;
+        switch (cd_test::rand_u32() % 5)
+        {
+        case 0:
+            return obb_point(obb, (cd_test::rand_u32() & 1) ? hl : -hl, cd_test::rand_f(-hw, hw));
+        case 1:
+            return obb_point(obb, cd_test::rand_f(-hl, hl), (cd_test::rand_u32() & 1) ? hw : -hw);
+        case 2:
+            return obb_point(obb, (cd_test::rand_u32() & 1) ? hl + CD_EPS : -hl - CD_EPS,
+                             (cd_test::rand_u32() & 1) ? hw + CD_EPS : -hw - CD_EPS);
+        default:
+            return rand_vec(4.0f);
+        }
+    }
+
+    CD_BOOL mask_bit(const std::vector<CD_U32> &mask, CD_S32 i)
+    {
+        return (mask[i >> 5] >> (i & 31)) & 1u;
+    }
+
+    CD_VOID test_points_in_obbs()
+    {
+        for (CD_S32 iter = 0; iter < 3000; ++iter)
+        {
+            const CD_S32 obb_count = cd_test::rand_s(1, MAX_BATCH_OBBS);
+            CD_OBB obbs[MAX_BATCH_OBBS];
+            for (CD_S32 k = 0; k < obb_count; ++k)
+            {
+                obbs[k] = rand_obb();
+            }
+            // 点数覆盖0、少于一个向量以及各种剩余点数;起始地址错开一个元素,测试非对齐加载
+            const CD_S32 count = (iter % 3 == 0) ? cd_test::rand_s(0, 9) : cd_test::rand_s(0, 200);
+            const CD_S32 offset = cd_test::rand_s(0, 1);
+            std::vector<CD_F32> xs(count + offset + 1);
+            std::vector<CD_F32> ys(count + offset + 1);
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                const CD_VEC2 p = rand_point_near(obbs, obb_count);
+                xs[offset + i] = p.x;
+                ys[offset + i] = p.y;
+            }
+
+            // 掩码预置为全1,多余的位必须被清零
+            const CD_S32 words = (count + 31) / 32;
+            std::vector<CD_U32> mask(words + 1, 0xFFFFFFFFu);
+            CD_S32 result = -1;
+            CD_TEST_CHECK(cd_points_in_obbs_batch(xs.data() + offset, ys.data() + offset, count, obbs, obb_count, mask.data(),
+                                                  &result) == CD_RET_OK);
+            CD_S32 expected = 0;
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                CD_BOOL inside = CD_FALSE;
+                for (CD_S32 k = 0; k < obb_count; ++k)
+                {
+                    inside = inside || cd_is_point_in_obb_v(obbs[k], cd_vec2_make_v(xs[offset + i], ys[offset + i]));
+                }
+                CD_TEST_CHECK(mask_bit(mask, i) == inside);
+                expected += inside;
+            }
+            CD_TEST_CHECK(result == expected);
+            if (count % 32 != 0)
+            {
+                CD_TEST_CHECK((mask[words - 1] >> (count % 32)) == 0u);
+            }
+            CD_TEST_CHECK(mask[words] == 0xFFFFFFFFu); // 不越界写
+
+            // 只要计数,或只要掩码
+            CD_S32 only_count = -1;
+            CD_TEST_CHECK(cd_points_in_obbs_batch(xs.data() + offset, ys.data() + offset, count, obbs, obb_count, CD_NULL,
+                                                  &only_count) == CD_RET_OK);
+            CD_TEST_CHECK(only_count == expected);
+            if (obb_count == 1)
+            {
+                std::vector<CD_U32> single(words + 1, 0);
+                CD_TEST_CHECK(cd_points_in_obb_batch(xs.data() + offset, ys.data() + offset, count, obbs, single.data(),
+                                                     CD_NULL) == CD_RET_OK);
+                for (CD_S32 w = 0; w < words; ++w)
+                {
+                    CD_TEST_CHECK(single[w] == mask[w]);
+                }
+            }
+        }
+    }
+
+    // 多边形视图及其存储,顶点数可超过 MAX_POLYGON_VERTICES 以覆盖多轮 CD_POLYGON_BATCH_EDGES
+    struct PolygonView
+    {
+        std::vector<CD_VEC2> vertices;
+        std::vector<CD_VEC2> normals;
+        CD_POLYGON_VIEW view;
+
+        PolygonView(const CD_VEC2 *points, CD_S32 count, CD_F32 radius) : vertices(points, points + count), normals(count)
+        {
+            cd_polygon_normals_v(vertices.data(), count, normals.data());
+            view.vertices = vertices.data();
+            view.normals = normals.data();
+            view.count = count;
+            view.radius = radius;
+        }
+    };
+
+    // 双精度参考: 到多边形的有符号距离(内部为负)
+    CD_F64 polygon_signed_distance(const CD_POLYGON_VIEW &view, CD_VEC2 p)
+    {
+        CD_F64 inside = -1e30;
+        CD_F64 outside = 1e30;
+        for (CD_S32 i = 0; i < view.count; ++i)
+        {
+            const CD_VEC2 a = view.vertices[i];
+            const CD_VEC2 b = view.vertices[i + 1 < view.count ? i + 1 : 0];
+            const CD_F64 ex = (CD_F64)b.x - a.x, ey = (CD_F64)b.y - a.y;
+            const CD_F64 len = sqrt(ex * ex + ey * ey);
+            const CD_F64 px = (CD_F64)p.x - a.x, py = (CD_F64)p.y - a.y;
+            inside = CD_MAX(inside, (px * ey - py * ex) / len);
+            const CD_F64 t = CD_MAX(0.0, CD_MIN(1.0, (px * ex + py * ey) / (len * len)));
+            outside = CD_MIN(outside, sqrt((px - t * ex) * (px - t * ex) + (py - t * ey) * (py - t * ey)));
+        }
+        return inside <= 0.0 ? inside : outside;
+    }
+
+    // 随机点: 一部分在顶点、边上,或沿边法向外移 radius(圆角带的边界)
+    CD_VEC2 rand_point_near_polygon(const CD_POLYGON_VIEW &view, CD_F32 radius)
+    {
+        const CD_S32 i = cd_test::rand_s(0, view.count - 1);
+        const CD_VEC2 a = view.vertices[i];
+        const CD_VEC2 b = view.vertices[i + 1 < view.count ? i + 1 : 0];
+        const CD_VEC2 on_edge = cd_vec2_add_v(a, cd_vec2_scale_v(cd_vec2_sub_v(b, a), cd_test::rand_f(0.0f, 1.0f)));
+        switch (cd_test::rand_u32() % 7)
+        {
+        case 0:
+            return a;
+        case 4:
+            // 对角点在原点的轴对齐多边形,左、下边外 CD_EPS 处的分离量恰好等于 CD_EPS
+            return (cd_test::rand_u32() & 1) ? cd_vec2_make_v(-CD_EPS, on_edge.y) : cd_vec2_make_v(on_edge.x, -CD_EPS);
+        case 1:
+            return on_edge;
+        case 2:
+            return cd_vec2_mul_add_v(on_edge, radius * cd_test::rand_f(0.9f, 1.1f), view.normals[i]);
+        case 3:
+            // 角点外的圆角区域
+            return cd_vec2_mul_add_v(a, radius * cd_test::rand_f(0.9f, 1.1f), cd_create_unit_vec2_v(cd_test::rand_f(-3.2f, 3.2f)));
+        default:
+            return rand_vec(3.0f);
+        }
+    }
+
+    CD_VOID test_points_in_polygon()
+    {
+        CD_S32 decided = 0;
+        for (CD_S32 iter = 0; iter < 600; ++iter)
+        {
+            CD_VEC2 points[64];
+            CD_S32 vertex_count = 0;
+            CD_POLYGON polygon;
+            CD_BOOL has_polygon = CD_FALSE;
+            if (iter % 6 == 1)
+            {
+                const CD_F32 side = cd_test::rand_f(0.5f, 2.0f);
+                vertex_count = 4;
+                points[0] = cd_vec2_make_v(0.0f, 0.0f);
+                points[1] = cd_vec2_make_v(side, 0.0f);
+                points[2] = cd_vec2_make_v(side, side);
+                points[3] = cd_vec2_make_v(0.0f, side);
+            }
+            else if (iter % 3 == 0)
+            {
+                // 正多边形,边数跨过 CD_POLYGON_BATCH_EDGES 的整数倍
+                vertex_count = cd_test::rand_s(3, 40);
+                const CD_F32 r = cd_test::rand_f(0.5f, 2.5f);
+                const CD_F32 phase = cd_test::rand_f(-3.2f, 3.2f);
+                for (CD_S32 k = 0; k < vertex_count; ++k)
+                {
+                    points[k] = cd_vec2_scale_v(cd_create_unit_vec2_v(phase + 2.0f * CD_PI * k / vertex_count), r);
+                }
+            }
+            else
+            {
+                CD_VEC2 raw[MAX_POLYGON_VERTICES];
+                CD_VEC2 scratch[CD_HULL_SCRATCH_SIZE(MAX_POLYGON_VERTICES)];
+                const CD_S32 raw_count = cd_test::rand_s(3, MAX_POLYGON_VERTICES);
+                for (CD_S32 k = 0; k < raw_count; ++k)
+                {
+                    raw[k] = rand_vec(2.0f);
+                }
+                if (cd_make_polygon(raw, raw_count, 0.0f, scratch, &polygon) != CD_RET_OK)
+                {
+                    continue;
+                }
+                has_polygon = CD_TRUE;
+                vertex_count = polygon.count;
+                for (CD_S32 k = 0; k < vertex_count; ++k)
+                {
+                    points[k] = polygon.vertices[k];
+                }
+            }
+            const CD_F32 radius = (iter & 1) ? 0.0f : cd_test::rand_f(0.05f, 0.6f);
+            const PolygonView pv(points, vertex_count, radius);
+
+            // 点数跨过 CD_POLYGON_BATCH_TILE 分块,起始地址错开一个元素
+            const CD_S32 count = (iter % 4 == 0) ? cd_test::rand_s(0, 9) : cd_test::rand_s(0, 2 * CD_POLYGON_BATCH_TILE + 37);
+            const CD_S32 offset = cd_test::rand_s(0, 1);
+            std::vector<CD_F32> xs(count + offset + 1);
+            std::vector<CD_F32> ys(count + offset + 1);
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                const CD_VEC2 p = rand_point_near_polygon(pv.view, radius);
+                xs[offset + i] = p.x;
+                ys[offset + i] = p.y;
+            }
+
+            const CD_S32 words = (count + 31) / 32;
+            std::vector<CD_U32> mask(words + 1, 0xFFFFFFFFu);
+            CD_S32 result = -1;
+            CD_TEST_CHECK(cd_points_in_polygon_view_batch(xs.data() + offset, ys.data() + offset, count, &pv.view, radius, mask.data(),
+                                                          &result) == CD_RET_OK);
+            CD_S32 expected = 0;
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                const CD_VEC2 p = cd_vec2_make_v(xs[offset + i], ys[offset + i]);
+                const CD_BOOL inside = cd_point_in_polygon_view_v(&pv.view, p, radius);
+                CD_TEST_CHECK(mask_bit(mask, i) == inside);
+                expected += inside;
+                // 离边界足够远时与双精度参考一致
+                const CD_F64 sd = polygon_signed_distance(pv.view, p);
+                if (fabs(sd - radius) > 1e-4)
+                {
+                    CD_TEST_CHECK(inside == (sd < radius));
+                    ++decided;
+                }
+            }
+            CD_TEST_CHECK(result == expected);
+            if (count % 32 != 0)
+            {
+                CD_TEST_CHECK((mask[words - 1] >> (count % 32)) == 0u);
+            }
+            CD_TEST_CHECK(mask[words] == 0xFFFFFFFFu); // 不越界写
+
+            CD_S32 only_count = -1;
+            CD_TEST_CHECK(cd_points_in_polygon_view_batch(xs.data() + offset, ys.data() + offset, count, &pv.view, radius, CD_NULL,
+                                                          &only_count) == CD_RET_OK);
+            CD_TEST_CHECK(only_count == expected);
+            if (has_polygon)
+            {
+                std::vector<CD_U32> by_polygon(words + 1, 0);
+                CD_TEST_CHECK(cd_points_in_polygon_batch(xs.data() + offset, ys.data() + offset, count, &polygon, radius,
+                                                         by_polygon.data(), CD_NULL) == CD_RET_OK);
+                for (CD_S32 w = 0; w < words; ++w)
+                {
+                    CD_TEST_CHECK(by_polygon[w] == mask[w]);
+                }
+            }
+        }
+        CD_TEST_CHECK(decided > 50000);
+
+        // 参数检查
+        const CD_VEC2 square[4] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+        const PolygonView pv(square, 4, 0.0f);
+        const CD_F32 x = 0.5f;
+        CD_U32 word = 0;
+        CD_S32 result = 0;
+        CD_TEST_CHECK(cd_points_in_polygon_view_batch(&x, &x, 1, &pv.view, 0.0f, &word, &result) == CD_RET_OK);
+        CD_TEST_CHECK(word == 1u && result == 1);
+        CD_TEST_CHECK(cd_points_in_polygon_view_batch(&x, &x, 1, &pv.view, 0.0f, CD_NULL, CD_NULL) ==
+                      COLLISION_DETECTION_E_PARAM_NULL);
+        CD_TEST_CHECK(cd_points_in_polygon_view_batch(&x, &x, -1, &pv.view, 0.0f, &word, &result) == COLLISION_DETECTION_E_ZERO_NUM);
+        CD_TEST_CHECK(cd_points_in_polygon_batch(&x, &x, 1, CD_NULL, 0.0f, &word, &result) == COLLISION_DETECTION_E_PARAM_NULL);
+    }
+
+    // 坐标取自粗网格,边界相接的aabb很常见
+    CD_AABB rand_grid_aabb()
+    {
+        CD_AABB a;
+        a.lowerBound = cd_vec2_make_v(0.5f * cd_test::rand_s(-10, 10), 0.5f * cd_test::rand_s(-10, 10));
+        a.upperBound = cd_vec2_add_v(a.lowerBound, cd_vec2_make_v(0.5f * cd_test::rand_s(0, 4), 0.5f * cd_test::rand_s(0, 4)));
+        return a;
+    }
+
+    struct AabbSoa
+    {
+        std::vector<CD_F32> lowerX, lowerY, upperX, upperY;
+        std::vector<CD_AABB> aabbs;
+        CD_AABB_SOA soa;
+
+        explicit AabbSoa(CD_S32 count) : lowerX(count + 1), lowerY(count + 1), upperX(count + 1), upperY(count + 1), aabbs(count)
+        {
+            soa.lowerX = lowerX.data();
+            soa.lowerY = lowerY.data();
+            soa.upperX = upperX.data();
+            soa.upperY = upperY.data();
+            soa.count = count;
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                aabbs[i] = rand_grid_aabb();
+                cd_aabb_soa_set(&soa, i, &aabbs[i]);
+            }
+        }
+    };
+
+    CD_VOID test_aabb_overlap()
+    {
+        for (CD_S32 iter = 0; iter < 3000; ++iter)
+        {
+            const CD_S32 count = (iter % 3 == 0) ? cd_test::rand_s(0, 9) : cd_test::rand_s(0, 100);
+            AabbSoa boxes(count);
+            const CD_AABB query = rand_grid_aabb();
+            std::vector<CD_S32> expected;
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                if (cd_aabb_overlap_v(query, boxes.aabbs[i]))
+                {
+                    expected.push_back(i);
+                }
+            }
+            std::vector<CD_S32> indices(count + 1, -1);
+            CD_S32 result = -1;
+            CD_TEST_CHECK(cd_aabb_overlap_batch(&query, &boxes.soa, indices.data(), count, &result) == CD_RET_OK);
+            CD_TEST_CHECK(std::vector<CD_S32>(indices.begin(), indices.begin() + CD_MAX(result, 0)) == expected);
+
+            // 容量不足: 输出前 capacity 个
+            if (!expected.empty())
+            {
+                const CD_S32 capacity = cd_test::rand_s(0, (CD_S32)expected.size() - 1);
+                CD_TEST_CHECK(cd_aabb_overlap_batch(&query, &boxes.soa, indices.data(), capacity, &result) ==
+                              COLLISION_DETECTION_E_MEM_FULL);
+                CD_TEST_CHECK(result == capacity);
+                CD_TEST_CHECK(std::equal(expected.begin(), expected.begin() + capacity, indices.begin()));
+            }
+        }
+    }
+
+    CD_BOOL pair_less(const CD_INDEX_PAIR &a, const CD_INDEX_PAIR &b)
+    {
+        return a.indexA != b.indexA ? a.indexA < b.indexA : a.indexB < b.indexB;
+    }
+
+    CD_VOID test_aabbs_overlap()
+    {
+        for (CD_S32 iter = 0; iter < 50; ++iter)
+        {
+            // 跨过多个 CD_AABB_BATCH_CHUNK 分块,最后一块不满
+            const CD_S32 count = cd_test::rand_s(0, 3 * CD_AABB_BATCH_CHUNK + 7);
+            const CD_S32 query_count = cd_test::rand_s(1, 20);
+            AabbSoa boxes(count);
+            std::vector<CD_AABB> queries(query_count);
+            std::vector<CD_INDEX_PAIR> expected;
+            for (CD_S32 q = 0; q < query_count; ++q)
+            {
+                queries[q] = rand_grid_aabb();
+                for (CD_S32 i = 0; i < count; ++i)
+                {
+                    if (cd_aabb_overlap_v(queries[q], boxes.aabbs[i]))
+                    {
+                        const CD_INDEX_PAIR pair = {q, i};
+                        expected.push_back(pair);
+                    }
+                }
+            }
+            const CD_S32 capacity = (CD_S32)expected.size();
+            std::vector<CD_INDEX_PAIR> pairs(capacity + 1);
+            CD_S32 result = -1;
+            CD_TEST_CHECK(cd_aabbs_overlap_batch(queries.data(), query_count, &boxes.soa, pairs.data(), capacity, &result) ==
+                          CD_RET_OK);
+            CD_TEST_CHECK(result == capacity);
+            std::vector<CD_INDEX_PAIR> got(pairs.begin(), pairs.begin() + CD_MAX(result, 0));
+            std::sort(got.begin(), got.end(), pair_less);
+            CD_BOOL same = got.size() == expected.size();
+            for (size_t k = 0; same && k < got.size(); ++k)
+            {
+                same = got[k].indexA == expected[k].indexA && got[k].indexB == expected[k].indexB;
+            }
+            CD_TEST_CHECK(same);
+
+            if (capacity > 0)
+            {
+                const CD_S32 partial = cd_test::rand_s(0, capacity - 1);
+                CD_TEST_CHECK(cd_aabbs_overlap_batch(queries.data(), query_count, &boxes.soa, pairs.data(), partial, &result) ==
+                              COLLISION_DETECTION_E_MEM_FULL);
+                CD_TEST_CHECK(result == partial);
+            }
+        }
+    }
+} // namespace
+
+int main()
+{
+    test_points_in_obbs();
+    test_points_in_polygon();
+    test_aabb_overlap();
+    test_aabbs_overlap();
+    return cd_test::report(kName);
+}
@@ -0,0 +1,236 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 11:55:09
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 11:55:09
+ */
+
+// 胶囊体: 闭式线段距离与各重叠测试,以核心点集上的 GJK 距离为参考
+
+#include "cd_test.h"
+
+namespace
+{
+    const CD_S32 kCases = 20000;
+    const CD_F32 kBand = 1e-3f; // 参考距离与半径和过于接近时不判定重叠结果
+
+    CD_VEC2 rand_vec(CD_F32 range)
+    {
+        return cd_vec2_make_v(cd_test::rand_f(-range, range), cd_test::rand_f(-range, range));
+    }
+
+    // 覆盖一般、退化成点、平行与共线的线段
+    CD_SEGMENT rand_segment(const CD_SEGMENT *other)
+    {
+        CD_SEGMENT s;
+        s.point1 = rand_vec(2.0f);
+        switch (cd_test::rand_u32() % 8)
+        {
+        case 0:
+            s.point2 = s.point1;
+            break;
+        case 1:
+        {
+            // 与 other 平行
+            const CD_F32 k = cd_test::rand_f(-1.5f, 1.5f);
+            s.point2 = cd_vec2_mul_add_v(s.point1, k, cd_vec2_sub_v(other->point2, other->point1));
+            break;
+        }
+        case 2:
+        {
+            // 与 other 共线
+            const CD_VEC2 d = cd_vec2_sub_v(other->point2, other->point1);
+            s.point1 = cd_vec2_mul_add_v(other->point1, cd_test::rand_f(-1.5f, 1.5f), d);
+            s.point2 = cd_vec2_mul_add_v(other->point1, cd_test::rand_f(-1.5f, 1.5f), d);
+            break;
+        }
+        default:
+            s.point2 = cd_vec2_add_v(s.point1, rand_vec(2.0f));
+            break;
+        }
+        return s;
+    }
+
+    CD_CAPSULE rand_capsule()
+    {
+        return cd_create_capsule_v(rand_vec(2.0f), rand_vec(2.0f), cd_test::rand_f(0.05f, 0.6f));
+    }
+
+    CD_F32 gjk_distance(const CD_VEC2 *points_a, CD_S32 count_a, const CD_VEC2 *points_b, CD_S32 count_b)
+    {
+        CD_DISTANCE_SPAN_INPUT input;
+        input.proxyA = cd_make_span_v(points_a, count_a, 0.0f);
+        input.proxyB = cd_make_span_v(points_b, count_b, 0.0f);
+        input.transformA = TRANSFORM_IDENTITY;
+        input.transformB = TRANSFORM_IDENTITY;
+        input.useRadii = CD_FALSE;
+        CD_DISTANCE_CACHE cache = emptyDistanceCache;
+        CD_DISTANCE_OUTPUT output;
+        cd_shape_distance_span(&cache, &input, CD_NULL, 0, &output);
+        return output.distance;
+    }
+
+    CD_F32 gjk_segment_distance(CD_SEGMENT s, const CD_VEC2 *points, CD_S32 count)
+    {
+        const CD_VEC2 seg_points[2] = {s.point1, s.point2};
+        return gjk_distance(seg_points, 2, points, count);
+    }
+
+    // 核心距离为0时一定重叠,否则在边界附近的带宽内不判定
+    CD_BOOL decidable(CD_F32 core, CD_F32 radius)
+    {
+        return core <= 0.0f || CD_FABS(core - radius) >= kBand;
+    }
+
+    CD_VOID test_segments_distance()
+    {
+        CD_SEGMENT prev;
+        prev.point1 = rand_vec(2.0f);
+        prev.point2 = rand_vec(2.0f);
+        for (CD_S32 i = 0; i < kCases; ++i)
+        {
+            const CD_SEGMENT s1 = rand_segment(&prev);
+            const CD_SEGMENT s2 = rand_segment(&s1);
+            prev = s2;
+            const CD_SEGMENT_DISTANCE_RESULT r = cd_segments_distance_v(s1, s2);
+            const CD_VEC2 points2[2] = {s2.point1, s2.point2};
+            CD_TEST_CHECK_NEAR(sqrtf(r.distanceSquared), gjk_segment_distance(s1, points2, 2), 1e-4);
+            // 最近点、比例与距离平方相互一致
+            CD_TEST_CHECK(r.fraction1 >= 0.0f && r.fraction1 <= 1.0f && r.fraction2 >= 0.0f && r.fraction2 <= 1.0f);
+            CD_TEST_CHECK_NEAR(cd_vec2_dis_sqr_v(r.closest1, r.closest2), r.distanceSquared, 1e-5);
+            const CD_VEC2 p1 = cd_vec2_mul_add_v(s1.point1, r.fraction1, cd_vec2_sub_v(s1.point2, s1.point1));
+            const CD_VEC2 p2 = cd_vec2_mul_add_v(s2.point1, r.fraction2, cd_vec2_sub_v(s2.point2, s2.point1));
+            CD_TEST_CHECK_NEAR(cd_vec2_dis_v(p1, r.closest1), 0.0, 1e-5);
+            CD_TEST_CHECK_NEAR(cd_vec2_dis_v(p2, r.closest2), 0.0, 1e-5);
+        }
+    }
+
+    CD_VOID test_capsule_capsule()
+    {
+        for (CD_S32 i = 0; i < kCases; ++i)
+        {
+            const CD_CAPSULE a = rand_capsule();
+            const CD_CAPSULE b = rand_capsule();
+            const CD_VEC2 points_b[2] = {b.seg.point1, b.seg.point2};
+            const CD_F32 core = gjk_segment_distance(a.seg, points_b, 2);
+            const CD_F32 radius = a.radius + b.radius;
+            CD_TEST_CHECK_NEAR(cd_capsules_distance_v(a, b), CD_MAX(0.0f, core - radius), 1e-4);
+            if (decidable(core, radius))
+            {
+                CD_TEST_CHECK(cd_capsules_overlap_v(a, b) == (core < radius));
+            }
+        }
+    }
+
+    CD_VOID test_capsule_circle()
+    {
+        for (CD_S32 i = 0; i < kCases; ++i)
+        {
+            const CD_CAPSULE a = rand_capsule();
+            CD_CIRCLE c;
+            c.center = rand_vec(2.5f);
+            c.radius = cd_test::rand_f(0.05f, 0.6f);
+            const CD_F32 core = gjk_segment_distance(a.seg, &c.center, 1);
+            const CD_F32 radius = a.radius + c.radius;
+            if (decidable(core, radius))
+            {
+                CD_TEST_CHECK(cd_capsule_circle_overlap_v(a, c) == (core < radius));
+            }
+        }
+    }
+
+    CD_VOID test_capsule_box()
+    {
+        for (CD_S32 i = 0; i < kCases; ++i)
+        {
+            const CD_CAPSULE a = rand_capsule();
+            const CD_OBB obb = cd_create_obb_v(rand_vec(2.5f), cd_test::rand_f(0.1f, 2.0f), cd_test::rand_f(0.1f, 1.5f),
+                                               cd_test::rand_f(-3.2f, 3.2f));
+            CD_VEC2 vertices[4];
+            cd_obb_vertices_v(obb, vertices);
+            const CD_F32 core = gjk_segment_distance(a.seg, vertices, 4);
+            if (decidable(core, a.radius))
+            {
+                CD_TEST_CHECK(cd_capsule_obb_overlap_v(a, obb) == (core < a.radius));
+            }
+
+            CD_AABB box;
+            box.lowerBound = rand_vec(2.5f);
+            box.upperBound = cd_vec2_add_v(box.lowerBound, cd_vec2_make_v(cd_test::rand_f(0.1f, 2.0f), cd_test::rand_f(0.1f, 2.0f)));
+            const CD_VEC2 corners[4] = {box.lowerBound, cd_vec2_make_v(box.upperBound.x, box.lowerBound.y), box.upperBound,
+                                        cd_vec2_make_v(box.lowerBound.x, box.upperBound.y)};
+            const CD_F32 core_box = gjk_segment_distance(a.seg, corners, 4);
+            if (decidable(core_box, a.radius))
+            {
+                CD_TEST_CHECK(cd_capsule_aabb_overlap_v(a, box) == (core_box < a.radius));
+            }
+        }
+    }
+
+    CD_VOID test_capsule_polygon()
+    {
+        CD_S32 checked = 0;
+        for (CD_S32 i = 0; i < kCases; ++i)
+        {
+            const CD_CAPSULE a = rand_capsule();
+            const CD_VEC2 center = rand_vec(2.0f);
+            CD_VEC2 points[MAX_POLYGON_VERTICES];
+            CD_VEC2 scratch[CD_HULL_SCRATCH_SIZE(MAX_POLYGON_VERTICES)];
+            const CD_S32 count = cd_test::rand_s(3, MAX_POLYGON_VERTICES);
+            for (CD_S32 k = 0; k < count; ++k)
+            {
+                points[k] = cd_vec2_add_v(center, rand_vec(1.0f));
+            }
+            const CD_F32 rounding = (cd_test::rand_u32() & 1) ? cd_test::rand_f(0.05f, 0.4f) : 0.0f;
+            CD_POLYGON polygon;
+            if (cd_make_polygon(points, count, rounding, scratch, &polygon) != CD_RET_OK)
+            {
+                continue;
+            }
+            const CD_F32 core = gjk_segment_distance(a.seg, polygon.vertices, polygon.count);
+            const CD_F32 radius = a.radius + rounding;
+            if (decidable(core, radius))
+            {
+                CD_BOOL overlap = CD_FALSE;
+                CD_TEST_CHECK(cd_capsule_polygon_overlap(&a, &polygon, &overlap) == CD_RET_OK);
+                CD_TEST_CHECK(overlap == (core < radius));
+                ++checked;
+            }
+        }
+        CD_TEST_CHECK(checked > kCases / 2);
+    }
+
+    CD_VOID test_swept_circle()
+    {
+        for (CD_S32 i = 0; i < 1000; ++i)
+        {
+            CD_CIRCLE c;
+            c.center = rand_vec(2.0f);
+            c.radius = cd_test::rand_f(0.05f, 0.6f);
+            const CD_VEC2 translation = rand_vec(3.0f);
+            const CD_CAPSULE swept = cd_swept_circle_capsule_v(c, translation);
+            const CD_AABB box = cd_capsule_to_aabb_v(swept);
+            // 扫掠路径上任一位置的圆都在胶囊体内,胶囊体在 aabb 内
+            for (CD_S32 k = 0; k <= 8; ++k)
+            {
+                CD_CIRCLE moved = c;
+                moved.center = cd_vec2_mul_add_v(c.center, (CD_F32)k / 8.0f, translation);
+                const CD_VEC2 edge = cd_vec2_mul_add_v(moved.center, c.radius, cd_create_unit_vec2_v(cd_test::rand_f(0.0f, CD_2PI)));
+                CD_TEST_CHECK(cd_vec2_dis_v(edge, cd_segment_nearest_point_v(swept.seg, edge)) <= swept.radius + 1e-5f);
+                CD_TEST_CHECK(edge.x >= box.lowerBound.x - 1e-5f && edge.x <= box.upperBound.x + 1e-5f &&
+                              edge.y >= box.lowerBound.y - 1e-5f && edge.y <= box.upperBound.y + 1e-5f);
+            }
+        }
+    }
+} // namespace
+
+int main()
+{
+    test_segments_distance();
+    test_capsule_capsule();
+    test_capsule_circle();
+    test_capsule_box();
+    test_capsule_polygon();
+    test_swept_circle();
+    return cd_test::report("test_capsule");
+}
@@ -0,0 +1,184 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 13:10:42
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 13:10:42
+ */
+
+// 覆盖圆: 覆盖圆包含多边形与obb的边界,点云与圆形障碍物检查与逐个暴力检查一致,无碰撞时输出复位
+
+#include "cd_test.h"
+
+#include <vector>
+
+namespace
+{
+    CD_VEC2 rand_vec(CD_F32 range)
+    {
+        return cd_vec2_make_v(cd_test::rand_f(-range, range), cd_test::rand_f(-range, range));
+    }
+
+    // 点是否在某个覆盖圆内(允许浮点误差)
+    CD_BOOL covered(const CD_CIRCLE_COVER *cover, CD_VEC2 p)
+    {
+        for (CD_S32 k = 0; k < cover->count; ++k)
+        {
+            if (cd_vec2_dis_v(p, cover->circles[k].center) <= cover->circles[k].radius + 1e-4f)
+            {
+                return CD_TRUE;
+            }
+        }
+        return CD_FALSE;
+    }
+
+    // 凸多边形边界上的采样点(含圆角外扩)都在覆盖圆内,覆盖圆都在外接圆内
+    CD_VOID check_covers_boundary(const CD_CIRCLE_COVER *cover, const CD_VEC2 *vertices, CD_S32 count, CD_F32 radius)
+    {
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            const CD_VEC2 p1 = vertices[i];
+            const CD_VEC2 p2 = vertices[i + 1 < count ? i + 1 : 0];
+            for (CD_S32 k = 0; k <= 16; ++k)
+            {
+                const CD_VEC2 p = cd_vec2_mul_add_v(p1, (CD_F32)k / 16.0f, cd_vec2_sub_v(p2, p1));
+                const CD_VEC2 offset = cd_vec2_scale_v(cd_create_unit_vec2_v(cd_test::rand_f(0.0f, CD_2PI)), radius);
+                CD_TEST_CHECK(covered(cover, cd_vec2_add_v(p, offset)));
+            }
+        }
+        for (CD_S32 k = 0; k < cover->count; ++k)
+        {
+            CD_TEST_CHECK(cd_vec2_dis_v(cover->bound.center, cover->circles[k].center) + cover->circles[k].radius <=
+                          cover->bound.radius + 1e-4f);
+        }
+    }
+
+    CD_VOID test_polygon_cover()
+    {
+        for (CD_S32 iter = 0; iter < 2000; ++iter)
+        {
+            CD_VEC2 points[MAX_POLYGON_VERTICES];
+            CD_VEC2 scratch[CD_HULL_SCRATCH_SIZE(MAX_POLYGON_VERTICES)];
+            const CD_S32 count = cd_test::rand_s(3, MAX_POLYGON_VERTICES);
+            // 拉长的点云,覆盖需要多个圆的情况
+            const CD_F32 stretch = cd_test::rand_f(1.0f, 5.0f);
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                const CD_VEC2 p = rand_vec(1.0f);
+                points[i] = cd_vec2_make_v(p.x * stretch, p.y);
+            }
+            const CD_F32 radius = (cd_test::rand_u32() & 1) ? cd_test::rand_f(0.05f, 0.3f) : 0.0f;
+            CD_POLYGON polygon;
+            if (cd_make_polygon(points, count, radius, scratch, &polygon) != CD_RET_OK)
+            {
+                continue;
+            }
+            CD_CIRCLE_COVER cover;
+            cover.count = 0;
+            const CD_F32 tolerance = cd_test::rand_f(0.02f, 0.5f);
+            CD_TEST_CHECK(cd_circle_cover_from_polygon(&polygon, tolerance, &cover) == CD_RET_OK);
+            CD_TEST_CHECK(cover.count >= 1 && cover.count <= CD_MAX_COVER_CIRCLES);
+            check_covers_boundary(&cover, polygon.vertices, polygon.count, polygon.radius);
+        }
+
+        // 顶点数超过上限的多边形被拒绝
+        CD_POLYGON bad;
+        bad.count = MAX_POLYGON_VERTICES + 1;
+        bad.radius = 0.0f;
+        CD_CIRCLE_COVER cover;
+        CD_TEST_CHECK(cd_circle_cover_from_polygon(&bad, 0.1f, &cover) == COLLISION_DETECTION_E_ZERO_NUM);
+    }
+
+    CD_VOID test_obb_cover()
+    {
+        for (CD_S32 iter = 0; iter < 2000; ++iter)
+        {
+            const CD_OBB obb = cd_create_obb_v(rand_vec(1.0f), cd_test::rand_f(0.2f, 6.0f), cd_test::rand_f(0.2f, 2.0f),
+                                               cd_test::rand_f(-3.2f, 3.2f));
+            CD_CIRCLE_COVER cover;
+            CD_TEST_CHECK(cd_circle_cover_from_obb(&obb, cd_test::rand_f(0.02f, 0.5f), &cover) == CD_RET_OK);
+            CD_VEC2 vertices[4];
+            cd_obb_vertices_v(obb, vertices);
+            check_covers_boundary(&cover, vertices, 4, 0.0f);
+        }
+    }
+
+    CD_VOID test_checks_match_brute_force()
+    {
+        const CD_OBB footprint = cd_create_obb_v(cd_vec2_make_v(0.0f, 0.0f), 2.0f, 1.0f, 0.0f);
+        CD_CIRCLE_COVER cover;
+        cd_circle_cover_from_obb(&footprint, 0.1f, &cover);
+        for (CD_S32 iter = 0; iter < 500; ++iter)
+        {
+            const CD_S32 pose_count = cd_test::rand_s(1, 8);
+            CD_TRANSFORM poses[8];
+            for (CD_S32 p = 0; p < pose_count; ++p)
+            {
+                poses[p].p = rand_vec(5.0f);
+                poses[p].q = cd_rot_from_angle_v(cd_test::rand_f(-3.2f, 3.2f));
+            }
+            const CD_S32 point_count = cd_test::rand_s(0, 20);
+            std::vector<CD_F32> xs(point_count + 1);
+            std::vector<CD_F32> ys(point_count + 1);
+            std::vector<CD_CIRCLE> obstacles(point_count + 1);
+            for (CD_S32 i = 0; i < point_count; ++i)
+            {
+                xs[i] = cd_test::rand_f(-6.0f, 6.0f);
+                ys[i] = cd_test::rand_f(-6.0f, 6.0f);
+                obstacles[i].center = cd_vec2_make_v(xs[i], ys[i]);
+                obstacles[i].radius = cd_test::rand_f(0.0f, 0.3f);
+            }
+
+            // 暴力: 按位姿、点、覆盖圆的顺序找第一个碰撞,不做外接圆剔除
+            CD_S32 expected_pose = CD_TRAJECTORY_NO_HIT;
+            CD_S32 expected_point = CD_TRAJECTORY_NO_HIT;
+            CD_S32 expected_obstacle_pose = CD_TRAJECTORY_NO_HIT;
+            CD_S32 expected_obstacle = CD_TRAJECTORY_NO_HIT;
+            for (CD_S32 p = 0; p < pose_count; ++p)
+            {
+                CD_CIRCLE circles[CD_MAX_COVER_CIRCLES];
+                cd_circle_cover_transform_v(&cover, poses[p], circles);
+                for (CD_S32 i = 0; i < point_count; ++i)
+                {
+                    for (CD_S32 k = 0; k < cover.count; ++k)
+                    {
+                        const CD_F32 dis_sqr = cd_vec2_dis_sqr_v(obstacles[i].center, circles[k].center);
+                        if (expected_pose == CD_TRAJECTORY_NO_HIT && dis_sqr <= circles[k].radius * circles[k].radius)
+                        {
+                            expected_pose = p;
+                            expected_point = i;
+                        }
+                        if (expected_obstacle_pose == CD_TRAJECTORY_NO_HIT &&
+                            dis_sqr <= CD_SQUARE(circles[k].radius + obstacles[i].radius))
+                        {
+                            expected_obstacle_pose = p;
+                            expected_obstacle = i;
+                        }
+                    }
+                }
+            }
+
+            // 输出预置为上一次的值,无碰撞时必须复位
+            CD_S32 pose = 12345;
+            CD_S32 point = 12345;
+            CD_TEST_CHECK(cd_circle_cover_check_points(&cover, poses, pose_count, xs.data(), ys.data(), point_count,
+                                                       &pose, &point) == CD_RET_OK);
+            CD_TEST_CHECK(pose == expected_pose);
+            CD_TEST_CHECK(point == expected_point);
+
+            CD_S32 obstacle = 12345;
+            pose = 12345;
+            CD_TEST_CHECK(cd_circle_cover_check_circles(&cover, poses, pose_count, obstacles.data(), point_count,
+                                                        &pose, &obstacle) == CD_RET_OK);
+            CD_TEST_CHECK(pose == expected_obstacle_pose);
+            CD_TEST_CHECK(obstacle == expected_obstacle);
+        }
+    }
+} // namespace
+
+int main()
+{
+    test_polygon_cover();
+    test_obb_cover();
+    test_checks_match_brute_force();
+    return cd_test::report("test_circle_cover");
+}
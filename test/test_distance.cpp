@@ -0,0 +1,369 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 14:52:37
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 14:52:37
+ */
+
+// GJK 距离: 圆、盒子、线段之间的闭式解,随机凸多边形与逐边暴力最小距离一致,
+// 热启动与冷启动的结果一致(同一帧与小幅运动后)
+
+#include "cd_test.h"
+
+#include <string.h>
+
+namespace
+{
+    const CD_F64 kTol = 1e-4;
+
+    CD_VEC2 rand_vec(CD_F32 range)
+    {
+        return cd_vec2_make_v(cd_test::rand_f(-range, range), cd_test::rand_f(-range, range));
+    }
+
+    CD_TRANSFORM rand_transform(CD_F32 range)
+    {
+        CD_TRANSFORM t;
+        t.p = rand_vec(range);
+        t.q = cd_rot_from_angle_v(cd_test::rand_f(-3.2f, 3.2f));
+        return t;
+    }
+
+    CD_DISTANCE_OUTPUT distance(const CD_DISTANCE_INPUT *input, CD_DISTANCE_CACHE *cache)
+    {
+        CD_DISTANCE_OUTPUT output;
+        CD_TEST_CHECK(cd_shape_distance(cache, input, CD_NULL, 0, &output) == CD_RET_OK);
+        return output;
+    }
+
+    CD_DISTANCE_OUTPUT cold_distance(const CD_DISTANCE_INPUT *input)
+    {
+        CD_DISTANCE_CACHE cache = emptyDistanceCache;
+        return distance(input, &cache);
+    }
+
+    // 最近点之间的距离就是输出的距离
+    CD_VOID check_witness(const CD_DISTANCE_OUTPUT &output)
+    {
+        CD_TEST_CHECK_NEAR(cd_vec2_dis_v(output.pointA, output.pointB), output.distance, kTol);
+    }
+
+    // 局部坐标系下以原点为中心的盒子
+    CD_VOID make_box(CD_F32 hx, CD_F32 hy, CD_F32 radius, CD_DISTANCE_PROXY *proxy)
+    {
+        const CD_VEC2 box[4] = {{-hx, -hy}, {hx, -hy}, {hx, hy}, {-hx, hy}};
+        cd_make_proxy(box, 4, radius, proxy);
+    }
+
+    // 点到以原点为中心、轴对齐的盒子的距离
+    CD_F32 point_box_distance(CD_VEC2 p, CD_F32 hx, CD_F32 hy)
+    {
+        const CD_F32 dx = CD_MAX(CD_FABS(p.x) - hx, 0.0f);
+        const CD_F32 dy = CD_MAX(CD_FABS(p.y) - hy, 0.0f);
+        return sqrtf(dx * dx + dy * dy);
+    }
+
+    CD_VOID test_circles()
+    {
+        const CD_VEC2 origin = {0.0f, 0.0f};
+        for (CD_S32 iter = 0; iter < 1000; ++iter)
+        {
+            CD_DISTANCE_INPUT input;
+            const CD_F32 ra = cd_test::rand_f(0.0f, 1.0f);
+            const CD_F32 rb = cd_test::rand_f(0.0f, 1.0f);
+            cd_make_proxy(&origin, 1, ra, &input.proxyA);
+            cd_make_proxy(&origin, 1, rb, &input.proxyB);
+            input.transformA = rand_transform(3.0f);
+            input.transformB = rand_transform(3.0f);
+            input.useRadii = CD_TRUE;
+            const CD_F32 centers = cd_vec2_dis_v(input.transformA.p, input.transformB.p);
+            const CD_DISTANCE_OUTPUT output = cold_distance(&input);
+            CD_TEST_CHECK_NEAR(output.distance, CD_MAX(centers - ra - rb, 0.0f), kTol);
+            if (centers - ra - rb > CD_EPS)
+            {
+                check_witness(output);
+                CD_TEST_CHECK_NEAR(cd_vec2_dis_v(output.pointA, input.transformA.p), ra, kTol);
+                CD_TEST_CHECK_NEAR(cd_vec2_dis_v(output.pointB, input.transformB.p), rb, kTol);
+            }
+
+            // 不考虑半径时为圆心距离
+            input.useRadii = CD_FALSE;
+            CD_TEST_CHECK_NEAR(cold_distance(&input).distance, centers, kTol);
+        }
+    }
+
+    CD_VOID test_circle_box()
+    {
+        const CD_VEC2 origin = {0.0f, 0.0f};
+        for (CD_S32 iter = 0; iter < 1000; ++iter)
+        {
+            const CD_F32 hx = cd_test::rand_f(0.1f, 2.0f);
+            const CD_F32 hy = cd_test::rand_f(0.1f, 2.0f);
+            const CD_F32 r = cd_test::rand_f(0.0f, 0.5f);
+            CD_DISTANCE_INPUT input;
+            make_box(hx, hy, 0.0f, &input.proxyA);
+            cd_make_proxy(&origin, 1, r, &input.proxyB);
+            input.transformA = rand_transform(3.0f);
+            input.transformB = rand_transform(3.0f);
+            input.useRadii = CD_TRUE;
+            // 在盒子的局部坐标系下求圆心到盒子的距离
+            const CD_VEC2 local = cd_inv_transforms_point_v(input.transformA, input.transformB.p);
+            const CD_F32 expected = point_box_distance(local, hx, hy) - r;
+            const CD_DISTANCE_OUTPUT output = cold_distance(&input);
+            if (point_box_distance(local, hx, hy) > 0.0f)
+            {
+                CD_TEST_CHECK_NEAR(output.distance, CD_MAX(expected, 0.0f), kTol);
+            }
+            else
+            {
+                CD_TEST_CHECK(output.distance == 0.0f);
+            }
+        }
+    }
+
+    CD_VOID test_boxes()
+    {
+        for (CD_S32 iter = 0; iter < 1000; ++iter)
+        {
+            // 轴对齐的两个盒子: 距离由两个方向的间隙决定
+            const CD_F32 ha[2] = {cd_test::rand_f(0.1f, 2.0f), cd_test::rand_f(0.1f, 2.0f)};
+            const CD_F32 hb[2] = {cd_test::rand_f(0.1f, 2.0f), cd_test::rand_f(0.1f, 2.0f)};
+            const CD_F32 ra = (cd_test::rand_u32() & 1) ? cd_test::rand_f(0.0f, 0.3f) : 0.0f;
+            CD_DISTANCE_INPUT input;
+            make_box(ha[0], ha[1], ra, &input.proxyA);
+            make_box(hb[0], hb[1], 0.0f, &input.proxyB);
+            const CD_VEC2 offset = rand_vec(5.0f);
+            // 整体旋转平移后距离不变
+            const CD_TRANSFORM frame = rand_transform(10.0f);
+            input.transformA = frame;
+            input.transformB.q = frame.q;
+            input.transformB.p = cd_transforms_point_v(frame, offset);
+            input.useRadii = CD_TRUE;
+            const CD_F32 gx = CD_MAX(CD_FABS(offset.x) - ha[0] - hb[0], 0.0f);
+            const CD_F32 gy = CD_MAX(CD_FABS(offset.y) - ha[1] - hb[1], 0.0f);
+            const CD_F32 gap = sqrtf(gx * gx + gy * gy);
+            const CD_DISTANCE_OUTPUT output = cold_distance(&input);
+            CD_TEST_CHECK_NEAR(output.distance, CD_MAX(gap - ra, 0.0f), kTol);
+            if (gap - ra > CD_EPS)
+            {
+                check_witness(output);
+            }
+        }
+    }
+
+    // 两条线段在内部相交
+    CD_BOOL segments_cross(CD_VEC2 a1, CD_VEC2 a2, CD_VEC2 b1, CD_VEC2 b2)
+    {
+        return cd_points_cross_v(a1, a2, b1) * cd_points_cross_v(a1, a2, b2) < 0.0f &&
+               cd_points_cross_v(b1, b2, a1) * cd_points_cross_v(b1, b2, a2) < 0.0f;
+    }
+
+    CD_VOID test_segments()
+    {
+        for (CD_S32 iter = 0; iter < 2000; ++iter)
+        {
+            CD_SEGMENT sa;
+            CD_SEGMENT sb;
+            sa.point1 = rand_vec(2.0f);
+            sa.point2 = rand_vec(2.0f);
+            sb.point1 = rand_vec(2.0f);
+            sb.point2 = rand_vec(2.0f);
+            CD_DISTANCE_INPUT input;
+            cd_make_proxy(&sa.point1, 2, 0.0f, &input.proxyA);
+            cd_make_proxy(&sb.point1, 2, 0.0f, &input.proxyB);
+            input.transformA = TRANSFORM_IDENTITY;
+            input.transformB = TRANSFORM_IDENTITY;
+            input.useRadii = CD_FALSE;
+
+            // 闭式解: 不相交时为四个端点到另一条线段距离的最小值
+            CD_F32 d2 = CD_MAXABS_F;
+            const CD_VEC2 ends[4] = {sa.point1, sa.point2, sb.point1, sb.point2};
+            for (CD_S32 k = 0; k < 4; ++k)
+            {
+                const CD_SEGMENT other = k < 2 ? sb : sa;
+                const CD_VEC2 d = cd_vec2_sub_v(other.point2, other.point1);
+                const CD_F32 t = CD_CLIP(cd_vec2_dot_v(cd_vec2_sub_v(ends[k], other.point1), d) / cd_vec2_dot_v(d, d), 0.0f, 1.0f);
+                d2 = CD_MIN(d2, cd_vec2_dis_v(ends[k], cd_vec2_mul_add_v(other.point1, t, d)));
+            }
+            const CD_DISTANCE_OUTPUT output = cold_distance(&input);
+            CD_TEST_CHECK_NEAR(output.distance, segments_cross(sa.point1, sa.point2, sb.point1, sb.point2) ? 0.0f : d2, kTol);
+            check_witness(output);
+        }
+    }
+
+    // 随机凸多边形
+    CD_BOOL rand_polygon(CD_F32 radius, CD_POLYGON *polygon)
+    {
+        CD_VEC2 points[MAX_POLYGON_VERTICES];
+        CD_VEC2 scratch[CD_HULL_SCRATCH_SIZE(MAX_POLYGON_VERTICES)];
+        const CD_S32 count = cd_test::rand_s(3, MAX_POLYGON_VERTICES);
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            points[i] = rand_vec(1.0f);
+        }
+        return cd_make_polygon(points, count, radius, scratch, polygon) == CD_RET_OK;
+    }
+
+    // 暴力: 不相交时两个凸多边形的距离是所有顶点到另一个多边形的边的距离的最小值
+    CD_F32 brute_force_distance(const CD_VEC2 *a, CD_S32 count_a, const CD_VEC2 *b, CD_S32 count_b)
+    {
+        CD_F32 best = CD_MAXABS_F;
+        for (CD_S32 pass = 0; pass < 2; ++pass)
+        {
+            const CD_VEC2 *points = pass == 0 ? a : b;
+            const CD_S32 point_count = pass == 0 ? count_a : count_b;
+            const CD_VEC2 *edges = pass == 0 ? b : a;
+            const CD_S32 edge_count = pass == 0 ? count_b : count_a;
+            for (CD_S32 i = 0; i < point_count; ++i)
+            {
+                for (CD_S32 j = 0; j < edge_count; ++j)
+                {
+                    const CD_VEC2 e1 = edges[j];
+                    const CD_VEC2 d = cd_vec2_sub_v(edges[j + 1 < edge_count ? j + 1 : 0], e1);
+                    const CD_F32 t = CD_CLIP(cd_vec2_dot_v(cd_vec2_sub_v(points[i], e1), d) / cd_vec2_dot_v(d, d), 0.0f, 1.0f);
+                    best = CD_MIN(best, cd_vec2_dis_v(points[i], cd_vec2_mul_add_v(e1, t, d)));
+                }
+            }
+        }
+        return best;
+    }
+
+    // 两个凸多边形的边相交
+    CD_BOOL edges_cross(const CD_VEC2 *a, CD_S32 count_a, const CD_VEC2 *b, CD_S32 count_b)
+    {
+        for (CD_S32 i = 0; i < count_a; ++i)
+        {
+            for (CD_S32 j = 0; j < count_b; ++j)
+            {
+                if (segments_cross(a[i], a[i + 1 < count_a ? i + 1 : 0], b[j], b[j + 1 < count_b ? j + 1 : 0]))
+                {
+                    return CD_TRUE;
+                }
+            }
+        }
+        return CD_FALSE;
+    }
+
+    // 点在逆时针凸多边形内(含边界)
+    CD_BOOL point_in_convex(const CD_VEC2 *vertices, CD_S32 count, CD_VEC2 p)
+    {
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            if (cd_points_cross_v(vertices[i], vertices[i + 1 < count ? i + 1 : 0], p) < 0.0f)
+            {
+                return CD_FALSE;
+            }
+        }
+        return CD_TRUE;
+    }
+
+    CD_VOID test_random_polygons()
+    {
+        CD_S32 separated = 0;
+        CD_S32 overlapped = 0;
+        for (CD_S32 iter = 0; iter < 3000; ++iter)
+        {
+            CD_POLYGON pa;
+            CD_POLYGON pb;
+            const CD_F32 rounding = (cd_test::rand_u32() & 1) ? cd_test::rand_f(0.0f, 0.2f) : 0.0f;
+            if (!rand_polygon(rounding, &pa) || !rand_polygon(0.0f, &pb))
+            {
+                continue;
+            }
+            CD_DISTANCE_INPUT input;
+            memset(&input, 0, sizeof(input));
+            cd_make_proxy(pa.vertices, (CD_S16)pa.count, pa.radius, &input.proxyA);
+            cd_make_proxy(pb.vertices, (CD_S16)pb.count, pb.radius, &input.proxyB);
+            input.transformA = rand_transform(2.0f);
+            input.transformB = rand_transform(2.0f);
+            input.useRadii = CD_TRUE;
+
+            // 世界坐标系下的顶点
+            CD_VEC2 wa[MAX_POLYGON_VERTICES];
+            CD_VEC2 wb[MAX_POLYGON_VERTICES];
+            for (CD_S32 i = 0; i < pa.count; ++i)
+            {
+                wa[i] = cd_transforms_point_v(input.transformA, pa.vertices[i]);
+            }
+            for (CD_S32 i = 0; i < pb.count; ++i)
+            {
+                wb[i] = cd_transforms_point_v(input.transformB, pb.vertices[i]);
+            }
+            const CD_F32 core = brute_force_distance(wa, pa.count, wb, pb.count);
+            const CD_BOOL overlap = edges_cross(wa, pa.count, wb, pb.count) || point_in_convex(wa, pa.count, wb[0]) ||
+                                    point_in_convex(wb, pb.count, wa[0]);
+            const CD_DISTANCE_OUTPUT output = cold_distance(&input);
+            if (core > 1e-3f && !overlap)
+            {
+                CD_TEST_CHECK_NEAR(output.distance, CD_MAX(core - pa.radius, 0.0f), kTol);
+                if (core - pa.radius > 1e-3f)
+                {
+                    check_witness(output);
+                    ++separated;
+                }
+            }
+            else
+            {
+                CD_TEST_CHECK(output.distance == 0.0f);
+                ++overlapped;
+            }
+        }
+        CD_TEST_CHECK(separated > 500 && overlapped > 500);
+    }
+
+    CD_VOID test_warm_start()
+    {
+        CD_S32 warm_iterations = 0;
+        CD_S32 cold_iterations = 0;
+        for (CD_S32 iter = 0; iter < 2000; ++iter)
+        {
+            CD_POLYGON pa;
+            CD_POLYGON pb;
+            if (!rand_polygon(0.0f, &pa) || !rand_polygon(0.1f, &pb))
+            {
+                continue;
+            }
+            CD_DISTANCE_INPUT input;
+            memset(&input, 0, sizeof(input));
+            cd_make_proxy(pa.vertices, (CD_S16)pa.count, pa.radius, &input.proxyA);
+            cd_make_proxy(pb.vertices, (CD_S16)pb.count, pb.radius, &input.proxyB);
+            input.transformA = rand_transform(2.0f);
+            input.transformB = rand_transform(2.0f);
+            input.useRadii = CD_TRUE;
+
+            CD_DISTANCE_CACHE cache = emptyDistanceCache;
+            const CD_DISTANCE_OUTPUT cold = distance(&input, &cache);
+
+            // 同一帧: 用上次的单纯形热启动,结果不变
+            const CD_DISTANCE_OUTPUT same = distance(&input, &cache);
+            CD_TEST_CHECK_NEAR(same.distance, cold.distance, kTol);
+            CD_TEST_CHECK(same.iterations <= cold.iterations);
+
+            // 小幅运动后: 热启动与冷启动的距离一致
+            input.transformB.p = cd_vec2_add_v(input.transformB.p, rand_vec(0.05f));
+            input.transformB.q = cd_rot_from_angle_v(cd_rot_to_angle_v(input.transformB.q) + cd_test::rand_f(-0.05f, 0.05f));
+            const CD_DISTANCE_OUTPUT warm = distance(&input, &cache);
+            const CD_DISTANCE_OUTPUT moved = cold_distance(&input);
+            CD_TEST_CHECK_NEAR(warm.distance, moved.distance, kTol);
+            if (moved.distance > 1e-3f)
+            {
+                check_witness(warm);
+            }
+            warm_iterations += warm.iterations;
+            cold_iterations += moved.iterations;
+        }
+        // 热启动平均需要的迭代次数更少
+        CD_TEST_CHECK(warm_iterations < cold_iterations);
+    }
+} // namespace
+
+int main()
+{
+    test_circles();
+    test_circle_box();
+    test_boxes();
+    test_segments();
+    test_random_polygons();
+    test_warm_start();
+    return cd_test::report("test_distance");
+}
@@ -0,0 +1,270 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 15:40:52
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 15:40:52
+ */
+
+// 动态树: 随机插入、删除、移动后,查询结果与重叠对与暴力枚举一致,
+// 父子链接、内部节点包围盒、扩展aabb的包含关系与高度保持正确
+
+#include "cd_test.h"
+
+#include <math.h>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    const CD_S32 PROXY_N = 400;
+
+    typedef std::set<std::pair<CD_S32, CD_S32>> PAIR_SET;
+
+    struct Proxy
+    {
+        CD_S32 id;   // 叶子节点索引, CD_TREE_NULL_NODE 表示未插入
+        CD_AABB aabb; // 障碍物的真实aabb
+    };
+
+    // 坐标取0.5的整数倍,扩展后的aabb之间常有边界接触
+    CD_AABB random_aabb()
+    {
+        CD_AABB aabb;
+        aabb.lowerBound = cd_vec2_make_v(0.5f * cd_test::rand_s(0, 80), 0.5f * cd_test::rand_s(0, 80));
+        aabb.upperBound = cd_vec2_make_v(aabb.lowerBound.x + 0.5f * cd_test::rand_s(0, 6),
+                                         aabb.lowerBound.y + 0.5f * cd_test::rand_s(0, 6));
+        return aabb;
+    }
+
+    CD_BOOL collect(CD_S32 proxyId, CD_S32 userData, CD_VOID *context)
+    {
+        std::set<CD_S32> *ids = (std::set<CD_S32> *)context;
+        (CD_VOID) proxyId;
+        CD_TEST_CHECK(ids->insert(userData).second); // 每个叶子只报告一次
+        return CD_TRUE;
+    }
+
+    CD_BOOL contains(const CD_AABB &outer, const CD_AABB &inner)
+    {
+        return outer.lowerBound.x <= inner.lowerBound.x && outer.lowerBound.y <= inner.lowerBound.y &&
+               outer.upperBound.x >= inner.upperBound.x && outer.upperBound.y >= inner.upperBound.y;
+    }
+
+    // 递归检查子树,返回叶子数
+    CD_S32 check_node(const CD_DYNAMIC_TREE *tree, CD_S32 index, CD_S32 parent, std::vector<CD_BOOL> *seen)
+    {
+        CD_TEST_CHECK(index >= 0 && index < tree->nodeCapacity);
+        if (index < 0 || index >= tree->nodeCapacity || (*seen)[index])
+        {
+            return 0;
+        }
+        (*seen)[index] = CD_TRUE;
+        const CD_TREE_NODE *node = tree->nodes + index;
+        CD_TEST_CHECK(node->parent == parent);
+        if (node->child1 == CD_TREE_NULL_NODE)
+        {
+            CD_TEST_CHECK(node->child2 == CD_TREE_NULL_NODE);
+            CD_TEST_CHECK(node->height == 0);
+            return 1;
+        }
+        const CD_S32 leaves = check_node(tree, node->child1, index, seen) + check_node(tree, node->child2, index, seen);
+        const CD_TREE_NODE *child1 = tree->nodes + node->child1;
+        const CD_TREE_NODE *child2 = tree->nodes + node->child2;
+        CD_TEST_CHECK(node->height == 1 + CD_MAX(child1->height, child2->height));
+        // 内部节点的aabb恰好是两个子节点的并集
+        CD_AABB merged;
+        cd_aabb_union(&child1->aabb, &child2->aabb, &merged);
+        CD_TEST_CHECK(merged.lowerBound.x == node->aabb.lowerBound.x && merged.lowerBound.y == node->aabb.lowerBound.y &&
+                      merged.upperBound.x == node->aabb.upperBound.x && merged.upperBound.y == node->aabb.upperBound.y);
+        return leaves;
+    }
+
+    CD_VOID check_tree(const CD_DYNAMIC_TREE *tree, const std::vector<Proxy> &proxies)
+    {
+        CD_S32 live = 0;
+        for (size_t i = 0; i < proxies.size(); ++i)
+        {
+            if (proxies[i].id == CD_TREE_NULL_NODE)
+            {
+                continue;
+            }
+            ++live;
+            // 叶子的扩展aabb包含真实aabb
+            CD_AABB fat;
+            fat.lowerBound = fat.upperBound = cd_vec2_make_v(0.0f, 0.0f);
+            CD_S32 user_data = -1;
+            CD_TEST_CHECK(cd_dynamic_tree_get_fat_aabb(tree, proxies[i].id, &fat) == CD_RET_OK);
+            CD_TEST_CHECK(cd_dynamic_tree_get_user_data(tree, proxies[i].id, &user_data) == CD_RET_OK);
+            CD_TEST_CHECK(user_data == (CD_S32)i);
+            CD_TEST_CHECK(tree->nodes[proxies[i].id].height == 0);
+            CD_TEST_CHECK(contains(fat, proxies[i].aabb));
+        }
+        CD_TEST_CHECK(tree->proxyCount == live);
+        CD_TEST_CHECK(tree->nodeCount == (live == 0 ? 0 : 2 * live - 1));
+
+        std::vector<CD_BOOL> seen(tree->nodeCapacity, CD_FALSE);
+        if (tree->root == CD_TREE_NULL_NODE)
+        {
+            CD_TEST_CHECK(live == 0);
+        }
+        else
+        {
+            CD_TEST_CHECK(check_node(tree, tree->root, CD_TREE_NULL_NODE, &seen) == live);
+            // 旋转按表面积代价进行而不是严格的高度平衡,高度仍应保持在对数量级
+            CD_S32 height = -1;
+            CD_TEST_CHECK(cd_dynamic_tree_get_height(tree, &height) == CD_RET_OK);
+            CD_TEST_CHECK(height <= 2 * (CD_S32)ceil(log2((CD_F64)live + 1.0)) + 4);
+        }
+
+        // 空闲链表与树中的节点互不重叠,合起来是整个节点池
+        CD_S32 free_count = 0;
+        for (CD_S32 index = tree->freeList; index != CD_TREE_NULL_NODE && free_count <= tree->nodeCapacity;
+             index = tree->nodes[index].parent)
+        {
+            CD_TEST_CHECK(!seen[index]);
+            CD_TEST_CHECK(tree->nodes[index].height == -1);
+            ++free_count;
+        }
+        CD_TEST_CHECK(free_count + tree->nodeCount == tree->nodeCapacity);
+    }
+
+    CD_VOID check_queries(const CD_DYNAMIC_TREE *tree, const std::vector<Proxy> &proxies)
+    {
+        // 查询: 与所有叶子的扩展aabb暴力比较
+        for (CD_S32 q = 0; q < 20; ++q)
+        {
+            const CD_AABB query = random_aabb();
+            std::set<CD_S32> got;
+            CD_TEST_CHECK(cd_dynamic_tree_query(tree, &query, collect, &got) == CD_RET_OK);
+            std::set<CD_S32> expected;
+            for (size_t i = 0; i < proxies.size(); ++i)
+            {
+                if (proxies[i].id != CD_TREE_NULL_NODE && cd_aabb_overlap_v(query, tree->nodes[proxies[i].id].aabb))
+                {
+                    expected.insert((CD_S32)i);
+                }
+            }
+            CD_TEST_CHECK(got == expected);
+        }
+
+        // 重叠对: 以每个叶子的扩展aabb查询树,与两两暴力比较一致
+        PAIR_SET pairs;
+        PAIR_SET expected_pairs;
+        for (size_t i = 0; i < proxies.size(); ++i)
+        {
+            if (proxies[i].id == CD_TREE_NULL_NODE)
+            {
+                continue;
+            }
+            const CD_AABB fat = tree->nodes[proxies[i].id].aabb;
+            std::set<CD_S32> hits;
+            CD_TEST_CHECK(cd_dynamic_tree_query(tree, &fat, collect, &hits) == CD_RET_OK);
+            for (std::set<CD_S32>::const_iterator it = hits.begin(); it != hits.end(); ++it)
+            {
+                if (*it != (CD_S32)i)
+                {
+                    pairs.insert(std::make_pair(CD_MIN((CD_S32)i, *it), CD_MAX((CD_S32)i, *it)));
+                }
+            }
+            for (size_t j = i + 1; j < proxies.size(); ++j)
+            {
+                if (proxies[j].id != CD_TREE_NULL_NODE && cd_aabb_overlap_v(fat, tree->nodes[proxies[j].id].aabb))
+                {
+                    expected_pairs.insert(std::make_pair((CD_S32)i, (CD_S32)j));
+                }
+            }
+        }
+        CD_TEST_CHECK(pairs == expected_pairs);
+    }
+
+    CD_VOID test_random_operations()
+    {
+        std::vector<CD_TREE_NODE> nodes(2 * PROXY_N);
+        CD_DYNAMIC_TREE tree;
+        CD_TEST_CHECK(cd_dynamic_tree_init(&tree, nodes.data(), (CD_S32)nodes.size()) == CD_RET_OK);
+        std::vector<Proxy> proxies(PROXY_N);
+        for (CD_S32 i = 0; i < PROXY_N; ++i)
+        {
+            proxies[i].id = CD_TREE_NULL_NODE;
+        }
+
+        CD_S32 moves = 0;
+        CD_S32 reinserts = 0;
+        for (CD_S32 step = 0; step < 6000; ++step)
+        {
+            Proxy &p = proxies[cd_test::rand_s(0, PROXY_N - 1)];
+            const CD_U32 op = cd_test::rand_u32() % 10;
+            if (p.id == CD_TREE_NULL_NODE)
+            {
+                p.aabb = random_aabb();
+                CD_TEST_CHECK(cd_dynamic_tree_create_proxy(&tree, &p.aabb, (CD_S32)(&p - &proxies[0]), &p.id) == CD_RET_OK);
+            }
+            else if (op < 2)
+            {
+                CD_TEST_CHECK(cd_dynamic_tree_destroy_proxy(&tree, p.id) == CD_RET_OK);
+                p.id = CD_TREE_NULL_NODE;
+            }
+            else
+            {
+                // 小位移多数留在扩展aabb内,大位移触发重新插入
+                const CD_F32 step_size = (op < 5) ? 3.0f : 0.05f;
+                const CD_VEC2 delta = cd_vec2_make_v(cd_test::rand_f(-step_size, step_size), cd_test::rand_f(-step_size, step_size));
+                p.aabb.lowerBound = cd_vec2_add_v(p.aabb.lowerBound, delta);
+                p.aabb.upperBound = cd_vec2_add_v(p.aabb.upperBound, delta);
+                CD_BOOL moved = CD_FALSE;
+                CD_TEST_CHECK(cd_dynamic_tree_move_proxy(&tree, p.id, &p.aabb, &moved) == CD_RET_OK);
+                ++moves;
+                reinserts += moved;
+            }
+            if (step % 200 == 0)
+            {
+                check_tree(&tree, proxies);
+                check_queries(&tree, proxies);
+            }
+        }
+        check_tree(&tree, proxies);
+        check_queries(&tree, proxies);
+        CD_TEST_CHECK(reinserts > 0 && reinserts < moves);
+
+        // 全部删除后回到空树
+        for (CD_S32 i = 0; i < PROXY_N; ++i)
+        {
+            if (proxies[i].id != CD_TREE_NULL_NODE)
+            {
+                CD_TEST_CHECK(cd_dynamic_tree_destroy_proxy(&tree, proxies[i].id) == CD_RET_OK);
+                proxies[i].id = CD_TREE_NULL_NODE;
+            }
+        }
+        check_tree(&tree, proxies);
+        CD_TEST_CHECK(tree.root == CD_TREE_NULL_NODE);
+    }
+
+    // 节点池恰好容纳 N 个障碍物时,第 N+1 个返回 E_MEM_FULL 且不破坏树
+    CD_VOID test_capacity()
+    {
+        const CD_S32 n = 50;
+        std::vector<CD_TREE_NODE> nodes(2 * n - 1);
+        CD_DYNAMIC_TREE tree;
+        cd_dynamic_tree_init(&tree, nodes.data(), (CD_S32)nodes.size());
+        std::vector<Proxy> proxies(n + 1);
+        for (CD_S32 i = 0; i < n; ++i)
+        {
+            proxies[i].aabb = random_aabb();
+            CD_TEST_CHECK(cd_dynamic_tree_create_proxy(&tree, &proxies[i].aabb, i, &proxies[i].id) == CD_RET_OK);
+        }
+        proxies[n].aabb = random_aabb();
+        proxies[n].id = CD_TREE_NULL_NODE;
+        CD_S32 id = -1;
+        CD_TEST_CHECK(cd_dynamic_tree_create_proxy(&tree, &proxies[n].aabb, n, &id) == COLLISION_DETECTION_E_MEM_FULL);
+        check_tree(&tree, proxies);
+        check_queries(&tree, proxies);
+    }
+} // namespace
+
+int main()
+{
+    test_random_operations();
+    test_capacity();
+    return cd_test::report("test_dynamic_tree");
+}
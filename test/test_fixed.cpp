@@ -0,0 +1,138 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 09:30:15
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 09:30:15
+ */
+
+// 定点查询: 整数平方根、sin/cos 误差上界、点到线段距离平方的精确性
+
+#include "cd_test.h"
+
+namespace
+{
+    // 128 位参考值: 返回 q 是否满足 (q - 1) * den < num^2 <= q * den
+    CD_BOOL is_sqr_div_ceil(CD_U64 q, CD_U64 num, CD_U64 den)
+    {
+        const unsigned __int128 sqr = (unsigned __int128)num * num;
+        return (unsigned __int128)q * den >= sqr && (q == 0 || (unsigned __int128)(q - 1) * den < sqr);
+    }
+
+    CD_VOID test_isqrt()
+    {
+        for (CD_S32 i = 0; i < 100000; ++i)
+        {
+            const CD_U64 v = ((CD_U64)cd_test::rand_u32() << 32 | cd_test::rand_u32()) >> (cd_test::rand_u32() % 64);
+            const CD_U64 r = cd_fx_isqrt_v(v);
+            CD_TEST_CHECK(r * r <= v && (r + 1) * (r + 1) > v);
+        }
+        CD_TEST_CHECK(cd_fx_isqrt_v(0) == 0);
+        CD_TEST_CHECK(cd_fx_isqrt_v(~(CD_U64)0) == 0xFFFFFFFFu);
+    }
+
+    CD_VOID test_sin_cos()
+    {
+        for (CD_S32 mrad = -1000000; mrad <= 1000000; mrad += 7)
+        {
+            CD_S32 s = 0;
+            CD_S32 c = 0;
+            cd_fx_sin_cos_v(mrad, &s, &c);
+            CD_TEST_CHECK_NEAR((CD_F64)s / CD_FX_ONE, sin(mrad * 1e-3), 5.2e-6);
+            CD_TEST_CHECK_NEAR((CD_F64)c / CD_FX_ONE, cos(mrad * 1e-3), 5.2e-6);
+        }
+    }
+
+    CD_VOID test_sqr_div_ceil()
+    {
+        for (CD_S32 i = 0; i < 200000; ++i)
+        {
+            // |cross| < 2^61, |d|^2 < 2^61, 商小于 2^63
+            const CD_U64 den = (((CD_U64)cd_test::rand_u32() << 32 | cd_test::rand_u32()) >> 3) | 1u;
+            const CD_U64 num = ((CD_U64)cd_test::rand_u32() << 32 | cd_test::rand_u32()) >> (3 + cd_test::rand_u32() % 40);
+            if ((unsigned __int128)num * num / den >= ((CD_U64)1 << 63))
+            {
+                continue;
+            }
+            const CD_U64 q = cd_fx_sqr_div_ceil_v(num, den);
+            CD_TEST_CHECK(is_sqr_div_ceil(q, num, den));
+            CD_TEST_CHECK(cd_fx_sqr_div_ceil_soft_v(num, den) == q);
+        }
+    }
+
+    CD_FX_SEGMENT make_seg(CD_S32 x1, CD_S32 y1, CD_S32 x2, CD_S32 y2)
+    {
+        CD_FX_SEGMENT seg;
+        seg.point1 = cd_fx_vec2_make_v(x1, y1);
+        seg.point2 = cd_fx_vec2_make_v(x2, y2);
+        return seg;
+    }
+
+    CD_VOID test_segment_dis_sqr()
+    {
+        // 最近点舍入到毫米会低估距离的两个例子: 真实值 0.25 与 0.4 平方毫米
+        CD_TEST_CHECK(cd_fx_segment_dis_sqr_to_point_v(make_seg(0, 0, 2000, 1), cd_fx_vec2_make_v(1000, 1)) == 1);
+        CD_TEST_CHECK(cd_fx_segment_dis_sqr_to_point_v(make_seg(0, 0, 3, 1), cd_fx_vec2_make_v(1, 1)) == 1);
+        // 点在线段上、端点外侧、退化线段
+        CD_TEST_CHECK(cd_fx_segment_dis_sqr_to_point_v(make_seg(0, 0, 2000, 1000), cd_fx_vec2_make_v(1000, 500)) == 0);
+        CD_TEST_CHECK(cd_fx_segment_dis_sqr_to_point_v(make_seg(0, 0, 100, 0), cd_fx_vec2_make_v(-3, 4)) == 25);
+        CD_TEST_CHECK(cd_fx_segment_dis_sqr_to_point_v(make_seg(0, 0, 100, 0), cd_fx_vec2_make_v(106, -8)) == 100);
+        CD_TEST_CHECK(cd_fx_segment_dis_sqr_to_point_v(make_seg(5, 5, 5, 5), cd_fx_vec2_make_v(8, 9)) == 25);
+
+        // 与安全距离平方比较的结论必须与精确有理数比较一致
+        for (CD_S32 i = 0; i < 200000; ++i)
+        {
+            const CD_S32 range = (i & 1) ? 3000 : CD_FX_MAX_COORD - 1;
+            const CD_FX_SEGMENT seg = make_seg(cd_test::rand_s(-range, range), cd_test::rand_s(-range, range),
+                                               cd_test::rand_s(-range, range), cd_test::rand_s(-range, range));
+            const CD_FX_VEC2 p = cd_fx_vec2_make_v(cd_test::rand_s(-range, range), cd_test::rand_s(-range, range));
+            const CD_S64 dis_sqr = cd_fx_segment_dis_sqr_to_point_v(seg, p);
+
+            const CD_S64 dx = (CD_S64)seg.point2.x - seg.point1.x;
+            const CD_S64 dy = (CD_S64)seg.point2.y - seg.point1.y;
+            const CD_S64 wx = (CD_S64)p.x - seg.point1.x;
+            const CD_S64 wy = (CD_S64)p.y - seg.point1.y;
+            const CD_S64 dot = dx * wx + dy * wy;
+            const CD_S64 den = dx * dx + dy * dy;
+            if (dot > 0 && dot < den)
+            {
+                const CD_S64 cross = dx * wy - dy * wx;
+                const CD_U64 abs_cross = (CD_U64)(cross < 0 ? -cross : cross);
+                CD_TEST_CHECK(is_sqr_div_ceil((CD_U64)dis_sqr, abs_cross, (CD_U64)den));
+                const CD_S64 clearance = (CD_S64)cd_fx_isqrt_v((CD_U64)dis_sqr);
+                const unsigned __int128 lhs = (unsigned __int128)abs_cross * abs_cross;
+                const unsigned __int128 rhs = (unsigned __int128)(clearance * clearance) * (CD_U64)den;
+                CD_TEST_CHECK((dis_sqr <= clearance * clearance) == (lhs <= rhs));
+            }
+            else
+            {
+                const CD_FX_VEC2 end = dot <= 0 || den == 0 ? seg.point1 : seg.point2;
+                const CD_S64 ex = (CD_S64)p.x - end.x;
+                const CD_S64 ey = (CD_S64)p.y - end.y;
+                CD_TEST_CHECK(dis_sqr == ex * ex + ey * ey);
+            }
+        }
+    }
+
+    CD_VOID test_aabb_touching()
+    {
+        CD_FX_AABB a;
+        CD_FX_AABB b;
+        a.lowerBound = cd_fx_vec2_make_v(0, 0);
+        a.upperBound = cd_fx_vec2_make_v(1000, 1000);
+        b.lowerBound = cd_fx_vec2_make_v(1000, 500);
+        b.upperBound = cd_fx_vec2_make_v(2000, 1500);
+        CD_TEST_CHECK(cd_fx_aabb_overlap_v(a, b));
+        b.lowerBound.x = 1001;
+        CD_TEST_CHECK(!cd_fx_aabb_overlap_v(a, b));
+    }
+} // namespace
+
+int main()
+{
+    test_isqrt();
+    test_sin_cos();
+    test_sqr_div_ceil();
+    test_segment_dis_sqr();
+    test_aabb_touching();
+    return cd_test::report("test_fixed");
+}
@@ -0,0 +1,128 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 12:20:31
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 12:20:31
+ */
+
+// 栅格地图: 越界栅格的错误码,远离地图与 NaN 坐标的查询,以及与逐栅格暴力检查一致的碰撞结果
+
+#include "cd_test.h"
+
+#include <limits>
+#include <vector>
+
+namespace
+{
+    const CD_S32 kWidth = 40;
+    const CD_S32 kHeight = 30;
+    const CD_F32 kResolution = 0.1f;
+
+    struct GridFixture
+    {
+        std::vector<CD_U08> cells;
+        std::vector<CD_F32> distance;
+        std::vector<CD_F32> scratch;
+        std::vector<CD_S32> indices;
+        CD_GRID_MAP map;
+
+        GridFixture()
+            : cells(kWidth * kHeight), distance(kWidth * kHeight), scratch(CD_GRID_SCRATCH_SIZE(kWidth, kHeight)),
+              indices(CD_GRID_INDEX_SIZE(kWidth, kHeight))
+        {
+            const CD_VEC2 origin = cd_vec2_make_v(-2.0f, -1.5f);
+            cd_grid_map_init(&map, kWidth, kHeight, kResolution, &origin, 0.5f, cells.data(), distance.data(),
+                             scratch.data(), indices.data());
+        }
+    };
+
+    CD_VOID test_set_cell_range()
+    {
+        GridFixture g;
+        CD_TEST_CHECK(cd_grid_map_set_cell(&g.map, 0, 0, CD_TRUE) == CD_RET_OK);
+        CD_TEST_CHECK(cd_grid_map_set_cell(&g.map, kWidth - 1, kHeight - 1, CD_TRUE) == CD_RET_OK);
+        CD_TEST_CHECK(cd_grid_map_set_cell(&g.map, -1, 0, CD_TRUE) == COLLISION_DETECTION_E_CALC_ERROR);
+        CD_TEST_CHECK(cd_grid_map_set_cell(&g.map, 0, kHeight, CD_TRUE) == COLLISION_DETECTION_E_CALC_ERROR);
+        CD_TEST_CHECK(cd_grid_map_set_cell(CD_NULL, 0, 0, CD_TRUE) == COLLISION_DETECTION_E_PARAM_NULL);
+    }
+
+    // 远超 CD_S32 范围与 NaN 的坐标: 视为地图范围外,不得越界访问
+    CD_VOID test_far_and_nan()
+    {
+        GridFixture g;
+        for (CD_S32 y = 0; y < kHeight; ++y)
+        {
+            for (CD_S32 x = 0; x < kWidth; ++x)
+            {
+                cd_grid_map_set_cell(&g.map, x, y, CD_TRUE);
+            }
+        }
+        CD_TEST_CHECK(cd_grid_map_update_distance(&g.map) == CD_RET_OK);
+
+        const CD_F32 nan = std::numeric_limits<CD_F32>::quiet_NaN();
+        const CD_F32 values[] = {1e12f, -1e12f, 3e9f, -3e9f, nan};
+        for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+        {
+            const CD_VEC2 p = cd_vec2_make_v(values[i], 0.0f);
+            CD_S32 cell_x = 0;
+            CD_S32 cell_y = 0;
+            CD_TEST_CHECK(!cd_grid_map_cell_v(&g.map, p, &cell_x, &cell_y));
+            CD_TEST_CHECK(cell_x == -1 || cell_x == kWidth);
+
+            CD_F32 clearance = -1.0f;
+            CD_TEST_CHECK(cd_grid_map_clearance(&g.map, &p, &clearance) == CD_RET_OK);
+            CD_TEST_CHECK(clearance == 0.0f);
+
+            CD_CIRCLE circle;
+            circle.center = p;
+            circle.radius = 0.2f;
+            CD_BOOL hit = CD_TRUE;
+            CD_TEST_CHECK(cd_grid_map_circle_collide(&g.map, &circle, &hit) == CD_RET_OK);
+            CD_TEST_CHECK(!hit);
+
+            const CD_OBB obb = cd_create_obb_v(p, 0.4f, 0.2f, 0.3f);
+            hit = CD_TRUE;
+            CD_TEST_CHECK(cd_grid_map_obb_collide(&g.map, &obb, &hit) == CD_RET_OK);
+            CD_TEST_CHECK(!hit);
+        }
+
+        // 覆盖整张地图的超大圆仍按截断后的范围扫描
+        CD_CIRCLE huge;
+        huge.center = cd_vec2_make_v(0.0f, 0.0f);
+        huge.radius = 1e12f;
+        CD_TEST_CHECK(cd_grid_map_circle_scan_v(&g.map, huge));
+    }
+
+    // 随机占据栅格,距离场加速的结果与逐栅格检查一致
+    CD_VOID test_collide_matches_scan()
+    {
+        GridFixture g;
+        for (CD_S32 i = 0; i < 40; ++i)
+        {
+            cd_grid_map_set_cell(&g.map, cd_test::rand_s(0, kWidth - 1), cd_test::rand_s(0, kHeight - 1), CD_TRUE);
+        }
+        CD_TEST_CHECK(cd_grid_map_update_distance(&g.map) == CD_RET_OK);
+        for (CD_S32 iter = 0; iter < 5000; ++iter)
+        {
+            CD_CIRCLE circle;
+            circle.center = cd_vec2_make_v(cd_test::rand_f(-2.5f, 2.5f), cd_test::rand_f(-2.0f, 2.0f));
+            circle.radius = cd_test::rand_f(0.01f, 0.8f);
+            CD_BOOL hit = CD_FALSE;
+            CD_TEST_CHECK(cd_grid_map_circle_collide(&g.map, &circle, &hit) == CD_RET_OK);
+            CD_TEST_CHECK(hit == cd_grid_map_circle_scan_v(&g.map, circle));
+
+            const CD_OBB obb = cd_create_obb_v(circle.center, cd_test::rand_f(0.05f, 1.0f), cd_test::rand_f(0.05f, 0.6f),
+                                               cd_test::rand_f(-3.2f, 3.2f));
+            CD_TEST_CHECK(cd_grid_map_obb_collide(&g.map, &obb, &hit) == CD_RET_OK);
+            CD_TEST_CHECK(hit == cd_grid_map_obb_scan_v(&g.map, obb));
+        }
+    }
+} // namespace
+
+int main()
+{
+    test_set_cell_range();
+    test_far_and_nan();
+    test_collide_matches_scan();
+    return cd_test::report("test_grid");
+}
@@ -0,0 +1,229 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 16:03:19
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 16:03:19
+ */
+
+// 接触流形: 盒子叠放的边-边接触(两个点及特征id)、顶点-边接触、分离与圆角范围内的接触,
+// 多边形与圆在边区域、顶点区域、圆心在内部时的接触,以及圆与圆,均与手算结果一致
+
+#include "cd_test.h"
+
+#include <vector>
+
+namespace
+{
+    const CD_F64 kTol = 1e-5;
+
+    // 由逆时针顶点构建多边形视图
+    struct View
+    {
+        std::vector<CD_VEC2> vertices;
+        std::vector<CD_VEC2> normals;
+        CD_POLYGON_VIEW view;
+
+        View(const CD_VEC2 *points, CD_S32 count, CD_F32 radius) : vertices(points, points + count), normals(count)
+        {
+            cd_polygon_normals_v(vertices.data(), count, normals.data());
+            view.vertices = vertices.data();
+            view.normals = normals.data();
+            view.count = count;
+            view.radius = radius;
+        }
+    };
+
+    // 以 (cx, cy) 为中心的轴对齐盒子,顶点从左下角开始逆时针,边0的法向为 -y,边2的法向为 +y
+    View make_box(CD_F32 cx, CD_F32 cy, CD_F32 h, CD_F32 radius)
+    {
+        const CD_VEC2 points[4] = {{cx - h, cy - h}, {cx + h, cy - h}, {cx + h, cy + h}, {cx - h, cy + h}};
+        return View(points, 4, radius);
+    }
+
+    CD_CIRCLE make_circle(CD_F32 x, CD_F32 y, CD_F32 r)
+    {
+        CD_CIRCLE c;
+        c.center = cd_vec2_make_v(x, y);
+        c.radius = r;
+        return c;
+    }
+
+    CD_VOID check_vec(CD_VEC2 v, CD_F32 x, CD_F32 y)
+    {
+        CD_TEST_CHECK_NEAR(v.x, x, kTol);
+        CD_TEST_CHECK_NEAR(v.y, y, kTol);
+    }
+
+    CD_VOID check_point(const CD_MANIFOLD_POINT &p, CD_F32 x, CD_F32 y, CD_F32 separation, CD_CONTACT_ID id)
+    {
+        check_vec(p.point, x, y);
+        CD_TEST_CHECK_NEAR(p.separation, separation, kTol);
+        CD_TEST_CHECK(p.id.key == id.key);
+    }
+
+    CD_VOID check_empty(const CD_MANIFOLD &m)
+    {
+        CD_TEST_CHECK(m.pointCount == 0);
+        CD_TEST_CHECK(m.normal.x == 0.0f && m.normal.y == 0.0f);
+    }
+
+    // 小盒子压在大盒子上表面,穿透0.1: 参考边为a的上边,入射边为b的下边,两个端点都保留
+    CD_VOID test_box_on_box()
+    {
+        const View a = make_box(0.0f, 0.0f, 1.0f, 0.0f);
+        const View b = make_box(0.0f, 1.4f, 0.5f, 0.0f);
+        const CD_MANIFOLD m = cd_collide_polygon_views_v(&a.view, &b.view);
+        CD_TEST_CHECK(m.pointCount == 2);
+        check_vec(m.normal, 0.0f, 1.0f);
+        check_point(m.points[0], -0.5f, 0.95f, -0.1f, cd_make_contact_id_v(2, CD_CONTACT_FEATURE_FACE, 0, CD_CONTACT_FEATURE_VERTEX));
+        check_point(m.points[1], 0.5f, 0.95f, -0.1f, cd_make_contact_id_v(2, CD_CONTACT_FEATURE_FACE, 1, CD_CONTACT_FEATURE_VERTEX));
+
+        // 交换顺序: 两侧分离量相同,参考边取a(小盒子)的下边,入射边是大盒子的上边,被侧面裁剪出两个交点
+        const CD_MANIFOLD s = cd_collide_polygon_views_v(&b.view, &a.view);
+        CD_TEST_CHECK(s.pointCount == 2);
+        check_vec(s.normal, 0.0f, -1.0f);
+        check_point(s.points[0], -0.5f, 0.95f, -0.1f, cd_make_contact_id_v(0, CD_CONTACT_FEATURE_VERTEX, 2, CD_CONTACT_FEATURE_FACE));
+        check_point(s.points[1], 0.5f, 0.95f, -0.1f, cd_make_contact_id_v(1, CD_CONTACT_FEATURE_VERTEX, 2, CD_CONTACT_FEATURE_FACE));
+
+        // 整体旋转平移后: 接触点随之变换,间距与id不变
+        for (CD_S32 iter = 0; iter < 100; ++iter)
+        {
+            CD_TRANSFORM t;
+            t.p = cd_vec2_make_v(cd_test::rand_f(-5.0f, 5.0f), cd_test::rand_f(-5.0f, 5.0f));
+            t.q = cd_rot_from_angle_v(cd_test::rand_f(-3.2f, 3.2f));
+            CD_VEC2 pa[4];
+            CD_VEC2 pb[4];
+            for (CD_S32 i = 0; i < 4; ++i)
+            {
+                pa[i] = cd_transforms_point_v(t, a.vertices[i]);
+                pb[i] = cd_transforms_point_v(t, b.vertices[i]);
+            }
+            const View ta(pa, 4, 0.0f);
+            const View tb(pb, 4, 0.0f);
+            const CD_MANIFOLD r = cd_collide_polygon_views_v(&ta.view, &tb.view);
+            CD_TEST_CHECK(r.pointCount == 2);
+            const CD_VEC2 normal = cd_rot_vector_v(t.q, m.normal);
+            CD_TEST_CHECK_NEAR(r.normal.x, normal.x, 1e-4);
+            CD_TEST_CHECK_NEAR(r.normal.y, normal.y, 1e-4);
+            for (CD_S32 k = 0; k < CD_MIN(r.pointCount, 2); ++k)
+            {
+                const CD_VEC2 p = cd_transforms_point_v(t, m.points[k].point);
+                CD_TEST_CHECK_NEAR(r.points[k].point.x, p.x, 1e-4);
+                CD_TEST_CHECK_NEAR(r.points[k].point.y, p.y, 1e-4);
+                CD_TEST_CHECK_NEAR(r.points[k].separation, m.points[k].separation, 1e-4);
+                CD_TEST_CHECK(r.points[k].id.key == m.points[k].id.key);
+            }
+        }
+    }
+
+    // 菱形的下顶点压入盒子上表面: 只有一个接触点
+    CD_VOID test_vertex_face()
+    {
+        const View box = make_box(0.0f, 0.0f, 1.0f, 0.0f);
+        const CD_VEC2 diamond_points[4] = {{0.0f, 0.9f}, {0.5f, 1.4f}, {0.0f, 1.9f}, {-0.5f, 1.4f}};
+        const View diamond(diamond_points, 4, 0.0f);
+
+        const CD_MANIFOLD m = cd_collide_polygon_views_v(&box.view, &diamond.view);
+        CD_TEST_CHECK(m.pointCount == 1);
+        check_vec(m.normal, 0.0f, 1.0f);
+        check_point(m.points[0], 0.0f, 0.95f, -0.1f, cd_make_contact_id_v(2, CD_CONTACT_FEATURE_FACE, 0, CD_CONTACT_FEATURE_VERTEX));
+
+        // 交换顺序: 参考边仍是盒子的上边,特征id与法向随之翻转
+        const CD_MANIFOLD s = cd_collide_polygon_views_v(&diamond.view, &box.view);
+        CD_TEST_CHECK(s.pointCount == 1);
+        check_vec(s.normal, 0.0f, -1.0f);
+        check_point(s.points[0], 0.0f, 0.95f, -0.1f, cd_make_contact_id_v(0, CD_CONTACT_FEATURE_VERTEX, 2, CD_CONTACT_FEATURE_FACE));
+    }
+
+    CD_VOID test_separated()
+    {
+        const View a = make_box(0.0f, 0.0f, 1.0f, 0.0f);
+        const View far_box = make_box(0.0f, 1.6f, 0.5f, 0.0f);
+        check_empty(cd_collide_polygon_views_v(&a.view, &far_box.view));
+        check_empty(cd_collide_polygon_views_v(&far_box.view, &a.view));
+        // 仅在对角方向分离
+        const View corner = make_box(1.55f, 1.55f, 0.5f, 0.0f);
+        check_empty(cd_collide_polygon_views_v(&a.view, &corner.view));
+
+        // 圆角: 间隙0.15小于两侧圆角之和0.2时接触,间距为 0.15 - 0.2
+        const View ra = make_box(0.0f, 0.0f, 1.0f, 0.1f);
+        const View rb = make_box(0.0f, 1.65f, 0.5f, 0.1f);
+        const CD_MANIFOLD m = cd_collide_polygon_views_v(&ra.view, &rb.view);
+        CD_TEST_CHECK(m.pointCount == 2);
+        check_vec(m.normal, 0.0f, 1.0f);
+        check_point(m.points[0], -0.5f, 1.075f, -0.05f, cd_make_contact_id_v(2, CD_CONTACT_FEATURE_FACE, 0, CD_CONTACT_FEATURE_VERTEX));
+        check_point(m.points[1], 0.5f, 1.075f, -0.05f, cd_make_contact_id_v(2, CD_CONTACT_FEATURE_FACE, 1, CD_CONTACT_FEATURE_VERTEX));
+        const View rfar = make_box(0.0f, 1.75f, 0.5f, 0.1f);
+        check_empty(cd_collide_polygon_views_v(&ra.view, &rfar.view));
+    }
+
+    CD_VOID test_polygon_circle()
+    {
+        const View box = make_box(0.0f, 0.0f, 1.0f, 0.0f);
+        const CD_CONTACT_ID top_face = cd_make_contact_id_v(2, CD_CONTACT_FEATURE_FACE, 0, CD_CONTACT_FEATURE_VERTEX);
+
+        // 边区域
+        CD_MANIFOLD m = cd_collide_polygon_view_circle_v(&box.view, make_circle(0.3f, 1.2f, 0.3f));
+        CD_TEST_CHECK(m.pointCount == 1);
+        check_vec(m.normal, 0.0f, 1.0f);
+        check_point(m.points[0], 0.3f, 0.95f, -0.1f, top_face);
+
+        // 顶点区域: 最近点为右上角顶点2
+        m = cd_collide_polygon_view_circle_v(&box.view, make_circle(1.2f, 1.2f, 0.3f));
+        CD_TEST_CHECK(m.pointCount == 1);
+        const CD_F32 d = sqrtf(0.08f);
+        check_vec(m.normal, 0.2f / d, 0.2f / d);
+        const CD_F32 mid = 0.5f * (1.0f + 1.2f - 0.3f * 0.2f / d);
+        check_point(m.points[0], mid, mid, d - 0.3f, cd_make_contact_id_v(2, CD_CONTACT_FEATURE_VERTEX, 0, CD_CONTACT_FEATURE_VERTEX));
+
+        // 顶点区域: 到两条边的分离量都小于半径,但到顶点的距离大于半径
+        check_empty(cd_collide_polygon_view_circle_v(&box.view, make_circle(1.25f, 1.25f, 0.3f)));
+        // 边区域分离
+        check_empty(cd_collide_polygon_view_circle_v(&box.view, make_circle(0.3f, 1.31f, 0.3f)));
+
+        // 圆心在多边形内: 取分离量最大(最浅)的上边
+        m = cd_collide_polygon_view_circle_v(&box.view, make_circle(0.2f, 0.7f, 0.1f));
+        CD_TEST_CHECK(m.pointCount == 1);
+        check_vec(m.normal, 0.0f, 1.0f);
+        check_point(m.points[0], 0.2f, 0.8f, -0.4f, top_face);
+
+        // 圆角多边形
+        const View rounded = make_box(0.0f, 0.0f, 1.0f, 0.1f);
+        m = cd_collide_polygon_view_circle_v(&rounded.view, make_circle(0.0f, 1.25f, 0.2f));
+        CD_TEST_CHECK(m.pointCount == 1);
+        check_point(m.points[0], 0.0f, 1.075f, -0.05f, top_face);
+        check_empty(cd_collide_polygon_view_circle_v(&rounded.view, make_circle(0.0f, 1.35f, 0.2f)));
+    }
+
+    CD_VOID test_circles()
+    {
+        CD_MANIFOLD m = cd_collide_circles_v(make_circle(0.0f, 0.0f, 1.0f), make_circle(1.5f, 0.0f, 0.7f));
+        CD_TEST_CHECK(m.pointCount == 1);
+        check_vec(m.normal, 1.0f, 0.0f);
+        check_point(m.points[0], 0.9f, 0.0f, -0.2f, cd_make_contact_id_v(0, 0, 0, 0));
+
+        // 恰好相切
+        m = cd_collide_circles_v(make_circle(0.0f, 0.0f, 1.0f), make_circle(0.0f, -1.5f, 0.5f));
+        CD_TEST_CHECK(m.pointCount == 1);
+        check_vec(m.normal, 0.0f, -1.0f);
+        check_point(m.points[0], 0.0f, -1.0f, 0.0f, cd_make_contact_id_v(0, 0, 0, 0));
+
+        // 圆心重合: 法向取x轴
+        m = cd_collide_circles_v(make_circle(2.0f, 3.0f, 1.0f), make_circle(2.0f, 3.0f, 0.5f));
+        CD_TEST_CHECK(m.pointCount == 1);
+        check_vec(m.normal, 1.0f, 0.0f);
+        CD_TEST_CHECK_NEAR(m.points[0].separation, -1.5f, kTol);
+
+        check_empty(cd_collide_circles_v(make_circle(0.0f, 0.0f, 1.0f), make_circle(1.8f, 0.0f, 0.7f)));
+    }
+} // namespace
+
+int main()
+{
+    test_box_on_box();
+    test_vertex_face();
+    test_separated();
+    test_polygon_circle();
+    test_circles();
+    return cd_test::report("test_manifold");
+}
@@ -0,0 +1,184 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 16:29:05
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 16:29:05
+ */
+
+// obb分离轴检测: 重叠判定与由顶点投影的双精度暴力一致;最小穿透向量与手算结果一致,
+// 沿其移动 depth 恰好分离,沿任何方向移动少于 depth 都仍然重叠
+
+#include "cd_test.h"
+
+#include <math.h>
+
+namespace
+{
+    const CD_F64 kTol = 1e-5;
+
+    CD_VEC2 rand_vec(CD_F32 range)
+    {
+        return cd_vec2_make_v(cd_test::rand_f(-range, range), cd_test::rand_f(-range, range));
+    }
+
+    CD_OBB rand_obb()
+    {
+        return cd_create_obb_v(rand_vec(2.0f), cd_test::rand_f(0.1f, 3.0f), cd_test::rand_f(0.1f, 2.0f),
+                               cd_test::rand_f(-3.2f, 3.2f));
+    }
+
+    CD_OBB moved(CD_OBB obb, CD_VEC2 delta)
+    {
+        obb.center = cd_vec2_add_v(obb.center, delta);
+        return obb;
+    }
+
+    // 暴力: 两个obb各自的两条边法向共四个轴,把8个顶点投影到轴上求重叠量,取最小值;负值表示分离
+    CD_F64 brute_force_overlap(CD_OBB a, CD_OBB b, CD_F64 *nx, CD_F64 *ny)
+    {
+        CD_VEC2 va[4], vb[4];
+        cd_obb_vertices_v(a, va);
+        cd_obb_vertices_v(b, vb);
+        CD_F64 best = 1e30;
+        for (CD_S32 k = 0; k < 4; ++k)
+        {
+            const CD_VEC2 *v = k < 2 ? va : vb;
+            // 边 (v0, v1) 与 (v1, v2) 的方向
+            const CD_F64 ex = (CD_F64)v[k % 2 + 1].x - v[k % 2].x;
+            const CD_F64 ey = (CD_F64)v[k % 2 + 1].y - v[k % 2].y;
+            const CD_F64 len = sqrt(ex * ex + ey * ey);
+            const CD_F64 ax = ey / len, ay = -ex / len;
+            CD_F64 min_a = 1e30, max_a = -1e30, min_b = 1e30, max_b = -1e30;
+            for (CD_S32 i = 0; i < 4; ++i)
+            {
+                const CD_F64 pa = ax * va[i].x + ay * va[i].y;
+                const CD_F64 pb = ax * vb[i].x + ay * vb[i].y;
+                min_a = CD_MIN(min_a, pa);
+                max_a = CD_MAX(max_a, pa);
+                min_b = CD_MIN(min_b, pb);
+                max_b = CD_MAX(max_b, pb);
+            }
+            // b 沿 +axis 移出 max_a - min_b,沿 -axis 移出 max_b - min_a
+            const CD_F64 forward = max_a - min_b;
+            const CD_F64 backward = max_b - min_a;
+            const CD_F64 overlap = CD_MIN(forward, backward);
+            if (overlap < best)
+            {
+                best = overlap;
+                *nx = forward <= backward ? ax : -ax;
+                *ny = forward <= backward ? ay : -ay;
+            }
+        }
+        return best;
+    }
+
+    CD_VOID check_mtv(CD_OBB a, CD_OBB b, CD_F32 nx, CD_F32 ny, CD_F32 depth)
+    {
+        CD_VEC2 normal;
+        CD_F32 d = -1.0f;
+        CD_TEST_CHECK(cd_obb_overlap_mtv_v(a, b, &normal, &d));
+        CD_TEST_CHECK_NEAR(normal.x, nx, kTol);
+        CD_TEST_CHECK_NEAR(normal.y, ny, kTol);
+        CD_TEST_CHECK_NEAR(d, depth, kTol);
+    }
+
+    CD_VOID test_known()
+    {
+        const CD_OBB a = cd_create_obb_v(Vec2_Zero, 2.0f, 2.0f, 0.0f);
+
+        // 轴对齐: x方向重叠0.5,y方向重叠1.8
+        check_mtv(a, cd_create_obb_v(cd_vec2_make_v(1.5f, 0.2f), 2.0f, 2.0f, 0.0f), 1.0f, 0.0f, 0.5f);
+        check_mtv(a, cd_create_obb_v(cd_vec2_make_v(-0.2f, -1.5f), 2.0f, 2.0f, 0.0f), 0.0f, -1.0f, 0.5f);
+
+        // 旋转45度的方块在右侧: a的x轴上重叠 1 + sqrt(2) - 2.2,b的轴上重叠 2 * sqrt(2) - 2.2 / sqrt(2)
+        const CD_OBB diamond = cd_create_obb_v(cd_vec2_make_v(2.2f, 0.0f), 2.0f, 2.0f, 0.25f * CD_PI);
+        check_mtv(a, diamond, 1.0f, 0.0f, 1.0f + sqrtf(2.0f) - 2.2f);
+        // 交换次序,法向反向
+        check_mtv(diamond, a, -1.0f, 0.0f, 1.0f + sqrtf(2.0f) - 2.2f);
+
+        // 细长的b横穿a: 沿b的短轴推出更近
+        const CD_OBB bar = cd_create_obb_v(cd_vec2_make_v(0.0f, 0.8f), 10.0f, 0.4f, 0.0f);
+        check_mtv(a, bar, 0.0f, 1.0f, 0.4f);
+
+        // 边界接触算重叠,深度为0
+        check_mtv(a, cd_create_obb_v(cd_vec2_make_v(2.0f, 0.5f), 2.0f, 2.0f, 0.0f), 1.0f, 0.0f, 0.0f);
+
+        // 分离: 法向为0向量,深度为0
+        CD_VEC2 normal = cd_vec2_make_v(7.0f, 7.0f);
+        CD_F32 depth = 7.0f;
+        CD_TEST_CHECK(!cd_obb_overlap_mtv_v(a, cd_create_obb_v(cd_vec2_make_v(2.1f, 0.0f), 2.0f, 2.0f, 0.0f), &normal, &depth));
+        CD_TEST_CHECK(normal.x == 0.0f && normal.y == 0.0f && depth == 0.0f);
+        // 对角分离: 两个轴上投影都重叠,只有b的轴能分开
+        CD_TEST_CHECK(!cd_obb_overlap_v(a, cd_create_obb_v(cd_vec2_make_v(2.3f, 2.3f), 2.0f, 2.0f, 0.25f * CD_PI)));
+        CD_TEST_CHECK(cd_obb_overlap_v(a, cd_create_obb_v(cd_vec2_make_v(1.6f, 1.6f), 2.0f, 2.0f, 0.25f * CD_PI)));
+
+        // 带检查的接口: 不重叠时不修改法向,输出可为null
+        const CD_OBB far_box = cd_create_obb_v(cd_vec2_make_v(5.0f, 0.0f), 2.0f, 2.0f, 0.0f);
+        CD_BOOL result = CD_TRUE;
+        normal = cd_vec2_make_v(7.0f, 7.0f);
+        CD_TEST_CHECK(cd_obb_overlap_mtv(&a, &far_box, &result, &normal, &depth) == CD_RET_OK);
+        CD_TEST_CHECK(!result && normal.x == 7.0f && depth == 0.0f);
+        CD_TEST_CHECK(cd_obb_overlap_mtv(&a, &diamond, &result, CD_NULL, CD_NULL) == CD_RET_OK);
+        CD_TEST_CHECK(result);
+        CD_TEST_CHECK(cd_obb_overlap_mtv(&a, CD_NULL, &result, &normal, &depth) == COLLISION_DETECTION_E_PARAM_NULL);
+        CD_TEST_CHECK(cd_obb_overlap(&a, &far_box, CD_NULL) == COLLISION_DETECTION_E_PARAM_NULL);
+    }
+
+    CD_VOID test_random()
+    {
+        CD_S32 overlaps = 0;
+        CD_S32 decided = 0;
+        for (CD_S32 iter = 0; iter < 50000; ++iter)
+        {
+            const CD_OBB a = rand_obb();
+            const CD_OBB b = rand_obb();
+            CD_F64 nx = 0.0, ny = 0.0;
+            const CD_F64 expected = brute_force_overlap(a, b, &nx, &ny);
+            CD_VEC2 normal;
+            CD_F32 depth = -1.0f;
+            const CD_BOOL hit = cd_obb_overlap_mtv_v(a, b, &normal, &depth);
+            CD_TEST_CHECK(hit == cd_obb_overlap_v(a, b));
+            CD_BOOL result = !hit;
+            CD_TEST_CHECK(cd_obb_overlap(&a, &b, &result) == CD_RET_OK && result == hit);
+            // 接近接触时两者的结论取决于舍入
+            if (fabs(expected) < 1e-4)
+            {
+                continue;
+            }
+            ++decided;
+            CD_TEST_CHECK(hit == (expected > 0.0));
+            if (!hit || expected <= 0.0)
+            {
+                continue;
+            }
+            ++overlaps;
+            CD_TEST_CHECK_NEAR(depth, expected, 1e-4);
+            CD_TEST_CHECK_NEAR(cd_vec2_len_v(normal), 1.0, kTol);
+            // 有两个轴的重叠量几乎相同时,选哪个都对
+            CD_F64 ox = 0.0, oy = 0.0;
+            const CD_F64 along = brute_force_overlap(a, moved(b, cd_vec2_scale_v(normal, depth + 1e-3f)), &ox, &oy);
+            CD_TEST_CHECK(along < 0.0);
+            CD_TEST_CHECK(!cd_obb_overlap_v(a, moved(b, cd_vec2_scale_v(normal, depth + 1e-3f))));
+            // 由a指向b
+            CD_TEST_CHECK(cd_vec2_dot_v(normal, cd_vec2_sub_v(b.center, a.center)) >= -1e-4f);
+            if (depth > 2e-3f)
+            {
+                // 最小性: 沿任意方向移动不到 depth 都不能分开
+                for (CD_S32 k = 0; k < 8; ++k)
+                {
+                    const CD_VEC2 dir = cd_create_unit_vec2_v(cd_test::rand_f(-3.2f, 3.2f));
+                    CD_TEST_CHECK(cd_obb_overlap_v(a, moved(b, cd_vec2_scale_v(dir, depth - 1e-3f))));
+                }
+            }
+        }
+        CD_TEST_CHECK(decided > 49000);
+        CD_TEST_CHECK(overlaps > 5000 && overlaps < 45000);
+    }
+} // namespace
+
+int main()
+{
+    test_known();
+    test_random();
+    return cd_test::report("test_obb");
+}
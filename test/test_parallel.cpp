@@ -0,0 +1,310 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 14:31:08
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 14:31:08
+ */
+
+// 线程池: 多线程、每块一个查询时结果与串行一致,分块的错误被返回,
+// 反复初始化与销毁正常,创建线程失败时回收已创建的线程
+
+#include <pthread.h>
+
+// 替换线程创建函数,统计创建与退出的线程数,并可在第 N 次创建时失败
+static int cd_test_thread_create(pthread_t *thread, const pthread_attr_t *attr, void *(*routine)(void *), void *arg);
+#define CD_PARALLEL_THREAD_CREATE cd_test_thread_create
+
+#include "cd_test.h"
+
+#include <vector>
+
+namespace
+{
+    struct ThreadSlot
+    {
+        void *(*routine)(void *);
+        void *arg;
+    };
+
+    ThreadSlot g_slots[CD_MAX_WORKERS * 64];
+    CD_S32 g_create_limit = -1; // 允许创建的线程数,负数表示不限
+    CD_S32 g_created = 0;
+    CD_S32 g_exited = 0;
+
+    void *thread_trampoline(void *arg)
+    {
+        const ThreadSlot *slot = (const ThreadSlot *)arg;
+        void *result = slot->routine(slot->arg);
+        __atomic_add_fetch(&g_exited, 1, __ATOMIC_SEQ_CST);
+        return result;
+    }
+} // namespace
+
+static int cd_test_thread_create(pthread_t *thread, const pthread_attr_t *attr, void *(*routine)(void *), void *arg)
+{
+    if ((g_create_limit >= 0 && g_created >= g_create_limit) || g_created >= (CD_S32)(sizeof(g_slots) / sizeof(g_slots[0])))
+    {
+        return -1;
+    }
+    ThreadSlot *slot = &g_slots[g_created++];
+    slot->routine = routine;
+    slot->arg = arg;
+    return pthread_create(thread, attr, thread_trampoline, slot);
+}
+
+namespace
+{
+    const CD_S32 kWorkers = 16;
+
+    CD_VEC2 rand_vec(CD_F32 range)
+    {
+        return cd_vec2_make_v(cd_test::rand_f(-range, range), cd_test::rand_f(-range, range));
+    }
+
+    CD_OBB rand_obb(CD_F32 range)
+    {
+        return cd_create_obb_v(rand_vec(range), cd_test::rand_f(0.2f, 2.0f), cd_test::rand_f(0.2f, 1.0f),
+                               cd_test::rand_f(-3.2f, 3.2f));
+    }
+
+    // 每块一个查询: 记录每个下标被执行的次数与执行线程,指定下标返回错误
+    struct CountContext
+    {
+        CD_S32 *visits;
+        CD_S32 *workers;
+        CD_S32 failAt;
+        CD_RET errors[CD_PARALLEL_ERROR_SLOT(CD_MAX_WORKERS)];
+    };
+
+    CD_VOID count_task(CD_VOID *context, CD_S32 begin, CD_S32 end, CD_S32 worker)
+    {
+        CountContext *c = (CountContext *)context;
+        for (CD_S32 i = begin; i < end; ++i)
+        {
+            __atomic_add_fetch(&c->visits[i], 1, __ATOMIC_RELAXED);
+            c->workers[i] = worker;
+            cd_parallel_record_error_v(c->errors, worker, i == c->failAt ? COLLISION_DETECTION_E_CALC_ERROR : CD_RET_OK);
+        }
+    }
+
+    // 运行一次每块一个查询的任务,检查每个下标恰好执行一次,返回第一个错误
+    CD_RET run_count_task(CD_WORKER_POOL *pool, CD_S32 count, CD_S32 fail_at)
+    {
+        std::vector<CD_S32> visits(count, 0);
+        std::vector<CD_S32> workers(count, -1);
+        CountContext context;
+        context.visits = visits.data();
+        context.workers = workers.data();
+        context.failAt = fail_at;
+        for (CD_S32 i = 0; i < CD_MAX_WORKERS; ++i)
+        {
+            context.errors[CD_PARALLEL_ERROR_SLOT(i)] = CD_RET_OK;
+        }
+        CD_TEST_CHECK(cd_worker_pool_run(pool, count, 1, count_task, &context) == CD_RET_OK);
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            CD_TEST_CHECK(visits[i] == 1);
+            CD_TEST_CHECK(workers[i] >= 0 && workers[i] < pool->workerCount);
+        }
+        return cd_parallel_first_error_v(context.errors, pool->workerCount);
+    }
+
+    CD_VOID test_points_in_polygon(CD_WORKER_POOL *pool)
+    {
+        CD_VEC2 points[MAX_POLYGON_VERTICES];
+        CD_VEC2 scratch[CD_HULL_SCRATCH_SIZE(MAX_POLYGON_VERTICES)];
+        for (CD_S32 i = 0; i < MAX_POLYGON_VERTICES; ++i)
+        {
+            points[i] = rand_vec(5.0f);
+        }
+        CD_POLYGON polygon;
+        CD_TEST_CHECK(cd_make_polygon(points, MAX_POLYGON_VERTICES, 0.3f, scratch, &polygon) == CD_RET_OK);
+        const CD_POLYGON_VIEW view = cd_polygon_view_v(&polygon);
+
+        // 点数不是分块大小与32的整数倍,也覆盖少于一块的情况
+        const CD_S32 counts[3] = {CD_PARALLEL_POINT_CHUNK * 37 + 13, 1000, 0};
+        for (CD_S32 k = 0; k < 3; ++k)
+        {
+            const CD_S32 count = counts[k];
+            std::vector<CD_F32> xs(count + 1);
+            std::vector<CD_F32> ys(count + 1);
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                xs[i] = cd_test::rand_f(-6.0f, 6.0f);
+                ys[i] = cd_test::rand_f(-6.0f, 6.0f);
+            }
+            const CD_S32 words = (count + 31) / 32 + 1;
+            std::vector<CD_U32> expected_mask(words, 0);
+            std::vector<CD_U32> mask(words, 0xFFFFFFFFu);
+            CD_S32 expected = -1;
+            CD_S32 result = -1;
+            CD_TEST_CHECK(cd_points_in_polygon_view_batch(xs.data(), ys.data(), count, &view, polygon.radius,
+                                                          expected_mask.data(), &expected) == CD_RET_OK);
+            CD_TEST_CHECK(cd_parallel_points_in_polygon(pool, xs.data(), ys.data(), count, &view, polygon.radius, mask.data(),
+                                                        &result) == CD_RET_OK);
+            CD_TEST_CHECK(result == expected);
+            for (CD_S32 w = 0; w < (count + 31) / 32; ++w)
+            {
+                CD_TEST_CHECK(mask[w] == expected_mask[w]);
+            }
+            CD_TEST_CHECK(cd_parallel_points_in_polygon(pool, xs.data(), ys.data(), count, &view, polygon.radius, CD_NULL,
+                                                        &result) == CD_RET_OK);
+            CD_TEST_CHECK(result == expected);
+        }
+    }
+
+    CD_VOID test_trajectories(CD_WORKER_POOL *pool)
+    {
+        const CD_S32 pose_count = 20;
+        const CD_S32 trajectory_count = 300;
+        const CD_OBB footprint = cd_create_obb_v(cd_vec2_make_v(0.0f, 0.0f), 2.0f, 1.0f, 0.0f);
+        std::vector<CD_OBB> obstacles(200);
+        for (size_t i = 0; i < obstacles.size(); ++i)
+        {
+            obstacles[i] = rand_obb(20.0f);
+        }
+        std::vector<CD_TRANSFORM> poses(pose_count * trajectory_count);
+        for (CD_S32 t = 0; t < trajectory_count; ++t)
+        {
+            CD_VEC2 p = rand_vec(20.0f);
+            const CD_F32 heading = cd_test::rand_f(-3.2f, 3.2f);
+            for (CD_S32 k = 0; k < pose_count; ++k)
+            {
+                p = cd_vec2_mul_add_v(p, 0.3f, cd_create_unit_vec2_v(heading));
+                poses[t * pose_count + k].p = p;
+                poses[t * pose_count + k].q = cd_rot_from_angle_v(heading);
+            }
+        }
+
+        std::vector<CD_S32> result_poses(trajectory_count, 12345);
+        std::vector<CD_S32> result_obstacles(trajectory_count, 12345);
+        CD_TEST_CHECK(cd_parallel_trajectories_check_obb(pool, poses.data(), pose_count, trajectory_count, &footprint,
+                                                         obstacles.data(), (CD_S32)obstacles.size(), result_poses.data(),
+                                                         result_obstacles.data()) == CD_RET_OK);
+        CD_S32 hits = 0;
+        for (CD_S32 t = 0; t < trajectory_count; ++t)
+        {
+            CD_S32 expected_pose = -1;
+            CD_S32 expected_obstacle = -1;
+            CD_TEST_CHECK(cd_trajectory_check_obb(&poses[t * pose_count], pose_count, &footprint, obstacles.data(),
+                                                  (CD_S32)obstacles.size(), &expected_pose, &expected_obstacle) == CD_RET_OK);
+            CD_TEST_CHECK(result_poses[t] == expected_pose);
+            CD_TEST_CHECK(result_obstacles[t] == expected_obstacle);
+            hits += expected_pose != CD_TRAJECTORY_NO_HIT;
+        }
+        CD_TEST_CHECK(hits > 30 && hits < trajectory_count - 30);
+    }
+
+    CD_VOID test_tree_overlap(CD_WORKER_POOL *pool)
+    {
+        const CD_S32 obstacle_count = 500;
+        const CD_S32 query_count = 2000;
+        std::vector<CD_OBB> obstacles(obstacle_count);
+        std::vector<CD_TREE_NODE> nodes(2 * obstacle_count);
+        CD_DYNAMIC_TREE tree;
+        CD_TEST_CHECK(cd_dynamic_tree_init(&tree, nodes.data(), (CD_S32)nodes.size()) == CD_RET_OK);
+        for (CD_S32 i = 0; i < obstacle_count; ++i)
+        {
+            obstacles[i] = rand_obb(30.0f);
+            const CD_AABB box = cd_obb_to_aabb_v(obstacles[i]);
+            CD_S32 proxy = -1;
+            CD_TEST_CHECK(cd_dynamic_tree_create_proxy(&tree, &box, i, &proxy) == CD_RET_OK);
+        }
+        std::vector<CD_OBB> queries(query_count);
+        for (CD_S32 i = 0; i < query_count; ++i)
+        {
+            queries[i] = rand_obb(30.0f);
+        }
+        std::vector<CD_S32> results(query_count, 12345);
+        CD_TEST_CHECK(cd_parallel_tree_overlap_obbs(pool, &tree, obstacles.data(), queries.data(), query_count,
+                                                    results.data()) == CD_RET_OK);
+        CD_S32 hits = 0;
+        for (CD_S32 i = 0; i < query_count; ++i)
+        {
+            // 串行: 同样的遍历顺序得到同一个障碍物
+            CD_TREE_OBB_HIT hit;
+            hit.obstacles = obstacles.data();
+            hit.query = queries[i];
+            hit.hit = CD_TREE_NULL_NODE;
+            const CD_AABB box = cd_obb_to_aabb_v(queries[i]);
+            CD_TEST_CHECK(cd_dynamic_tree_query(&tree, &box, cd_tree_obb_hit_callback, &hit) == CD_RET_OK);
+            CD_TEST_CHECK(results[i] == hit.hit);
+
+            // 暴力: 有碰撞当且仅当存在相交的障碍物
+            CD_BOOL any = CD_FALSE;
+            for (CD_S32 j = 0; j < obstacle_count && !any; ++j)
+            {
+                any = cd_obb_overlap_v(queries[i], obstacles[j]);
+            }
+            CD_TEST_CHECK(any == (results[i] != CD_TREE_NULL_NODE));
+            if (results[i] != CD_TREE_NULL_NODE)
+            {
+                CD_TEST_CHECK(cd_obb_overlap_v(queries[i], obstacles[results[i]]));
+                ++hits;
+            }
+        }
+        CD_TEST_CHECK(hits > 100 && hits < query_count - 100);
+    }
+
+    CD_VOID test_results_match_serial()
+    {
+        CD_WORKER_POOL pool;
+        CD_TEST_CHECK(cd_worker_pool_init(&pool, kWorkers) == CD_RET_OK);
+        CD_TEST_CHECK(pool.workerCount == (CD_PARALLEL_THREADS ? kWorkers : 1));
+        test_points_in_polygon(&pool);
+        test_trajectories(&pool);
+        test_tree_overlap(&pool);
+
+        // 每块一个查询: 每个下标恰好执行一次,某一块的错误被返回
+        CD_TEST_CHECK(run_count_task(&pool, 5000, -1) == CD_RET_OK);
+        CD_TEST_CHECK(run_count_task(&pool, 5000, 4321) == COLLISION_DETECTION_E_CALC_ERROR);
+        CD_TEST_CHECK(run_count_task(&pool, 3, 2) == COLLISION_DETECTION_E_CALC_ERROR);
+        CD_TEST_CHECK(cd_worker_pool_destroy(&pool) == CD_RET_OK);
+    }
+
+    CD_VOID test_repeated_cycles()
+    {
+        for (CD_S32 cycle = 0; cycle < 40; ++cycle)
+        {
+            CD_WORKER_POOL pool;
+            const CD_S32 workers = cd_test::rand_s(1, CD_MAX_WORKERS);
+            CD_TEST_CHECK(cd_worker_pool_init(&pool, workers) == CD_RET_OK);
+            for (CD_S32 run = 0; run < 5; ++run)
+            {
+                CD_TEST_CHECK(run_count_task(&pool, cd_test::rand_s(0, 300), -1) == CD_RET_OK);
+            }
+            CD_TEST_CHECK(cd_worker_pool_destroy(&pool) == CD_RET_OK);
+        }
+        CD_TEST_CHECK(g_exited == g_created);
+    }
+
+    CD_VOID test_failed_init()
+    {
+#if CD_PARALLEL_THREADS
+        // 第4个后台线程创建失败: 已创建的3个线程退出并被回收
+        g_created = 0;
+        g_exited = 0;
+        g_create_limit = 3;
+        CD_WORKER_POOL pool;
+        CD_TEST_CHECK(cd_worker_pool_init(&pool, 8) == COLLISION_DETECTION_E_CALC_ERROR);
+        CD_TEST_CHECK(g_created == 3);
+        CD_TEST_CHECK(__atomic_load_n(&g_exited, __ATOMIC_SEQ_CST) == 3);
+        CD_TEST_CHECK(pool.workerCount == 0);
+
+        // 失败后可以重新初始化
+        g_create_limit = -1;
+        CD_TEST_CHECK(cd_worker_pool_init(&pool, 8) == CD_RET_OK);
+        CD_TEST_CHECK(run_count_task(&pool, 100, 50) == COLLISION_DETECTION_E_CALC_ERROR);
+        CD_TEST_CHECK(cd_worker_pool_destroy(&pool) == CD_RET_OK);
+        CD_TEST_CHECK(g_created == 10 && g_exited == 10);
+#endif
+    }
+} // namespace
+
+int main()
+{
+    test_results_match_serial();
+    test_repeated_cycles();
+    test_failed_init();
+    return cd_test::report("test_parallel");
+}
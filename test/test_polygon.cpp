@@ -0,0 +1,172 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 10:40:18
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 10:40:18
+ */
+
+// 快速凸包: 凸性、包含性、顶点上限在清理之后才检查,以及由顶点计算的包围盒
+
+#include "cd_test.h"
+
+#include <string.h>
+#include <vector>
+
+namespace
+{
+    // 逆时针且严格凸
+    CD_BOOL is_convex_ccw(const CD_VEC2 *hull, CD_S32 m)
+    {
+        for (CD_S32 i = 0; i < m; ++i)
+        {
+            const CD_VEC2 a = hull[i];
+            const CD_VEC2 b = hull[(i + 1) % m];
+            const CD_VEC2 c = hull[(i + 2) % m];
+            if (cd_points_cross_v(a, b, c) <= 0.0f)
+            {
+                return CD_FALSE;
+            }
+        }
+        return CD_TRUE;
+    }
+
+    // 所有点到凸包的外侧距离不超过合并距离
+    CD_BOOL contains_all(const CD_VEC2 *hull, CD_S32 m, const CD_VEC2 *points, CD_S32 count)
+    {
+        for (CD_S32 j = 0; j < count; ++j)
+        {
+            for (CD_S32 i = 0; i < m; ++i)
+            {
+                const CD_VEC2 a = hull[i];
+                const CD_VEC2 b = hull[(i + 1) % m];
+                const CD_F32 dist = cd_points_cross_v(a, b, points[j]) / cd_vec2_dis_v(a, b);
+                if (dist < -2.0f * CD_HULL_WELD_DISTANCE)
+                {
+                    return CD_FALSE;
+                }
+            }
+        }
+        return CD_TRUE;
+    }
+
+    CD_VOID test_random_clouds()
+    {
+        for (CD_S32 iter = 0; iter < 2000; ++iter)
+        {
+            const CD_S32 count = cd_test::rand_s(3, 200);
+            std::vector<CD_VEC2> points(count);
+            std::vector<CD_VEC2> scratch(CD_HULL_SCRATCH_SIZE(count));
+            std::vector<CD_VEC2> hull(count);
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                points[i] = cd_vec2_make_v(cd_test::rand_f(-5.0f, 5.0f), cd_test::rand_f(-5.0f, 5.0f));
+            }
+            CD_S32 m = 0;
+            const CD_RET ret = cd_make_hull(points.data(), count, scratch.data(), hull.data(), count, &m);
+            if (ret == COLLISION_DETECTION_E_CALC_ERROR)
+            {
+                continue;
+            }
+            CD_TEST_CHECK(ret == CD_RET_OK);
+            CD_TEST_CHECK(m >= 3 && m <= count);
+            CD_TEST_CHECK(is_convex_ccw(hull.data(), m));
+            CD_TEST_CHECK(contains_all(hull.data(), m, points.data(), count));
+        }
+    }
+
+    // 带噪声的小圆: 原始凸包顶点常多于上限,合并与去共线后落在上限内;
+    // 结果只取决于清理后的顶点数,与容量足够时求得的凸包一致
+    CD_VOID test_limit_after_cleanup()
+    {
+        CD_S32 checked = 0;
+        for (CD_S32 iter = 0; iter < 2000; ++iter)
+        {
+            const CD_S32 count = cd_test::rand_s(10, 200);
+            const CD_F32 radius = cd_test::rand_f(0.01f, 0.2f);
+            const CD_F32 noise = cd_test::rand_f(0.0f, 0.01f);
+            std::vector<CD_VEC2> points(count);
+            std::vector<CD_VEC2> scratch(CD_HULL_SCRATCH_SIZE(count));
+            std::vector<CD_VEC2> hull(count);
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                const CD_F32 r = radius + cd_test::rand_f(-noise, noise);
+                points[i] = cd_vec2_scale_v(cd_create_unit_vec2_v(cd_test::rand_f(0.0f, CD_2PI)), r);
+            }
+            CD_S32 m = 0;
+            if (cd_make_hull(points.data(), count, scratch.data(), hull.data(), count, &m) != CD_RET_OK)
+            {
+                continue;
+            }
+            CD_POLYGON polygon;
+            const CD_RET ret = cd_make_polygon(points.data(), count, 0.0f, scratch.data(), &polygon);
+            if (m <= MAX_POLYGON_VERTICES)
+            {
+                CD_TEST_CHECK(ret == CD_RET_OK);
+                CD_TEST_CHECK(ret != CD_RET_OK || polygon.count == m);
+                ++checked;
+            }
+            else
+            {
+                CD_TEST_CHECK(ret == COLLISION_DETECTION_E_MEM_FULL);
+            }
+        }
+        CD_TEST_CHECK(checked > 100);
+
+        CD_POLYGON polygon;
+        // 重复点同理
+        std::vector<CD_VEC2> dup;
+        for (CD_S32 i = 0; i < 3 * MAX_POLYGON_VERTICES; ++i)
+        {
+            const CD_VEC2 corner[3] = {cd_vec2_make_v(0.0f, 0.0f), cd_vec2_make_v(1.0f, 0.0f), cd_vec2_make_v(0.0f, 1.0f)};
+            dup.push_back(cd_vec2_add_v(corner[i % 3], cd_vec2_make_v(0.0001f * (CD_F32)(i / 3), 0.0f)));
+        }
+        std::vector<CD_VEC2> scratch2(CD_HULL_SCRATCH_SIZE((CD_S32)dup.size()));
+        CD_TEST_CHECK(cd_make_polygon(dup.data(), (CD_S32)dup.size(), 0.0f, scratch2.data(), &polygon) == CD_RET_OK);
+        CD_TEST_CHECK(polygon.count == 3);
+    }
+
+    // 清理后仍超过上限时返回 E_MEM_FULL
+    CD_VOID test_limit_exceeded()
+    {
+        const CD_S32 count = MAX_POLYGON_VERTICES + 1;
+        std::vector<CD_VEC2> points(count);
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            points[i] = cd_create_unit_vec2_v(CD_2PI * (CD_F32)i / (CD_F32)count);
+        }
+        std::vector<CD_VEC2> scratch(CD_HULL_SCRATCH_SIZE(count));
+        CD_POLYGON polygon;
+        CD_TEST_CHECK(cd_make_polygon(points.data(), count, 0.0f, scratch.data(), &polygon) == COLLISION_DETECTION_E_MEM_FULL);
+        CD_TEST_CHECK(cd_make_polygon(points.data(), count - 1, 0.0f, scratch.data(), &polygon) == CD_RET_OK);
+        CD_TEST_CHECK(polygon.count == MAX_POLYGON_VERTICES);
+    }
+
+    // 手工填写顶点、未调用 cd_polygon_update 的多边形也能得到正确包围盒
+    CD_VOID test_hand_built_aabb()
+    {
+        CD_POLYGON polygon;
+        memset(&polygon, 0xCD, sizeof(polygon));
+        polygon.count = 3;
+        polygon.radius = 0.5f;
+        polygon.vertices[0] = cd_vec2_make_v(1.0f, 2.0f);
+        polygon.vertices[1] = cd_vec2_make_v(4.0f, 2.0f);
+        polygon.vertices[2] = cd_vec2_make_v(2.0f, 6.0f);
+        CD_AABB box;
+        CD_TEST_CHECK(cd_polygon_to_aabb(&polygon, &box) == CD_RET_OK);
+        CD_TEST_CHECK(box.lowerBound.x == 0.5f && box.lowerBound.y == 1.5f);
+        CD_TEST_CHECK(box.upperBound.x == 4.5f && box.upperBound.y == 6.5f);
+
+        cd_polygon_update_v(&polygon);
+        const CD_AABB cached = polygon.aabb;
+        CD_TEST_CHECK(cached.lowerBound.x == box.lowerBound.x && cached.upperBound.y == box.upperBound.y);
+    }
+} // namespace
+
+int main()
+{
+    test_random_clouds();
+    test_limit_after_cleanup();
+    test_limit_exceeded();
+    test_hand_built_aabb();
+    return cd_test::report("test_polygon");
+}
@@ -0,0 +1,635 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 16:21:37
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 16:21:37
+ */
+
+// 射线检测: 线段、圆、aabb、obb、尖角与圆角多边形的命中、比例与法向和双精度参考一致,
+// 起点在形状内部不算命中;动态树上的单条射线、批量射线与16条一包的射线包与逐个障碍物暴力枚举一致
+
+#include "cd_test.h"
+
+#include <math.h>
+#include <set>
+#include <vector>
+
+namespace
+{
+    const CD_F64 kAmbiguous = 1e-3; // 擦边、起点贴着边界等情形,float 与参考的结论可以不同,跳过
+    const CD_F64 kPointTol = 1e-3;
+
+    struct D2
+    {
+        CD_F64 x, y;
+    };
+
+    D2 d2(CD_VEC2 v)
+    {
+        D2 r = {v.x, v.y};
+        return r;
+    }
+
+    D2 d2_sub(D2 a, D2 b)
+    {
+        D2 r = {a.x - b.x, a.y - b.y};
+        return r;
+    }
+
+    D2 d2_mul_add(D2 a, CD_F64 s, D2 b)
+    {
+        D2 r = {a.x + s * b.x, a.y + s * b.y};
+        return r;
+    }
+
+    CD_F64 d2_dot(D2 a, D2 b)
+    {
+        return a.x * b.x + a.y * b.y;
+    }
+
+    CD_F64 d2_len(D2 a)
+    {
+        return sqrt(d2_dot(a, a));
+    }
+
+    // 参考形状: 逆时针凸多边形外扩 radius;只有一个顶点时为圆
+    struct Shape
+    {
+        std::vector<D2> vertices;
+        std::vector<D2> normals;
+        CD_F64 radius;
+
+        Shape(const CD_VEC2 *points, CD_S32 count, CD_F32 r) : radius(r)
+        {
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                vertices.push_back(d2(points[i]));
+            }
+            for (CD_S32 i = 0; count > 1 && i < count; ++i)
+            {
+                const D2 e = d2_sub(vertices[(i + 1) % count], vertices[i]);
+                const D2 n = {e.y / d2_len(e), -e.x / d2_len(e)};
+                normals.push_back(n);
+            }
+        }
+
+        // 到核心多边形最近的点
+        D2 closest(D2 p) const
+        {
+            D2 best = vertices[0];
+            CD_F64 best_dis = d2_len(d2_sub(p, best));
+            for (size_t i = 0; i < normals.size(); ++i)
+            {
+                const D2 a = vertices[i];
+                const D2 e = d2_sub(vertices[(i + 1) % vertices.size()], a);
+                const CD_F64 t = CD_MAX(0.0, CD_MIN(1.0, d2_dot(d2_sub(p, a), e) / d2_dot(e, e)));
+                const D2 q = d2_mul_add(a, t, e);
+                if (d2_len(d2_sub(p, q)) < best_dis)
+                {
+                    best = q;
+                    best_dis = d2_len(d2_sub(p, q));
+                }
+            }
+            return best;
+        }
+
+        // 到形状表面的有符号距离,内部为负;凸集的有符号距离是凸函数
+        CD_F64 sd(D2 p) const
+        {
+            CD_F64 inside = -1.0;
+            for (size_t i = 0; i < normals.size(); ++i)
+            {
+                const CD_F64 s = d2_dot(normals[i], d2_sub(p, vertices[i]));
+                inside = i == 0 ? s : CD_MAX(inside, s);
+            }
+            if (!normals.empty() && inside <= 0.0)
+            {
+                return inside - radius;
+            }
+            return d2_len(d2_sub(p, closest(p))) - radius;
+        }
+    };
+
+    enum Expect
+    {
+        EXPECT_MISS,
+        EXPECT_HIT,
+        EXPECT_AMBIGUOUS
+    };
+
+    // 参考解: 沿射线的有符号距离是凸函数,三分法找最小值,有负值时二分出第一个零点
+    Expect reference_cast(const Shape &shape, const CD_RAY_INPUT &input, CD_F64 *fraction)
+    {
+        const D2 o = d2(input.origin);
+        const D2 d = d2(input.translation);
+        const CD_F64 len = d2_len(d);
+        const CD_F64 start = shape.sd(o);
+        if (start < -kAmbiguous)
+        {
+            return EXPECT_MISS; // 起点在内部
+        }
+        if (start <= kAmbiguous)
+        {
+            return EXPECT_AMBIGUOUS;
+        }
+        CD_F64 lo = 0.0;
+        CD_F64 hi = input.maxFraction;
+        for (CD_S32 i = 0; i < 200; ++i)
+        {
+            const CD_F64 m1 = lo + (hi - lo) / 3.0;
+            const CD_F64 m2 = hi - (hi - lo) / 3.0;
+            if (shape.sd(d2_mul_add(o, m1, d)) < shape.sd(d2_mul_add(o, m2, d)))
+            {
+                hi = m2;
+            }
+            else
+            {
+                lo = m1;
+            }
+        }
+        const CD_F64 deepest = 0.5 * (lo + hi);
+        const CD_F64 depth = shape.sd(d2_mul_add(o, deepest, d));
+        if (depth > kAmbiguous)
+        {
+            return EXPECT_MISS;
+        }
+        if (depth >= -kAmbiguous)
+        {
+            return EXPECT_AMBIGUOUS;
+        }
+        lo = 0.0;
+        hi = deepest;
+        for (CD_S32 i = 0; i < 100; ++i)
+        {
+            const CD_F64 mid = 0.5 * (lo + hi);
+            (shape.sd(d2_mul_add(o, mid, d)) > 0.0 ? lo : hi) = mid;
+        }
+        *fraction = 0.5 * (lo + hi);
+        // 在 maxFraction 附近才进入,命中与否取决于舍入
+        if ((input.maxFraction - *fraction) * len < kAmbiguous)
+        {
+            return EXPECT_AMBIGUOUS;
+        }
+        return EXPECT_HIT;
+    }
+
+    // 检查射线结果与参考一致,返回是否为可判定的用例
+    CD_BOOL check_cast(const Shape &shape, const CD_RAY_INPUT &input, const CD_RAY_OUTPUT &out)
+    {
+        CD_F64 fraction = 0.0;
+        const Expect expect = reference_cast(shape, input, &fraction);
+        if (expect == EXPECT_AMBIGUOUS)
+        {
+            return CD_FALSE;
+        }
+        CD_TEST_CHECK(out.hit == (expect == EXPECT_HIT));
+        if (!out.hit || expect != EXPECT_HIT)
+        {
+            return CD_TRUE;
+        }
+        const D2 d = d2(input.translation);
+        const D2 point = d2(out.point);
+        CD_TEST_CHECK(out.fraction >= 0.0f && out.fraction <= input.maxFraction);
+        CD_TEST_CHECK(d2_len(d2_sub(point, d2_mul_add(d2(input.origin), out.fraction, d))) < 1e-4);
+        CD_TEST_CHECK(d2_len(d2_sub(point, d2_mul_add(d2(input.origin), fraction, d))) < kPointTol);
+        CD_TEST_CHECK_NEAR(d2_len(d2(out.normal)), 1.0, 1e-5);
+        CD_TEST_CHECK(d2_dot(d2(out.normal), d) < 0.0);
+        if (shape.radius > 0.0)
+        {
+            // 圆角: 法向沿核心上最近点指向命中点
+            const D2 c = shape.closest(point);
+            const D2 dir = d2_sub(point, c);
+            CD_TEST_CHECK_NEAR(out.normal.x, dir.x / d2_len(dir), 1e-2);
+            CD_TEST_CHECK_NEAR(out.normal.y, dir.y / d2_len(dir), 1e-2);
+        }
+        else
+        {
+            // 尖角: 法向是命中点所在的某条边的法向
+            CD_BOOL found = CD_FALSE;
+            for (size_t i = 0; i < shape.normals.size(); ++i)
+            {
+                found = found || (fabs(d2_dot(shape.normals[i], d2_sub(point, shape.vertices[i]))) < kPointTol &&
+                                  d2_len(d2_sub(d2(out.normal), shape.normals[i])) < 1e-5);
+            }
+            CD_TEST_CHECK(found);
+        }
+        return CD_TRUE;
+    }
+
+    CD_VEC2 rand_vec(CD_F32 range)
+    {
+        return cd_vec2_make_v(cd_test::rand_f(-range, range), cd_test::rand_f(-range, range));
+    }
+
+    // 随机射线: 一部分起点取在形状内部点 inner 附近,一部分为轴对齐方向,一部分大致瞄准 inner
+    CD_RAY_INPUT rand_ray(CD_VEC2 inner)
+    {
+        CD_RAY_INPUT input;
+        const CD_U32 kind = cd_test::rand_u32() % 8;
+        input.origin = kind == 0 ? cd_vec2_add_v(inner, rand_vec(0.1f)) : rand_vec(5.0f);
+        const CD_F32 length = cd_test::rand_f(1.0f, 10.0f);
+        if (kind == 1)
+        {
+            const CD_S32 axis = cd_test::rand_s(0, 3);
+            input.translation = cd_vec2_make_v(axis == 0 ? length : axis == 1 ? -length : 0.0f,
+                                               axis == 2 ? length : axis == 3 ? -length : 0.0f);
+        }
+        else if (kind < 5)
+        {
+            const CD_VEC2 target = cd_vec2_sub_v(cd_vec2_add_v(inner, rand_vec(1.5f)), input.origin);
+            input.translation = cd_vec2_scale_v(target, length / CD_MAX(cd_vec2_len_v(target), 0.1f));
+        }
+        else
+        {
+            input.translation = cd_vec2_scale_v(cd_create_unit_vec2_v(cd_test::rand_f(-3.2f, 3.2f)), length);
+        }
+        input.maxFraction = (cd_test::rand_u32() & 1) ? 1.0f : cd_test::rand_f(0.1f, 1.0f);
+        return input;
+    }
+
+    // 统计可判定用例中的命中数,确保测试不是空转
+    struct Stats
+    {
+        CD_S32 decided;
+        CD_S32 hits;
+        CD_S32 total;
+
+        Stats() : decided(0), hits(0), total(0) {}
+
+        CD_VOID add(CD_BOOL decided_case, const CD_RAY_OUTPUT &out)
+        {
+            ++total;
+            decided += decided_case;
+            hits += decided_case && out.hit;
+        }
+
+        CD_VOID check() const
+        {
+            CD_TEST_CHECK(decided > total * 9 / 10);
+            CD_TEST_CHECK(hits > decided / 10 && hits < decided * 9 / 10);
+        }
+    };
+
+    CD_VOID test_segment()
+    {
+        Stats stats;
+        for (CD_S32 iter = 0; iter < 20000; ++iter)
+        {
+            CD_SEGMENT segment;
+            segment.point1 = rand_vec(3.0f);
+            segment.point2 = rand_vec(3.0f);
+            const CD_RAY_INPUT input = rand_ray(segment.point1);
+            CD_RAY_OUTPUT out;
+            CD_TEST_CHECK(cd_ray_cast_segment(&input, &segment, &out) == CD_RET_OK);
+
+            // 参考: 双精度解 o + t d = p1 + u e
+            const D2 o = d2(input.origin), d = d2(input.translation);
+            const D2 p1 = d2(segment.point1);
+            const D2 e = d2_sub(d2(segment.point2), p1);
+            const D2 m = d2_sub(p1, o);
+            const CD_F64 denom = d.x * e.y - d.y * e.x;
+            const CD_F64 t = (m.x * e.y - m.y * e.x) / denom;
+            const CD_F64 u = (m.x * d.y - m.y * d.x) / denom;
+            const CD_F64 tol = kAmbiguous / d2_len(d);
+            const CD_F64 utol = kAmbiguous / d2_len(e);
+            const CD_BOOL decided = fabs(denom) > kAmbiguous * d2_len(d) * d2_len(e) && fabs(t) > tol &&
+                                    fabs(t - input.maxFraction) > tol && fabs(u) > utol && fabs(u - 1.0) > utol;
+            stats.add(decided, out);
+            if (!decided)
+            {
+                continue;
+            }
+            const CD_BOOL expect = t > 0.0 && t < input.maxFraction && u > 0.0 && u < 1.0;
+            CD_TEST_CHECK(out.hit == expect);
+            if (out.hit && expect)
+            {
+                CD_TEST_CHECK_NEAR(out.fraction, t, 1e-4);
+                CD_TEST_CHECK(d2_len(d2_sub(d2(out.point), d2_mul_add(o, t, d))) < kPointTol);
+                // 双面: 法向垂直于线段并朝向起点一侧
+                CD_TEST_CHECK_NEAR(d2_dot(d2(out.normal), e) / d2_len(e), 0.0, 1e-5);
+                CD_TEST_CHECK_NEAR(d2_len(d2(out.normal)), 1.0, 1e-5);
+                CD_TEST_CHECK(d2_dot(d2(out.normal), d) < 0.0);
+            }
+        }
+        stats.check();
+    }
+
+    CD_VOID test_circle()
+    {
+        Stats stats;
+        for (CD_S32 iter = 0; iter < 20000; ++iter)
+        {
+            CD_CIRCLE circle;
+            circle.center = rand_vec(2.0f);
+            circle.radius = cd_test::rand_f(0.1f, 2.0f);
+            const CD_RAY_INPUT input = rand_ray(circle.center);
+            CD_RAY_OUTPUT out;
+            CD_TEST_CHECK(cd_ray_cast_circle(&input, &circle, &out) == CD_RET_OK);
+            stats.add(check_cast(Shape(&circle.center, 1, circle.radius), input, out), out);
+        }
+        stats.check();
+    }
+
+    CD_VOID test_aabb()
+    {
+        Stats stats;
+        for (CD_S32 iter = 0; iter < 20000; ++iter)
+        {
+            CD_AABB aabb;
+            aabb.lowerBound = rand_vec(2.0f);
+            aabb.upperBound = cd_vec2_add_v(aabb.lowerBound, cd_vec2_make_v(cd_test::rand_f(0.1f, 3.0f), cd_test::rand_f(0.1f, 3.0f)));
+            const CD_VEC2 points[4] = {aabb.lowerBound, cd_vec2_make_v(aabb.upperBound.x, aabb.lowerBound.y), aabb.upperBound,
+                                       cd_vec2_make_v(aabb.lowerBound.x, aabb.upperBound.y)};
+            const CD_RAY_INPUT input = rand_ray(cd_vec2_scale_v(cd_vec2_add_v(aabb.lowerBound, aabb.upperBound), 0.5f));
+            CD_RAY_OUTPUT out;
+            CD_TEST_CHECK(cd_ray_cast_aabb(&input, &aabb, &out) == CD_RET_OK);
+            stats.add(check_cast(Shape(points, 4, 0.0f), input, out), out);
+        }
+        stats.check();
+    }
+
+    CD_VOID test_obb()
+    {
+        Stats stats;
+        for (CD_S32 iter = 0; iter < 20000; ++iter)
+        {
+            const CD_OBB obb = cd_create_obb_v(rand_vec(2.0f), cd_test::rand_f(0.1f, 4.0f), cd_test::rand_f(0.1f, 2.0f),
+                                               cd_test::rand_f(-3.2f, 3.2f));
+            CD_VEC2 points[4];
+            cd_obb_vertices_v(obb, points);
+            const CD_RAY_INPUT input = rand_ray(obb.center);
+            CD_RAY_OUTPUT out;
+            CD_TEST_CHECK(cd_ray_cast_obb(&input, &obb, &out) == CD_RET_OK);
+            stats.add(check_cast(Shape(points, 4, 0.0f), input, out), out);
+        }
+        stats.check();
+    }
+
+    // 尖角与圆角多边形,多边形接口与视图接口结果相同
+    CD_VOID test_polygon(CD_BOOL rounded)
+    {
+        Stats stats;
+        for (CD_S32 iter = 0; iter < 20000; ++iter)
+        {
+            CD_VEC2 points[MAX_POLYGON_VERTICES];
+            CD_VEC2 scratch[CD_HULL_SCRATCH_SIZE(MAX_POLYGON_VERTICES)];
+            const CD_S32 count = cd_test::rand_s(3, MAX_POLYGON_VERTICES);
+            const CD_VEC2 center = rand_vec(2.0f);
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                points[i] = cd_vec2_add_v(center, rand_vec(1.5f));
+            }
+            const CD_F32 radius = rounded ? cd_test::rand_f(0.05f, 0.5f) : 0.0f;
+            CD_POLYGON polygon;
+            if (cd_make_polygon(points, count, radius, scratch, &polygon) != CD_RET_OK)
+            {
+                continue;
+            }
+            const CD_RAY_INPUT input = rand_ray(polygon.centroid);
+            CD_RAY_OUTPUT out;
+            CD_TEST_CHECK(cd_ray_cast_polygon(&input, &polygon, &out) == CD_RET_OK);
+            const CD_POLYGON_VIEW view = cd_polygon_view_v(&polygon);
+            const CD_RAY_OUTPUT out_view = cd_ray_cast_polygon_view_v(&input, &view);
+            CD_TEST_CHECK(out_view.hit == out.hit && out_view.fraction == out.fraction);
+            stats.add(check_cast(Shape(polygon.vertices, polygon.count, polygon.radius), input, out), out);
+        }
+        stats.check();
+    }
+
+    // 起点在形状内部: 无论方向与长度都不命中
+    CD_VOID test_origin_inside()
+    {
+        for (CD_S32 iter = 0; iter < 2000; ++iter)
+        {
+            const CD_OBB obb = cd_create_obb_v(rand_vec(2.0f), cd_test::rand_f(0.5f, 4.0f), cd_test::rand_f(0.5f, 2.0f),
+                                               cd_test::rand_f(-3.2f, 3.2f));
+            CD_RAY_INPUT input;
+            input.origin = cd_vec2_add_v(obb.center, cd_rot_vector_v(obb.q, cd_vec2_make_v(cd_test::rand_f(-0.2f, 0.2f) * obb.length,
+                                                                                          cd_test::rand_f(-0.2f, 0.2f) * obb.width)));
+            input.translation = cd_vec2_scale_v(cd_create_unit_vec2_v(cd_test::rand_f(-3.2f, 3.2f)), cd_test::rand_f(1.0f, 20.0f));
+            input.maxFraction = 1.0f;
+            CD_TEST_CHECK(!cd_ray_cast_obb_v(&input, obb).hit);
+
+            CD_CIRCLE circle;
+            circle.center = obb.center;
+            circle.radius = 0.5f * (obb.length + obb.width);
+            CD_TEST_CHECK(!cd_ray_cast_circle_v(&input, circle).hit);
+
+            CD_VEC2 points[4];
+            cd_obb_vertices_v(obb, points);
+            CD_POLYGON polygon;
+            CD_VEC2 scratch[CD_HULL_SCRATCH_SIZE(4)];
+            CD_TEST_CHECK(cd_make_polygon(points, 4, 0.0f, scratch, &polygon) == CD_RET_OK);
+            CD_TEST_CHECK(!cd_ray_cast_polygon_v(&input, &polygon).hit);
+            polygon.radius = 0.3f;
+            CD_TEST_CHECK(!cd_ray_cast_polygon_v(&input, &polygon).hit);
+        }
+    }
+
+    // 动态树上的障碍物场景
+    struct Scene
+    {
+        std::vector<CD_OBB> obstacles;
+        std::vector<CD_TREE_NODE> nodes;
+        CD_DYNAMIC_TREE tree;
+
+        explicit Scene(CD_S32 count) : obstacles(count), nodes(2 * count + 1)
+        {
+            CD_TEST_CHECK(cd_dynamic_tree_init(&tree, nodes.data(), (CD_S32)nodes.size()) == CD_RET_OK);
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                obstacles[i] = cd_create_obb_v(cd_vec2_make_v(cd_test::rand_f(0.0f, 40.0f), cd_test::rand_f(0.0f, 40.0f)),
+                                               cd_test::rand_f(0.5f, 3.0f), cd_test::rand_f(0.3f, 2.0f), cd_test::rand_f(-3.2f, 3.2f));
+                const CD_AABB aabb = cd_obb_to_aabb_v(obstacles[i]);
+                CD_S32 proxy = CD_TREE_NULL_NODE;
+                CD_TEST_CHECK(cd_dynamic_tree_create_proxy(&tree, &aabb, i, &proxy) == CD_RET_OK);
+            }
+        }
+
+        // 暴力: 逐个障碍物取最近命中
+        CD_RAY_OUTPUT brute_force(const CD_RAY_INPUT &input) const
+        {
+            CD_RAY_OUTPUT best = cd_ray_no_hit_v();
+            for (size_t i = 0; i < obstacles.size(); ++i)
+            {
+                const CD_RAY_OUTPUT out = cd_ray_cast_obb_v(&input, obstacles[i]);
+                if (out.hit && (!best.hit || out.fraction < best.fraction))
+                {
+                    best = out;
+                }
+            }
+            return best;
+        }
+    };
+
+    CD_RAY_INPUT rand_scene_ray(const Scene &scene)
+    {
+        CD_RAY_INPUT input;
+        const CD_U32 kind = cd_test::rand_u32() % 6;
+        input.origin = kind == 0 ? scene.obstacles[cd_test::rand_s(0, (CD_S32)scene.obstacles.size() - 1)].center
+                                 : cd_vec2_make_v(cd_test::rand_f(-5.0f, 45.0f), cd_test::rand_f(-5.0f, 45.0f));
+        const CD_F32 length = cd_test::rand_f(2.0f, 30.0f);
+        input.translation = kind == 1 ? cd_vec2_make_v(0.0f, (cd_test::rand_u32() & 1) ? length : -length)
+                                      : cd_vec2_scale_v(cd_create_unit_vec2_v(cd_test::rand_f(-3.2f, 3.2f)), length);
+        input.maxFraction = 1.0f;
+        return input;
+    }
+
+    CD_F32 collect_all(const CD_RAY_INPUT *input, CD_S32 proxyId, CD_S32 userData, CD_VOID *context)
+    {
+        std::set<CD_S32> *visited = (std::set<CD_S32> *)context;
+        (CD_VOID) input;
+        (CD_VOID) proxyId;
+        CD_TEST_CHECK(visited->insert(userData).second);
+        return -1.0f;
+    }
+
+    CD_F32 stop_at_first(const CD_RAY_INPUT *input, CD_S32 proxyId, CD_S32 userData, CD_VOID *context)
+    {
+        (CD_VOID) input;
+        (CD_VOID) proxyId;
+        (CD_VOID) userData;
+        ++*(CD_S32 *)context;
+        return 0.0f;
+    }
+
+    // 树上的最近命中与暴力枚举比例完全相同;命中的障碍物可能因并列而不同,但其比例相同
+    CD_VOID check_same_hit(const Scene &scene, const CD_RAY_INPUT &input, const CD_RAY_OUTPUT &expected,
+                           const CD_RAY_OUTPUT &out, CD_S32 id)
+    {
+        CD_TEST_CHECK(out.hit == expected.hit);
+        if (!out.hit || !expected.hit)
+        {
+            CD_TEST_CHECK(id == CD_TREE_NULL_NODE);
+            return;
+        }
+        CD_TEST_CHECK(out.fraction == expected.fraction);
+        CD_TEST_CHECK(id >= 0 && id < (CD_S32)scene.obstacles.size());
+        if (id >= 0 && id < (CD_S32)scene.obstacles.size())
+        {
+            const CD_RAY_OUTPUT again = cd_ray_cast_obb_v(&input, scene.obstacles[id]);
+            CD_TEST_CHECK(again.hit && again.fraction == out.fraction && again.normal.x == out.normal.x &&
+                          again.normal.y == out.normal.y);
+        }
+    }
+
+    CD_VOID test_tree_ray_cast()
+    {
+        Scene scene(300);
+        const CD_S32 count = 2000;
+        std::vector<CD_RAY_INPUT> rays(count);
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            rays[i] = rand_scene_ray(scene);
+        }
+        std::vector<CD_RAY_OUTPUT> outputs(count);
+        std::vector<CD_S32> ids(count);
+        CD_TEST_CHECK(cd_dynamic_tree_ray_cast_obbs(&scene.tree, scene.obstacles.data(), rays.data(), count, outputs.data(),
+                                                    ids.data()) == CD_RET_OK);
+        CD_S32 hits = 0;
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            const CD_RAY_OUTPUT expected = scene.brute_force(rays[i]);
+            check_same_hit(scene, rays[i], expected, outputs[i], ids[i]);
+            hits += expected.hit;
+
+            // 只做裁剪不命中时,遍历到的叶子必须包含所有能命中的障碍物
+            std::set<CD_S32> visited;
+            CD_TEST_CHECK(cd_dynamic_tree_ray_cast(&scene.tree, &rays[i], collect_all, &visited) == CD_RET_OK);
+            for (CD_S32 k = 0; k < (CD_S32)scene.obstacles.size(); ++k)
+            {
+                if (cd_ray_cast_obb_v(&rays[i], scene.obstacles[k]).hit)
+                {
+                    CD_TEST_CHECK(visited.count(k) == 1);
+                }
+            }
+
+            // 回调返回0立即终止
+            CD_S32 calls = 0;
+            CD_TEST_CHECK(cd_dynamic_tree_ray_cast(&scene.tree, &rays[i], stop_at_first, &calls) == CD_RET_OK);
+            CD_TEST_CHECK(calls == (visited.empty() ? 0 : 1));
+        }
+        CD_TEST_CHECK(hits > count / 4 && hits < count * 3 / 4);
+
+        // 不要命中下标
+        std::vector<CD_RAY_OUTPUT> no_ids(count);
+        CD_TEST_CHECK(cd_dynamic_tree_ray_cast_obbs(&scene.tree, scene.obstacles.data(), rays.data(), count, no_ids.data(),
+                                                    CD_NULL) == CD_RET_OK);
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            CD_TEST_CHECK(no_ids[i].hit == outputs[i].hit && no_ids[i].fraction == outputs[i].fraction);
+        }
+        CD_TEST_CHECK(cd_dynamic_tree_ray_cast_obbs(CD_NULL, scene.obstacles.data(), rays.data(), count, outputs.data(),
+                                                    CD_NULL) == COLLISION_DETECTION_E_PARAM_NULL);
+    }
+
+    // 射线包与逐条射线结果相同: 扇形的相干射线与方向随机的不相干射线,数量不是包大小的整数倍
+    CD_VOID test_tree_ray_packet()
+    {
+        Scene scene(300);
+        for (CD_S32 iter = 0; iter < 200; ++iter)
+        {
+            const CD_VEC2 origin = iter % 5 == 0 ? scene.obstacles[cd_test::rand_s(0, 299)].center
+                                                 : cd_vec2_make_v(cd_test::rand_f(-5.0f, 45.0f), cd_test::rand_f(-5.0f, 45.0f));
+            const CD_S32 count = cd_test::rand_s(0, 6 * CD_RAY_PACKET_SIZE + 5);
+            const CD_BOOL coherent = iter % 2 == 0;
+            const CD_F32 start = cd_test::rand_f(-3.2f, 3.2f);
+            std::vector<CD_F32> dxs(count + 1), dys(count + 1);
+            std::vector<CD_RAY_INPUT> rays(count + 1);
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                const CD_F32 angle = coherent ? start + 0.01f * i : cd_test::rand_f(-3.2f, 3.2f);
+                const CD_F32 length = coherent ? 25.0f : cd_test::rand_f(2.0f, 30.0f);
+                dxs[i] = i % 17 == 3 ? 0.0f : length * cosf(angle);
+                dys[i] = length * sinf(angle);
+                rays[i].origin = origin;
+                rays[i].translation = cd_vec2_make_v(dxs[i], dys[i]);
+                rays[i].maxFraction = 1.0f;
+            }
+            std::vector<CD_RAY_OUTPUT> single(count + 1), packet(count + 1);
+            std::vector<CD_S32> single_ids(count + 1), packet_ids(count + 1, 12345);
+            CD_TEST_CHECK(cd_dynamic_tree_ray_cast_obbs(&scene.tree, scene.obstacles.data(), rays.data(), count, single.data(),
+                                                        single_ids.data()) == CD_RET_OK);
+            CD_TEST_CHECK(cd_dynamic_tree_ray_cast_obbs_packet(&scene.tree, scene.obstacles.data(), &origin, dxs.data(),
+                                                               dys.data(), count, packet.data(),
+                                                               packet_ids.data()) == CD_RET_OK);
+            for (CD_S32 i = 0; i < count; ++i)
+            {
+                check_same_hit(scene, rays[i], single[i], packet[i], packet_ids[i]);
+            }
+            CD_TEST_CHECK(packet_ids[count] == 12345); // 不越界写
+        }
+
+        // 空树: 全部不命中
+        std::vector<CD_TREE_NODE> nodes(4);
+        CD_DYNAMIC_TREE empty;
+        CD_TEST_CHECK(cd_dynamic_tree_init(&empty, nodes.data(), 4) == CD_RET_OK);
+        const CD_VEC2 origin = Vec2_Zero;
+        const CD_F32 dxs[20] = {1.0f};
+        const CD_F32 dys[20] = {0.0f};
+        CD_RAY_OUTPUT outputs[20];
+        CD_S32 ids[20];
+        CD_TEST_CHECK(cd_dynamic_tree_ray_cast_obbs_packet(&empty, scene.obstacles.data(), &origin, dxs, dys, 20, outputs,
+                                                           ids) == CD_RET_OK);
+        for (CD_S32 i = 0; i < 20; ++i)
+        {
+            CD_TEST_CHECK(!outputs[i].hit && ids[i] == CD_TREE_NULL_NODE);
+        }
+        CD_TEST_CHECK(cd_dynamic_tree_ray_cast_obbs_packet(&scene.tree, scene.obstacles.data(), CD_NULL, dxs, dys, 20, outputs,
+                                                           ids) == COLLISION_DETECTION_E_PARAM_NULL);
+    }
+} // namespace
+
+int main()
+{
+    test_segment();
+    test_circle();
+    test_aabb();
+    test_obb();
+    test_polygon(CD_FALSE);
+    test_polygon(CD_TRUE);
+    test_origin_inside();
+    test_tree_ray_cast();
+    test_tree_ray_packet();
+    return cd_test::report("test_raycast");
+}
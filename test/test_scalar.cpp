@@ -0,0 +1,336 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 10:05:32
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 17:21:48
+ */
+
+// 按精度实例化的基础几何: 双精度实例在公里级坐标上与局部坐标下的暴力结果一致(单精度在此处会出错),
+// 线段相交与整数精确结果一致,单/双精度实例在远离边界时结论相同,CD_REAL 按 CD_SCALAR_DOUBLE 选择实例
+
+#include "cd_test.h"
+
+#include <math.h>
+
+namespace
+{
+    const CD_S32 kCases = 20000;
+    // 地图坐标量级的平移,单精度在此处的间距为 0.25~0.5 米
+    const CD_F64 kMapX = 3500000.125;
+    const CD_F64 kMapY = 4500000.375;
+
+    CD_VEC2 rand_vec(CD_F32 range)
+    {
+        return cd_vec2_make_v(cd_test::rand_f(-range, range), cd_test::rand_f(-range, range));
+    }
+
+    CD_OBB rand_obb()
+    {
+        return cd_create_obb_v(rand_vec(20.0f), cd_test::rand_f(0.1f, 8.0f), cd_test::rand_f(0.1f, 4.0f),
+                               cd_test::rand_f(-4.0f, 4.0f));
+    }
+
+    CD_OBB_D to_map(CD_OBB_D obb)
+    {
+        obb.center = cd_vec2_add_d_v(obb.center, cd_vec2_make_d_v(kMapX, kMapY));
+        return obb;
+    }
+
+    CD_VOID obb_vertices(CD_OBB_D obb, CD_VEC2_D *v)
+    {
+        const CD_VEC2_D l = cd_vec2_scale_d_v(cd_vec2_make_d_v(obb.q.c, obb.q.s), obb.length * 0.5);
+        const CD_VEC2_D w = cd_vec2_scale_d_v(cd_vec2_make_d_v(-obb.q.s, obb.q.c), obb.width * 0.5);
+        v[0] = cd_vec2_sub_d_v(cd_vec2_sub_d_v(obb.center, l), w);
+        v[1] = cd_vec2_sub_d_v(cd_vec2_add_d_v(obb.center, l), w);
+        v[2] = cd_vec2_add_d_v(cd_vec2_add_d_v(obb.center, l), w);
+        v[3] = cd_vec2_add_d_v(cd_vec2_sub_d_v(obb.center, l), w);
+    }
+
+    // 暴力: 把两个obb的8个顶点投影到4条边法向上,返回最小重叠量,负值表示分离
+    CD_F64 brute_force_margin(CD_OBB_D a, CD_OBB_D b)
+    {
+        CD_VEC2_D va[4], vb[4];
+        obb_vertices(a, va);
+        obb_vertices(b, vb);
+        const CD_VEC2_D axes[4] = {{a.q.c, a.q.s}, {-a.q.s, a.q.c}, {b.q.c, b.q.s}, {-b.q.s, b.q.c}};
+        CD_F64 best = 1e30;
+        for (CD_S32 k = 0; k < 4; ++k)
+        {
+            CD_F64 min_a = 1e30, max_a = -1e30, min_b = 1e30, max_b = -1e30;
+            for (CD_S32 i = 0; i < 4; ++i)
+            {
+                const CD_F64 pa = cd_vec2_dot_d_v(axes[k], va[i]);
+                const CD_F64 pb = cd_vec2_dot_d_v(axes[k], vb[i]);
+                min_a = CD_MIN(min_a, pa);
+                max_a = CD_MAX(max_a, pa);
+                min_b = CD_MIN(min_b, pb);
+                max_b = CD_MAX(max_b, pb);
+            }
+            best = CD_MIN(best, CD_MIN(max_a - min_b, max_b - min_a));
+        }
+        return best;
+    }
+
+    // 在局部坐标下构造接近接触的一对obb,再整体平移到地图坐标
+    CD_VOID test_obb_map()
+    {
+        CD_S32 decided = 0;
+        CD_S32 float_wrong = 0;
+        for (CD_S32 i = 0; i < kCases; ++i)
+        {
+            const CD_OBB_D a = cd_obb_to_d_v(rand_obb());
+            CD_OBB_D b = cd_obb_to_d_v(rand_obb());
+            // 沿中心连线把b推到与a刚好接触附近
+            const CD_VEC2_D dir = cd_vec2_sub_d_v(b.center, a.center);
+            const CD_F64 len = cd_vec2_len_d_v(dir);
+            if (len < 1e-3)
+            {
+                continue;
+            }
+            const CD_VEC2_D unit = cd_vec2_scale_d_v(dir, 1.0 / len);
+            CD_F64 lo = 0.0, hi = 40.0;
+            for (CD_S32 k = 0; k < 60; ++k)
+            {
+                const CD_F64 mid = 0.5 * (lo + hi);
+                CD_OBB_D t = b;
+                t.center = cd_vec2_mul_add_d_v(a.center, mid, unit);
+                (brute_force_margin(a, t) > 0.0 ? lo : hi) = mid;
+            }
+            b.center = cd_vec2_mul_add_d_v(a.center, lo + cd_test::rand_f(-0.3f, 0.3f), unit);
+
+            const CD_F64 margin = brute_force_margin(a, b);
+            if (fabs(margin) < 1e-6)
+            {
+                continue;
+            }
+            ++decided;
+            const CD_OBB_D ma = to_map(a);
+            const CD_OBB_D mb = to_map(b);
+            CD_TEST_CHECK(cd_obb_overlap_d_v(ma, mb) == (margin > 0.0));
+            CD_TEST_CHECK(cd_obb_overlap_d_v(a, b) == (margin > 0.0));
+            if (cd_obb_overlap_v(cd_obb_to_f_v(ma), cd_obb_to_f_v(mb)) != (margin > 0.0))
+            {
+                ++float_wrong;
+            }
+
+            // 点在obb内: 中心与角点外侧
+            CD_VEC2_D v[4];
+            obb_vertices(ma, v);
+            CD_TEST_CHECK(cd_is_point_in_obb_d_v(ma, ma.center));
+            const CD_VEC2_D out = cd_vec2_add_d_v(v[2], cd_vec2_scale_d_v(cd_vec2_sub_d_v(v[2], ma.center), 1e-6));
+            CD_TEST_CHECK(!cd_is_point_in_obb_d_v(ma, out));
+            const CD_VEC2_D in = cd_vec2_sub_d_v(v[2], cd_vec2_scale_d_v(cd_vec2_sub_d_v(v[2], ma.center), 1e-6));
+            CD_TEST_CHECK(cd_is_point_in_obb_d_v(ma, in));
+
+            // 外接aabb包含四个顶点且紧贴
+            const CD_AABB_D box = cd_obb_to_aabb_d_v(ma);
+            CD_F64 min_x = 1e30, max_x = -1e30, min_y = 1e30, max_y = -1e30;
+            for (CD_S32 k = 0; k < 4; ++k)
+            {
+                CD_TEST_CHECK(cd_is_point_in_aabb_d_v(box, v[k]) || fabs(v[k].x - box.lowerBound.x) < 1e-8 ||
+                              fabs(v[k].x - box.upperBound.x) < 1e-8 || fabs(v[k].y - box.lowerBound.y) < 1e-8 ||
+                              fabs(v[k].y - box.upperBound.y) < 1e-8);
+                min_x = CD_MIN(min_x, v[k].x);
+                max_x = CD_MAX(max_x, v[k].x);
+                min_y = CD_MIN(min_y, v[k].y);
+                max_y = CD_MAX(max_y, v[k].y);
+            }
+            CD_TEST_CHECK_NEAR(box.lowerBound.x, min_x, 1e-8);
+            CD_TEST_CHECK_NEAR(box.upperBound.x, max_x, 1e-8);
+            CD_TEST_CHECK_NEAR(box.lowerBound.y, min_y, 1e-8);
+            CD_TEST_CHECK_NEAR(box.upperBound.y, max_y, 1e-8);
+        }
+        CD_TEST_CHECK(decided > kCases * 9 / 10);
+        // 单精度在同一组输入上明显出错,说明这些用例确实需要双精度
+        CD_TEST_CHECK(float_wrong > decided / 20);
+    }
+
+    // 精确参照: 整数坐标上的方向判定
+    CD_S32 orient(CD_S32 ax, CD_S32 ay, CD_S32 bx, CD_S32 by, CD_S32 cx, CD_S32 cy)
+    {
+        const CD_S32 v = (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+        return (v > 0) - (v < 0);
+    }
+
+    CD_BOOL on_segment(CD_S32 ax, CD_S32 ay, CD_S32 bx, CD_S32 by, CD_S32 px, CD_S32 py)
+    {
+        return orient(ax, ay, bx, by, px, py) == 0 && CD_MIN(ax, bx) <= px && px <= CD_MAX(ax, bx) &&
+               CD_MIN(ay, by) <= py && py <= CD_MAX(ay, by);
+    }
+
+    CD_BOOL reference_intersect(const CD_S32 *c)
+    {
+        const CD_S32 o1 = orient(c[0], c[1], c[2], c[3], c[4], c[5]);
+        const CD_S32 o2 = orient(c[0], c[1], c[2], c[3], c[6], c[7]);
+        const CD_S32 o3 = orient(c[4], c[5], c[6], c[7], c[0], c[1]);
+        const CD_S32 o4 = orient(c[4], c[5], c[6], c[7], c[2], c[3]);
+        if (o1 * o2 < 0 && o3 * o4 < 0)
+        {
+            return CD_TRUE;
+        }
+        return on_segment(c[0], c[1], c[2], c[3], c[4], c[5]) || on_segment(c[0], c[1], c[2], c[3], c[6], c[7]) ||
+               on_segment(c[4], c[5], c[6], c[7], c[0], c[1]) || on_segment(c[4], c[5], c[6], c[7], c[2], c[3]);
+    }
+
+    CD_VOID test_segment_map()
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 i = 0; i < 100000; ++i)
+        {
+            CD_S32 c[8];
+            for (CD_S32 k = 0; k < 8; ++k)
+            {
+                c[k] = cd_test::rand_s(0, 4);
+            }
+            // 整数加地图平移在双精度下精确
+            CD_SEGMENT_D s1, s2;
+            s1.point1 = cd_vec2_make_d_v(kMapX + c[0], kMapY + c[1]);
+            s1.point2 = cd_vec2_make_d_v(kMapX + c[2], kMapY + c[3]);
+            s2.point1 = cd_vec2_make_d_v(kMapX + c[4], kMapY + c[5]);
+            s2.point2 = cd_vec2_make_d_v(kMapX + c[6], kMapY + c[7]);
+            CD_VEC2_D p = cd_vec2_make_d_v(0.0, 0.0);
+            const CD_BOOL hit = cd_segments_intersect_core_d(s1.point1.x, s1.point1.y, s1.point2.x, s1.point2.y,
+                                                             s2.point1.x, s2.point1.y, s2.point2.x, s2.point2.y, &p);
+            CD_TEST_CHECK(hit == reference_intersect(c));
+            if (hit)
+            {
+                ++hits;
+                // 交点在两条线段上
+                CD_TEST_CHECK(cd_vec2_dis_d_v(cd_segment_nearest_point_d_v(s1, p), p) < 1e-6);
+                CD_TEST_CHECK(cd_vec2_dis_d_v(cd_segment_nearest_point_d_v(s2, p), p) < 1e-6);
+            }
+        }
+        CD_TEST_CHECK(hits > 10000);
+    }
+
+    // 最近点: 与投影的闭式解一致,且不比两个端点更远
+    CD_VOID test_nearest_map()
+    {
+        for (CD_S32 i = 0; i < kCases; ++i)
+        {
+            CD_SEGMENT_D seg;
+            seg.point1 = cd_vec2_make_d_v(kMapX + cd_test::rand_f(-50.0f, 50.0f), kMapY + cd_test::rand_f(-50.0f, 50.0f));
+            seg.point2 = (cd_test::rand_u32() % 16 == 0)
+                             ? seg.point1
+                             : cd_vec2_make_d_v(kMapX + cd_test::rand_f(-50.0f, 50.0f), kMapY + cd_test::rand_f(-50.0f, 50.0f));
+            const CD_VEC2_D p = cd_vec2_make_d_v(kMapX + cd_test::rand_f(-60.0f, 60.0f), kMapY + cd_test::rand_f(-60.0f, 60.0f));
+            const CD_VEC2_D n = cd_segment_nearest_point_d_v(seg, p);
+
+            // 在局部坐标下求投影
+            const CD_F64 dx = seg.point2.x - seg.point1.x, dy = seg.point2.y - seg.point1.y;
+            const CD_F64 px = p.x - seg.point1.x, py = p.y - seg.point1.y;
+            const CD_F64 len_sqr = dx * dx + dy * dy;
+            const CD_F64 t = len_sqr > 0.0 ? CD_CLIP((px * dx + py * dy) / len_sqr, 0.0, 1.0) : 0.0;
+            CD_TEST_CHECK_NEAR(n.x - seg.point1.x, t * dx, 1e-8);
+            CD_TEST_CHECK_NEAR(n.y - seg.point1.y, t * dy, 1e-8);
+            const CD_F64 d = cd_vec2_dis_d_v(p, n);
+            CD_TEST_CHECK(d <= cd_vec2_dis_d_v(p, seg.point1) + 1e-9);
+            CD_TEST_CHECK(d <= cd_vec2_dis_d_v(p, seg.point2) + 1e-9);
+
+            // 圆: 最近点所在的圆
+            CD_CIRCLE_D circle;
+            circle.center = p;
+            circle.radius = d + 1e-6;
+            CD_TEST_CHECK(cd_point_in_circle_d_v(n, circle));
+            circle.radius = d - 1e-6;
+            CD_TEST_CHECK(d < 1e-6 || !cd_point_in_circle_d_v(n, circle));
+        }
+    }
+
+    // 变换与逆变换在地图坐标下互逆
+    CD_VOID test_transform_map()
+    {
+        for (CD_S32 i = 0; i < kCases; ++i)
+        {
+            CD_TRANSFORM_D t;
+            t.p = cd_vec2_make_d_v(kMapX + cd_test::rand_f(-1000.0f, 1000.0f), kMapY + cd_test::rand_f(-1000.0f, 1000.0f));
+            t.q = cd_rot_from_angle_d_v(cd_test::rand_f(-4.0f, 4.0f));
+            const CD_VEC2_D local = cd_vec2_make_d_v(cd_test::rand_f(-100.0f, 100.0f), cd_test::rand_f(-100.0f, 100.0f));
+            const CD_VEC2_D world = cd_transforms_point_d_v(t, local);
+            const CD_VEC2_D back = cd_inv_transforms_point_d_v(t, world);
+            CD_TEST_CHECK_NEAR(back.x, local.x, 1e-8);
+            CD_TEST_CHECK_NEAR(back.y, local.y, 1e-8);
+            CD_TEST_CHECK_NEAR(cd_vec2_dis_d_v(world, t.p), cd_vec2_len_d_v(local), 1e-8);
+            const CD_VEC2_D r = cd_rot_vector_d_v(t.q, local);
+            CD_TEST_CHECK_NEAR(cd_vec2_cross_d_v(local, r), cd_vec2_len_sqr_d_v(local) * t.q.s, 1e-7);
+            CD_TEST_CHECK_NEAR(cd_inv_rot_vector_d_v(t.q, r).x, local.x, 1e-10);
+        }
+    }
+
+    // 两个实例出自同一份实现: 在单精度输入上,除接近边界的情况外结论相同
+    CD_VOID test_float_double_agree()
+    {
+        CD_S32 decided = 0;
+        for (CD_S32 i = 0; i < kCases; ++i)
+        {
+            const CD_OBB a = rand_obb();
+            const CD_OBB b = rand_obb();
+            const CD_F64 margin = brute_force_margin(cd_obb_to_d_v(a), cd_obb_to_d_v(b));
+            if (fabs(margin) > 1e-4)
+            {
+                ++decided;
+                CD_TEST_CHECK(cd_obb_overlap_v(a, b) == cd_obb_overlap_d_v(cd_obb_to_d_v(a), cd_obb_to_d_v(b)));
+            }
+
+            // aabb 的比较与取大小在两种精度下都是精确的
+            const CD_AABB fa = cd_obb_to_aabb_v(a);
+            const CD_AABB fb = cd_obb_to_aabb_v(b);
+            const CD_AABB_D da = cd_aabb_to_d_v(fa);
+            const CD_AABB_D db = cd_aabb_to_d_v(fb);
+            CD_TEST_CHECK(cd_aabb_overlap_v(fa, fb) == cd_aabb_overlap_d_v(da, db));
+            const CD_AABB u = cd_aabb_union_v(fa, fb);
+            const CD_AABB u2 = cd_aabb_to_f_v(cd_aabb_union_d_v(da, db));
+            CD_TEST_CHECK(u.lowerBound.x == u2.lowerBound.x && u.lowerBound.y == u2.lowerBound.y &&
+                          u.upperBound.x == u2.upperBound.x && u.upperBound.y == u2.upperBound.y);
+            const CD_VEC2 p = rand_vec(25.0f);
+            CD_TEST_CHECK(cd_is_point_in_aabb_v(fa, p) == cd_is_point_in_aabb_d_v(da, cd_vec2_to_d_v(p)));
+
+            const CD_AABB_D box = cd_obb_to_aabb_d_v(cd_obb_to_d_v(a));
+            CD_TEST_CHECK_NEAR(box.lowerBound.x, fa.lowerBound.x, 1e-4);
+            CD_TEST_CHECK_NEAR(box.upperBound.y, fa.upperBound.y, 1e-4);
+
+            CD_SEGMENT seg;
+            seg.point1 = rand_vec(10.0f);
+            seg.point2 = rand_vec(10.0f);
+            const CD_VEC2 n = cd_segment_nearest_point_v(seg, p);
+            const CD_VEC2_D nd = cd_segment_nearest_point_d_v(cd_segment_to_d_v(seg), cd_vec2_to_d_v(p));
+            CD_TEST_CHECK_NEAR(n.x, nd.x, 1e-4);
+            CD_TEST_CHECK_NEAR(n.y, nd.y, 1e-4);
+            const CD_SEGMENT back = cd_segment_to_f_v(cd_segment_to_d_v(seg));
+            CD_TEST_CHECK(back.point1.x == seg.point1.x && back.point2.y == seg.point2.y);
+        }
+        CD_TEST_CHECK(decided > kCases * 9 / 10);
+    }
+
+    // CD_REAL 与 CD_*_R / CD_REAL_FN 选中同一个实例
+    CD_VOID test_real()
+    {
+#ifdef CD_SCALAR_DOUBLE
+        CD_TEST_CHECK(sizeof(CD_REAL) == sizeof(CD_F64));
+        CD_TEST_CHECK(CD_REAL_EPS == CD_EPS_D);
+#else
+        CD_TEST_CHECK(sizeof(CD_REAL) == sizeof(CD_F32));
+        CD_TEST_CHECK(CD_REAL_EPS == CD_EPS);
+#endif
+        CD_TEST_CHECK(sizeof(CD_VEC2_R) == 2 * sizeof(CD_REAL));
+        CD_TEST_CHECK(sizeof(CD_OBB_R) == 6 * sizeof(CD_REAL));
+        const CD_OBB_R a = CD_REAL_FN(cd_create_obb)(CD_REAL_FN(cd_vec2_make)(0, 0), 2, 2, 0);
+        const CD_OBB_R b = CD_REAL_FN(cd_create_obb)(CD_REAL_FN(cd_vec2_make)(1.5, 0.5), 2, 2, CD_PI / 4);
+        const CD_OBB_R c = CD_REAL_FN(cd_create_obb)(CD_REAL_FN(cd_vec2_make)(3, 0), 2, 2, 0);
+        CD_TEST_CHECK(CD_REAL_FN(cd_obb_overlap)(a, b));
+        CD_TEST_CHECK(!CD_REAL_FN(cd_obb_overlap)(a, c));
+        const CD_AABB_R box = CD_REAL_FN(cd_obb_to_aabb)(b);
+        CD_TEST_CHECK_NEAR(box.upperBound.x - box.lowerBound.x, 2.0 * sqrt(2.0), 1e-5);
+    }
+} // namespace
+
+int main()
+{
+    test_obb_map();
+    test_segment_map();
+    test_nearest_map();
+    test_transform_map();
+    test_float_double_agree();
+    test_real();
+    return cd_test::report("test_scalar");
+}
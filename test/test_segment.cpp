@@ -0,0 +1,314 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 16:36:48
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 16:36:48
+ */
+
+// 线段相交: 整数网格上的线段(端点接触、共线重叠、退化为点)与精确整数参考完全一致,
+// 随机浮点线段与双精度参数解一致;折线与SoA批量接口与逐段调用一致
+
+#include "cd_test.h"
+
+#include <math.h>
+#include <vector>
+
+namespace
+{
+    struct IPoint
+    {
+        CD_S64 x, y;
+    };
+
+    CD_S64 cross(IPoint o, IPoint a, IPoint b)
+    {
+        return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+    }
+
+    // 共线时点p是否在线段ab上(含端点)
+    CD_BOOL on_collinear(IPoint a, IPoint b, IPoint p)
+    {
+        return CD_MIN(a.x, b.x) <= p.x && p.x <= CD_MAX(a.x, b.x) && CD_MIN(a.y, b.y) <= p.y && p.y <= CD_MAX(a.y, b.y);
+    }
+
+    // 精确参考: 不平行时解 p1 + t e1 = p3 + u e2,用分子与分母比较 t, u ∈ [0, 1];
+    // 平行时只有共线才可能相交,退化为一维区间是否重叠
+    CD_BOOL reference_intersect(IPoint p1, IPoint p2, IPoint p3, IPoint p4)
+    {
+        const IPoint e1 = {p2.x - p1.x, p2.y - p1.y};
+        const IPoint e2 = {p4.x - p3.x, p4.y - p3.y};
+        const CD_S64 den = e1.x * e2.y - e1.y * e2.x;
+        const IPoint m = {p3.x - p1.x, p3.y - p1.y};
+        if (den != 0)
+        {
+            CD_S64 tn = m.x * e2.y - m.y * e2.x;
+            CD_S64 un = m.x * e1.y - m.y * e1.x;
+            const CD_S64 d = den < 0 ? -den : den;
+            if (den < 0)
+            {
+                tn = -tn;
+                un = -un;
+            }
+            return tn >= 0 && tn <= d && un >= 0 && un <= d;
+        }
+        const CD_BOOL point1 = e1.x == 0 && e1.y == 0;
+        const CD_BOOL point2 = e2.x == 0 && e2.y == 0;
+        if (point1 && point2)
+        {
+            return p1.x == p3.x && p1.y == p3.y;
+        }
+        if (point1)
+        {
+            return cross(p3, p4, p1) == 0 && on_collinear(p3, p4, p1);
+        }
+        if (point2)
+        {
+            return cross(p1, p2, p3) == 0 && on_collinear(p1, p2, p3);
+        }
+        if (cross(p1, p2, p3) != 0)
+        {
+            return CD_FALSE; // 平行不共线
+        }
+        // 共线: 投影到 e1 上比较区间
+        const CD_S64 a0 = 0;
+        const CD_S64 a1 = e1.x * e1.x + e1.y * e1.y;
+        const CD_S64 b0 = m.x * e1.x + m.y * e1.y;
+        const CD_S64 b1 = (p4.x - p1.x) * e1.x + (p4.y - p1.y) * e1.y;
+        return CD_MAX(a0, CD_MIN(b0, b1)) <= CD_MIN(a1, CD_MAX(b0, b1));
+    }
+
+    CD_F64 point_segment_distance(CD_VEC2 p, CD_F64 x1, CD_F64 y1, CD_F64 x2, CD_F64 y2)
+    {
+        const CD_F64 ex = x2 - x1, ey = y2 - y1;
+        const CD_F64 len2 = ex * ex + ey * ey;
+        const CD_F64 t = len2 > 0.0 ? CD_MAX(0.0, CD_MIN(1.0, ((p.x - x1) * ex + (p.y - y1) * ey) / len2)) : 0.0;
+        return hypot(p.x - (x1 + t * ex), p.y - (y1 + t * ey));
+    }
+
+    CD_SEGMENT make_segment(CD_F32 x1, CD_F32 y1, CD_F32 x2, CD_F32 y2)
+    {
+        CD_SEGMENT s;
+        s.point1 = cd_vec2_make_v(x1, y1);
+        s.point2 = cd_vec2_make_v(x2, y2);
+        return s;
+    }
+
+    CD_BOOL intersect(const CD_SEGMENT &a, const CD_SEGMENT &b, CD_VEC2 *point)
+    {
+        return cd_segments_intersect_core(a.point1.x, a.point1.y, a.point2.x, a.point2.y, b.point1.x, b.point1.y, b.point2.x,
+                                          b.point2.y, point);
+    }
+
+    // 小整数网格: 端点接触、共线、退化线段都很常见,且浮点叉积是精确的
+    CD_VOID test_grid()
+    {
+        CD_S32 hits = 0;
+        for (CD_S32 iter = 0; iter < 200000; ++iter)
+        {
+            IPoint p[4];
+            for (CD_S32 k = 0; k < 4; ++k)
+            {
+                p[k].x = cd_test::rand_s(0, 4);
+                p[k].y = cd_test::rand_s(0, 4);
+            }
+            const CD_SEGMENT a = make_segment((CD_F32)p[0].x, (CD_F32)p[0].y, (CD_F32)p[1].x, (CD_F32)p[1].y);
+            const CD_SEGMENT b = make_segment((CD_F32)p[2].x, (CD_F32)p[2].y, (CD_F32)p[3].x, (CD_F32)p[3].y);
+            const CD_BOOL expected = reference_intersect(p[0], p[1], p[2], p[3]);
+            CD_VEC2 point = cd_vec2_make_v(-100.0f, -100.0f);
+            const CD_BOOL hit = intersect(a, b, &point);
+            CD_TEST_CHECK(hit == expected);
+            CD_TEST_CHECK(intersect(a, b, CD_NULL) == hit);
+            // 对称
+            CD_TEST_CHECK(intersect(b, a, CD_NULL) == hit);
+            if (hit)
+            {
+                ++hits;
+                // 交点同时在两条线段上
+                CD_TEST_CHECK(point_segment_distance(point, a.point1.x, a.point1.y, a.point2.x, a.point2.y) < 1e-5);
+                CD_TEST_CHECK(point_segment_distance(point, b.point1.x, b.point1.y, b.point2.x, b.point2.y) < 1e-5);
+            }
+
+            CD_BOOL result = !hit;
+            CD_VEC2 fast_point = cd_vec2_make_v(0.0f, 0.0f);
+            CD_TEST_CHECK(cd_segments_intersect(&a, &b, &fast_point, &result) == CD_RET_OK);
+            CD_TEST_CHECK(result == hit);
+            CD_TEST_CHECK(!hit || (fast_point.x == point.x && fast_point.y == point.y));
+        }
+        CD_TEST_CHECK(hits > 20000 && hits < 180000);
+    }
+
+    CD_VOID test_known()
+    {
+        CD_VEC2 point;
+        // 交叉于 (1, 1)
+        CD_TEST_CHECK(intersect(make_segment(0.0f, 0.0f, 2.0f, 2.0f), make_segment(0.0f, 2.0f, 2.0f, 0.0f), &point));
+        CD_TEST_CHECK(point.x == 1.0f && point.y == 1.0f);
+        // T形接触: 端点落在另一条线段中间
+        CD_TEST_CHECK(intersect(make_segment(0.0f, 0.0f, 4.0f, 0.0f), make_segment(1.5f, 0.0f, 1.5f, 3.0f), &point));
+        CD_TEST_CHECK(point.x == 1.5f && point.y == 0.0f);
+        // 只与另一条线段的延长线相交
+        CD_TEST_CHECK(!intersect(make_segment(0.0f, 0.0f, 4.0f, 0.0f), make_segment(5.0f, -1.0f, 5.0f, 1.0f), CD_NULL));
+        CD_TEST_CHECK(!intersect(make_segment(5.0f, -1.0f, 5.0f, 1.0f), make_segment(0.0f, 0.0f, 4.0f, 0.0f), CD_NULL));
+        // 共线: 重叠、首尾相接、分离
+        CD_TEST_CHECK(intersect(make_segment(0.0f, 0.0f, 2.0f, 0.0f), make_segment(1.0f, 0.0f, 3.0f, 0.0f), CD_NULL));
+        CD_TEST_CHECK(intersect(make_segment(0.0f, 0.0f, 2.0f, 0.0f), make_segment(2.0f, 0.0f, 3.0f, 0.0f), CD_NULL));
+        CD_TEST_CHECK(!intersect(make_segment(0.0f, 0.0f, 2.0f, 0.0f), make_segment(2.5f, 0.0f, 3.0f, 0.0f), CD_NULL));
+        // 平行不共线
+        CD_TEST_CHECK(!intersect(make_segment(0.0f, 0.0f, 2.0f, 0.0f), make_segment(0.0f, 1.0f, 2.0f, 1.0f), CD_NULL));
+
+        CD_BOOL result = CD_FALSE;
+        const CD_SEGMENT s = make_segment(0.0f, 0.0f, 1.0f, 1.0f);
+        CD_TEST_CHECK(cd_segments_intersect_fast(&s, CD_NULL, CD_NULL, &result) == COLLISION_DETECTION_E_PARAM_NULL);
+        CD_TEST_CHECK(cd_segments_intersect(&s, &s, CD_NULL, CD_NULL) == COLLISION_DETECTION_E_PARAM_NULL);
+    }
+
+    // 随机浮点线段与双精度参数解比较,交点接近端点或近乎平行时跳过
+    CD_VOID test_random()
+    {
+        CD_S32 decided = 0;
+        CD_S32 hits = 0;
+        for (CD_S32 iter = 0; iter < 100000; ++iter)
+        {
+            const CD_SEGMENT a = make_segment(cd_test::rand_f(-5.0f, 5.0f), cd_test::rand_f(-5.0f, 5.0f), cd_test::rand_f(-5.0f, 5.0f),
+                                              cd_test::rand_f(-5.0f, 5.0f));
+            const CD_SEGMENT b = make_segment(cd_test::rand_f(-5.0f, 5.0f), cd_test::rand_f(-5.0f, 5.0f), cd_test::rand_f(-5.0f, 5.0f),
+                                              cd_test::rand_f(-5.0f, 5.0f));
+            const CD_F64 e1x = (CD_F64)a.point2.x - a.point1.x, e1y = (CD_F64)a.point2.y - a.point1.y;
+            const CD_F64 e2x = (CD_F64)b.point2.x - b.point1.x, e2y = (CD_F64)b.point2.y - b.point1.y;
+            const CD_F64 mx = (CD_F64)b.point1.x - a.point1.x, my = (CD_F64)b.point1.y - a.point1.y;
+            const CD_F64 den = e1x * e2y - e1y * e2x;
+            if (fabs(den) < 1e-3 * hypot(e1x, e1y) * hypot(e2x, e2y))
+            {
+                continue;
+            }
+            const CD_F64 t = (mx * e2y - my * e2x) / den;
+            const CD_F64 u = (mx * e1y - my * e1x) / den;
+            if (fabs(t) < 1e-4 || fabs(t - 1.0) < 1e-4 || fabs(u) < 1e-4 || fabs(u - 1.0) < 1e-4)
+            {
+                continue;
+            }
+            ++decided;
+            const CD_BOOL expected = t > 0.0 && t < 1.0 && u > 0.0 && u < 1.0;
+            CD_VEC2 point;
+            const CD_BOOL hit = intersect(a, b, &point);
+            CD_TEST_CHECK(hit == expected);
+            if (hit && expected)
+            {
+                ++hits;
+                CD_TEST_CHECK(hypot(point.x - (a.point1.x + t * e1x), point.y - (a.point1.y + t * e1y)) < 1e-3);
+            }
+        }
+        CD_TEST_CHECK(decided > 90000);
+        CD_TEST_CHECK(hits > decided / 10 && hits < decided * 9 / 10);
+    }
+
+    // 折线与SoA批量接口: 命中下标与交点同逐段调用,first_only 只报第一个,容量不足返回 E_MEM_FULL
+    CD_VOID test_batch()
+    {
+        for (CD_S32 iter = 0; iter < 2000; ++iter)
+        {
+            const CD_S32 point_count = cd_test::rand_s(0, 40);
+            std::vector<CD_VEC2> points(point_count + 1); // 点数为0时 data() 也非空
+            for (CD_S32 i = 0; i < point_count; ++i)
+            {
+                // 一部分取整数坐标,制造端点接触
+                points[i] = (iter & 1) ? cd_vec2_make_v((CD_F32)cd_test::rand_s(0, 6), (CD_F32)cd_test::rand_s(0, 6))
+                                       : cd_vec2_make_v(cd_test::rand_f(0.0f, 6.0f), cd_test::rand_f(0.0f, 6.0f));
+            }
+            const CD_SEGMENT seg = (iter & 1) ? make_segment((CD_F32)cd_test::rand_s(0, 6), (CD_F32)cd_test::rand_s(0, 6),
+                                                             (CD_F32)cd_test::rand_s(0, 6), (CD_F32)cd_test::rand_s(0, 6))
+                                              : make_segment(cd_test::rand_f(0.0f, 6.0f), cd_test::rand_f(0.0f, 6.0f),
+                                                             cd_test::rand_f(0.0f, 6.0f), cd_test::rand_f(0.0f, 6.0f));
+            std::vector<CD_S32> expected;
+            std::vector<CD_VEC2> expected_points;
+            for (CD_S32 i = 0; i + 1 < point_count; ++i)
+            {
+                CD_VEC2 point;
+                if (intersect(seg, make_segment(points[i].x, points[i].y, points[i + 1].x, points[i + 1].y), &point))
+                {
+                    expected.push_back(i);
+                    expected_points.push_back(point);
+                }
+            }
+            const CD_S32 n = (CD_S32)expected.size();
+
+            // 折线上每段同时存为SoA线段数组
+            const CD_S32 seg_count = CD_MAX(point_count - 1, 0);
+            std::vector<CD_F32> x1(seg_count + 1), y1(seg_count + 1), x2(seg_count + 1), y2(seg_count + 1);
+            for (CD_S32 i = 0; i < seg_count; ++i)
+            {
+                x1[i] = points[i].x;
+                y1[i] = points[i].y;
+                x2[i] = points[i + 1].x;
+                y2[i] = points[i + 1].y;
+            }
+            CD_SEGMENT_SOA soa;
+            soa.x1 = x1.data();
+            soa.y1 = y1.data();
+            soa.x2 = x2.data();
+            soa.y2 = y2.data();
+            soa.count = seg_count;
+
+            for (CD_S32 api = 0; api < 2; ++api)
+            {
+                std::vector<CD_S32> indices(n + 1, -1);
+                std::vector<CD_VEC2> hit_points(n + 1);
+                CD_S32 count = -1;
+#define CD_TEST_BATCH(first_only, out_points, capacity)                                                                       \
+    (api == 0 ? cd_segment_polyline_intersect(&seg, points.data(), point_count, first_only, indices.data(), out_points, capacity, \
+                                              &count)                                                                        \
+              : cd_segment_soa_intersect(&seg, &soa, first_only, indices.data(), out_points, capacity, &count))
+                CD_TEST_CHECK(CD_TEST_BATCH(CD_FALSE, hit_points.data(), n) == CD_RET_OK);
+                CD_TEST_CHECK(count == n);
+                for (CD_S32 k = 0; k < n && k < count; ++k)
+                {
+                    CD_TEST_CHECK(indices[k] == expected[k]);
+                    CD_TEST_CHECK(hit_points[k].x == expected_points[k].x && hit_points[k].y == expected_points[k].y);
+                }
+                CD_TEST_CHECK(indices[n] == -1); // 不越界写
+
+                // 不要交点
+                CD_TEST_CHECK(CD_TEST_BATCH(CD_FALSE, CD_NULL, n) == CD_RET_OK);
+                CD_TEST_CHECK(count == n);
+
+                // 只要第一个
+                CD_TEST_CHECK(CD_TEST_BATCH(CD_TRUE, hit_points.data(), n + 1) == CD_RET_OK);
+                CD_TEST_CHECK(count == CD_MIN(n, 1));
+                CD_TEST_CHECK(n == 0 || indices[0] == expected[0]);
+
+                // 容量不足
+                if (n > 0)
+                {
+                    const CD_S32 capacity = cd_test::rand_s(0, n - 1);
+                    CD_TEST_CHECK(CD_TEST_BATCH(CD_FALSE, hit_points.data(), capacity) == COLLISION_DETECTION_E_MEM_FULL);
+                    CD_TEST_CHECK(count == capacity);
+                    for (CD_S32 k = 0; k < capacity; ++k)
+                    {
+                        CD_TEST_CHECK(indices[k] == expected[k]);
+                    }
+                }
+#undef CD_TEST_BATCH
+            }
+        }
+
+        CD_S32 index = 0;
+        CD_S32 count = 0;
+        const CD_SEGMENT seg = make_segment(0.0f, 0.0f, 1.0f, 1.0f);
+        CD_TEST_CHECK(cd_segment_polyline_intersect(&seg, CD_NULL, 3, CD_FALSE, &index, CD_NULL, 1, &count) ==
+                      COLLISION_DETECTION_E_PARAM_NULL);
+        CD_SEGMENT_SOA soa;
+        soa.x1 = soa.y1 = soa.x2 = CD_NULL;
+        soa.y2 = CD_NULL;
+        soa.count = 1;
+        CD_TEST_CHECK(cd_segment_soa_intersect(&seg, &soa, CD_FALSE, &index, CD_NULL, 1, &count) == COLLISION_DETECTION_E_PARAM_NULL);
+    }
+} // namespace
+
+int main()
+{
+    test_known();
+    test_grid();
+    test_random();
+    test_batch();
+    return cd_test::report("test_segment");
+}
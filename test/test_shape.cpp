@@ -0,0 +1,221 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 11:20:46
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 11:20:46
+ */
+
+// 形状分派表: 6 x 6 种组合的重叠、距离与接触流形,以核心点集上的 GJK 距离为参考
+
+#include "cd_test.h"
+
+namespace
+{
+    const CD_S32 kCasesPerPair = 3000;
+    const CD_F32 kBand = 1e-3f; // 参考距离与半径和过于接近时不判定
+
+    CD_POLYGON g_polygons[2];
+
+    CD_AABB make_aabb(CD_VEC2 lower, CD_VEC2 upper)
+    {
+        CD_AABB r;
+        r.lowerBound = lower;
+        r.upperBound = upper;
+        return r;
+    }
+
+    CD_F32 table_distance(const CD_SHAPE *a, const CD_SHAPE *b)
+    {
+        CD_DISTANCE_OUTPUT output;
+        cd_shapes_distance_v(a, b, &output);
+        return output.distance;
+    }
+
+    CD_VEC2 rand_vec(CD_F32 range)
+    {
+        return cd_vec2_make_v(cd_test::rand_f(-range, range), cd_test::rand_f(-range, range));
+    }
+
+    // slot 区分 a、b 两侧,多边形形状引用 g_polygons[slot]
+    CD_SHAPE rand_shape(CD_S32 type, CD_S32 slot)
+    {
+        const CD_VEC2 center = rand_vec(2.0f);
+        switch (type)
+        {
+        case CD_SHAPE_CIRCLE:
+        {
+            CD_CIRCLE c;
+            c.center = center;
+            c.radius = cd_test::rand_f(0.1f, 1.0f);
+            return cd_make_circle_shape_v(c);
+        }
+        case CD_SHAPE_AABB:
+        {
+            CD_AABB a;
+            a.lowerBound = center;
+            a.upperBound = cd_vec2_add_v(center, cd_vec2_make_v(cd_test::rand_f(0.1f, 2.0f), cd_test::rand_f(0.1f, 2.0f)));
+            return cd_make_aabb_shape_v(a);
+        }
+        case CD_SHAPE_OBB:
+            return cd_make_obb_shape_v(cd_create_obb_v(center, cd_test::rand_f(0.2f, 2.0f), cd_test::rand_f(0.2f, 1.5f),
+                                                       cd_test::rand_f(-3.2f, 3.2f)));
+        case CD_SHAPE_POLYGON:
+        {
+            CD_VEC2 points[MAX_POLYGON_VERTICES];
+            CD_VEC2 scratch[CD_HULL_SCRATCH_SIZE(MAX_POLYGON_VERTICES)];
+            const CD_S32 count = cd_test::rand_s(3, MAX_POLYGON_VERTICES);
+            // 一半多边形带圆角,覆盖分离轴测试在角点处偏保守的情况
+            const CD_F32 radius = (cd_test::rand_u32() & 1) ? cd_test::rand_f(0.05f, 0.5f) : 0.0f;
+            while (CD_TRUE)
+            {
+                for (CD_S32 i = 0; i < count; ++i)
+                {
+                    points[i] = cd_vec2_add_v(center, rand_vec(1.0f));
+                }
+                if (cd_make_polygon(points, count, radius, scratch, &g_polygons[slot]) == CD_RET_OK)
+                {
+                    break;
+                }
+            }
+            return cd_make_polygon_shape_v(&g_polygons[slot]);
+        }
+        case CD_SHAPE_SEGMENT:
+        {
+            CD_SEGMENT s;
+            s.point1 = center;
+            s.point2 = cd_vec2_add_v(center, rand_vec(1.5f));
+            return cd_make_segment_shape_v(s);
+        }
+        default:
+        {
+            CD_CAPSULE c;
+            c.seg.point1 = center;
+            c.seg.point2 = cd_vec2_add_v(center, rand_vec(1.5f));
+            c.radius = cd_test::rand_f(0.05f, 0.8f);
+            return cd_make_capsule_shape_v(c);
+        }
+        }
+    }
+
+    // 参考: 核心点集之间的 GJK 距离,以及两侧的圆角半径之和
+    CD_F32 reference_core_distance(const CD_SHAPE *a, const CD_SHAPE *b, CD_F32 *radius)
+    {
+        CD_SHAPE_SCRATCH scratch_a;
+        CD_SHAPE_SCRATCH scratch_b;
+        CD_DISTANCE_SPAN_INPUT input;
+        input.proxyA = cd_shape_span_v(a, &scratch_a);
+        input.proxyB = cd_shape_span_v(b, &scratch_b);
+        input.transformA = TRANSFORM_IDENTITY;
+        input.transformB = TRANSFORM_IDENTITY;
+        input.useRadii = CD_FALSE;
+        *radius = input.proxyA.radius + input.proxyB.radius;
+        CD_DISTANCE_CACHE cache = emptyDistanceCache;
+        CD_DISTANCE_OUTPUT output;
+        cd_shape_distance_span(&cache, &input, CD_NULL, 0, &output);
+        return output.distance;
+    }
+
+    CD_VOID test_pair(CD_S32 type_a, CD_S32 type_b)
+    {
+        CD_S32 overlaps = 0;
+        CD_S32 separated = 0;
+        for (CD_S32 iter = 0; iter < kCasesPerPair; ++iter)
+        {
+            const CD_SHAPE a = rand_shape(type_a, 0);
+            const CD_SHAPE b = rand_shape(type_b, 1);
+            CD_F32 radius = 0.0f;
+            const CD_F32 core = reference_core_distance(&a, &b, &radius);
+            const CD_F32 gap = core - radius;
+            // 核心相交时 GJK 距离为0,一定重叠;否则跳过贴近边界的用例
+            if (core > 0.0f && CD_FABS(gap) < kBand)
+            {
+                continue;
+            }
+            const CD_BOOL expected = core <= 0.0f || gap < 0.0f;
+            overlaps += expected;
+            separated += !expected;
+
+            CD_BOOL overlap = CD_FALSE;
+            CD_TEST_CHECK(cd_shapes_overlap(&a, &b, &overlap) == CD_RET_OK);
+            CD_TEST_CHECK(overlap == expected);
+
+            CD_DISTANCE_OUTPUT output;
+            CD_TEST_CHECK(cd_shapes_distance(&a, &b, &output) == CD_RET_OK);
+            CD_TEST_CHECK_NEAR(output.distance, CD_MAX(gap, 0.0f), 1e-3);
+            if (!expected)
+            {
+                // 最近点之间的距离与输出的距离一致
+                CD_TEST_CHECK_NEAR(cd_vec2_dis_v(output.pointA, output.pointB), output.distance, 1e-3);
+            }
+
+            CD_MANIFOLD m = cd_empty_manifold_v();
+            CD_TEST_CHECK(cd_shapes_manifold(&a, &b, &m) == CD_RET_OK);
+            if (core <= 0.0f || gap < -0.01f)
+            {
+                CD_TEST_CHECK(m.pointCount > 0);
+                CD_TEST_CHECK_NEAR(cd_vec2_len_v(m.normal), 1.0, 1e-3);
+            }
+            else if (gap > 0.1f)
+            {
+                CD_TEST_CHECK(m.pointCount == 0);
+            }
+        }
+        // 每种组合都要同时覆盖重叠与分离
+        CD_TEST_CHECK(overlaps > kCasesPerPair / 50 && separated > kCasesPerPair / 50);
+    }
+
+    CD_VOID test_all_pairs()
+    {
+        for (CD_S32 a = 0; a < CD_SHAPE_TYPE_COUNT; ++a)
+        {
+            for (CD_S32 b = 0; b < CD_SHAPE_TYPE_COUNT; ++b)
+            {
+                test_pair(a, b);
+            }
+        }
+    }
+
+    // 圆角多边形的角点: 尖角外扩会误判为重叠,按圆角应分离
+    CD_VOID test_rounded_corner()
+    {
+        CD_VEC2 points[4] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+        CD_VEC2 scratch[CD_HULL_SCRATCH_SIZE(4)];
+        CD_POLYGON rounded;
+        CD_TEST_CHECK(cd_make_polygon(points, 4, 0.5f, scratch, &rounded) == CD_RET_OK);
+        const CD_SHAPE a = cd_make_polygon_shape_v(&rounded);
+        // 对角方向上距角点 0.6 > 0.5,但在两个边法向上的分离量都只有 0.42
+        const CD_F32 d = 0.6f / sqrtf(2.0f);
+        const CD_SHAPE b = cd_make_aabb_shape_v(
+            make_aabb(cd_vec2_make_v(1.0f + d, 1.0f + d), cd_vec2_make_v(2.0f + d, 2.0f + d)));
+        CD_TEST_CHECK(!cd_shapes_overlap_v(&a, &b));
+        CD_TEST_CHECK(!cd_shapes_overlap_v(&b, &a));
+        const CD_F32 e = 0.4f / sqrtf(2.0f);
+        const CD_SHAPE c = cd_make_aabb_shape_v(
+            make_aabb(cd_vec2_make_v(1.0f + e, 1.0f + e), cd_vec2_make_v(2.0f + e, 2.0f + e)));
+        CD_TEST_CHECK(cd_shapes_overlap_v(&a, &c));
+    }
+
+    // 编译期分派与运行期查表一致
+    CD_VOID test_compile_time_dispatch()
+    {
+        for (CD_S32 iter = 0; iter < 1000; ++iter)
+        {
+            const CD_SHAPE a = rand_shape(CD_SHAPE_OBB, 0);
+            const CD_SHAPE b = rand_shape(CD_SHAPE_CAPSULE, 1);
+            CD_TEST_CHECK(cd::shape_overlap(a.data.obb, b.data.capsule) == cd_shapes_overlap_v(&a, &b));
+            CD_TEST_CHECK(cd::shape_distance(a.data.obb, b.data.capsule).distance == table_distance(&a, &b));
+        }
+        CD_BOOL result = CD_FALSE;
+        CD_SHAPE bad = rand_shape(CD_SHAPE_CIRCLE, 0);
+        bad.type = CD_SHAPE_TYPE_COUNT;
+        CD_TEST_CHECK(cd_shapes_overlap(&bad, &bad, &result) == COLLISION_DETECTION_E_CALC_ERROR);
+    }
+} // namespace
+
+int main()
+{
+    test_all_pairs();
+    test_rounded_corner();
+    test_compile_time_dispatch();
+    return cd_test::report("test_shape");
+}
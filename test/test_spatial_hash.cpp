@@ -0,0 +1,183 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 14:05:19
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 14:05:19
+ */
+
+// 空间哈希: 多帧清空重建后的查询结果与按栅格范围暴力求得的候选一致,
+// NaN 与超出范围的坐标被拒绝,超大的查询范围按表项数有界
+
+#include "cd_test.h"
+
+#include <limits>
+#include <math.h>
+#include <set>
+#include <vector>
+
+namespace
+{
+    const CD_S32 kObstacles = 200;
+    const CD_S32 kEntryCapacity = 8192;
+    const CD_F32 kCellSize = 0.5f;
+
+    struct CellRange
+    {
+        CD_S32 x0, y0, x1, y1;
+    };
+
+    struct HashFixture
+    {
+        std::vector<CD_S32> buckets;
+        std::vector<CD_HASH_ENTRY> entries;
+        std::vector<CD_U32> stamps;
+        CD_SPATIAL_HASH hash;
+
+        HashFixture() : buckets(1024), entries(kEntryCapacity), stamps(kObstacles)
+        {
+            cd_spatial_hash_init(&hash, kCellSize, buckets.data(), (CD_S32)buckets.size(), entries.data(), kEntryCapacity,
+                                 stamps.data(), kObstacles);
+        }
+    };
+
+    CD_VEC2 rand_vec(CD_F32 range)
+    {
+        return cd_vec2_make_v(cd_test::rand_f(-range, range), cd_test::rand_f(-range, range));
+    }
+
+    CellRange cell_range(const CD_AABB &aabb)
+    {
+        CellRange r;
+        r.x0 = (CD_S32)floorf(aabb.lowerBound.x / kCellSize);
+        r.y0 = (CD_S32)floorf(aabb.lowerBound.y / kCellSize);
+        r.x1 = (CD_S32)floorf(aabb.upperBound.x / kCellSize);
+        r.y1 = (CD_S32)floorf(aabb.upperBound.y / kCellSize);
+        return r;
+    }
+
+    CD_BOOL ranges_overlap(const CellRange &a, const CellRange &b)
+    {
+        return a.x0 <= b.x1 && b.x0 <= a.x1 && a.y0 <= b.y1 && b.y0 <= a.y1;
+    }
+
+    // 随机插入圆、obb或aabb障碍物,返回各障碍物的aabb
+    std::vector<CD_AABB> fill(HashFixture *f)
+    {
+        std::vector<CD_AABB> aabbs(kObstacles);
+        for (CD_S32 id = 0; id < kObstacles; ++id)
+        {
+            const CD_VEC2 center = rand_vec(10.0f);
+            switch (cd_test::rand_u32() % 3)
+            {
+            case 0:
+            {
+                CD_CIRCLE c;
+                c.center = center;
+                c.radius = cd_test::rand_f(0.05f, 1.0f);
+                CD_TEST_CHECK(cd_spatial_hash_insert_circle(&f->hash, &c, id) == CD_RET_OK);
+                aabbs[id] = cd_circle_to_aabb_v(c);
+                break;
+            }
+            case 1:
+            {
+                const CD_OBB obb = cd_create_obb_v(center, cd_test::rand_f(0.1f, 2.0f), cd_test::rand_f(0.1f, 1.0f),
+                                                   cd_test::rand_f(-3.2f, 3.2f));
+                CD_TEST_CHECK(cd_spatial_hash_insert_obb(&f->hash, &obb, id) == CD_RET_OK);
+                aabbs[id] = cd_obb_to_aabb_v(obb);
+                break;
+            }
+            default:
+            {
+                CD_AABB a;
+                a.lowerBound = center;
+                a.upperBound = cd_vec2_add_v(center, cd_vec2_make_v(cd_test::rand_f(0.0f, 1.5f), cd_test::rand_f(0.0f, 1.5f)));
+                CD_TEST_CHECK(cd_spatial_hash_insert_aabb(&f->hash, &a, id) == CD_RET_OK);
+                aabbs[id] = a;
+                break;
+            }
+            }
+        }
+        return aabbs;
+    }
+
+    CD_VOID test_query_matches_brute_force()
+    {
+        HashFixture f;
+        std::vector<CD_S32> ids(kObstacles);
+        for (CD_S32 frame = 0; frame < 20; ++frame)
+        {
+            CD_TEST_CHECK(cd_spatial_hash_clear(&f.hash) == CD_RET_OK);
+            const std::vector<CD_AABB> aabbs = fill(&f);
+            for (CD_S32 q = 0; q < 100; ++q)
+            {
+                CD_AABB query;
+                query.lowerBound = rand_vec(12.0f);
+                // 少数查询覆盖整个场景,走逐表项检查的分支
+                const CD_F32 size = (q % 10 == 0) ? 40.0f : cd_test::rand_f(0.0f, 4.0f);
+                query.upperBound = cd_vec2_add_v(query.lowerBound, cd_vec2_make_v(size, cd_test::rand_f(0.0f, size)));
+                std::set<CD_S32> expected;
+                const CellRange qr = cell_range(query);
+                for (CD_S32 id = 0; id < kObstacles; ++id)
+                {
+                    if (ranges_overlap(qr, cell_range(aabbs[id])))
+                    {
+                        expected.insert(id);
+                    }
+                }
+                CD_S32 count = -1;
+                CD_TEST_CHECK(cd_spatial_hash_query(&f.hash, &query, ids.data(), kObstacles, &count) == CD_RET_OK);
+                const std::set<CD_S32> got(ids.begin(), ids.begin() + CD_MAX(count, 0));
+                CD_TEST_CHECK((CD_S32)got.size() == count); // 结果不重复
+                CD_TEST_CHECK(got == expected);
+
+                // 容量不足时输出前 capacity 个并返回 E_MEM_FULL
+                if (count > 1)
+                {
+                    CD_S32 partial = -1;
+                    CD_TEST_CHECK(cd_spatial_hash_query(&f.hash, &query, ids.data(), count - 1, &partial) ==
+                                  COLLISION_DETECTION_E_MEM_FULL);
+                    CD_TEST_CHECK(partial == count - 1);
+                }
+            }
+        }
+    }
+
+    CD_VOID test_invalid_and_huge()
+    {
+        HashFixture f;
+        fill(&f);
+        const CD_S32 entries = f.hash.entryCount;
+        const CD_F32 nan = std::numeric_limits<CD_F32>::quiet_NaN();
+        std::vector<CD_S32> ids(kObstacles);
+        CD_S32 count = 0;
+
+        CD_AABB bad;
+        bad.lowerBound = cd_vec2_make_v(nan, 0.0f);
+        bad.upperBound = cd_vec2_make_v(1.0f, 1.0f);
+        CD_TEST_CHECK(cd_spatial_hash_insert_aabb(&f.hash, &bad, 0) == COLLISION_DETECTION_E_CALC_ERROR);
+        CD_TEST_CHECK(cd_spatial_hash_query(&f.hash, &bad, ids.data(), kObstacles, &count) == COLLISION_DETECTION_E_CALC_ERROR);
+        bad.lowerBound = cd_vec2_make_v(0.0f, -1e30f);
+        CD_TEST_CHECK(cd_spatial_hash_insert_aabb(&f.hash, &bad, 0) == COLLISION_DETECTION_E_CALC_ERROR);
+        CD_TEST_CHECK(cd_spatial_hash_query(&f.hash, &bad, ids.data(), kObstacles, &count) == COLLISION_DETECTION_E_CALC_ERROR);
+        CD_TEST_CHECK(f.hash.entryCount == entries);
+
+        // 栅格范围接近 CD_HASH_CELL_LIMIT 的查询: 不逐栅格循环,返回全部障碍物
+        CD_AABB huge;
+        const CD_F32 extent = 0.99f * CD_HASH_CELL_LIMIT * kCellSize;
+        huge.lowerBound = cd_vec2_make_v(-extent, -extent);
+        huge.upperBound = cd_vec2_make_v(extent, extent);
+        CD_TEST_CHECK(cd_spatial_hash_query(&f.hash, &huge, ids.data(), kObstacles, &count) == CD_RET_OK);
+        CD_TEST_CHECK(count == kObstacles);
+
+        // 插入同样大的aabb需要的表项超过容量
+        CD_TEST_CHECK(cd_spatial_hash_insert_aabb(&f.hash, &huge, 0) == COLLISION_DETECTION_E_MEM_FULL);
+        CD_TEST_CHECK(f.hash.entryCount == entries);
+    }
+} // namespace
+
+int main()
+{
+    test_query_matches_brute_force();
+    test_invalid_and_huge();
+    return cd_test::report("test_spatial_hash");
+}
@@ -0,0 +1,220 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 10:05:37
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 10:05:37
+ */
+
+// 扫描剪枝: 重叠对与暴力枚举一致(含边界接触),哈希表已满后端点仍保持有序
+
+#include "cd_test.h"
+
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    const CD_S32 PROXY_N = 96;
+
+    typedef std::set<std::pair<CD_S32, CD_S32>> PAIR_SET;
+
+    CD_VOID on_pair(CD_S32 userDataA, CD_S32 userDataB, CD_BOOL added, CD_VOID *context)
+    {
+        PAIR_SET *pairs = (PAIR_SET *)context;
+        const std::pair<CD_S32, CD_S32> key(CD_MIN(userDataA, userDataB), CD_MAX(userDataA, userDataB));
+        if (added)
+        {
+            CD_TEST_CHECK(pairs->insert(key).second);
+        }
+        else
+        {
+            CD_TEST_CHECK(pairs->erase(key) == 1);
+        }
+    }
+
+    // 坐标取整数,使大量aabb恰好边界接触
+    CD_AABB random_aabb()
+    {
+        CD_AABB aabb;
+        aabb.lowerBound = cd_vec2_make_v((CD_F32)cd_test::rand_s(0, 40), (CD_F32)cd_test::rand_s(0, 40));
+        aabb.upperBound = cd_vec2_make_v(aabb.lowerBound.x + (CD_F32)cd_test::rand_s(0, 6),
+                                         aabb.lowerBound.y + (CD_F32)cd_test::rand_s(0, 6));
+        return aabb;
+    }
+
+    CD_VOID check_sorted(const CD_SWEEP_PRUNE *sap)
+    {
+        for (CD_S32 axis = 0; axis < 2; ++axis)
+        {
+            const CD_SAP_ENDPOINT *endpoints = sap->endpoints[axis];
+            for (CD_S32 i = 0; i < 2 * sap->proxyCount; ++i)
+            {
+                const CD_S32 id = endpoints[i].data >> 1;
+                const CD_SAP_PROXY *proxy = sap->proxies + id;
+                CD_TEST_CHECK(proxy->active);
+                CD_TEST_CHECK(((endpoints[i].data & 1) ? proxy->maxIndex[axis] : proxy->minIndex[axis]) == i);
+                if (i > 0)
+                {
+                    CD_TEST_CHECK(!cd_sap_endpoint_after_v(endpoints[i - 1], endpoints[i]));
+                }
+            }
+        }
+    }
+
+    PAIR_SET brute_force(const CD_SWEEP_PRUNE *sap, const std::vector<CD_S32> &ids)
+    {
+        PAIR_SET pairs;
+        for (size_t i = 0; i < ids.size(); ++i)
+        {
+            for (size_t j = i + 1; j < ids.size(); ++j)
+            {
+                const CD_SAP_PROXY *a = sap->proxies + ids[i];
+                const CD_SAP_PROXY *b = sap->proxies + ids[j];
+                if (cd_aabb_overlap_v(a->aabb, b->aabb))
+                {
+                    pairs.insert(std::make_pair(CD_MIN(a->userData, b->userData), CD_MAX(a->userData, b->userData)));
+                }
+            }
+        }
+        return pairs;
+    }
+
+    PAIR_SET stored_pairs(const CD_SWEEP_PRUNE *sap)
+    {
+        std::vector<CD_SAP_PAIR> buffer(sap->pairMask + 1);
+        CD_S32 count = 0;
+        CD_TEST_CHECK(cd_sap_get_pairs(sap, buffer.data(), (CD_S32)buffer.size(), &count) == CD_RET_OK);
+        PAIR_SET pairs;
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            const CD_S32 a = sap->proxies[buffer[i].proxyA].userData;
+            const CD_S32 b = sap->proxies[buffer[i].proxyB].userData;
+            pairs.insert(std::make_pair(CD_MIN(a, b), CD_MAX(a, b)));
+        }
+        return pairs;
+    }
+
+    CD_VOID test_against_brute_force()
+    {
+        std::vector<CD_SAP_PROXY> proxies(PROXY_N);
+        std::vector<CD_SAP_ENDPOINT> endpoints_x(2 * PROXY_N);
+        std::vector<CD_SAP_ENDPOINT> endpoints_y(2 * PROXY_N);
+        std::vector<CD_SAP_PAIR> pairs(8192);
+        PAIR_SET reported;
+        CD_SWEEP_PRUNE sap;
+        CD_TEST_CHECK(cd_sap_init(&sap, proxies.data(), PROXY_N, endpoints_x.data(), endpoints_y.data(), pairs.data(),
+                                  (CD_S32)pairs.size(), on_pair, &reported) == CD_RET_OK);
+
+        // 代理的 userData 取代理索引,便于与暴力结果对照
+        std::vector<CD_S32> ids;
+        for (CD_S32 step = 0; step < 4000; ++step)
+        {
+            const CD_U32 op = cd_test::rand_u32() % 10;
+            if ((op < 3 || ids.empty()) && (CD_S32)ids.size() < PROXY_N)
+            {
+                const CD_AABB aabb = random_aabb();
+                CD_S32 id = CD_SAP_NULL_PROXY;
+                CD_TEST_CHECK(cd_sap_create_proxy(&sap, &aabb, sap.freeList, &id) == CD_RET_OK);
+                ids.push_back(id);
+            }
+            else if (op < 4 && !ids.empty())
+            {
+                const size_t k = cd_test::rand_u32() % ids.size();
+                CD_TEST_CHECK(cd_sap_destroy_proxy(&sap, ids[k]) == CD_RET_OK);
+                ids.erase(ids.begin() + k);
+            }
+            else if (!ids.empty())
+            {
+                const CD_AABB aabb = random_aabb();
+                CD_TEST_CHECK(cd_sap_move_proxy(&sap, ids[cd_test::rand_u32() % ids.size()], &aabb) == CD_RET_OK);
+            }
+            if (step % 50 == 0)
+            {
+                check_sorted(&sap);
+                const PAIR_SET expected = brute_force(&sap, ids);
+                CD_TEST_CHECK(stored_pairs(&sap) == expected);
+                CD_TEST_CHECK(reported == expected);
+            }
+        }
+    }
+
+    CD_VOID test_touching()
+    {
+        CD_SAP_PROXY proxies[2];
+        CD_SAP_ENDPOINT endpoints_x[4];
+        CD_SAP_ENDPOINT endpoints_y[4];
+        CD_SAP_PAIR pairs[8];
+        CD_SWEEP_PRUNE sap;
+        CD_TEST_CHECK(cd_sap_init(&sap, proxies, 2, endpoints_x, endpoints_y, pairs, 8, CD_NULL, CD_NULL) == CD_RET_OK);
+        CD_AABB a;
+        a.lowerBound = cd_vec2_make_v(0.0f, 0.0f);
+        a.upperBound = cd_vec2_make_v(1.0f, 1.0f);
+        CD_AABB b;
+        b.lowerBound = cd_vec2_make_v(1.0f, 1.0f);
+        b.upperBound = cd_vec2_make_v(2.0f, 2.0f);
+        CD_S32 id_a = 0;
+        CD_S32 id_b = 0;
+        CD_TEST_CHECK(cd_sap_create_proxy(&sap, &a, 0, &id_a) == CD_RET_OK);
+        CD_TEST_CHECK(cd_sap_create_proxy(&sap, &b, 1, &id_b) == CD_RET_OK);
+        CD_TEST_CHECK(sap.pairCount == 1);
+        b.lowerBound.x = 1.5f;
+        CD_TEST_CHECK(cd_sap_move_proxy(&sap, id_b, &b) == CD_RET_OK);
+        CD_TEST_CHECK(sap.pairCount == 0);
+    }
+
+    CD_VOID test_pairs_full()
+    {
+        // 8 个槽位最多容纳 7 个重叠对,所有代理彼此重叠时必然溢出
+        const CD_S32 n = 8;
+        CD_SAP_PROXY proxies[n];
+        CD_SAP_ENDPOINT endpoints_x[2 * n];
+        CD_SAP_ENDPOINT endpoints_y[2 * n];
+        CD_SAP_PAIR pairs[8];
+        CD_SWEEP_PRUNE sap;
+        CD_TEST_CHECK(cd_sap_init(&sap, proxies, n, endpoints_x, endpoints_y, pairs, 8, CD_NULL, CD_NULL) == CD_RET_OK);
+        std::vector<CD_S32> ids;
+        CD_BOOL saw_full = CD_FALSE;
+        for (CD_S32 i = 0; i < n; ++i)
+        {
+            CD_AABB aabb;
+            aabb.lowerBound = cd_vec2_make_v((CD_F32)i, 0.0f);
+            aabb.upperBound = cd_vec2_make_v((CD_F32)i + 10.0f, 1.0f);
+            CD_S32 id = CD_SAP_NULL_PROXY;
+            const CD_RET ret = cd_sap_create_proxy(&sap, &aabb, i, &id);
+            CD_TEST_CHECK(ret == CD_RET_OK || ret == COLLISION_DETECTION_E_MEM_FULL);
+            saw_full = saw_full || ret == COLLISION_DETECTION_E_MEM_FULL;
+            CD_TEST_CHECK(id != CD_SAP_NULL_PROXY);
+            ids.push_back(id);
+            check_sorted(&sap);
+        }
+        CD_TEST_CHECK(saw_full);
+
+        // 记录下来的重叠对必须真实存在
+        const PAIR_SET expected = brute_force(&sap, ids);
+        const PAIR_SET stored = stored_pairs(&sap);
+        for (PAIR_SET::const_iterator it = stored.begin(); it != stored.end(); ++it)
+        {
+            CD_TEST_CHECK(expected.count(*it) == 1);
+        }
+
+        // 全部分开后端点仍然有序,重叠对清空
+        for (CD_S32 i = 0; i < n; ++i)
+        {
+            CD_AABB aabb;
+            aabb.lowerBound = cd_vec2_make_v(20.0f * (CD_F32)i, 0.0f);
+            aabb.upperBound = cd_vec2_make_v(20.0f * (CD_F32)i + 10.0f, 1.0f);
+            CD_TEST_CHECK(cd_sap_move_proxy(&sap, ids[i], &aabb) == CD_RET_OK);
+            check_sorted(&sap);
+        }
+        CD_TEST_CHECK(sap.pairCount == 0);
+    }
+} // namespace
+
+int main()
+{
+    test_against_brute_force();
+    test_touching();
+    test_pairs_full();
+    return cd_test::report("test_sweep_prune");
+}
@@ -0,0 +1,86 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 12:48:05
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 12:48:05
+ */
+
+// 保守前进: 输出的 t 与同时刻的间距、法向一致,且不越过真实的接触时刻
+
+#include "cd_test.h"
+
+namespace
+{
+    const CD_VEC2 kBox[4] = {{-0.5f, -0.1f}, {0.5f, -0.1f}, {0.5f, 0.1f}, {-0.5f, 0.1f}};
+
+    CD_F32 distance_at(const CD_TOI_INPUT *input, CD_F32 t)
+    {
+        CD_DISTANCE_INPUT distance_input;
+        distance_input.proxyA = input->proxyA;
+        distance_input.proxyB = input->proxyB;
+        distance_input.transformA = cd_sweep_transform_v(input->sweepA, t);
+        distance_input.transformB = cd_sweep_transform_v(input->sweepB, t);
+        distance_input.useRadii = CD_TRUE;
+        CD_DISTANCE_CACHE cache = emptyDistanceCache;
+        CD_DISTANCE_OUTPUT output;
+        cd_shape_distance(&cache, &distance_input, CD_NULL, 0, &output);
+        return output.distance;
+    }
+
+    // 快速旋转的细长盒子逐渐靠近: 角速度上界很松,少量迭代时无法收敛
+    CD_TOI_INPUT spinning_input(CD_S32 max_iterations)
+    {
+        CD_TOI_INPUT input;
+        cd_make_proxy(kBox, 4, 0.0f, &input.proxyA);
+        cd_make_proxy(kBox, 4, 0.0f, &input.proxyB);
+        input.sweepA.transform = TRANSFORM_IDENTITY;
+        input.sweepA.localCenter = cd_vec2_make_v(0.0f, 0.0f);
+        input.sweepA.velocity = cd_vec2_make_v(0.5f, 0.0f);
+        input.sweepA.angularVelocity = 20.0f;
+        input.sweepB.transform = TRANSFORM_IDENTITY;
+        input.sweepB.transform.p = cd_vec2_make_v(3.0f, 0.0f);
+        input.sweepB.localCenter = cd_vec2_make_v(0.0f, 0.0f);
+        input.sweepB.velocity = cd_vec2_make_v(-0.5f, 0.0f);
+        input.sweepB.angularVelocity = 0.0f;
+        input.tMax = 4.0f;
+        input.tolerance = 0.005f;
+        input.maxIterations = max_iterations;
+        return input;
+    }
+
+    CD_VOID test_iterations_exhausted()
+    {
+        for (CD_S32 iters = 1; iters <= 4; ++iters)
+        {
+            const CD_TOI_INPUT input = spinning_input(iters);
+            CD_TOI_OUTPUT output;
+            CD_TEST_CHECK(cd_time_of_impact(&input, &output) == CD_RET_OK);
+            CD_TEST_CHECK(output.state == CD_TOI_STATE_FAILED);
+            CD_TEST_CHECK(output.iterations == iters);
+            // 输出的间距就是输出时刻的间距
+            CD_TEST_CHECK_NEAR(output.distance, distance_at(&input, output.t), 1e-5);
+        }
+    }
+
+    CD_VOID test_hit_is_conservative()
+    {
+        const CD_TOI_INPUT input = spinning_input(1000);
+        CD_TOI_OUTPUT output;
+        CD_TEST_CHECK(cd_time_of_impact(&input, &output) == CD_RET_OK);
+        CD_TEST_CHECK(output.state == CD_TOI_STATE_HIT);
+        CD_TEST_CHECK(output.distance < input.tolerance);
+        CD_TEST_CHECK_NEAR(output.distance, distance_at(&input, output.t), 1e-5);
+        // 输出时刻之前的采样都没有接触
+        for (CD_S32 k = 0; k < 200; ++k)
+        {
+            CD_TEST_CHECK(distance_at(&input, output.t * (CD_F32)k / 200.0f) > 0.0f);
+        }
+    }
+} // namespace
+
+int main()
+{
+    test_iterations_exhausted();
+    test_hit_is_conservative();
+    return cd_test::report("test_toi");
+}
@@ -0,0 +1,307 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 16:44:12
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 16:44:12
+ */
+
+// 轨迹检测: 第一个碰撞位姿与障碍物下标和逐位姿逐障碍物的暴力枚举一致,
+// 胶囊体覆盖所有位姿上的足迹、剔除不会漏掉能碰撞的障碍物,障碍物数量跨过 CD_TRAJECTORY_CHUNK 分块
+
+#include "cd_test.h"
+
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+namespace
+{
+    // 弧线轨迹: 起点、朝向随机,曲率恒定,经 cd_trajectory_poses_from_xyh 转换
+    std::vector<CD_TRANSFORM> rand_trajectory(CD_S32 pose_count)
+    {
+        std::vector<CD_F32> xs(pose_count + 1), ys(pose_count + 1), headings(pose_count + 1);
+        CD_F32 x = cd_test::rand_f(-10.0f, 10.0f);
+        CD_F32 y = cd_test::rand_f(-10.0f, 10.0f);
+        CD_F32 heading = cd_test::rand_f(-3.2f, 3.2f);
+        const CD_F32 curvature = cd_test::rand_f(-0.15f, 0.15f);
+        for (CD_S32 i = 0; i < pose_count; ++i)
+        {
+            xs[i] = x;
+            ys[i] = y;
+            headings[i] = heading;
+            x += 0.5f * cosf(heading);
+            y += 0.5f * sinf(heading);
+            heading += 0.5f * curvature;
+        }
+        std::vector<CD_TRANSFORM> poses(pose_count + 1);
+        CD_TEST_CHECK(cd_trajectory_poses_from_xyh(xs.data(), ys.data(), headings.data(), pose_count, poses.data()) ==
+                      CD_RET_OK);
+        for (CD_S32 i = 0; i < pose_count; ++i)
+        {
+            const CD_ROT q = cd_rot_from_angle_v(headings[i]);
+            CD_TEST_CHECK(poses[i].p.x == xs[i] && poses[i].p.y == ys[i] && poses[i].q.c == q.c && poses[i].q.s == q.s);
+        }
+        poses.resize(pose_count);
+        return poses;
+    }
+
+    CD_OBB world_footprint(const CD_TRANSFORM &pose, const CD_OBB &footprint)
+    {
+        CD_OBB world = footprint;
+        world.center = cd_transforms_point_v(pose, footprint.center);
+        world.q = cd_rot_mul_v(pose.q, footprint.q);
+        return world;
+    }
+
+    // 障碍物散布在轨迹附近,多数通过胶囊体剔除;前 clear 个位姿上的足迹内不放障碍物,使第一个碰撞出现在轨迹后段
+    std::vector<CD_OBB> rand_obstacles(const std::vector<CD_TRANSFORM> &poses, const CD_OBB &footprint, CD_S32 count,
+                                       CD_F32 spread, CD_S32 clear)
+    {
+        std::vector<CD_OBB> obstacles(count);
+        for (CD_S32 j = 0; j < count; ++j)
+        {
+            CD_BOOL blocked = CD_TRUE;
+            for (CD_S32 attempt = 0; attempt < 20 && blocked; ++attempt)
+            {
+                const CD_VEC2 base = poses[cd_test::rand_s(0, (CD_S32)poses.size() - 1)].p;
+                const CD_VEC2 center = cd_vec2_add_v(base, cd_vec2_make_v(cd_test::rand_f(-spread, spread), cd_test::rand_f(-spread, spread)));
+                obstacles[j] = cd_create_obb_v(center, cd_test::rand_f(0.1f, 1.0f), cd_test::rand_f(0.1f, 0.6f), cd_test::rand_f(-3.2f, 3.2f));
+                blocked = CD_FALSE;
+                for (CD_S32 i = 0; i < clear && i < (CD_S32)poses.size() && !blocked; ++i)
+                {
+                    blocked = cd_obb_overlap_v(world_footprint(poses[i], footprint), obstacles[j]);
+                }
+            }
+        }
+        return obstacles;
+    }
+
+    // 暴力: 按位姿顺序,每个位姿按障碍物下标顺序,取第一个重叠
+    CD_VOID brute_force_obb(const std::vector<CD_TRANSFORM> &poses, const CD_OBB &footprint, const std::vector<CD_OBB> &obstacles,
+                            CD_S32 *pose, CD_S32 *obstacle)
+    {
+        *pose = CD_TRAJECTORY_NO_HIT;
+        *obstacle = CD_TRAJECTORY_NO_HIT;
+        for (size_t i = 0; i < poses.size(); ++i)
+        {
+            const CD_OBB world = world_footprint(poses[i], footprint);
+            for (size_t j = 0; j < obstacles.size(); ++j)
+            {
+                if (cd_obb_overlap_v(world, obstacles[j]))
+                {
+                    *pose = (CD_S32)i;
+                    *obstacle = (CD_S32)j;
+                    return;
+                }
+            }
+        }
+    }
+
+    CD_VOID brute_force_polygon(const std::vector<CD_TRANSFORM> &poses, const CD_POLYGON &footprint,
+                                const std::vector<CD_OBB> &obstacles, CD_S32 *pose, CD_S32 *obstacle)
+    {
+        *pose = CD_TRAJECTORY_NO_HIT;
+        *obstacle = CD_TRAJECTORY_NO_HIT;
+        for (size_t i = 0; i < poses.size(); ++i)
+        {
+            CD_VEC2 world[MAX_POLYGON_VERTICES];
+            for (CD_S32 v = 0; v < footprint.count; ++v)
+            {
+                world[v] = cd_transforms_point_v(poses[i], footprint.vertices[v]);
+            }
+            for (size_t j = 0; j < obstacles.size(); ++j)
+            {
+                if (cd_vertices_obb_overlap_v(world, footprint.count, obstacles[j]))
+                {
+                    *pose = (CD_S32)i;
+                    *obstacle = (CD_S32)j;
+                    return;
+                }
+            }
+        }
+    }
+
+    // 胶囊体包住每个位姿上的足迹顶点,剔除保留所有至少在一个位姿上碰撞的障碍物,返回通过剔除的数量
+    CD_S32 check_capsule(const std::vector<CD_TRANSFORM> &poses, const CD_OBB &footprint, const std::vector<CD_OBB> &obstacles)
+    {
+        CD_TRAJECTORY_CAPSULE capsule;
+        memset(&capsule, 0, sizeof(capsule));
+        CD_TEST_CHECK(cd_trajectory_capsule(poses.data(), (CD_S32)poses.size(), cd_trajectory_obb_radius_v(footprint), &capsule) ==
+                      CD_RET_OK);
+        for (size_t i = 0; i < poses.size(); ++i)
+        {
+            CD_VEC2 vertices[4];
+            cd_obb_vertices_v(world_footprint(poses[i], footprint), vertices);
+            for (CD_S32 v = 0; v < 4; ++v)
+            {
+                CD_TEST_CHECK(sqrtf(cd_trajectory_dis_sqr_to_axis_v(capsule.point1, capsule.point2, vertices[v])) <=
+                              capsule.radius + 1e-4f);
+            }
+        }
+        std::vector<CD_BOOL> kept(obstacles.size(), CD_FALSE);
+        CD_S32 next = 0;
+        CD_S32 chunks = 0;
+        CD_S32 total = 0;
+        while (next < (CD_S32)obstacles.size())
+        {
+            CD_TRAJECTORY_CANDIDATES candidates;
+            candidates.count = 0;
+            const CD_S32 start = next;
+            next = cd_trajectory_cull_v(&capsule, obstacles.data(), (CD_S32)obstacles.size(), next, &candidates);
+            CD_TEST_CHECK(next > start);
+            CD_TEST_CHECK(candidates.count <= CD_TRAJECTORY_CHUNK);
+            // 候选集满时停在最后一个候选之后
+            CD_TEST_CHECK(candidates.count < CD_TRAJECTORY_CHUNK || next == candidates.index[candidates.count - 1] + 1);
+            for (CD_S32 k = 0; k < candidates.count; ++k)
+            {
+                CD_TEST_CHECK(candidates.index[k] >= start && candidates.index[k] < next);
+                CD_TEST_CHECK(k == 0 || candidates.index[k] > candidates.index[k - 1]);
+                kept[candidates.index[k]] = CD_TRUE;
+            }
+            total += candidates.count;
+            ++chunks;
+        }
+        // 只有最后一个分块可以不满
+        CD_TEST_CHECK(chunks >= (total + CD_TRAJECTORY_CHUNK - 1) / CD_TRAJECTORY_CHUNK && chunks <= total / CD_TRAJECTORY_CHUNK + 1);
+        for (size_t j = 0; j < obstacles.size(); ++j)
+        {
+            for (size_t i = 0; i < poses.size() && !kept[j]; ++i)
+            {
+                CD_TEST_CHECK(!cd_obb_overlap_v(world_footprint(poses[i], footprint), obstacles[j]));
+            }
+        }
+        return total;
+    }
+
+    CD_VOID test_random()
+    {
+        // 障碍物数量覆盖空、少量以及分块边界两侧
+        const CD_S32 counts[] = {0, 1, 37, CD_TRAJECTORY_CHUNK - 1, CD_TRAJECTORY_CHUNK, CD_TRAJECTORY_CHUNK + 1,
+                                 2 * CD_TRAJECTORY_CHUNK + 3};
+        CD_S32 hits = 0;
+        CD_S32 later_hits = 0;
+        CD_S32 multi_chunk = 0;
+        CD_S32 cases = 0;
+        for (CD_S32 iter = 0; iter < 700; ++iter)
+        {
+            const CD_S32 obstacle_count = counts[iter % 7];
+            const CD_S32 pose_count = cd_test::rand_s(1, 60);
+            const std::vector<CD_TRANSFORM> poses = rand_trajectory(pose_count);
+            const CD_OBB footprint = cd_create_obb_v(cd_vec2_make_v(cd_test::rand_f(0.0f, 1.5f), 0.0f), cd_test::rand_f(2.0f, 5.0f),
+                                                     cd_test::rand_f(1.0f, 2.2f), cd_test::rand_f(-0.1f, 0.1f));
+            const CD_F32 spread = 3.0f + 0.01f * obstacle_count;
+            const CD_S32 clear = (iter / 7) % 2 == 0 ? 0 : cd_test::rand_s(1, pose_count);
+            const std::vector<CD_OBB> obstacles = rand_obstacles(poses, footprint, obstacle_count, spread, clear);
+
+            CD_S32 expected_pose, expected_obstacle;
+            brute_force_obb(poses, footprint, obstacles, &expected_pose, &expected_obstacle);
+            CD_S32 pose = 12345, obstacle = 12345;
+            CD_TEST_CHECK(cd_trajectory_check_obb(poses.data(), pose_count, &footprint, obstacle_count > 0 ? obstacles.data() : CD_NULL,
+                                                  obstacle_count, &pose, &obstacle) == CD_RET_OK);
+            CD_TEST_CHECK(pose == expected_pose);
+            CD_TEST_CHECK(obstacle == expected_obstacle);
+            CD_S32 pose_only = 12345;
+            CD_TEST_CHECK(cd_trajectory_check_obb(poses.data(), pose_count, &footprint, obstacles.data(), obstacle_count, &pose_only,
+                                                  CD_NULL) == CD_RET_OK);
+            CD_TEST_CHECK(pose_only == expected_pose);
+            if (obstacle_count > 0 && pose_count > 1)
+            {
+                multi_chunk += check_capsule(poses, footprint, obstacles) > CD_TRAJECTORY_CHUNK;
+            }
+
+            // 矩形与随机凸多边形足迹
+            CD_VEC2 points[MAX_POLYGON_VERTICES];
+            CD_VEC2 scratch[CD_HULL_SCRATCH_SIZE(MAX_POLYGON_VERTICES)];
+            CD_S32 point_count = 4;
+            if (iter & 1)
+            {
+                cd_obb_vertices_v(footprint, points);
+            }
+            else
+            {
+                point_count = cd_test::rand_s(3, MAX_POLYGON_VERTICES);
+                for (CD_S32 v = 0; v < point_count; ++v)
+                {
+                    points[v] = cd_vec2_make_v(cd_test::rand_f(-1.0f, 3.5f), cd_test::rand_f(-1.1f, 1.1f));
+                }
+            }
+            CD_POLYGON polygon;
+            if (cd_make_polygon(points, point_count, 0.0f, scratch, &polygon) == CD_RET_OK)
+            {
+                brute_force_polygon(poses, polygon, obstacles, &expected_pose, &expected_obstacle);
+                CD_TEST_CHECK(cd_trajectory_check_polygon(poses.data(), pose_count, &polygon, obstacles.data(), obstacle_count, &pose,
+                                                          &obstacle) == CD_RET_OK);
+                CD_TEST_CHECK(pose == expected_pose);
+                CD_TEST_CHECK(obstacle == expected_obstacle);
+            }
+
+            ++cases;
+            hits += expected_pose != CD_TRAJECTORY_NO_HIT;
+            later_hits += expected_pose > 0;
+        }
+        CD_TEST_CHECK(hits > cases / 5 && hits < cases * 4 / 5);
+        CD_TEST_CHECK(later_hits > cases / 5);
+        CD_TEST_CHECK(multi_chunk > 20);
+    }
+
+    // 手工构造: 直线轨迹,第一个分块里的障碍物碰撞位姿更晚,后续分块里的障碍物碰撞位姿更早
+    CD_VOID test_chunks()
+    {
+        const CD_S32 pose_count = 60;
+        std::vector<CD_TRANSFORM> poses(pose_count);
+        for (CD_S32 i = 0; i < pose_count; ++i)
+        {
+            poses[i].p = cd_vec2_make_v(0.5f * i, 0.0f);
+            poses[i].q = cd_rot_from_angle_v(0.0f);
+        }
+        // 足迹中心即位姿原点, 4 x 2
+        const CD_OBB footprint = cd_create_obb_v(Vec2_Zero, 4.0f, 2.0f, 0.0f);
+        // 胶囊体半径为半对角线 sqrt(5),y = 2 处的小障碍物通过剔除但不碰撞
+        std::vector<CD_OBB> obstacles(3 * CD_TRAJECTORY_CHUNK + 10);
+        for (size_t j = 0; j < obstacles.size(); ++j)
+        {
+            obstacles[j] = cd_create_obb_v(cd_vec2_make_v(0.1f * (CD_F32)(j % 300), 2.0f), 0.2f, 0.2f, 0.0f);
+        }
+        // 横坐标 x 处的障碍物最早与 x - 2.1 之后的第一个位姿碰撞
+        const CD_S32 late = 10;                           // 第一个分块,位姿 (20.5 - 2.1) / 0.5 上取整 = 37
+        const CD_S32 early = CD_TRAJECTORY_CHUNK + 5;     // 第二个分块,位姿 12
+        const CD_S32 early_too = 2 * CD_TRAJECTORY_CHUNK; // 第三个分块,同一个位姿,但下标更大
+        obstacles[late] = cd_create_obb_v(cd_vec2_make_v(20.5f, 0.0f), 0.2f, 0.2f, 0.0f);
+        obstacles[early] = cd_create_obb_v(cd_vec2_make_v(8.0f, 0.5f), 0.2f, 0.2f, 0.0f);
+        obstacles[early_too] = cd_create_obb_v(cd_vec2_make_v(8.0f, -0.5f), 0.2f, 0.2f, 0.0f);
+
+        CD_S32 pose = -2, obstacle = -2;
+        CD_TEST_CHECK(cd_trajectory_check_obb(poses.data(), pose_count, &footprint, obstacles.data(), (CD_S32)obstacles.size(),
+                                              &pose, &obstacle) == CD_RET_OK);
+        CD_TEST_CHECK(pose == 12 && obstacle == early);
+
+        // 只保留第一个分块里的碰撞
+        obstacles[early] = obstacles[early + 1];
+        obstacles[early_too] = obstacles[early_too + 1];
+        CD_TEST_CHECK(cd_trajectory_check_obb(poses.data(), pose_count, &footprint, obstacles.data(), (CD_S32)obstacles.size(),
+                                              &pose, &obstacle) == CD_RET_OK);
+        CD_TEST_CHECK(pose == 37 && obstacle == late);
+
+        // 无碰撞
+        obstacles[late] = obstacles[late + 1];
+        CD_TEST_CHECK(cd_trajectory_check_obb(poses.data(), pose_count, &footprint, obstacles.data(), (CD_S32)obstacles.size(),
+                                              &pose, &obstacle) == CD_RET_OK);
+        CD_TEST_CHECK(pose == CD_TRAJECTORY_NO_HIT && obstacle == CD_TRAJECTORY_NO_HIT);
+
+        // 直线轨迹的胶囊体半径就是足迹包围半径
+        CD_TRAJECTORY_CAPSULE capsule;
+        memset(&capsule, 0, sizeof(capsule));
+        CD_TEST_CHECK(cd_trajectory_capsule(poses.data(), pose_count, cd_trajectory_obb_radius_v(footprint), &capsule) == CD_RET_OK);
+        CD_TEST_CHECK_NEAR(capsule.radius, sqrtf(5.0f), 1e-6);
+        CD_TEST_CHECK(cd_trajectory_capsule(poses.data(), 0, 1.0f, &capsule) == COLLISION_DETECTION_E_ZERO_NUM);
+        CD_TEST_CHECK(cd_trajectory_check_obb(poses.data(), pose_count, &footprint, CD_NULL, 3, &pose, &obstacle) ==
+                      COLLISION_DETECTION_E_PARAM_NULL);
+    }
+} // namespace
+
+int main()
+{
+    test_chunks();
+    test_random();
+    return cd_test::report("test_trajectory");
+}
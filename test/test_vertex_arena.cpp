@@ -0,0 +1,197 @@
+/**
+ * @Author: Xia Yunkai
+ * @Date:   2026-10-20 13:42:16
+ * @Last Modified by:   Xia Yunkai
+ * @Last Modified time: 2026-10-20 13:42:16
+ */
+
+// 顶点池: 超过 MAX_POLYGON_VERTICES 的多边形视图、基于点集视图的 GJK 与逐边暴力距离一致,
+// 复制定长多边形时重新计算包围盒,以及顶点池耗尽时的错误码
+
+#include "cd_test.h"
+
+#include <string.h>
+#include <vector>
+
+namespace
+{
+    const CD_S32 kCapacity = 4096;
+    const CD_F32 kBand = 1e-3f;
+
+    CD_VEC2 rand_vec(CD_F32 range)
+    {
+        return cd_vec2_make_v(cd_test::rand_f(-range, range), cd_test::rand_f(-range, range));
+    }
+
+    struct ArenaFixture
+    {
+        std::vector<CD_VEC2> vertices;
+        std::vector<CD_VEC2> normals;
+        CD_VERTEX_ARENA arena;
+
+        explicit ArenaFixture(CD_S32 capacity) : vertices(capacity), normals(capacity)
+        {
+            cd_vertex_arena_init(vertices.data(), normals.data(), capacity, &arena);
+        }
+    };
+
+    // 圆上的随机点,凸包顶点数一般远多于 MAX_POLYGON_VERTICES
+    CD_RET make_round_polygon(CD_VERTEX_ARENA *arena, CD_VEC2 center, CD_F32 radius, CD_S32 count, CD_F32 rounding,
+                              CD_ARENA_POLYGON *result)
+    {
+        std::vector<CD_VEC2> points(count);
+        std::vector<CD_VEC2> scratch(CD_HULL_SCRATCH_SIZE(count));
+        for (CD_S32 i = 0; i < count; ++i)
+        {
+            points[i] = cd_vec2_mul_add_v(center, radius, cd_create_unit_vec2_v(cd_test::rand_f(0.0f, CD_2PI)));
+        }
+        return cd_make_arena_polygon(arena, points.data(), count, rounding, scratch.data(), result);
+    }
+
+    // 暴力: 不相交时两个凸多边形的距离是所有边对之间的最小距离
+    CD_F32 brute_force_distance(const CD_POLYGON_VIEW *a, const CD_POLYGON_VIEW *b)
+    {
+        CD_F32 best = CD_MAXABS_F;
+        for (CD_S32 i = 0; i < a->count; ++i)
+        {
+            CD_SEGMENT ea;
+            ea.point1 = a->vertices[i];
+            ea.point2 = a->vertices[i + 1 < a->count ? i + 1 : 0];
+            for (CD_S32 j = 0; j < b->count; ++j)
+            {
+                CD_SEGMENT eb;
+                eb.point1 = b->vertices[j];
+                eb.point2 = b->vertices[j + 1 < b->count ? j + 1 : 0];
+                best = CD_MIN(best, sqrtf(cd_segments_distance_v(ea, eb).distanceSquared));
+            }
+        }
+        return best;
+    }
+
+    CD_VOID test_large_polygons()
+    {
+        CD_S32 large = 0;
+        CD_S32 separated = 0;
+        CD_S32 overlapped = 0;
+        for (CD_S32 iter = 0; iter < 500; ++iter)
+        {
+            ArenaFixture f(kCapacity);
+            CD_ARENA_POLYGON pa;
+            CD_ARENA_POLYGON pb;
+            const CD_F32 ra = cd_test::rand_f(0.3f, 1.5f);
+            const CD_F32 rb = cd_test::rand_f(0.3f, 1.5f);
+            CD_TEST_CHECK(make_round_polygon(&f.arena, rand_vec(2.0f), ra, cd_test::rand_s(20, 200), 0.0f, &pa) == CD_RET_OK);
+            CD_TEST_CHECK(make_round_polygon(&f.arena, rand_vec(2.0f), rb, cd_test::rand_s(20, 200), 0.0f, &pb) == CD_RET_OK);
+            large += pa.count > MAX_POLYGON_VERTICES;
+            // 顶点池中的多边形首尾相接
+            CD_TEST_CHECK(pb.offset == pa.offset + pa.count && f.arena.count == pa.count + pb.count);
+
+            const CD_POLYGON_VIEW va = cd_arena_polygon_view_v(&f.arena, &pa);
+            const CD_POLYGON_VIEW vb = cd_arena_polygon_view_v(&f.arena, &pb);
+
+            // 点在多边形视图内: 与逐边半平面测试一致
+            for (CD_S32 k = 0; k < 20; ++k)
+            {
+                const CD_VEC2 p = rand_vec(3.5f);
+                CD_F32 separation = -CD_MAXABS_F;
+                for (CD_S32 i = 0; i < va.count; ++i)
+                {
+                    const CD_VEC2 v1 = va.vertices[i];
+                    const CD_VEC2 v2 = va.vertices[i + 1 < va.count ? i + 1 : 0];
+                    separation = CD_MAX(separation, cd_points_cross_v(v2, v1, p) / cd_vec2_dis_v(v1, v2));
+                }
+                if (CD_FABS(separation) > kBand)
+                {
+                    CD_TEST_CHECK(cd_point_in_polygon_view_v(&va, p, 0.0f) == (separation < 0.0f));
+                }
+            }
+
+            // 点集视图上的 GJK 与逐边暴力距离一致,重叠时两者都为0或 SAT 判为重叠
+            CD_DISTANCE_SPAN_INPUT input;
+            input.proxyA = cd_arena_polygon_span_v(&f.arena, &pa);
+            input.proxyB = cd_arena_polygon_span_v(&f.arena, &pb);
+            input.transformA = TRANSFORM_IDENTITY;
+            input.transformB = TRANSFORM_IDENTITY;
+            input.useRadii = CD_FALSE;
+            CD_DISTANCE_CACHE cache = emptyDistanceCache;
+            CD_DISTANCE_OUTPUT output;
+            CD_TEST_CHECK(cd_shape_distance_span(&cache, &input, CD_NULL, 0, &output) == CD_RET_OK);
+            const CD_BOOL sat = cd_polygon_views_overlap_v(&va, &vb);
+            if (output.distance > kBand)
+            {
+                CD_TEST_CHECK_NEAR(output.distance, brute_force_distance(&va, &vb), 1e-4);
+                CD_TEST_CHECK(!sat);
+                ++separated;
+            }
+            else if (output.distance <= 0.0f)
+            {
+                CD_TEST_CHECK(sat);
+                ++overlapped;
+            }
+        }
+        CD_TEST_CHECK(large > 400 && separated > 50 && overlapped > 50);
+    }
+
+    // 复制定长多边形: 缓存的包围盒、形心与法向即使过期也不影响结果
+    CD_VOID test_from_polygon()
+    {
+        ArenaFixture f(64);
+        CD_POLYGON polygon;
+        memset(&polygon, 0xCD, sizeof(polygon));
+        polygon.count = 4;
+        polygon.radius = 0.25f;
+        polygon.vertices[0] = cd_vec2_make_v(1.0f, 1.0f);
+        polygon.vertices[1] = cd_vec2_make_v(3.0f, 1.0f);
+        polygon.vertices[2] = cd_vec2_make_v(3.0f, 2.0f);
+        polygon.vertices[3] = cd_vec2_make_v(1.0f, 2.0f);
+        CD_ARENA_POLYGON result;
+        memset(&result, 0, sizeof(result));
+        CD_TEST_CHECK(cd_arena_polygon_from_polygon(&f.arena, &polygon, &result) == CD_RET_OK);
+        CD_TEST_CHECK(result.aabb.lowerBound.x == 0.75f && result.aabb.lowerBound.y == 0.75f);
+        CD_TEST_CHECK(result.aabb.upperBound.x == 3.25f && result.aabb.upperBound.y == 2.25f);
+        CD_TEST_CHECK_NEAR(result.centroid.x, 2.0, 1e-6);
+        CD_TEST_CHECK_NEAR(result.centroid.y, 1.5, 1e-6);
+        const CD_POLYGON_VIEW view = cd_arena_polygon_view_v(&f.arena, &result);
+        CD_TEST_CHECK(view.normals[0].x == 0.0f && view.normals[0].y == -1.0f);
+        CD_TEST_CHECK(cd_point_in_polygon_view_v(&view, cd_vec2_make_v(2.0f, 1.5f), 0.0f));
+
+        polygon.count = MAX_POLYGON_VERTICES + 1;
+        CD_TEST_CHECK(cd_arena_polygon_from_polygon(&f.arena, &polygon, &result) == COLLISION_DETECTION_E_ZERO_NUM);
+        polygon.count = 2;
+        CD_TEST_CHECK(cd_arena_polygon_from_polygon(&f.arena, &polygon, &result) == COLLISION_DETECTION_E_ZERO_NUM);
+        CD_TEST_CHECK(f.arena.count == 4);
+    }
+
+    // 顶点池耗尽: 剩余空间不足3个或放不下凸包时返回 E_MEM_FULL,重置后可以继续分配
+    CD_VOID test_exhausted()
+    {
+        ArenaFixture f(10);
+        const CD_VEC2 square[4] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+        CD_VEC2 scratch[CD_HULL_SCRATCH_SIZE(4)];
+        CD_ARENA_POLYGON result;
+        memset(&result, 0, sizeof(result));
+        CD_TEST_CHECK(cd_make_arena_polygon(&f.arena, square, 4, 0.0f, scratch, &result) == CD_RET_OK);
+        CD_TEST_CHECK(cd_make_arena_polygon(&f.arena, square, 4, 0.0f, scratch, &result) == CD_RET_OK);
+        CD_TEST_CHECK(f.arena.count == 8);
+        CD_TEST_CHECK(cd_make_arena_polygon(&f.arena, square, 4, 0.0f, scratch, &result) == COLLISION_DETECTION_E_MEM_FULL);
+        CD_TEST_CHECK(f.arena.count == 8);
+
+        ArenaFixture g(7);
+        CD_TEST_CHECK(cd_make_arena_polygon(&g.arena, square, 4, 0.0f, scratch, &result) == CD_RET_OK);
+        // 剩余3个,放不下四边形
+        CD_TEST_CHECK(cd_make_arena_polygon(&g.arena, square, 4, 0.0f, scratch, &result) == COLLISION_DETECTION_E_MEM_FULL);
+        CD_TEST_CHECK(g.arena.count == 4);
+
+        cd_vertex_arena_reset_v(&f.arena);
+        CD_TEST_CHECK(cd_make_arena_polygon(&f.arena, square, 4, 0.0f, scratch, &result) == CD_RET_OK);
+        CD_TEST_CHECK(result.offset == 0);
+    }
+} // namespace
+
+int main()
+{
+    test_large_polygons();
+    test_from_polygon();
+    test_exhausted();
+    return cd_test::report("test_vertex_arena");
+}